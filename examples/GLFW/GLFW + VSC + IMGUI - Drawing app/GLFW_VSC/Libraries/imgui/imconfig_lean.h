@@ -0,0 +1,19 @@
+//-----------------------------------------------------------------------------
+// DEAR IMGUI COMPILE-TIME OPTIONS: "lean" profile for production tools
+// Use with '#define IMGUI_USER_CONFIG "imconfig_lean.h"' (e.g. -DIMGUI_USER_CONFIG=\"imconfig_lean.h\") for every file using Dear ImGui.
+// Keep using the default imconfig.h during development: the demo and the debug tools are very useful there.
+//-----------------------------------------------------------------------------
+// - Removes ShowDemoWindow() & co, ShowMetricsWindow()/ShowDebugLogWindow()/ShowIDStackToolWindow() and the obsolete API.
+//   ImGui::ShowDemoWindow() etc. still exist as empty functions, so code calling them builds unchanged.
+// - Gamepad navigation has no compile-time switch: it stays off unless io.ConfigFlags has ImGuiConfigFlags_NavEnableGamepad.
+// - Math: the default ImSqrt/ImFabs/... (libm, SSE ImRsqrt) are kept. They are already compiler builtins, what makes them
+//   slower is errno handling: build the library with -fno-math-errno (GCC/Clang, the benchmark CMake does it for profiles).
+// - Allocators are left as is: a frame in steady state doesn't allocate (measured on the demo), only startup does.
+// See imconfig.h for the meaning of each option and imconfig_lean_idx32.h for the 32-bit indices variant.
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#define IMGUI_DISABLE_OBSOLETE_FUNCTIONS
+#define IMGUI_DISABLE_DEMO_WINDOWS
+#define IMGUI_DISABLE_DEBUG_TOOLS
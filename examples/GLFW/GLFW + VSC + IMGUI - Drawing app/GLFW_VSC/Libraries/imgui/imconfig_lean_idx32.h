@@ -0,0 +1,14 @@
+//-----------------------------------------------------------------------------
+// DEAR IMGUI COMPILE-TIME OPTIONS: "lean" profile + 32-bit vertex indices
+// Use with '#define IMGUI_USER_CONFIG "imconfig_lean_idx32.h"' for every file using Dear ImGui.
+//-----------------------------------------------------------------------------
+// For tools drawing very large meshes through a single ImDrawList (e.g. thousands of strokes, plots with 100k+ points)
+// with a renderer backend that doesn't handle ImDrawCmd::VtxOffset. imgui_impl_opengl3 does, so prefer imconfig_lean.h
+// with it: 16-bit indices halve the index buffer size uploaded every frame.
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#include "imconfig_lean.h"
+
+#define ImDrawIdx unsigned int
@@ -4379,6 +4379,7 @@ void ImGui::Shutdown()
     g.ShrinkWidthBuffer.clear();
 
     g.ClipperTempData.clear_destruct();
+    g.ColorPickerWheelCache.clear_destruct();
 
     g.Tables.Clear();
     g.TablesTempData.clear_destruct();
@@ -4394,6 +4395,8 @@ void ImGui::Shutdown()
     g.InputTextDeactivatedState.ClearFreeMemory();
 
     g.SettingsWindows.clear();
+    g.SettingsWindowsIndex.Clear();
+    g.SettingsTablesIndex.Clear();
     g.SettingsHandlers.clear();
 
     if (g.LogFile)
@@ -15371,16 +15374,25 @@ ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
     IM_PLACEMENT_NEW(settings) ImGuiWindowSettings();
     settings->ID = ImHashStr(name, name_len);
     memcpy(settings->GetName(), name, name_len + 1);   // Store with zero terminator
+    g.SettingsWindowsIndex.SetInt(settings->ID, g.SettingsWindows.offset_from_ptr(settings));
 
     return settings;
 }
 
 // We don't provide a FindWindowSettingsByName() because Docking system doesn't always hold on names.
 // This is called once per window .ini entry + once per newly instantiated window.
+// The index always points to the most recently created entry for an ID, which is the only one not marked WantDelete
+// unless a deleted entry got revived by its window. Only in that rare case do we fall back to a linear search.
 ImGuiWindowSettings* ImGui::FindWindowSettingsByID(ImGuiID id)
 {
     ImGuiContext& g = *GImGui;
-    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
+    const int offset = g.SettingsWindowsIndex.GetInt(id, -1);
+    if (offset == -1)
+        return NULL;
+    ImGuiWindowSettings* settings = g.SettingsWindows.ptr_from_offset(offset);
+    if (settings->ID == id && !settings->WantDelete)
+        return settings;
+    for (settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
         if (settings->ID == id && !settings->WantDelete)
             return settings;
     return NULL;
@@ -15415,10 +15427,12 @@ static void WindowSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandl
     for (ImGuiWindow* window : g.Windows)
         window->SettingsOffset = -1;
     g.SettingsWindows.clear();
+    g.SettingsWindowsIndex.Clear();
 }
 
-static void* WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
+static void* WindowSettingsHandler_ReadOpen(ImGuiContext* ctx, ImGuiSettingsHandler*, const char* name)
 {
+    ImGuiContext& g = *ctx;
     ImGuiID id = ImHashStr(name);
     ImGuiWindowSettings* settings = ImGui::FindWindowSettingsByID(id);
     if (settings)
@@ -15427,6 +15441,7 @@ static void* WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*
         settings = ImGui::CreateNewWindowSettings(name);
     settings->ID = id;
     settings->WantApply = true;
+    g.SettingsWindowsIndex.SetInt(id, g.SettingsWindows.offset_from_ptr(settings));
     return (void*)settings;
 }
 
@@ -29,6 +29,9 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: Misc: GLFWwindow* -> ImGuiContext* map used by every callback is now an open-addressing hash table (O(1) lookups with many windows/contexts).
+//  2026-10-18: Inputs: Only call glfwSetCursor()/glfwSetInputMode() when the requested mouse cursor changes. Only poll gamepad state while a joystick is connected, as reported by glfwSetJoystickCallback() (GLFW 3.2+, requires installed callbacks).
+//  2026-10-18: Inputs: The joystick callback is global: it is installed by the first context installing callbacks and restored by the last one (reference counted), chaining to the user's previous callback. Replacing it in between stops the skipped polling from seeing connections: chain to ImGui_ImplGlfw_JoystickCallback() instead.
 //  2025-09-18: Call platform_io.ClearPlatformHandlers() on shutdown.
 //  2025-09-15: Content Scales are always reported as 1.0 on Wayland. FramebufferScale are always reported as 1.0 on X11. (#8920, #8921)
 //  2025-07-08: Made ImGui_ImplGlfw_GetContentScaleForWindow(), ImGui_ImplGlfw_GetContentScaleForMonitor() helpers return 1.0f on Emscripten and Android platforms, matching macOS logic. (#8742, #8733)
@@ -156,16 +159,81 @@
 #define GLFW_HAS_GETKEYNAME             (GLFW_VERSION_COMBINED >= 3200) // 3.2+ glfwGetKeyName()
 #define GLFW_HAS_GETERROR               (GLFW_VERSION_COMBINED >= 3300) // 3.3+ glfwGetError()
 #define GLFW_HAS_GETPLATFORM            (GLFW_VERSION_COMBINED >= 3400) // 3.4+ glfwGetPlatform()
+#define GLFW_HAS_JOYSTICK_CALLBACK      (GLFW_VERSION_COMBINED >= 3200) // 3.2+ glfwSetJoystickCallback()
 
 // Map GLFWWindow* to ImGuiContext*.
 // - Would be simpler if we could use glfwSetWindowUserPointer()/glfwGetWindowUserPointer(), but this is a single and shared resource.
 // - Would be simpler if we could use e.g. std::map<> as well. But we don't.
-// - This is not particularly optimized as we expect size to be small and queries to be rare.
+// - Every input callback performs a lookup, so this is a small open-addressing hash table (linear probing, power-of-two size, kept at most half full).
+//   Empty slots have Window == nullptr. Removal uses backward-shift deletion so we never need tombstones.
 struct ImGui_ImplGlfw_WindowToContext { GLFWwindow* Window; ImGuiContext* Context; };
 static ImVector<ImGui_ImplGlfw_WindowToContext> g_ContextMap;
-static void ImGui_ImplGlfw_ContextMap_Add(GLFWwindow* window, ImGuiContext* ctx) { g_ContextMap.push_back(ImGui_ImplGlfw_WindowToContext{ window, ctx }); }
-static void ImGui_ImplGlfw_ContextMap_Remove(GLFWwindow* window)                 { for (ImGui_ImplGlfw_WindowToContext& entry : g_ContextMap) if (entry.Window == window) { g_ContextMap.erase_unsorted(&entry); return; } }
-static ImGuiContext* ImGui_ImplGlfw_ContextMap_Get(GLFWwindow* window)           { for (ImGui_ImplGlfw_WindowToContext& entry : g_ContextMap) if (entry.Window == window) return entry.Context; return nullptr; }
+static int g_ContextMapCount = 0;
+#if GLFW_HAS_JOYSTICK_CALLBACK
+// The joystick callback is global to GLFW: shared by every context with installed callbacks.
+static int g_JoystickCallbackUsers = 0;                     // Contexts with installed callbacks, ours is installed while > 0
+static GLFWjoystickfun g_PrevUserCallbackJoystick = nullptr; // What the first of them replaced
+#endif
+static inline int ImGui_ImplGlfw_ContextMap_Home(GLFWwindow* window)
+{
+    ImU64 h = (ImU64)(size_t)window;
+    h ^= h >> 33; h *= 0xFF51AFD7ED558CCDull; h ^= h >> 33;
+    return (int)(h & (ImU64)(g_ContextMap.Size - 1));
+}
+static int ImGui_ImplGlfw_ContextMap_Find(GLFWwindow* window)
+{
+    if (g_ContextMap.Size == 0)
+        return -1;
+    for (int n = ImGui_ImplGlfw_ContextMap_Home(window); g_ContextMap[n].Window != nullptr; n = (n + 1) & (g_ContextMap.Size - 1))
+        if (g_ContextMap[n].Window == window)
+            return n;
+    return -1;
+}
+static void ImGui_ImplGlfw_ContextMap_Add(GLFWwindow* window, ImGuiContext* ctx)
+{
+    IM_ASSERT(window != nullptr && ImGui_ImplGlfw_ContextMap_Find(window) == -1);
+    if ((g_ContextMapCount + 1) * 2 > g_ContextMap.Size)
+    {
+        ImVector<ImGui_ImplGlfw_WindowToContext> old_map;
+        old_map.swap(g_ContextMap);
+        g_ContextMap.resize(old_map.Size ? old_map.Size * 2 : 8, ImGui_ImplGlfw_WindowToContext{ nullptr, nullptr });
+        g_ContextMapCount = 0;
+        for (ImGui_ImplGlfw_WindowToContext& entry : old_map)
+            if (entry.Window != nullptr)
+                ImGui_ImplGlfw_ContextMap_Add(entry.Window, entry.Context);
+    }
+    int n = ImGui_ImplGlfw_ContextMap_Home(window);
+    while (g_ContextMap[n].Window != nullptr)
+        n = (n + 1) & (g_ContextMap.Size - 1);
+    g_ContextMap[n] = ImGui_ImplGlfw_WindowToContext{ window, ctx };
+    g_ContextMapCount++;
+}
+static void ImGui_ImplGlfw_ContextMap_Remove(GLFWwindow* window)
+{
+    int hole = ImGui_ImplGlfw_ContextMap_Find(window);
+    if (hole == -1)
+        return;
+    const int mask = g_ContextMap.Size - 1;
+    for (int n = (hole + 1) & mask; g_ContextMap[n].Window != nullptr; n = (n + 1) & mask)
+    {
+        // Move entry back into the hole unless its home slot lies cyclically within (hole, n].
+        const int home = ImGui_ImplGlfw_ContextMap_Home(g_ContextMap[n].Window);
+        const bool home_in_range = (hole <= n) ? (home > hole && home <= n) : (home > hole || home <= n);
+        if (!home_in_range)
+        {
+            g_ContextMap[hole] = g_ContextMap[n];
+            hole = n;
+        }
+    }
+    g_ContextMap[hole] = ImGui_ImplGlfw_WindowToContext{ nullptr, nullptr };
+    if (--g_ContextMapCount == 0)
+        g_ContextMap.clear();
+}
+static ImGuiContext* ImGui_ImplGlfw_ContextMap_Get(GLFWwindow* window)
+{
+    int n = ImGui_ImplGlfw_ContextMap_Find(window);
+    return (n != -1) ? g_ContextMap[n].Context : nullptr;
+}
 
 enum GlfwClientApi
 {
@@ -183,10 +251,14 @@ struct ImGui_ImplGlfw_Data
     double                  Time;
     GLFWwindow*             MouseWindow;
     GLFWcursor*             MouseCursors[ImGuiMouseCursor_COUNT];
+    GLFWcursor*             LastMouseCursor;        // Last cursor passed to glfwSetCursor(), nullptr when hidden
+    int                     LastMouseCursorMode;    // Last mode passed to glfwSetInputMode(GLFW_CURSOR), 0 when unknown
     ImVec2                  LastValidMousePos;
     bool                    IsWayland;
     bool                    InstalledCallbacks;
     bool                    CallbacksChainForAllWindows;
+    bool                    WantUpdateGamepadPresence;
+    bool                    GamepadPresent;
     char                    BackendPlatformName[32];
 #ifdef EMSCRIPTEN_USE_EMBEDDED_GLFW3
     const char*             CanvasSelector;
@@ -530,6 +602,21 @@ void ImGui_ImplGlfw_MonitorCallback(GLFWmonitor*, int)
     // Unused in 'master' branch but 'docking' branch will use this, so we declare it ahead of it so if you have to install callbacks you can install this one too.
 }
 
+// Joystick connection state is global to GLFW: flag every context so the next ImGui_ImplGlfw_UpdateGamepads() re-queries presence.
+void ImGui_ImplGlfw_JoystickCallback(int jid, int event)
+{
+    for (ImGui_ImplGlfw_WindowToContext& entry : g_ContextMap)
+        if (ImGui_ImplGlfw_Data* bd = entry.Window ? (ImGui_ImplGlfw_Data*)ImGui::GetIO(entry.Context).BackendPlatformUserData : nullptr)
+            bd->WantUpdateGamepadPresence = true;
+#if GLFW_HAS_JOYSTICK_CALLBACK
+    if (g_PrevUserCallbackJoystick != nullptr)
+        g_PrevUserCallbackJoystick(jid, event);
+#else
+    IM_UNUSED(jid);
+    IM_UNUSED(event);
+#endif
+}
+
 #ifdef EMSCRIPTEN_USE_EMBEDDED_GLFW3
 static EM_BOOL ImGui_ImplEmscripten_WheelCallback(int, const EmscriptenWheelEvent* ev, void* user_data)
 {
@@ -595,6 +682,11 @@ void ImGui_ImplGlfw_InstallCallbacks(GLFWwindow* window)
     bd->PrevUserCallbackKey = glfwSetKeyCallback(window, ImGui_ImplGlfw_KeyCallback);
     bd->PrevUserCallbackChar = glfwSetCharCallback(window, ImGui_ImplGlfw_CharCallback);
     bd->PrevUserCallbackMonitor = glfwSetMonitorCallback(ImGui_ImplGlfw_MonitorCallback);
+#if GLFW_HAS_JOYSTICK_CALLBACK && !defined(EMSCRIPTEN_USE_EMBEDDED_GLFW3)
+    if (g_JoystickCallbackUsers++ == 0) // Already installed by another context otherwise
+        g_PrevUserCallbackJoystick = glfwSetJoystickCallback(ImGui_ImplGlfw_JoystickCallback);
+#endif
+    bd->WantUpdateGamepadPresence = true;
     bd->InstalledCallbacks = true;
 }
 
@@ -612,6 +704,17 @@ void ImGui_ImplGlfw_RestoreCallbacks(GLFWwindow* window)
     glfwSetKeyCallback(window, bd->PrevUserCallbackKey);
     glfwSetCharCallback(window, bd->PrevUserCallbackChar);
     glfwSetMonitorCallback(bd->PrevUserCallbackMonitor);
+#if GLFW_HAS_JOYSTICK_CALLBACK && !defined(EMSCRIPTEN_USE_EMBEDDED_GLFW3)
+    // The joystick callback is shared by all contexts: only restore it when we are the last one using it.
+    // If the user replaced ours in the meantime, keep theirs.
+    if (--g_JoystickCallbackUsers == 0)
+    {
+        GLFWjoystickfun current = glfwSetJoystickCallback(g_PrevUserCallbackJoystick);
+        if (current != ImGui_ImplGlfw_JoystickCallback)
+            glfwSetJoystickCallback(current);
+        g_PrevUserCallbackJoystick = nullptr;
+    }
+#endif
     bd->InstalledCallbacks = false;
     bd->PrevUserCallbackWindowFocus = nullptr;
     bd->PrevUserCallbackCursorEnter = nullptr;
@@ -837,7 +940,15 @@ static void ImGui_ImplGlfw_UpdateMouseCursor()
     // (those braces are here to reduce diff with multi-viewports support in 'docking' branch)
     {
         GLFWwindow* window = bd->Window;
-        if (imgui_cursor == ImGuiMouseCursor_None || io.MouseDrawCursor)
+        const bool hide_cursor = (imgui_cursor == ImGuiMouseCursor_None || io.MouseDrawCursor);
+        GLFWcursor* cursor = hide_cursor ? nullptr : bd->MouseCursors[imgui_cursor] ? bd->MouseCursors[imgui_cursor] : bd->MouseCursors[ImGuiMouseCursor_Arrow];
+        const int cursor_mode = hide_cursor ? GLFW_CURSOR_HIDDEN : GLFW_CURSOR_NORMAL;
+
+        // Only talk to GLFW when something changed: glfwSetCursor() is a server round-trip on X11 (XDefineCursor + XFlush).
+        // glfwGetInputMode() is a cheap read of GLFW state which lets us notice if the application changed the mode behind our back.
+        if (cursor == bd->LastMouseCursor && cursor_mode == bd->LastMouseCursorMode && glfwGetInputMode(window, GLFW_CURSOR) == cursor_mode)
+            return;
+        if (hide_cursor)
         {
             // Hide OS mouse cursor if imgui is drawing it or if it wants no cursor
             glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_HIDDEN);
@@ -846,9 +957,11 @@ static void ImGui_ImplGlfw_UpdateMouseCursor()
         {
             // Show OS mouse cursor
             // FIXME-PLATFORM: Unfocused windows seems to fail changing the mouse cursor with GLFW 3.2, but 3.3 works here.
-            glfwSetCursor(window, bd->MouseCursors[imgui_cursor] ? bd->MouseCursors[imgui_cursor] : bd->MouseCursors[ImGuiMouseCursor_Arrow]);
+            glfwSetCursor(window, cursor);
             glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
         }
+        bd->LastMouseCursor = cursor;
+        bd->LastMouseCursorMode = cursor_mode;
     }
 }
 
@@ -861,6 +974,22 @@ static void ImGui_ImplGlfw_UpdateGamepads()
         return;
 
     io.BackendFlags &= ~ImGuiBackendFlags_HasGamepad;
+#if GLFW_HAS_JOYSTICK_CALLBACK && !defined(EMSCRIPTEN_USE_EMBEDDED_GLFW3)
+    // When our callbacks are installed, presence only changes on joystick connection events, so we skip polling (which on Linux
+    // involves reading the inotify/evdev file descriptors) while nothing is plugged in.
+    // Without installed callbacks (or with a joystick callback of your own that doesn't chain to ours) poll every frame.
+    ImGui_ImplGlfw_Data* bd = ImGui_ImplGlfw_GetBackendData();
+    if (bd->InstalledCallbacks)
+    {
+        if (bd->WantUpdateGamepadPresence)
+        {
+            bd->GamepadPresent = glfwJoystickPresent(GLFW_JOYSTICK_1) != 0;
+            bd->WantUpdateGamepadPresence = false;
+        }
+        if (!bd->GamepadPresent)
+            return;
+    }
+#endif
 #if GLFW_HAS_GAMEPAD_API && !defined(EMSCRIPTEN_USE_EMBEDDED_GLFW3)
     GLFWgamepadstate gamepad;
     if (!glfwGetGamepadState(GLFW_JOYSTICK_1, &gamepad))
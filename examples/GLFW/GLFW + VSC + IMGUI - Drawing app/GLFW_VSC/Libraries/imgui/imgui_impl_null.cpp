@@ -0,0 +1,280 @@
+// dear imgui: Renderer Backend which doesn't render anything (null/recording renderer)
+// This needs to be used along with a Platform Backend, or with io.DisplaySize/io.DeltaTime filled manually (headless).
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Any ImTextureID is accepted and passed through to the stats/dump.
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+
+// See imgui_impl_null.h for the purpose of this backend and the layout of recorded frames.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+// CHANGELOG
+//  2026-10-18: Initial version: stats recording, texture requests handling, optional binary frame dump.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_null.h"
+#include <stdio.h>
+#include <stdint.h>     // intptr_t
+
+// Null renderer data
+struct ImGui_ImplNull_Data
+{
+    ImGui_ImplNull_Stats    Stats;
+    ImU32                   NextTexID;
+    FILE*                   DumpFile;
+    ImVector<char>          DumpTexEvents;      // Texture events since last frame, written along with the next frame
+    ImU32                   DumpTexEventsCount;
+    ImVector<char>          DumpFrame;          // Frame being serialized, written with a single fwrite()
+
+    ImGui_ImplNull_Data()   { NextTexID = 1; DumpFile = nullptr; DumpTexEventsCount = 0; }
+};
+
+// Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
+static ImGui_ImplNull_Data* ImGui_ImplNull_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplNull_Data*)ImGui::GetIO().BackendRendererUserData : nullptr;
+}
+
+static void ImGui_ImplNull_Append(ImVector<char>& buf, const void* data, size_t size)
+{
+    const int offset = buf.Size;
+    buf.resize(offset + (int)size);
+    memcpy(buf.Data + offset, data, size);
+}
+
+// Functions
+bool    ImGui_ImplNull_Init(const char* dump_filename)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IMGUI_CHECKVERSION();
+    IM_ASSERT(io.BackendRendererUserData == nullptr && "Already initialized a renderer backend!");
+
+    FILE* dump_file = nullptr;
+    if (dump_filename != nullptr)
+    {
+        dump_file = fopen(dump_filename, "wb");
+        if (dump_file == nullptr)
+            return false;
+        ImGui_ImplNull_DumpHeader header = { { 'I', 'M', 'D', 'D' }, IMGUI_IMPL_NULL_DUMP_VERSION, (ImU32)sizeof(ImDrawVert), (ImU32)sizeof(ImDrawIdx) };
+        fwrite(&header, sizeof(header), 1, dump_file);
+    }
+
+    // Setup backend capabilities flags
+    ImGui_ImplNull_Data* bd = IM_NEW(ImGui_ImplNull_Data)();
+    bd->DumpFile = dump_file;
+    io.BackendRendererUserData = (void*)bd;
+    io.BackendRendererName = "imgui_impl_null";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;   // We can honor ImGuiPlatformIO::Textures[] requests during render.
+
+    return true;
+}
+
+void    ImGui_ImplNull_Shutdown()
+{
+    ImGui_ImplNull_Data* bd = ImGui_ImplNull_GetBackendData();
+    IM_ASSERT(bd != nullptr && "No renderer backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+    ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+
+    // Destroy all textures
+    for (ImTextureData* tex : platform_io.Textures)
+        if (tex->RefCount == 1 && tex->TexID != ImTextureID_Invalid)
+        {
+            tex->SetTexID(ImTextureID_Invalid);
+            tex->SetStatus(ImTextureStatus_Destroyed);
+        }
+
+    if (bd->DumpFile)
+        fclose(bd->DumpFile);
+
+    io.BackendRendererName = nullptr;
+    io.BackendRendererUserData = nullptr;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures);
+    platform_io.ClearRendererHandlers();
+    IM_DELETE(bd);
+}
+
+void    ImGui_ImplNull_NewFrame()
+{
+    ImGui_ImplNull_Data* bd = ImGui_ImplNull_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplNull_Init()?");
+    IM_UNUSED(bd);
+}
+
+static void ImGui_ImplNull_RecordTexEvent(ImGui_ImplNull_Data* bd, ImGui_ImplNull_DumpTexEventType type, ImTextureData* tex, const ImTextureRect* rect)
+{
+    if (bd->DumpFile == nullptr)
+        return;
+    ImGui_ImplNull_DumpTexEvent ev;
+    ev.Type = (ImU32)type;
+    ev.TexID = (ImU32)tex->TexID;
+    ev.Format = (int)tex->Format;
+    ev.Width = tex->Width;
+    ev.Height = tex->Height;
+    ev.X = rect ? rect->x : 0;
+    ev.Y = rect ? rect->y : 0;
+    ev.W = rect ? rect->w : (type == ImGui_ImplNull_DumpTexEventType_Create ? tex->Width : 0);
+    ev.H = rect ? rect->h : (type == ImGui_ImplNull_DumpTexEventType_Create ? tex->Height : 0);
+    ImGui_ImplNull_Append(bd->DumpTexEvents, &ev, sizeof(ev));
+    const int row_size = ev.W * tex->BytesPerPixel;
+    for (int y = 0; y < ev.H; y++)
+        ImGui_ImplNull_Append(bd->DumpTexEvents, tex->GetPixelsAt(ev.X, ev.Y + y), (size_t)row_size);
+    bd->DumpTexEventsCount++;
+}
+
+void ImGui_ImplNull_UpdateTexture(ImTextureData* tex)
+{
+    ImGui_ImplNull_Data* bd = ImGui_ImplNull_GetBackendData();
+    ImGui_ImplNull_Stats& stats = bd->Stats;
+    if (tex->Status == ImTextureStatus_WantCreate)
+    {
+        // "Upload" whole texture
+        IM_ASSERT(tex->TexID == ImTextureID_Invalid && tex->BackendUserData == nullptr);
+        tex->SetTexID((ImTextureID)(intptr_t)bd->NextTexID++);
+        tex->SetStatus(ImTextureStatus_OK);
+        stats.TexturesCreated++;
+        stats.TextureBytesUploaded += (ImU64)tex->GetSizeInBytes();
+        ImGui_ImplNull_RecordTexEvent(bd, ImGui_ImplNull_DumpTexEventType_Create, tex, nullptr);
+    }
+    else if (tex->Status == ImTextureStatus_WantUpdates)
+    {
+        // "Upload" updated rectangles
+        for (ImTextureRect& r : tex->Updates)
+        {
+            stats.TextureUpdates++;
+            stats.TextureBytesUploaded += (ImU64)r.w * r.h * tex->BytesPerPixel;
+            ImGui_ImplNull_RecordTexEvent(bd, ImGui_ImplNull_DumpTexEventType_Update, tex, &r);
+        }
+        tex->SetStatus(ImTextureStatus_OK);
+    }
+    else if (tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames > 0)
+    {
+        ImGui_ImplNull_RecordTexEvent(bd, ImGui_ImplNull_DumpTexEventType_Destroy, tex, nullptr);
+        stats.TexturesDestroyed++;
+        tex->SetTexID(ImTextureID_Invalid);
+        tex->SetStatus(ImTextureStatus_Destroyed);
+    }
+}
+
+void    ImGui_ImplNull_RenderDrawData(ImDrawData* draw_data)
+{
+    ImGui_ImplNull_Data* bd = ImGui_ImplNull_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplNull_Init()?");
+
+    // Catch up with texture updates. Most of the times, the list will have 1 element with an OK status, aka nothing to do.
+    // (This almost always points to ImGui::GetPlatformIO().Textures[] but is part of ImDrawData to allow overriding or disabling texture updates).
+    if (draw_data->Textures != nullptr)
+        for (ImTextureData* tex : *draw_data->Textures)
+            if (tex->Status != ImTextureStatus_OK)
+                ImGui_ImplNull_UpdateTexture(tex);
+
+    ImGui_ImplNull_Stats& stats = bd->Stats;
+    stats.Frames++;
+    stats.LastVtxCount = draw_data->TotalVtxCount;
+    stats.LastIdxCount = draw_data->TotalIdxCount;
+    stats.LastCmdListCount = draw_data->CmdListsCount;
+    stats.LastCmdCount = 0;
+
+    ImVector<char>& out = bd->DumpFrame;
+    const bool dump = (bd->DumpFile != nullptr);
+    if (dump)
+    {
+        ImGui_ImplNull_DumpFrame frame;
+        frame.Magic = IMGUI_IMPL_NULL_DUMP_FRAME_MAGIC;
+        frame.TexEventsCount = bd->DumpTexEventsCount;
+        frame.CmdListsCount = (ImU32)draw_data->CmdListsCount;
+        frame.DisplayPos[0] = draw_data->DisplayPos.x;
+        frame.DisplayPos[1] = draw_data->DisplayPos.y;
+        frame.DisplaySize[0] = draw_data->DisplaySize.x;
+        frame.DisplaySize[1] = draw_data->DisplaySize.y;
+        frame.FramebufferScale[0] = draw_data->FramebufferScale.x;
+        frame.FramebufferScale[1] = draw_data->FramebufferScale.y;
+        out.resize(0);
+        ImGui_ImplNull_Append(out, &frame, sizeof(frame));
+        ImGui_ImplNull_Append(out, bd->DumpTexEvents.Data, (size_t)bd->DumpTexEvents.Size);
+        bd->DumpTexEvents.resize(0);
+        bd->DumpTexEventsCount = 0;
+    }
+
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        if (dump)
+        {
+            ImGui_ImplNull_DumpCmdList cmd_list = { (ImU32)draw_list->VtxBuffer.Size, (ImU32)draw_list->IdxBuffer.Size, (ImU32)draw_list->CmdBuffer.Size };
+            ImGui_ImplNull_Append(out, &cmd_list, sizeof(cmd_list));
+            ImGui_ImplNull_Append(out, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes());
+            ImGui_ImplNull_Append(out, draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes());
+        }
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            ImU32 flags = ImGui_ImplNull_DumpCmdFlags_None;
+            if (cmd.UserCallback != nullptr)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                if (cmd.UserCallback == ImDrawCallback_ResetRenderState)
+                    flags |= ImGui_ImplNull_DumpCmdFlags_ResetRenderState;
+                else
+                    cmd.UserCallback(draw_list, &cmd);
+                flags |= ImGui_ImplNull_DumpCmdFlags_UserCallback;
+            }
+            else
+            {
+                stats.LastCmdCount++;
+            }
+            if (dump)
+            {
+                ImGui_ImplNull_DumpCmd out_cmd;
+                out_cmd.ClipRect[0] = cmd.ClipRect.x;
+                out_cmd.ClipRect[1] = cmd.ClipRect.y;
+                out_cmd.ClipRect[2] = cmd.ClipRect.z;
+                out_cmd.ClipRect[3] = cmd.ClipRect.w;
+                out_cmd.TexID = (cmd.UserCallback != nullptr) ? 0 : (ImU64)cmd.GetTexID();
+                out_cmd.VtxOffset = cmd.VtxOffset;
+                out_cmd.IdxOffset = cmd.IdxOffset;
+                out_cmd.ElemCount = (cmd.UserCallback != nullptr) ? 0 : cmd.ElemCount;
+                out_cmd.Flags = flags;
+                ImGui_ImplNull_Append(out, &out_cmd, sizeof(out_cmd));
+            }
+        }
+    }
+    stats.TotalVtxCount += (ImU64)stats.LastVtxCount;
+    stats.TotalIdxCount += (ImU64)stats.LastIdxCount;
+    stats.TotalCmdCount += (ImU64)stats.LastCmdCount;
+
+    if (dump)
+    {
+        fwrite(out.Data, 1, (size_t)out.Size, bd->DumpFile);
+        stats.DumpBytesWritten += (ImU64)out.Size;
+    }
+}
+
+const ImGui_ImplNull_Stats* ImGui_ImplNull_GetStats()
+{
+    ImGui_ImplNull_Data* bd = ImGui_ImplNull_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplNull_Init()?");
+    return &bd->Stats;
+}
+
+void    ImGui_ImplNull_ResetStats()
+{
+    ImGui_ImplNull_Data* bd = ImGui_ImplNull_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplNull_Init()?");
+    const ImU64 dump_bytes = bd->Stats.DumpBytesWritten;
+    bd->Stats = ImGui_ImplNull_Stats();
+    bd->Stats.DumpBytesWritten = dump_bytes;
+}
+
+//-----------------------------------------------------------------------------
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,128 @@
+// dear imgui: Renderer Backend which doesn't render anything (null/recording renderer)
+// This needs to be used along with a Platform Backend, or with io.DisplaySize/io.DeltaTime filled manually (headless).
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Any ImTextureID is accepted and passed through to the stats/dump.
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+
+// What it's for:
+// - Measuring the CPU cost of a UI (widgets, layout, tessellation) without any graphics API in the way, e.g. in CI.
+//   ImGui_ImplNull_RenderDrawData() consumes ImDrawData and texture requests and only records counters (see ImGui_ImplNull_Stats).
+// - Recording real frames: pass a filename to ImGui_ImplNull_Init() to append every rendered frame to a compact binary file,
+//   which can be replayed offline into another renderer backend (e.g. ImGui_ImplOpenGL3_RenderDrawData) to benchmark it alone.
+
+// Dump file layout (native endianness and struct layouts, so replay on the same kind of machine/build settings):
+//   ImGui_ImplNull_DumpHeader
+//   for each frame:
+//     ImGui_ImplNull_DumpFrame
+//     TexEventsCount x { ImGui_ImplNull_DumpTexEvent, followed by W*H*BytesPerPixel bytes of tightly packed pixels for Create/Update }
+//     CmdListsCount  x { ImGui_ImplNull_DumpCmdList, ImDrawVert[VtxCount], ImDrawIdx[IdxCount], ImGui_ImplNull_DumpCmd[CmdCount] }
+// Textures managed by Dear ImGui are given TexID 1, 2, 3... by this backend, which is what commands refer to.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+// Follow "Getting Started" link and check examples/ folder to learn about using backends!
+IMGUI_IMPL_API bool     ImGui_ImplNull_Init(const char* dump_filename = nullptr);   // dump_filename: optional file to record frames into (truncated)
+IMGUI_IMPL_API void     ImGui_ImplNull_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplNull_NewFrame();
+IMGUI_IMPL_API void     ImGui_ImplNull_RenderDrawData(ImDrawData* draw_data);
+
+// (Advanced) Use e.g. if you need to precisely control the timing of texture updates (e.g. for staged rendering), by setting ImDrawData::Textures = NULL to handle this manually.
+IMGUI_IMPL_API void     ImGui_ImplNull_UpdateTexture(ImTextureData* tex);
+
+// Counters accumulated since Init() or the last ImGui_ImplNull_ResetStats() call.
+struct ImGui_ImplNull_Stats
+{
+    int         Frames;                 // Number of ImGui_ImplNull_RenderDrawData() calls
+    int         LastVtxCount;           // Last frame
+    int         LastIdxCount;
+    int         LastCmdCount;           // Last frame draw commands (user callbacks excluded)
+    int         LastCmdListCount;
+    ImU64       TotalVtxCount;          // All frames
+    ImU64       TotalIdxCount;
+    ImU64       TotalCmdCount;
+    int         TexturesCreated;
+    int         TexturesDestroyed;
+    int         TextureUpdates;         // Number of updated rectangles
+    ImU64       TextureBytesUploaded;   // Pixel bytes of created textures + updated rectangles
+    ImU64       DumpBytesWritten;       // Size of recorded frames (0 when not recording)
+
+    ImGui_ImplNull_Stats()  { memset((void*)this, 0, sizeof(*this)); }
+};
+IMGUI_IMPL_API const ImGui_ImplNull_Stats* ImGui_ImplNull_GetStats();
+IMGUI_IMPL_API void     ImGui_ImplNull_ResetStats();
+
+// Dump file records
+enum ImGui_ImplNull_DumpTexEventType
+{
+    ImGui_ImplNull_DumpTexEventType_Create,     // Pixels: whole texture
+    ImGui_ImplNull_DumpTexEventType_Update,     // Pixels: rectangle X,Y,W,H
+    ImGui_ImplNull_DumpTexEventType_Destroy,    // No pixels
+};
+
+enum ImGui_ImplNull_DumpCmdFlags_
+{
+    ImGui_ImplNull_DumpCmdFlags_None                = 0,
+    ImGui_ImplNull_DumpCmdFlags_UserCallback        = 1 << 0,   // Was a user callback: can't be replayed, ElemCount is 0
+    ImGui_ImplNull_DumpCmdFlags_ResetRenderState    = 1 << 1,   // Was ImDrawCallback_ResetRenderState
+};
+
+struct ImGui_ImplNull_DumpHeader
+{
+    char        Magic[4];               // "IMDD"
+    ImU32       Version;                // 1
+    ImU32       VtxSize;                // sizeof(ImDrawVert)
+    ImU32       IdxSize;                // sizeof(ImDrawIdx)
+};
+
+struct ImGui_ImplNull_DumpFrame
+{
+    ImU32       Magic;                  // IMGUI_IMPL_NULL_DUMP_FRAME_MAGIC
+    ImU32       TexEventsCount;
+    ImU32       CmdListsCount;
+    float       DisplayPos[2];
+    float       DisplaySize[2];
+    float       FramebufferScale[2];
+};
+
+struct ImGui_ImplNull_DumpTexEvent
+{
+    ImU32       Type;                   // ImGui_ImplNull_DumpTexEventType
+    ImU32       TexID;
+    int         Format;                 // ImTextureFormat
+    int         Width, Height;          // Whole texture
+    int         X, Y, W, H;             // Pixels following this record
+};
+
+struct ImGui_ImplNull_DumpCmdList
+{
+    ImU32       VtxCount;
+    ImU32       IdxCount;
+    ImU32       CmdCount;
+};
+
+struct ImGui_ImplNull_DumpCmd
+{
+    float       ClipRect[4];
+    ImU64       TexID;
+    ImU32       VtxOffset;
+    ImU32       IdxOffset;
+    ImU32       ElemCount;
+    ImU32       Flags;                  // ImGui_ImplNull_DumpCmdFlags_
+};
+
+#define IMGUI_IMPL_NULL_DUMP_VERSION        1
+#define IMGUI_IMPL_NULL_DUMP_FRAME_MAGIC    0x454D5246  // "FRME"
+
+#endif // #ifndef IMGUI_DISABLE
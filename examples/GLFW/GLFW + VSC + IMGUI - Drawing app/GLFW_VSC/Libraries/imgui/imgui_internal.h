@@ -148,6 +148,7 @@ struct ImFontAtlasRectEntry;        // Packed rectangle lookup entry
 // ImGui
 struct ImGuiBoxSelectState;         // Box-selection state (currently used by multi-selection, could potentially be used by others)
 struct ImGuiColorMod;               // Stacked color modifier, backup of modified data so we can restore it
+struct ImGuiColorPickerWheelCache;  // Cached hue wheel vertices/indices for ColorPicker4()
 struct ImGuiContext;                // Main Dear ImGui context
 struct ImGuiContextHook;            // Hook for extensions like ImGuiTestEngine
 struct ImGuiDataTypeInfo;           // Type information associated to a ImGuiDataType enum
@@ -800,6 +801,52 @@ struct ImChunkStream
     void    swap(ImChunkStream<T>& rhs) { rhs.Buf.swap(Buf); }
 };
 
+// Helper: ImGuiIDHashMap
+// Map ImGuiID -> non-negative int. Open addressing with linear probing, power-of-two capacity kept at most half full.
+// Unlike ImGuiStorage (sorted vector) inserts are O(1) amortized, which matters when bulk loading thousands of settings.
+// Values can be overwritten but not removed individually. Stored values are offset by one so that 0 marks an empty slot.
+struct ImGuiIDHashMap
+{
+    struct Slot { ImGuiID Key; int ValuePlusOne; };
+    ImVector<Slot>  Slots;
+    int             Count = 0;
+
+    void    Clear()                                 { Slots.clear(); Count = 0; }
+    int     GetInt(ImGuiID key, int default_val) const
+    {
+        if (Slots.Size == 0)
+            return default_val;
+        const int mask = Slots.Size - 1;
+        for (int n = (int)(key & (ImGuiID)mask); Slots[n].ValuePlusOne != 0; n = (n + 1) & mask)
+            if (Slots[n].Key == key)
+                return Slots[n].ValuePlusOne - 1;
+        return default_val;
+    }
+    void    SetInt(ImGuiID key, int val)
+    {
+        IM_ASSERT(val >= 0);
+        if ((Count + 1) * 2 > Slots.Size)
+        {
+            ImVector<Slot> old_slots;
+            old_slots.swap(Slots);
+            Slots.resize(old_slots.Size ? old_slots.Size * 2 : 64);
+            memset(Slots.Data, 0, (size_t)Slots.size_in_bytes());
+            Count = 0;
+            for (const Slot& slot : old_slots)
+                if (slot.ValuePlusOne != 0)
+                    SetInt(slot.Key, slot.ValuePlusOne - 1);
+        }
+        const int mask = Slots.Size - 1;
+        int n = (int)(key & (ImGuiID)mask);
+        while (Slots[n].ValuePlusOne != 0 && Slots[n].Key != key)
+            n = (n + 1) & mask;
+        if (Slots[n].ValuePlusOne == 0)
+            Count++;
+        Slots[n].Key = key;
+        Slots[n].ValuePlusOne = val + 1;
+    }
+};
+
 // Helper: ImGuiTextIndex
 // Maintain a line index for a text buffer. This is a strong candidate to be moved into the public API.
 struct ImGuiTextIndex
@@ -1161,6 +1208,24 @@ struct IMGUI_API ImGuiComboPreviewData
     ImGuiComboPreviewData() { memset(this, 0, sizeof(*this)); }
 };
 
+// Cached hue wheel geometry for ColorPicker4(), stored relative to the wheel center.
+// The wheel only depends on its radius/thickness and on a few draw list settings, so pickers of a same size share one entry
+// and only need to re-emit the vertices (translated) + indices (rebased) instead of re-tessellating 6 arcs and shading them.
+struct IMGUI_API ImGuiColorPickerWheelCache
+{
+    float               RadiusOuter;
+    float               Thickness;
+    ImU32               StyleAlpha8;
+    ImDrawListFlags     DrawListFlags;      // Anti-aliasing flags used to build the geometry
+    float               FringeScale;
+    ImVec2              TexUvWhitePixel;    // May change as the font atlas texture gets rebuilt
+    int                 LastFrameUsed;
+    ImVector<ImDrawVert> VtxBuffer;         // Positions relative to wheel center
+    ImVector<ImDrawIdx> IdxBuffer;          // Indices relative to first vertex
+
+    ImGuiColorPickerWheelCache() { RadiusOuter = Thickness = FringeScale = 0.0f; StyleAlpha8 = 0; DrawListFlags = 0; LastFrameUsed = -1; }
+};
+
 // Stacked storage data for BeginGroup()/EndGroup()
 struct IMGUI_API ImGuiGroupData
 {
@@ -2439,6 +2504,7 @@ struct ImGuiContext
     float                   ColorEditSavedSat;                  // Backup of last Saturation associated to LastColor, so we can restore Saturation in lossy RGB<>HSV round trips
     ImU32                   ColorEditSavedColor;                // RGB value with alpha set to 0.
     ImVec4                  ColorPickerRef;                     // Initial/reference color at the time of opening the color picker.
+    ImVector<ImGuiColorPickerWheelCache> ColorPickerWheelCache; // Hue wheel geometry, one entry per recently used size (see ColorPicker4())
     ImGuiComboPreviewData   ComboPreviewData;
     ImRect                  WindowResizeBorderExpectedRect;     // Expected border rect, switch to relative edit if moving
     bool                    WindowResizeRelativeMode;
@@ -2473,6 +2539,8 @@ struct ImGuiContext
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
     ImChunkStream<ImGuiTableSettings>   SettingsTables;         // ImGuiTable .ini settings entries
+    ImGuiIDHashMap                      SettingsWindowsIndex;   // Map ImGuiWindowSettings::ID -> offset into SettingsWindows (maintained on insert)
+    ImGuiIDHashMap                      SettingsTablesIndex;    // Map ImGuiTableSettings::ID -> offset into SettingsTables (maintained on insert)
     ImVector<ImGuiContextHook>          Hooks;                  // Hooks for extensions (e.g. test engine)
     ImGuiID                             HookIdNext;             // Next available HookId
 
@@ -5961,6 +5961,112 @@ static void RenderArrowsForVerticalBar(ImDrawList* draw_list, ImVec2 pos, ImVec2
     ImGui::RenderArrowPointingAt(draw_list, ImVec2(pos.x + bar_w - half_sz.x,     pos.y), half_sz,                              ImGuiDir_Left,  IM_COL32(255,255,255,alpha8));
 }
 
+// Helper for ColorPicker4(): render the 6 hue wheel segments.
+// The wheel geometry only depends on its size and on draw list/style settings, so it is tessellated once, stored relative
+// to its center, then re-emitted with a translation on following frames. Only the hue cursor and SV triangle are built each frame.
+static void RenderColorPickerHueWheel(ImDrawList* draw_list, ImVec2 wheel_center, float wheel_r_inner, float wheel_r_outer, float wheel_thickness, const ImU32 col_hues[6 + 1], int style_alpha8)
+{
+    ImGuiContext& g = *GImGui;
+    const ImVec2 uv_white = draw_list->_Data->TexUvWhitePixel;
+    ImGuiColorPickerWheelCache* cache = NULL;
+    for (ImGuiColorPickerWheelCache& entry : g.ColorPickerWheelCache)
+        if (entry.RadiusOuter == wheel_r_outer && entry.Thickness == wheel_thickness && entry.StyleAlpha8 == (ImU32)style_alpha8 && entry.DrawListFlags == draw_list->Flags
+            && entry.FringeScale == draw_list->_FringeScale && entry.TexUvWhitePixel.x == uv_white.x && entry.TexUvWhitePixel.y == uv_white.y)
+        {
+            cache = &entry;
+            break;
+        }
+
+    if (cache != NULL)
+    {
+        // Fast path: copy cached vertices (translated) and indices (rebased)
+        cache->LastFrameUsed = g.FrameCount;
+        const int vtx_count = cache->VtxBuffer.Size;
+        const int idx_count = cache->IdxBuffer.Size;
+        draw_list->PrimReserve(idx_count, vtx_count);
+        const ImDrawVert* vtx_src = cache->VtxBuffer.Data;
+        ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+        for (int n = 0; n < vtx_count; n++, vtx_src++, vtx_write++)
+        {
+            vtx_write->pos.x = vtx_src->pos.x + wheel_center.x;
+            vtx_write->pos.y = vtx_src->pos.y + wheel_center.y;
+            vtx_write->uv = vtx_src->uv;
+            vtx_write->col = vtx_src->col;
+        }
+        const ImDrawIdx* idx_src = cache->IdxBuffer.Data;
+        const unsigned int idx_base = draw_list->_VtxCurrentIdx;
+        ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+        for (int n = 0; n < idx_count; n++)
+            idx_write[n] = (ImDrawIdx)(idx_base + idx_src[n]);
+        draw_list->_VtxWritePtr += vtx_count;
+        draw_list->_IdxWritePtr += idx_count;
+        draw_list->_VtxCurrentIdx += vtx_count;
+        return;
+    }
+
+    // Slow path: tessellate, then capture the result
+    const int vtx_buffer_start = draw_list->VtxBuffer.Size;
+    const int idx_buffer_start = draw_list->IdxBuffer.Size;
+    const unsigned int vtx_current_idx_start = draw_list->_VtxCurrentIdx;
+    const unsigned int vtx_offset_start = draw_list->_CmdHeader.VtxOffset;
+
+    const float aeps = 0.5f / wheel_r_outer; // Half a pixel arc length in radians (2pi cancels out).
+    const int segment_per_arc = ImMax(4, (int)wheel_r_outer / 12);
+    for (int n = 0; n < 6; n++)
+    {
+        const float a0 = (n)     /6.0f * 2.0f * IM_PI - aeps;
+        const float a1 = (n+1.0f)/6.0f * 2.0f * IM_PI + aeps;
+        const int vert_start_idx = draw_list->VtxBuffer.Size;
+        draw_list->PathArcTo(wheel_center, (wheel_r_inner + wheel_r_outer)*0.5f, a0, a1, segment_per_arc);
+        draw_list->PathStroke(IM_COL32(255,255,255,style_alpha8), 0, wheel_thickness);
+        const int vert_end_idx = draw_list->VtxBuffer.Size;
+
+        // Paint colors over existing vertices
+        ImVec2 gradient_p0(wheel_center.x + ImCos(a0) * wheel_r_inner, wheel_center.y + ImSin(a0) * wheel_r_inner);
+        ImVec2 gradient_p1(wheel_center.x + ImCos(a1) * wheel_r_inner, wheel_center.y + ImSin(a1) * wheel_r_inner);
+        ImGui::ShadeVertsLinearColorGradientKeepAlpha(draw_list, vert_start_idx, vert_end_idx, gradient_p0, gradient_p1, col_hues[n], col_hues[n + 1]);
+    }
+
+    // Geometry split over a new VtxOffset (16-bit indices overflow) can't be replayed as a single block: don't cache it.
+    if (draw_list->_CmdHeader.VtxOffset != vtx_offset_start)
+        return;
+
+    const int max_entries = 8;
+    if (g.ColorPickerWheelCache.Size < max_entries)
+    {
+        g.ColorPickerWheelCache.push_back(ImGuiColorPickerWheelCache());
+        cache = &g.ColorPickerWheelCache.back();
+    }
+    else
+    {
+        cache = &g.ColorPickerWheelCache[0];
+        for (ImGuiColorPickerWheelCache& entry : g.ColorPickerWheelCache)
+            if (entry.LastFrameUsed < cache->LastFrameUsed)
+                cache = &entry;
+    }
+    cache->RadiusOuter = wheel_r_outer;
+    cache->Thickness = wheel_thickness;
+    cache->StyleAlpha8 = (ImU32)style_alpha8;
+    cache->DrawListFlags = draw_list->Flags;
+    cache->FringeScale = draw_list->_FringeScale;
+    cache->TexUvWhitePixel = uv_white;
+    cache->LastFrameUsed = g.FrameCount;
+
+    const int vtx_count = draw_list->VtxBuffer.Size - vtx_buffer_start;
+    const int idx_count = draw_list->IdxBuffer.Size - idx_buffer_start;
+    cache->VtxBuffer.resize(vtx_count);
+    cache->IdxBuffer.resize(idx_count);
+    for (int n = 0; n < vtx_count; n++)
+    {
+        ImDrawVert v = draw_list->VtxBuffer[vtx_buffer_start + n];
+        v.pos.x -= wheel_center.x;
+        v.pos.y -= wheel_center.y;
+        cache->VtxBuffer[n] = v;
+    }
+    for (int n = 0; n < idx_count; n++)
+        cache->IdxBuffer[n] = (ImDrawIdx)(draw_list->IdxBuffer[idx_buffer_start + n] - vtx_current_idx_start);
+}
+
 // Note: ColorPicker4() only accesses 3 floats if ImGuiColorEditFlags_NoAlpha flag is set.
 // (In C++ the 'float col[4]' notation for a function argument is equivalent to 'float* col', we only specify a size to facilitate understanding of the code.)
 // FIXME: we adjust the big color square height based on item width, which may cause a flickering feedback loop (if automatic height makes a vertical scrollbar appears, affecting automatic width..)
@@ -6244,23 +6350,8 @@ bool ImGui::ColorPicker4(const char* label, float col[4], ImGuiColorEditFlags fl
 
     if (flags & ImGuiColorEditFlags_PickerHueWheel)
     {
-        // Render Hue Wheel
-        const float aeps = 0.5f / wheel_r_outer; // Half a pixel arc length in radians (2pi cancels out).
-        const int segment_per_arc = ImMax(4, (int)wheel_r_outer / 12);
-        for (int n = 0; n < 6; n++)
-        {
-            const float a0 = (n)     /6.0f * 2.0f * IM_PI - aeps;
-            const float a1 = (n+1.0f)/6.0f * 2.0f * IM_PI + aeps;
-            const int vert_start_idx = draw_list->VtxBuffer.Size;
-            draw_list->PathArcTo(wheel_center, (wheel_r_inner + wheel_r_outer)*0.5f, a0, a1, segment_per_arc);
-            draw_list->PathStroke(col_white, 0, wheel_thickness);
-            const int vert_end_idx = draw_list->VtxBuffer.Size;
-
-            // Paint colors over existing vertices
-            ImVec2 gradient_p0(wheel_center.x + ImCos(a0) * wheel_r_inner, wheel_center.y + ImSin(a0) * wheel_r_inner);
-            ImVec2 gradient_p1(wheel_center.x + ImCos(a1) * wheel_r_inner, wheel_center.y + ImSin(a1) * wheel_r_inner);
-            ShadeVertsLinearColorGradientKeepAlpha(draw_list, vert_start_idx, vert_end_idx, gradient_p0, gradient_p1, col_hues[n], col_hues[n + 1]);
-        }
+        // Render Hue Wheel (geometry is cached, see RenderColorPickerHueWheel())
+        RenderColorPickerHueWheel(draw_list, wheel_center, wheel_r_inner, wheel_r_outer, wheel_thickness, col_hues, style_alpha8);
 
         // Render Cursor + preview on Hue Wheel
         float cos_hue_angle = ImCos(H * 2.0f * IM_PI);
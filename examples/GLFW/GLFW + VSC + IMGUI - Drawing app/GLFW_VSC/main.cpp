@@ -1,4 +1,4 @@
-// OpenGL Pencil Drawing - single-file example (C++17)
+// OpenGL Pencil Drawing example (C++17), stroke recording lives in strokes.cpp
 // Uses GLFW and GLAD. Draw with left mouse button (press + move).
 // 
 // STEP-BY-STEP DESCRIPTION (HOW IT WORKS):
@@ -21,38 +21,21 @@
 //   so geometry can be drawn in clip space without any projection matrix.
 // - The app stores strokes as vectors of 2D points. Each stroke is a contiguous polyline.
 // - For production, consider batching, smoothing input, saving to image/SVG, and adding UI.
+// - Strokes are shared with the Qt canvas through shared memory rings (stroke_ring.h, POSIX only): ours are
+//   published as they're drawn, the Qt app's are drawn here too (brown while still in progress).
 
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
+#include "strokes.h"
+#include "stroke_shaders.h" // shader sources, shared with the Qt canvas
+#include "stroke_ring.h"
+
 #include <vector>
 #include <iostream>
 #include <string>
 #include <cmath>
 
-// Simple 2D vector for vertex positions (x,y)
-struct Vec2 { float x, y; };
-
-// --- Shader sources -------------------------------------------------------
-// Vertex shader: expects vec2 positions in clip/NDC space and sets gl_Position
-static const char* vertex_shader_src = R"glsl(
-#version 330 core
-layout(location = 0) in vec2 aPos;
-void main() {
-    gl_Position = vec4(aPos, 0.0, 1.0);
-}
-)glsl";
-
-// Fragment shader: uniform color for the pencil
-static const char* fragment_shader_src = R"glsl(
-#version 330 core
-out vec4 FragColor;
-uniform vec3 uColor;
-void main() {
-    FragColor = vec4(uColor, 1.0);
-}
-)glsl";
-
 // --- Shader compilation utility -------------------------------------------
 GLuint compile_shader(GLenum type, const char* src) {
     GLuint s = glCreateShader(type);
@@ -83,19 +66,40 @@ GLuint create_program() {
     return p;
 }
 
-// --- Global state ---------------------------------------------------------
-int g_win_w = 800, g_win_h = 600; // window size (updated on resize)
+// --- Stroke sharing (see stroke_ring.h) -------------------------------------
+StrokeRing g_ring_out; // our strokes, read by the Qt app
+StrokeRing g_ring_in; // the Qt app's strokes
+size_t g_published = 0; // points of g_current already in g_ring_out
+std::vector<Vec2> g_remote_current; // stroke being drawn in the Qt app
+
+// New points of the current stroke, once per frame and on release
+void publish_current() {
+    if (g_current.size() > g_published) {
+        const Vec2* points = g_current.data() + g_published;
+        const uint32_t count = (uint32_t)(g_current.size() - g_published);
+        if (g_published == 0) g_ring_out.begin(points, count); // the canvas was cleared mid-stroke
+        else g_ring_out.append(points, count);
+        g_published = g_current.size();
+    }
+}
 
-// Convert window coordinates (pixels, origin top-left) to NDC (-1..1, origin center)
-inline Vec2 wnd_to_ndc(double sx, double sy) {
-    float x = (float)(sx / g_win_w * 2.0 - 1.0);
-    float y = (float)(1.0 - sy / g_win_h * 2.0);
-    return { x, y };
+// Erase the canvas. A stroke in progress is finished for the Qt app, its next points start a new one.
+void clear_canvas() {
+    if (g_mouse_down) { publish_current(); g_ring_out.end(); }
+    strokes_clear();
+    g_published = 0;
 }
 
-bool g_mouse_down = false; // is left mouse button held?
-std::vector<std::vector<Vec2>> g_strokes; // list of finished strokes
-std::vector<Vec2> g_current; // current stroke being recorded
+// Finished remote strokes join g_strokes (copied out of the ring); reconnects when the Qt app restarts,
+// including after a crash (checked about once per second)
+void receive_remote_strokes(int frame) {
+    if (!g_ring_in.is_open() && frame % 60 == 0) g_ring_in.open(STROKE_RING_QT);
+    stroke_ring_drain(g_ring_in, g_strokes, g_remote_current);
+    if (g_ring_in.writer_closed() || (frame % 60 == 30 && g_ring_in.writer_restarted())) {
+        g_ring_in.close();
+        g_remote_current.clear();
+    }
+}
 
 // --- Input callbacks ------------------------------------------------------
 // Called when a mouse button is pressed or released
@@ -103,32 +107,22 @@ void mouse_button_cb(GLFWwindow* win, int button, int action, int mods) {
     if (button == GLFW_MOUSE_BUTTON_LEFT) {
         if (action == GLFW_PRESS) {
             // start a new stroke
-            g_mouse_down = true;
-            g_current.clear();
             double mx, my; glfwGetCursorPos(win, &mx, &my);
-            g_current.push_back(wnd_to_ndc(mx, my));
+            stroke_begin(mx, my);
+            g_ring_out.begin(g_current.data(), (uint32_t)g_current.size());
+            g_published = g_current.size();
         }
         else if (action == GLFW_RELEASE) {
-            // finish stroke: push to list of strokes (but only if there's content)
-            g_mouse_down = false;
-            if (!g_current.empty()) {
-                g_strokes.push_back(g_current);
-                g_current.clear();
-            }
+            publish_current();
+            stroke_end();
+            g_ring_out.end();
         }
     }
 }
 
 // Called whenever the cursor moves
 void cursor_pos_cb(GLFWwindow* win, double x, double y) {
-    if (g_mouse_down) {
-        Vec2 p = wnd_to_ndc(x, y);
-        // Avoid adding many nearly-identical points: only push when distance exceeds threshold
-        if (g_current.empty()) { g_current.push_back(p); return; }
-        Vec2 last = g_current.back();
-        float dx = p.x - last.x; float dy = p.y - last.y;
-        if (dx * dx + dy * dy > 1e-6f) g_current.push_back(p);
-    }
+    stroke_add_point(x, y);
 }
 
 // Window resized -> update viewport and stored window size
@@ -161,6 +155,9 @@ int main() {
     glfwSetCursorPosCallback(window, cursor_pos_cb);
     glfwSetFramebufferSizeCallback(window, framebuffer_size_cb);
 
+    // Publish our strokes; the Qt app's ring is opened when it appears
+    g_ring_out.create(STROKE_RING_GLFW);
+
     // 3) Create shader program
     GLuint program = create_program();
     GLint color_loc = glGetUniformLocation(program, "uColor");
@@ -186,12 +183,14 @@ int main() {
     glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
 
     // Main loop
-    while (!glfwWindowShouldClose(window)) {
+    for (int frame = 0; !glfwWindowShouldClose(window); frame++) {
         glfwPollEvents();
+        publish_current();
+        receive_remote_strokes(frame);
 
         // Simple keyboard handling: ESC to close, C to clear canvas
         if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) glfwSetWindowShouldClose(window, true);
-        if (glfwGetKey(window, GLFW_KEY_C) == GLFW_PRESS) { g_strokes.clear(); g_current.clear(); }
+        if (glfwGetKey(window, GLFW_KEY_C) == GLFW_PRESS) clear_canvas();
 
         glClear(GL_COLOR_BUFFER_BIT);
 
@@ -218,6 +217,14 @@ int main() {
             glDrawArrays(GL_LINE_STRIP, 0, (GLsizei)g_current.size());
         }
 
+        // And the one being drawn in the Qt app
+        if (g_remote_current.size() >= 2) {
+            glUniform3f(color_loc, 0.45f, 0.15f, 0.05f);
+            glBindBuffer(GL_ARRAY_BUFFER, vbo);
+            glBufferData(GL_ARRAY_BUFFER, g_remote_current.size() * sizeof(Vec2), g_remote_current.data(), GL_DYNAMIC_DRAW);
+            glDrawArrays(GL_LINE_STRIP, 0, (GLsizei)g_remote_current.size());
+        }
+
         glBindVertexArray(0);
         glUseProgram(0);
 
@@ -225,6 +232,8 @@ int main() {
     }
 
     // Cleanup
+    g_ring_out.close();
+    g_ring_in.close();
     glDeleteBuffers(1, &vbo);
     glDeleteVertexArrays(1, &vao);
     glDeleteProgram(program);
@@ -0,0 +1,243 @@
+#include "stroke_ring.h"
+
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static const uint32_t kRingMagic = 0x4B525453; // "STRK"
+static const uint32_t kRingVersion = 1;
+
+// Shared by the two processes. head and tail are byte counters that only grow (position = counter & mask),
+// each on its own cache line: the writer only stores head, the reader only stores tail.
+struct StrokeRing::Header {
+    std::atomic<uint32_t> magic; // set last by the writer, the reader checks it before using the ring
+    uint32_t version;
+    uint64_t capacity;
+    std::atomic<uint32_t> closed;
+    alignas(64) std::atomic<uint64_t> head;
+    alignas(64) std::atomic<uint64_t> tail;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "the ring counters are shared between processes");
+static_assert(sizeof(StrokeRecord) == 8 && sizeof(Vec2) == 8, "records are 8-byte aligned");
+
+#ifndef _WIN32
+
+bool StrokeRing::create(const char* name, size_t capacity) {
+    close();
+    size_t cap = 4096;
+    while (cap < capacity) cap *= 2;
+
+    shm_unlink(name); // a reader still mapping the previous ring keeps it until it sees 'closed'
+    int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) return false;
+    const size_t size = sizeof(Header) + cap;
+    if (ftruncate(fd, (off_t)size) != 0 || !map(fd, size, true)) {
+        ::close(fd);
+        shm_unlink(name);
+        return false;
+    }
+    ::close(fd);
+
+    m_header->version = kRingVersion;
+    m_header->capacity = cap;
+    m_header->closed.store(0, std::memory_order_relaxed);
+    m_header->head.store(0, std::memory_order_relaxed);
+    m_header->tail.store(0, std::memory_order_relaxed);
+    m_header->magic.store(kRingMagic, std::memory_order_release);
+    m_mask = cap - 1;
+    m_writer = true;
+    m_dropping = false;
+    strncpy(m_name, name, sizeof(m_name) - 1);
+    return true;
+}
+
+bool StrokeRing::open(const char* name) {
+    close();
+    int fd = shm_open(name, O_RDWR, 0);
+    if (fd < 0) return false;
+    struct stat st;
+    bool ok = fstat(fd, &st) == 0 && (size_t)st.st_size > sizeof(Header) && map(fd, (size_t)st.st_size, false);
+    ::close(fd);
+    if (!ok) return false;
+    m_dev = (uint64_t)st.st_dev;
+    m_ino = (uint64_t)st.st_ino;
+
+    const uint64_t cap = m_header->capacity;
+    if (m_header->magic.load(std::memory_order_acquire) != kRingMagic || m_header->version != kRingVersion ||
+        (cap & (cap - 1)) != 0 || sizeof(Header) + cap > m_map_size) {
+        close(); // not initialized yet, or not a stroke ring
+        return false;
+    }
+    m_mask = cap - 1;
+    m_writer = false;
+    m_head_cache = m_header->tail.load(std::memory_order_relaxed);
+    strncpy(m_name, name, sizeof(m_name) - 1);
+    return true;
+}
+
+bool StrokeRing::map(int fd, size_t size, bool init) {
+    void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED) return false;
+    if (init) memset(p, 0, sizeof(Header));
+    m_header = (Header*)p;
+    m_data = (unsigned char*)p + sizeof(Header);
+    m_map_size = size;
+    return true;
+}
+
+void StrokeRing::close() {
+    if (!m_header) return;
+    if (m_writer) {
+        m_header->closed.store(1, std::memory_order_release);
+        shm_unlink(m_name);
+    }
+    munmap(m_header, m_map_size);
+    m_header = nullptr;
+    m_data = nullptr;
+    m_map_size = 0;
+}
+
+// create() unlinks the name before making a new ring: a new inode. Ours can't be reused while we map it.
+bool StrokeRing::writer_restarted() const {
+    if (!m_header || m_writer ||
+        m_header->tail.load(std::memory_order_relaxed) != m_header->head.load(std::memory_order_acquire))
+        return false;
+    int fd = shm_open(m_name, O_RDONLY, 0);
+    if (fd < 0) return true; // unlinked and not recreated yet
+    struct stat st;
+    const bool same = fstat(fd, &st) == 0 && (uint64_t)st.st_dev == m_dev && (uint64_t)st.st_ino == m_ino;
+    ::close(fd);
+    return !same;
+}
+
+#else
+
+bool StrokeRing::create(const char*, size_t) { return false; }
+bool StrokeRing::open(const char*) { return false; }
+bool StrokeRing::map(int, size_t, bool) { return false; }
+void StrokeRing::close() {}
+bool StrokeRing::writer_restarted() const { return false; }
+
+#endif
+
+// --- Writer -------------------------------------------------------------------
+bool StrokeRing::write(uint32_t type, const Vec2* points, uint32_t count) {
+    if (!m_header) return false;
+    if (type == STROKE_BEGIN) m_dropping = false;
+    const uint64_t size = sizeof(StrokeRecord) + (uint64_t)count * sizeof(Vec2);
+    const uint64_t cap = m_mask + 1;
+    const uint64_t head = m_header->head.load(std::memory_order_relaxed);
+    const uint64_t tail = m_header->tail.load(std::memory_order_acquire);
+    uint64_t pos = head & m_mask;
+    const uint64_t pad = pos + size > cap ? cap - pos : 0;
+    if (m_dropping || head + pad + size - tail > cap) {
+        m_dropping = true;
+        m_dropped++;
+        return false;
+    }
+    if (pad) {
+        StrokeRecord* filler = (StrokeRecord*)(m_data + pos);
+        filler->type = STROKE_PAD;
+        filler->count = 0;
+        pos = 0;
+    }
+    StrokeRecord* r = (StrokeRecord*)(m_data + pos);
+    r->type = type;
+    r->count = count;
+    if (count) memcpy(r + 1, points, count * sizeof(Vec2));
+    m_header->head.store(head + pad + size, std::memory_order_release); // publishes the record (and the filler)
+    return true;
+}
+
+size_t StrokeRing::free_space() const {
+    if (!m_header) return 0;
+    return (size_t)((m_mask + 1) - (m_header->head.load(std::memory_order_relaxed) - m_header->tail.load(std::memory_order_acquire)));
+}
+
+bool StrokeRing::begin(const Vec2* points, uint32_t count) {
+    return write(STROKE_BEGIN, points, count);
+}
+
+// Long runs are split so that a record never takes more than half of the ring
+bool StrokeRing::append(const Vec2* points, uint32_t count) {
+    const uint32_t max_points = m_header ? (uint32_t)(((m_mask + 1) / 2 - sizeof(StrokeRecord)) / sizeof(Vec2)) : 0;
+    while (count > max_points && max_points > 0) {
+        if (!write(STROKE_APPEND, points, max_points)) return false;
+        points += max_points;
+        count -= max_points;
+    }
+    return write(STROKE_APPEND, points, count);
+}
+
+bool StrokeRing::end() {
+    return write(STROKE_END, nullptr, 0);
+}
+
+// --- Reader -------------------------------------------------------------------
+// The ring is written by another process: a record is only returned once it's known to lie within what was
+// published and within the mapping. Anything else (corrupt or foreign writer) closes the ring.
+const StrokeRecord* StrokeRing::peek() {
+    if (!m_header) return nullptr;
+    const uint64_t cap = m_mask + 1;
+    uint64_t tail = m_header->tail.load(std::memory_order_relaxed);
+    for (;;) {
+        if (tail == m_head_cache) {
+            m_head_cache = m_header->head.load(std::memory_order_acquire);
+            if (tail == m_head_cache) return nullptr;
+        }
+        const uint64_t available = m_head_cache - tail;
+        const uint64_t room = cap - (tail & m_mask); // bytes up to the end of the ring
+        const StrokeRecord* r = (const StrokeRecord*)(m_data + (tail & m_mask));
+        if (available > cap || available < sizeof(StrokeRecord))
+            break;
+        const uint32_t type = r->type;
+        const uint64_t size = sizeof(StrokeRecord) + (uint64_t)r->count * sizeof(Vec2);
+        if (type == STROKE_PAD) {
+            if (room > available) break;
+            tail += room; // skip to the start of the ring
+            m_header->tail.store(tail, std::memory_order_release);
+            continue;
+        }
+        if (type < STROKE_BEGIN || type > STROKE_END || size > room || size > available)
+            break;
+        m_peek_size = size;
+        return r;
+    }
+    close();
+    return nullptr;
+}
+
+void StrokeRing::pop() {
+    const uint64_t tail = m_header->tail.load(std::memory_order_relaxed);
+    m_header->tail.store(tail + m_peek_size, std::memory_order_release); // the size checked by peek()
+}
+
+bool StrokeRing::writer_closed() const {
+    return m_header && m_header->closed.load(std::memory_order_acquire) &&
+        m_header->tail.load(std::memory_order_relaxed) == m_header->head.load(std::memory_order_acquire);
+}
+
+size_t stroke_ring_drain(StrokeRing& ring, std::vector<std::vector<Vec2>>& strokes, std::vector<Vec2>& current) {
+    size_t records = 0;
+    while (const StrokeRecord* r = ring.peek()) {
+        const Vec2* p = r->points();
+        switch (r->type) {
+        case STROKE_BEGIN: current.assign(p, p + r->count); break; // an unfinished stroke (END dropped) is discarded
+        case STROKE_APPEND: current.insert(current.end(), p, p + r->count); break;
+        case STROKE_END:
+            if (!current.empty()) strokes.push_back(std::move(current));
+            current.clear();
+            break;
+        }
+        ring.pop();
+        records++;
+    }
+    if (!ring.is_open()) current.clear(); // closed by peek(): the stroke in progress won't be finished
+    return records;
+}
@@ -0,0 +1,96 @@
+// Stroke interchange between the drawing apps (GLFW pencil, Qt canvas) through a POSIX shared memory ring.
+// Each app publishes its own strokes in a ring it creates, and maps the other app's ring to draw its strokes.
+//
+// Format: the ring holds 8-byte aligned records, a StrokeRecord header followed by 'count' points (Vec2, NDC):
+//   STROKE_BEGIN   first point(s) of a new stroke
+//   STROKE_APPEND  more points of the current stroke
+//   STROKE_END     count = 0, the stroke is finished
+//   STROKE_PAD     filler up to the end of the ring: records never wrap, so a reader always sees contiguous points
+// One writer and one reader per ring. The reader gets pointers into the mapping (no copy, no parsing); the space
+// is given back with pop(). The writer never blocks: when the ring is full the rest of the stroke is dropped.
+// The apps do copy the points out (stroke_ring_drain()): finished strokes must outlive their records, whose space
+// the writer reuses. Only the transport is copy-free.
+//
+// POSIX only (shm_open + mmap): on Windows create()/open() return false and the apps work without sharing.
+
+#pragma once
+
+#include "strokes.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+enum StrokeRecordType : uint32_t { STROKE_BEGIN = 1, STROKE_APPEND = 2, STROKE_END = 3, STROKE_PAD = 4 };
+
+struct StrokeRecord {
+    uint32_t type;
+    uint32_t count; // points following the header
+    const Vec2* points() const { return (const Vec2*)(this + 1); }
+};
+
+// Shared names of the rings, one per writer
+#define STROKE_RING_GLFW "/opus_strokes_glfw"
+#define STROKE_RING_QT "/opus_strokes_qt"
+
+class StrokeRing {
+public:
+    StrokeRing() = default;
+    ~StrokeRing() { close(); }
+    StrokeRing(const StrokeRing&) = delete;
+    StrokeRing& operator=(const StrokeRing&) = delete;
+
+    // Writer: (re)creates the ring, 'capacity' bytes of records (rounded up to a power of two)
+    bool create(const char* name, size_t capacity = 4 << 20);
+    // Reader: maps a ring created by another process; false if it doesn't exist (yet)
+    bool open(const char* name);
+    // Unmaps; the writer also unlinks the name and tells the reader it's gone
+    void close();
+
+    bool is_open() const { return m_header != nullptr; }
+
+    // --- Writer ---------------------------------------------------------------
+    // False when the record didn't fit; after that the stroke's following records are dropped until the next begin
+    bool begin(const Vec2* points, uint32_t count);
+    bool append(const Vec2* points, uint32_t count);
+    bool end();
+    uint64_t dropped_records() const { return m_dropped; }
+    // Bytes the reader has given back; a record of N points fits when this is >= 2 * (8 + 8 * N) (filler included)
+    size_t free_space() const;
+
+    // --- Reader ---------------------------------------------------------------
+    // Oldest unread record, nullptr if there's none. Stays valid until pop().
+    // Its type and size are checked against the published bytes and the mapping first: on a bad record
+    // (corrupt or foreign writer) the ring is closed, is_open() tells.
+    const StrokeRecord* peek();
+    void pop();
+    // The writer closed its ring (exited or restarted) and everything was read: close() and open() again
+    bool writer_closed() const;
+    // The name now refers to another ring, or to none, and everything was read: the writer died without close()
+    // (crash, SIGKILL) and was restarted. A shm_open() + fstat(), meant to be called every second or so.
+    bool writer_restarted() const;
+
+private:
+    struct Header;
+
+    bool map(int fd, size_t size, bool init);
+    bool write(uint32_t type, const Vec2* points, uint32_t count);
+
+    Header* m_header = nullptr;
+    unsigned char* m_data = nullptr;
+    size_t m_map_size = 0;
+    uint64_t m_mask = 0;
+    bool m_writer = false;
+    bool m_dropping = false;        // writer: a record of the current stroke was dropped
+    uint64_t m_dropped = 0;
+    uint64_t m_head_cache = 0;      // reader: last head seen, re-read only when everything up to it was consumed
+    uint64_t m_peek_size = 0;       // reader: size of the record returned by peek(), what pop() consumes
+    uint64_t m_dev = 0, m_ino = 0;  // reader: identity of the mapped ring, see writer_restarted()
+    char m_name[64] = {};
+};
+
+// Reader side for the apps: applies every pending record. Finished strokes are appended to 'strokes', the stroke
+// in progress is kept in 'current' (it's the writer's, don't mix it with the local g_current).
+// Returns the number of records read.
+size_t stroke_ring_drain(StrokeRing& ring, std::vector<std::vector<Vec2>>& strokes, std::vector<Vec2>& current);
@@ -0,0 +1,23 @@
+// Shader sources of the pencil renderer, shared by this app and the Qt canvas (examples/QT/QT/strokecanvas.cpp).
+// OpenGL 3.3 core, positions already in NDC.
+
+#pragma once
+
+// Vertex shader: expects vec2 positions in clip/NDC space and sets gl_Position
+static const char* vertex_shader_src = R"glsl(
+#version 330 core
+layout(location = 0) in vec2 aPos;
+void main() {
+    gl_Position = vec4(aPos, 0.0, 1.0);
+}
+)glsl";
+
+// Fragment shader: uniform color for the pencil
+static const char* fragment_shader_src = R"glsl(
+#version 330 core
+out vec4 FragColor;
+uniform vec3 uColor;
+void main() {
+    FragColor = vec4(uColor, 1.0);
+}
+)glsl";
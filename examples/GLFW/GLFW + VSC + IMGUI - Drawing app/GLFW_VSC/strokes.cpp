@@ -0,0 +1,178 @@
+#include "strokes.h"
+
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define STROKES_SSE2 1
+#endif
+
+int g_win_w = 800, g_win_h = 600;
+bool g_mouse_down = false;
+std::vector<std::vector<Vec2>> g_strokes;
+std::vector<Vec2> g_current;
+
+// --- Batch kernel -----------------------------------------------------------
+// The threshold makes each decision depend on the previous ones (the reference is the last *kept* point), so the
+// SSE2 path doesn't follow that chain sample by sample. For a step of 4 samples p0..p3 it computes, in parallel, the
+// 10 squared distances that can matter: each pj to L (last kept point before the step) and to every earlier pk of
+// the step. The 10 comparison bits then index a table giving which of the 4 points are kept (kKeepTable below).
+// The only serial work left per step is the table lookup and the new L.
+// The transform uses the same IEEE double operations as window_to_ndc(), and the distances the same float ones as
+// stroke_add_point(): the kept points are bit-identical to the scalar version.
+
+#ifdef STROKES_SSE2
+struct KeepTable {
+    unsigned char keep[1024];
+    // Index bits: 0-3 pj farther than L from j = 0..3; 4-6 p1..p3 far from p0; 7-8 p2, p3 far from p1; 9 p3 far from p2
+    constexpr KeepTable() : keep() {
+        const int base[3] = { 4, 7, 9 }; // first bit of "far from pk", k = 0..2
+        for (int index = 0; index < 1024; index++) {
+            int last = -1; // -1: L
+            int mask = 0;
+            for (int j = 0; j < 4; j++) {
+                const int bit = last < 0 ? j : base[last] + (j - last - 1);
+                if (index & (1 << bit)) { mask |= 1 << j; last = j; }
+            }
+            keep[index] = (unsigned char)mask;
+        }
+    }
+};
+static constexpr KeepTable kKeepTable;
+
+// Squared distances of the 4 points (x, y) to (px, py), compared with the threshold: one bit per point
+static inline int far_bits(__m128 x, __m128 y, __m128 px, __m128 py, __m128 threshold) {
+    const __m128 dx = _mm_sub_ps(x, px);
+    const __m128 dy = _mm_sub_ps(y, py);
+    return _mm_movemask_ps(_mm_cmpgt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), threshold));
+}
+#endif
+
+size_t stroke_append_samples(std::vector<Vec2>& stroke, const StrokeSample* samples, size_t count,
+                             int win_w, int win_h, float min_distance2) {
+    if (count == 0) return 0;
+    const size_t start = stroke.size();
+    stroke.resize(start + count); // worst case, trimmed below
+    Vec2* out = stroke.data() + start;
+    size_t kept = 0;
+    bool have_last = start > 0;
+    Vec2 last = have_last ? stroke[start - 1] : Vec2{ 0.0f, 0.0f };
+
+    size_t i = 0;
+#ifdef STROKES_SSE2
+    const __m128d size = _mm_set_pd((double)win_h, (double)win_w);
+    const __m128d two = _mm_set1_pd(2.0);
+    const __m128d one = _mm_set1_pd(1.0);
+    // (x, y) -> (tx - 1, 1 - ty), t = 2 * (x / w, y / h): the operations of window_to_ndc() (and the sign of zero)
+    auto ndc = [&](__m128d sample) {
+        const __m128d t = _mm_mul_pd(_mm_div_pd(sample, size), two);
+        return _mm_sub_pd(_mm_move_sd(one, t), _mm_move_sd(t, one));
+    };
+    const __m128 threshold = _mm_set1_ps(min_distance2);
+    // No point yet: an infinitely far L keeps the first one
+    __m128 lx = _mm_set1_ps(have_last ? last.x : std::numeric_limits<float>::infinity());
+    __m128 ly = _mm_set1_ps(have_last ? last.y : std::numeric_limits<float>::infinity());
+    for (; i + 4 <= count; i += 4) {
+        const __m128d s0 = ndc(_mm_loadu_pd(&samples[i + 0].x));
+        const __m128d s1 = ndc(_mm_loadu_pd(&samples[i + 1].x));
+        const __m128d s2 = ndc(_mm_loadu_pd(&samples[i + 2].x));
+        const __m128d s3 = ndc(_mm_loadu_pd(&samples[i + 3].x));
+        const __m128 p01 = _mm_movelh_ps(_mm_cvtpd_ps(s0), _mm_cvtpd_ps(s1)); // x0 y0 x1 y1
+        const __m128 p23 = _mm_movelh_ps(_mm_cvtpd_ps(s2), _mm_cvtpd_ps(s3)); // x2 y2 x3 y3
+        const __m128 x = _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 y = _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(3, 1, 3, 1));
+
+        // The 6 in-step pairs packed in two vectors: (p1, p2, p3, p2) - (p0, p0, p0, p1) and (p3, p3) - (p1, p2)
+        const int in_a = far_bits(_mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 2, 1)), _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 3, 2, 1)),
+                                  _mm_shuffle_ps(x, x, _MM_SHUFFLE(1, 0, 0, 0)), _mm_shuffle_ps(y, y, _MM_SHUFFLE(1, 0, 0, 0)), threshold);
+        const int in_b = far_bits(_mm_shuffle_ps(x, x, _MM_SHUFFLE(3, 3, 3, 3)), _mm_shuffle_ps(y, y, _MM_SHUFFLE(3, 3, 3, 3)),
+                                  _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 1, 2, 1)), _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 1, 2, 1)), threshold);
+        const int from_l = far_bits(x, y, lx, ly, threshold);
+        const int keep = kKeepTable.keep[from_l | (in_a & 7) << 4 | (in_a >> 3) << 7 | (in_b & 1) << 8 | (in_b & 2) << 8];
+
+        _mm_storel_pi((__m64*)&out[kept], p01);
+        kept += keep & 1;
+        _mm_storeh_pi((__m64*)&out[kept], p01);
+        kept += (keep >> 1) & 1;
+        _mm_storel_pi((__m64*)&out[kept], p23);
+        kept += (keep >> 2) & 1;
+        _mm_storeh_pi((__m64*)&out[kept], p23);
+        kept += (keep >> 3) & 1;
+        if (keep) {
+            lx = _mm_set1_ps(out[kept - 1].x);
+            ly = _mm_set1_ps(out[kept - 1].y);
+        }
+    }
+    if (kept > 0) { last = out[kept - 1]; have_last = true; }
+#endif
+    for (; i < count; i++) {
+        const Vec2 q = window_to_ndc(samples[i].x, samples[i].y, win_w, win_h);
+        bool keep = true;
+        if (have_last) {
+            const float dx = q.x - last.x, dy = q.y - last.y;
+            keep = dx * dx + dy * dy > min_distance2;
+        }
+        out[kept] = q;
+        kept += keep;
+        if (keep) { last = q; have_last = true; }
+    }
+    stroke.resize(start + kept);
+    return kept;
+}
+
+// --- Stroke builder ---------------------------------------------------------
+void StrokeBuilder::begin(double x, double y) {
+    m_drawing = true;
+    m_current.clear();
+    m_current.push_back(to_ndc(x, y));
+}
+
+size_t StrokeBuilder::feed(const StrokeSample* samples, size_t count) {
+    if (!m_drawing) return 0;
+    return stroke_append_samples(m_current, samples, count, m_win_w, m_win_h, m_min_distance2);
+}
+
+bool StrokeBuilder::end() {
+    m_drawing = false;
+    if (m_current.empty()) return false;
+    m_strokes.push_back(std::move(m_current));
+    m_current.clear();
+    return true;
+}
+
+// --- Global functions -------------------------------------------------------
+void stroke_begin(double x, double y) {
+    g_mouse_down = true;
+    g_current.clear();
+    g_current.push_back(wnd_to_ndc(x, y));
+}
+
+void stroke_add_point(double x, double y) {
+    if (g_mouse_down) {
+        Vec2 p = wnd_to_ndc(x, y);
+        // Avoid adding many nearly-identical points: only push when distance exceeds threshold
+        if (g_current.empty()) { g_current.push_back(p); return; }
+        Vec2 last = g_current.back();
+        float dx = p.x - last.x; float dy = p.y - last.y;
+        if (dx * dx + dy * dy > kStrokeMinDistance2) g_current.push_back(p);
+    }
+}
+
+void stroke_add_points(const StrokeSample* samples, size_t count) {
+    if (g_mouse_down)
+        stroke_append_samples(g_current, samples, count, g_win_w, g_win_h);
+}
+
+void stroke_end() {
+    // finish stroke: push to list of strokes (but only if there's content)
+    g_mouse_down = false;
+    if (!g_current.empty()) {
+        g_strokes.push_back(g_current);
+        g_current.clear();
+    }
+}
+
+void strokes_clear() {
+    g_strokes.clear();
+    g_current.clear();
+}
@@ -0,0 +1,86 @@
+// Stroke recording for the pencil app (window coordinates -> NDC polylines).
+// Kept free of GLFW/OpenGL so it can be built and benchmarked on its own (see examples/GLFW/benchmark).
+//
+// Two ways to use it:
+//  - StrokeBuilder: self-contained (no globals), takes input samples one at a time or in batches with feed(),
+//    for servers, tests, benchmarks, or an app that collects the input events of a frame;
+//  - the global functions below (g_strokes, g_current...), what the GLFW and Qt apps use.
+// Both keep the same points: a sample is kept when it's farther than the threshold from the last kept point.
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Simple 2D vector for vertex positions (x,y)
+struct Vec2 { float x, y; };
+
+// One input sample in window coordinates (pixels, origin top-left), as GLFW and Qt report them
+struct StrokeSample { double x, y; };
+
+// Squared NDC distance a point must exceed from the last kept one (avoids many nearly-identical points)
+const float kStrokeMinDistance2 = 1e-6f;
+
+// Convert window coordinates (pixels, origin top-left) to NDC (-1..1, origin center)
+inline Vec2 window_to_ndc(double sx, double sy, int w, int h) {
+    float x = (float)(sx / w * 2.0 - 1.0);
+    float y = (float)(1.0 - sy / h * 2.0);
+    return { x, y };
+}
+
+// Batch kernel: converts 'count' samples to NDC and appends the ones passing the distance threshold to 'stroke'
+// (compared with its last point, if any). Returns the number of points appended.
+// SSE2 on x86-64 (4 samples per step), scalar elsewhere; same points either way.
+size_t stroke_append_samples(std::vector<Vec2>& stroke, const StrokeSample* samples, size_t count,
+                             int win_w, int win_h, float min_distance2 = kStrokeMinDistance2);
+
+// --- Stroke builder ---------------------------------------------------------
+class StrokeBuilder {
+public:
+    explicit StrokeBuilder(int win_w = 800, int win_h = 600, float min_distance2 = kStrokeMinDistance2)
+        : m_win_w(win_w), m_win_h(win_h), m_min_distance2(min_distance2) {}
+
+    void set_window_size(int w, int h) { m_win_w = w; m_win_h = h; }
+    Vec2 to_ndc(double x, double y) const { return window_to_ndc(x, y, m_win_w, m_win_h); }
+
+    void begin(double x, double y); // starts a stroke with its first point
+    void add(double x, double y) { StrokeSample s = { x, y }; feed(&s, 1); }
+    // Samples of the stroke in progress (ignored if there's none); returns the number of points kept
+    size_t feed(const StrokeSample* samples, size_t count);
+    template<typename SAMPLES> // std::vector, std::array, std::span...
+    size_t feed(const SAMPLES& samples) { return feed(samples.data(), samples.size()); }
+    bool end(); // commits the stroke if it has content; returns true if it did
+
+    void clear() { m_strokes.clear(); m_current.clear(); m_drawing = false; }
+
+    bool drawing() const { return m_drawing; }
+    const std::vector<Vec2>& current() const { return m_current; }
+    const std::vector<std::vector<Vec2>>& strokes() const { return m_strokes; }
+    std::vector<std::vector<Vec2>> take_strokes() { return std::move(m_strokes); }
+
+private:
+    int m_win_w, m_win_h;
+    float m_min_distance2;
+    bool m_drawing = false;
+    std::vector<Vec2> m_current;
+    std::vector<std::vector<Vec2>> m_strokes;
+};
+
+// --- Global state ---------------------------------------------------------
+extern int g_win_w, g_win_h; // window size (updated on resize)
+extern bool g_mouse_down; // is left mouse button held?
+extern std::vector<std::vector<Vec2>> g_strokes; // list of finished strokes
+extern std::vector<Vec2> g_current; // current stroke being recorded
+
+// Convert window coordinates to NDC with the current window size
+inline Vec2 wnd_to_ndc(double sx, double sy) {
+    return window_to_ndc(sx, sy, g_win_w, g_win_h);
+}
+
+// --- Stroke editing -------------------------------------------------------
+void stroke_begin(double x, double y); // left button pressed at (x,y): start a new stroke
+void stroke_add_point(double x, double y); // cursor moved while the button is held
+void stroke_add_points(const StrokeSample* samples, size_t count); // several moves at once (e.g. a frame's events)
+void stroke_end(); // left button released: keep the stroke if it has content
+void strokes_clear(); // erase the canvas
@@ -0,0 +1,9 @@
+// Dear ImGui user config for the multi-window example (selected with IMGUI_USER_CONFIG=<imconfig_threads.h>).
+// Every render thread owns one ImGuiContext, so the implicit "current context" pointer must be thread local
+// (see the CONTEXT AND MEMORY ALLOCATORS section of imgui.cpp). The variable itself is defined in main.cpp.
+
+#pragma once
+
+struct ImGuiContext;
+extern thread_local ImGuiContext* MyImGuiTLS;
+#define GImGui MyImGuiTLS
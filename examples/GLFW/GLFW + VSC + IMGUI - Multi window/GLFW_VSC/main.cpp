@@ -0,0 +1,328 @@
+// Several independent GLFW windows, each with its own Dear ImGui context and OpenGL context,
+// rendered in parallel on one thread per window.
+//
+// HOW IT WORKS:
+// (1) The main thread initializes GLFW, creates all windows and loads the OpenGL functions once.
+// (2) Each window gets a render thread. The thread makes the window's GL context current, creates its own
+//     ImGuiContext (GImGui is thread local, see imconfig_threads.h) and its own ImGui_ImplOpenGL3 backend data.
+// (3) GLFW only allows event processing on the main thread, so the main thread does nothing but glfwWaitEvents().
+//     Our GLFW callbacks turn each event into a small InputEvent and push it into that window's
+//     single-producer/single-consumer lock-free queue.
+// (4) At the start of every frame the render thread drains its queue into its own ImGuiIO, builds the UI,
+//     renders and swaps. With vsync every window blocks on its own swap, so adding windows does not slow the others down.
+// (5) Closing a window flags its thread to quit; the main thread then joins the thread and destroys the window.
+//
+// Usage: GLFW_VSC.exe [window_count]   (default 3, max 16)
+//
+// NOTES:
+// - We do not use ImGui_ImplGlfw_InitForOpenGL(): its NewFrame() queries window size/cursor through GLFW functions
+//   which must be called from the main thread. We only borrow ImGui_ImplGlfw_KeyToImGuiKey() from it.
+// - For the same reason OS mouse cursor shapes and clipboard are not supported here.
+
+#include"imgui.h"
+#include"imgui_impl_opengl3.h"
+
+#include<glad/glad.h>
+#include<GLFW/glfw3.h>
+
+#include<atomic>
+#include<cfloat>
+#include<cstdio>
+#include<cstdlib>
+#include<memory>
+#include<mutex>
+#include<thread>
+#include<vector>
+
+// Thread local "current context" pointer declared in imconfig_threads.h
+thread_local ImGuiContext* MyImGuiTLS = NULL;
+
+// Exported by imgui_impl_glfw.cpp (not declared in its header)
+ImGuiKey ImGui_ImplGlfw_KeyToImGuiKey(int keycode, int scancode);
+
+// --- Input events ---------------------------------------------------------
+// One GLFW event, as seen by the render thread
+struct InputEvent
+{
+	enum Type { MousePos, MouseButton, MouseWheel, Key, Char, Focus, Size };
+	Type type;
+	int i0, i1, i2;     // button/key, pressed, modifiers | char | focused | window w, h
+	float f0, f1;       // mouse position / wheel | framebuffer w, h
+};
+
+// Fixed size single-producer (main thread) / single-consumer (render thread) ring buffer.
+// Head and tail are padded apart so the two threads never write to the same cache line.
+class InputQueue
+{
+public:
+	bool Push(const InputEvent& e)
+	{
+		const unsigned int tail = m_tail.load(std::memory_order_relaxed);
+		if (tail - m_head.load(std::memory_order_acquire) == Capacity)
+			return false; // full: render thread is stalled, drop the event
+		m_events[tail % Capacity] = e;
+		m_tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+	bool Pop(InputEvent& e)
+	{
+		const unsigned int head = m_head.load(std::memory_order_relaxed);
+		if (head == m_tail.load(std::memory_order_acquire))
+			return false;
+		e = m_events[head % Capacity];
+		m_head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+private:
+	static const unsigned int Capacity = 1024; // power of two, so wrap-around of the counters is harmless
+	InputEvent m_events[Capacity];
+	std::atomic<unsigned int> m_head{ 0 };
+	char m_padding[64];
+	std::atomic<unsigned int> m_tail{ 0 };
+};
+
+// --- Per window state -----------------------------------------------------
+struct RenderWindow
+{
+	int index = 0;
+	GLFWwindow* window = NULL;
+	InputQueue events;
+	std::atomic<bool> quit{ false };
+	std::thread thread;
+};
+
+// imgui_impl_opengl3 resolves its GL functions into process wide pointers on first Init(), so serialize it
+static std::mutex g_glInitMutex;
+
+// --- GLFW callbacks (main thread) -----------------------------------------
+static void PushEvent(GLFWwindow* window, const InputEvent& e)
+{
+	RenderWindow* rw = (RenderWindow*)glfwGetWindowUserPointer(window);
+	rw->events.Push(e);
+}
+
+static void CursorPosCallback(GLFWwindow* window, double x, double y)
+{
+	PushEvent(window, InputEvent{ InputEvent::MousePos, 0, 0, 0, (float)x, (float)y });
+}
+
+static void CursorEnterCallback(GLFWwindow* window, int entered)
+{
+	if (!entered)
+		PushEvent(window, InputEvent{ InputEvent::MousePos, 0, 0, 0, -FLT_MAX, -FLT_MAX });
+}
+
+static void MouseButtonCallback(GLFWwindow* window, int button, int action, int mods)
+{
+	PushEvent(window, InputEvent{ InputEvent::MouseButton, button, action == GLFW_PRESS, mods, 0.0f, 0.0f });
+}
+
+static void ScrollCallback(GLFWwindow* window, double xoffset, double yoffset)
+{
+	PushEvent(window, InputEvent{ InputEvent::MouseWheel, 0, 0, 0, (float)xoffset, (float)yoffset });
+}
+
+static void KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+	if (action != GLFW_PRESS && action != GLFW_RELEASE)
+		return;
+	PushEvent(window, InputEvent{ InputEvent::Key, (int)ImGui_ImplGlfw_KeyToImGuiKey(key, scancode), action == GLFW_PRESS, mods, 0.0f, 0.0f });
+}
+
+static void CharCallback(GLFWwindow* window, unsigned int c)
+{
+	PushEvent(window, InputEvent{ InputEvent::Char, (int)c, 0, 0, 0.0f, 0.0f });
+}
+
+static void FocusCallback(GLFWwindow* window, int focused)
+{
+	PushEvent(window, InputEvent{ InputEvent::Focus, focused, 0, 0, 0.0f, 0.0f });
+}
+
+static void PushSizeEvent(GLFWwindow* window)
+{
+	int w, h, fb_w, fb_h;
+	glfwGetWindowSize(window, &w, &h);
+	glfwGetFramebufferSize(window, &fb_w, &fb_h);
+	PushEvent(window, InputEvent{ InputEvent::Size, w, h, 0, (float)fb_w, (float)fb_h });
+}
+
+static void FramebufferSizeCallback(GLFWwindow* window, int, int)
+{
+	PushSizeEvent(window);
+}
+
+static void CloseCallback(GLFWwindow* window)
+{
+	RenderWindow* rw = (RenderWindow*)glfwGetWindowUserPointer(window);
+	rw->quit.store(true, std::memory_order_release);
+}
+
+// --- Render thread ----------------------------------------------------------
+static void ApplyModifiers(ImGuiIO& io, int mods)
+{
+	io.AddKeyEvent(ImGuiMod_Ctrl, (mods & GLFW_MOD_CONTROL) != 0);
+	io.AddKeyEvent(ImGuiMod_Shift, (mods & GLFW_MOD_SHIFT) != 0);
+	io.AddKeyEvent(ImGuiMod_Alt, (mods & GLFW_MOD_ALT) != 0);
+	io.AddKeyEvent(ImGuiMod_Super, (mods & GLFW_MOD_SUPER) != 0);
+}
+
+static void RenderThread(RenderWindow* rw)
+{
+	// Take ownership of this window's GL context
+	glfwMakeContextCurrent(rw->window);
+	glfwSwapInterval(1);
+
+	// Each thread gets its own ImGui context, bound to this thread only
+	ImGuiContext* ctx = ImGui::CreateContext();
+	ImGui::SetCurrentContext(ctx);
+	ImGuiIO& io = ImGui::GetIO();
+	io.IniFilename = NULL; // contexts would overwrite each other's imgui.ini
+	io.ConfigFlags |= ImGuiConfigFlags_NoMouseCursorChange;
+	io.BackendPlatformName = "queued GLFW events";
+	ImGui::StyleColorsDark();
+	{
+		std::lock_guard<std::mutex> lock(g_glInitMutex);
+		ImGui_ImplOpenGL3_Init("#version 330");
+	}
+
+	// Per window variables and frame time history
+	float clearColor[3] = { 0.07f + 0.1f * rw->index, 0.13f, 0.17f };
+	float frameTimes[120] = {};
+	int frameIndex = 0;
+	int fbWidth = 0, fbHeight = 0;
+	double lastTime = glfwGetTime(); // glfwGetTime() may be called from any thread
+
+	while (!rw->quit.load(std::memory_order_acquire))
+	{
+		// Drain events routed by the main thread
+		InputEvent e;
+		while (rw->events.Pop(e))
+		{
+			switch (e.type)
+			{
+			case InputEvent::MousePos:    io.AddMousePosEvent(e.f0, e.f1); break;
+			case InputEvent::MouseButton: ApplyModifiers(io, e.i2); if (e.i0 >= 0 && e.i0 < ImGuiMouseButton_COUNT) io.AddMouseButtonEvent(e.i0, e.i1 != 0); break;
+			case InputEvent::MouseWheel:  io.AddMouseWheelEvent(e.f0, e.f1); break;
+			case InputEvent::Key:         ApplyModifiers(io, e.i2); io.AddKeyEvent((ImGuiKey)e.i0, e.i1 != 0); break;
+			case InputEvent::Char:        io.AddInputCharacter((unsigned int)e.i0); break;
+			case InputEvent::Focus:       io.AddFocusEvent(e.i0 != 0); break;
+			case InputEvent::Size:
+				io.DisplaySize = ImVec2((float)e.i0, (float)e.i1);
+				io.DisplayFramebufferScale = ImVec2(e.i0 > 0 ? e.f0 / e.i0 : 1.0f, e.i1 > 0 ? e.f1 / e.i1 : 1.0f);
+				fbWidth = (int)e.f0; fbHeight = (int)e.f1;
+				break;
+			}
+		}
+
+		// Setup time step
+		double currentTime = glfwGetTime();
+		io.DeltaTime = currentTime > lastTime ? (float)(currentTime - lastTime) : 1.0f / 60.0f;
+		lastTime = currentTime;
+		frameTimes[frameIndex] = io.DeltaTime * 1000.0f;
+		frameIndex = (frameIndex + 1) % IM_ARRAYSIZE(frameTimes);
+
+		// Tell OpenGL and ImGui a new frame is about to begin
+		ImGui_ImplOpenGL3_NewFrame();
+		ImGui::NewFrame();
+
+		ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_FirstUseEver);
+		ImGui::Begin("Render thread");
+		ImGui::Text("Window %d, own ImGui + GL context", rw->index);
+		ImGui::Text("%.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
+		ImGui::PlotLines("Frame times", frameTimes, IM_ARRAYSIZE(frameTimes), frameIndex, NULL, 0.0f, 50.0f, ImVec2(0, 60));
+		ImGui::ColorEdit3("Clear color", clearColor);
+		ImGui::End();
+
+		// Renders the ImGUI elements
+		ImGui::Render();
+		glViewport(0, 0, fbWidth, fbHeight);
+		glClearColor(clearColor[0], clearColor[1], clearColor[2], 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT);
+		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+
+		// Swap the back buffer with the front buffer (blocks on vsync for this window only)
+		glfwSwapBuffers(rw->window);
+	}
+
+	// Deletes this thread's ImGUI instances and releases the GL context so the main thread can destroy the window
+	ImGui_ImplOpenGL3_Shutdown();
+	ImGui::DestroyContext(ctx);
+	glfwMakeContextCurrent(NULL);
+}
+
+// --- main -----------------------------------------------------------------
+int main(int argc, char** argv)
+{
+	int windowCount = argc > 1 ? atoi(argv[1]) : 3;
+	if (windowCount < 1) windowCount = 1;
+	if (windowCount > 16) windowCount = 16;
+
+	// Initialize GLFW and request OpenGL 3.3 core profile
+	if (!glfwInit())
+		return -1;
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+	// Create all windows on the main thread (GLFW requirement)
+	std::vector<std::unique_ptr<RenderWindow>> windows;
+	for (int n = 0; n < windowCount; n++)
+	{
+		char title[64];
+		snprintf(title, sizeof(title), "ImGui + GLFW - window %d", n);
+		std::unique_ptr<RenderWindow> rw(new RenderWindow());
+		rw->index = n;
+		rw->window = glfwCreateWindow(640, 480, title, NULL, NULL);
+		if (rw->window == NULL)
+		{
+			fprintf(stderr, "Failed to create GLFW window %d\n", n);
+			break;
+		}
+		glfwSetWindowPos(rw->window, 40 + 60 * n, 40 + 60 * n);
+		glfwSetWindowUserPointer(rw->window, rw.get());
+		glfwSetCursorPosCallback(rw->window, CursorPosCallback);
+		glfwSetCursorEnterCallback(rw->window, CursorEnterCallback);
+		glfwSetMouseButtonCallback(rw->window, MouseButtonCallback);
+		glfwSetScrollCallback(rw->window, ScrollCallback);
+		glfwSetKeyCallback(rw->window, KeyCallback);
+		glfwSetCharCallback(rw->window, CharCallback);
+		glfwSetWindowFocusCallback(rw->window, FocusCallback);
+		glfwSetFramebufferSizeCallback(rw->window, FramebufferSizeCallback);
+		glfwSetWindowCloseCallback(rw->window, CloseCallback);
+		PushSizeEvent(rw->window);
+		windows.push_back(std::move(rw));
+	}
+	if (windows.empty())
+	{
+		glfwTerminate();
+		return -1;
+	}
+
+	// Load GLAD once; all contexts share the same driver so the function pointers are valid for every thread
+	glfwMakeContextCurrent(windows[0]->window);
+	gladLoadGL();
+	glfwMakeContextCurrent(NULL);
+
+	// Start one render thread per window
+	for (std::unique_ptr<RenderWindow>& rw : windows)
+		rw->thread = std::thread(RenderThread, rw.get());
+
+	// Main loop: only pump events. Blocks until something happens so the main thread uses no CPU while idle.
+	while (!windows.empty())
+	{
+		glfwWaitEvents();
+		for (size_t n = 0; n < windows.size(); )
+		{
+			RenderWindow* rw = windows[n].get();
+			if (!rw->quit.load(std::memory_order_acquire)) { n++; continue; }
+			rw->thread.join();
+			glfwDestroyWindow(rw->window);
+			windows.erase(windows.begin() + n);
+		}
+	}
+
+	glfwTerminate();
+	return 0;
+}
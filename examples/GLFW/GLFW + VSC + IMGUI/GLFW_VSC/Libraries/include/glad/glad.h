@@ -86,6 +86,12 @@ GLAPI int gladLoadGL(void);
 
 GLAPI int gladLoadGLLoader(GLADloadproc);
 
+/* Compile glad.c with GLAD_LAZY_LOAD defined to resolve entry points on their first call instead of all of them
+ * in gladLoadGLLoader(). Function pointers are then never NULL, so 'if (glad_glFoo)' checks don't work:
+ * test GLAD_GL_VERSION_X_Y / GLVersion instead. Calling a function the context lacks prints a message to stderr
+ * (once per function), does nothing and returns 0. Each gladLoadGLLoader() puts every pointer back on lazy
+ * resolution through the new loader. */
+
 #include <KHR/khrplatform.h>
 typedef unsigned int GLenum;
 typedef unsigned char GLboolean;
@@ -150,7 +150,11 @@ int gladLoadGL(void) {
 
     if(open_gl()) {
         status = gladLoadGLLoader(&get_proc);
+#ifndef GLAD_LAZY_LOAD
         close_gl();
+#else
+        (void)&close_gl; /* The lazy loader keeps resolving through get_proc() */
+#endif
     }
 
     return status;
@@ -165,96 +169,1492 @@ struct gladGLversionStruct GLVersion = { 0, 0 };
 static int max_loaded_major;
 static int max_loaded_minor;
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
-
-static int get_exts(void) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        int index;
-
-        num_exts_i = 0;
-        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
-        }
-
-        if (exts_i == NULL) {
-            return 0;
-        }
+#ifdef GLAD_LAZY_LOAD
+/* Lazy loader: every glad_gl* pointer starts on a trampoline which resolves the real entry point
+ * through the loader given to gladLoadGLLoader(), patches the pointer and forwards the call.
+ * Only the functions actually called by the application get resolved. */
+static GLADloadproc glad_lazy_loader = NULL;
 
-        for(index = 0; index < num_exts_i; index++) {
-            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
+typedef void (*GLADlazyproc)(void);
 
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
-            }
-            exts_i[index] = local_str;
-        }
+/* The context doesn't have this function: say it once per function, the call does nothing and returns 0 */
+static void glad_lazy_missing(const char *name) {
+    static const char *reported[64];
+    static int reported_count = 0;
+    int index;
+    for(index = 0; index < reported_count; index++) {
+        if(reported[index] == name) return;
     }
-#endif
-    return 1;
+    if(reported_count < 64) reported[reported_count++] = name;
+    fprintf(stderr, "glad: %s is not available in this context, call ignored\n", name);
 }
 
-static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
-        }
-        free((void *)exts_i);
-        exts_i = NULL;
+/* Returns the entry point, or the trampoline itself when the loader has none: the pointer then stays on the
+ * trampoline, which reports the missing function instead of calling NULL */
+static GLADlazyproc glad_lazy_resolve(const char *name, GLADlazyproc trampoline) {
+    void *proc = glad_lazy_loader != NULL ? glad_lazy_loader(name) : NULL;
+    if(proc == NULL) {
+        glad_lazy_missing(name);
+        return trampoline;
     }
+    return (GLADlazyproc)proc;
 }
 
-static int has_ext(const char *ext) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
-            return 0;
-        }
-
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
-            }
-
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
-            }
-            extensions = terminator;
-        }
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
-
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
-            }
-        }
-    }
-#endif
-
-    return 0;
+static void APIENTRY glad_lazy_glAccum(GLenum op, GLfloat value) { glad_glAccum = (PFNGLACCUMPROC)glad_lazy_resolve("glAccum", (GLADlazyproc)glad_lazy_glAccum); if (glad_glAccum != glad_lazy_glAccum) glad_glAccum(op, value); }
+static void APIENTRY glad_lazy_glActiveTexture(GLenum texture) { glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)glad_lazy_resolve("glActiveTexture", (GLADlazyproc)glad_lazy_glActiveTexture); if (glad_glActiveTexture != glad_lazy_glActiveTexture) glad_glActiveTexture(texture); }
+static void APIENTRY glad_lazy_glAlphaFunc(GLenum func, GLfloat ref) { glad_glAlphaFunc = (PFNGLALPHAFUNCPROC)glad_lazy_resolve("glAlphaFunc", (GLADlazyproc)glad_lazy_glAlphaFunc); if (glad_glAlphaFunc != glad_lazy_glAlphaFunc) glad_glAlphaFunc(func, ref); }
+static GLboolean APIENTRY glad_lazy_glAreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *residences) { glad_glAreTexturesResident = (PFNGLARETEXTURESRESIDENTPROC)glad_lazy_resolve("glAreTexturesResident", (GLADlazyproc)glad_lazy_glAreTexturesResident); if (glad_glAreTexturesResident == glad_lazy_glAreTexturesResident) return (GLboolean)0; return glad_glAreTexturesResident(n, textures, residences); }
+static void APIENTRY glad_lazy_glArrayElement(GLint i) { glad_glArrayElement = (PFNGLARRAYELEMENTPROC)glad_lazy_resolve("glArrayElement", (GLADlazyproc)glad_lazy_glArrayElement); if (glad_glArrayElement != glad_lazy_glArrayElement) glad_glArrayElement(i); }
+static void APIENTRY glad_lazy_glAttachShader(GLuint program, GLuint shader) { glad_glAttachShader = (PFNGLATTACHSHADERPROC)glad_lazy_resolve("glAttachShader", (GLADlazyproc)glad_lazy_glAttachShader); if (glad_glAttachShader != glad_lazy_glAttachShader) glad_glAttachShader(program, shader); }
+static void APIENTRY glad_lazy_glBegin(GLenum mode) { glad_glBegin = (PFNGLBEGINPROC)glad_lazy_resolve("glBegin", (GLADlazyproc)glad_lazy_glBegin); if (glad_glBegin != glad_lazy_glBegin) glad_glBegin(mode); }
+static void APIENTRY glad_lazy_glBeginConditionalRender(GLuint id, GLenum mode) { glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)glad_lazy_resolve("glBeginConditionalRender", (GLADlazyproc)glad_lazy_glBeginConditionalRender); if (glad_glBeginConditionalRender != glad_lazy_glBeginConditionalRender) glad_glBeginConditionalRender(id, mode); }
+static void APIENTRY glad_lazy_glBeginQuery(GLenum target, GLuint id) { glad_glBeginQuery = (PFNGLBEGINQUERYPROC)glad_lazy_resolve("glBeginQuery", (GLADlazyproc)glad_lazy_glBeginQuery); if (glad_glBeginQuery != glad_lazy_glBeginQuery) glad_glBeginQuery(target, id); }
+static void APIENTRY glad_lazy_glBeginTransformFeedback(GLenum primitiveMode) { glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)glad_lazy_resolve("glBeginTransformFeedback", (GLADlazyproc)glad_lazy_glBeginTransformFeedback); if (glad_glBeginTransformFeedback != glad_lazy_glBeginTransformFeedback) glad_glBeginTransformFeedback(primitiveMode); }
+static void APIENTRY glad_lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) { glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)glad_lazy_resolve("glBindAttribLocation", (GLADlazyproc)glad_lazy_glBindAttribLocation); if (glad_glBindAttribLocation != glad_lazy_glBindAttribLocation) glad_glBindAttribLocation(program, index, name); }
+static void APIENTRY glad_lazy_glBindBuffer(GLenum target, GLuint buffer) { glad_glBindBuffer = (PFNGLBINDBUFFERPROC)glad_lazy_resolve("glBindBuffer", (GLADlazyproc)glad_lazy_glBindBuffer); if (glad_glBindBuffer != glad_lazy_glBindBuffer) glad_glBindBuffer(target, buffer); }
+static void APIENTRY glad_lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) { glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)glad_lazy_resolve("glBindBufferBase", (GLADlazyproc)glad_lazy_glBindBufferBase); if (glad_glBindBufferBase != glad_lazy_glBindBufferBase) glad_glBindBufferBase(target, index, buffer); }
+static void APIENTRY glad_lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) { glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)glad_lazy_resolve("glBindBufferRange", (GLADlazyproc)glad_lazy_glBindBufferRange); if (glad_glBindBufferRange != glad_lazy_glBindBufferRange) glad_glBindBufferRange(target, index, buffer, offset, size); }
+static void APIENTRY glad_lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) { glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)glad_lazy_resolve("glBindFragDataLocation", (GLADlazyproc)glad_lazy_glBindFragDataLocation); if (glad_glBindFragDataLocation != glad_lazy_glBindFragDataLocation) glad_glBindFragDataLocation(program, color, name); }
+static void APIENTRY glad_lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) { glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)glad_lazy_resolve("glBindFragDataLocationIndexed", (GLADlazyproc)glad_lazy_glBindFragDataLocationIndexed); if (glad_glBindFragDataLocationIndexed != glad_lazy_glBindFragDataLocationIndexed) glad_glBindFragDataLocationIndexed(program, colorNumber, index, name); }
+static void APIENTRY glad_lazy_glBindFramebuffer(GLenum target, GLuint framebuffer) { glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)glad_lazy_resolve("glBindFramebuffer", (GLADlazyproc)glad_lazy_glBindFramebuffer); if (glad_glBindFramebuffer != glad_lazy_glBindFramebuffer) glad_glBindFramebuffer(target, framebuffer); }
+static void APIENTRY glad_lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer) { glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)glad_lazy_resolve("glBindRenderbuffer", (GLADlazyproc)glad_lazy_glBindRenderbuffer); if (glad_glBindRenderbuffer != glad_lazy_glBindRenderbuffer) glad_glBindRenderbuffer(target, renderbuffer); }
+static void APIENTRY glad_lazy_glBindSampler(GLuint unit, GLuint sampler) { glad_glBindSampler = (PFNGLBINDSAMPLERPROC)glad_lazy_resolve("glBindSampler", (GLADlazyproc)glad_lazy_glBindSampler); if (glad_glBindSampler != glad_lazy_glBindSampler) glad_glBindSampler(unit, sampler); }
+static void APIENTRY glad_lazy_glBindTexture(GLenum target, GLuint texture) { glad_glBindTexture = (PFNGLBINDTEXTUREPROC)glad_lazy_resolve("glBindTexture", (GLADlazyproc)glad_lazy_glBindTexture); if (glad_glBindTexture != glad_lazy_glBindTexture) glad_glBindTexture(target, texture); }
+static void APIENTRY glad_lazy_glBindVertexArray(GLuint array) { glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)glad_lazy_resolve("glBindVertexArray", (GLADlazyproc)glad_lazy_glBindVertexArray); if (glad_glBindVertexArray != glad_lazy_glBindVertexArray) glad_glBindVertexArray(array); }
+static void APIENTRY glad_lazy_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap) { glad_glBitmap = (PFNGLBITMAPPROC)glad_lazy_resolve("glBitmap", (GLADlazyproc)glad_lazy_glBitmap); if (glad_glBitmap != glad_lazy_glBitmap) glad_glBitmap(width, height, xorig, yorig, xmove, ymove, bitmap); }
+static void APIENTRY glad_lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { glad_glBlendColor = (PFNGLBLENDCOLORPROC)glad_lazy_resolve("glBlendColor", (GLADlazyproc)glad_lazy_glBlendColor); if (glad_glBlendColor != glad_lazy_glBlendColor) glad_glBlendColor(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glBlendEquation(GLenum mode) { glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)glad_lazy_resolve("glBlendEquation", (GLADlazyproc)glad_lazy_glBlendEquation); if (glad_glBlendEquation != glad_lazy_glBlendEquation) glad_glBlendEquation(mode); }
+static void APIENTRY glad_lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) { glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)glad_lazy_resolve("glBlendEquationSeparate", (GLADlazyproc)glad_lazy_glBlendEquationSeparate); if (glad_glBlendEquationSeparate != glad_lazy_glBlendEquationSeparate) glad_glBlendEquationSeparate(modeRGB, modeAlpha); }
+static void APIENTRY glad_lazy_glBlendFunc(GLenum sfactor, GLenum dfactor) { glad_glBlendFunc = (PFNGLBLENDFUNCPROC)glad_lazy_resolve("glBlendFunc", (GLADlazyproc)glad_lazy_glBlendFunc); if (glad_glBlendFunc != glad_lazy_glBlendFunc) glad_glBlendFunc(sfactor, dfactor); }
+static void APIENTRY glad_lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) { glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)glad_lazy_resolve("glBlendFuncSeparate", (GLADlazyproc)glad_lazy_glBlendFuncSeparate); if (glad_glBlendFuncSeparate != glad_lazy_glBlendFuncSeparate) glad_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha); }
+static void APIENTRY glad_lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) { glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)glad_lazy_resolve("glBlitFramebuffer", (GLADlazyproc)glad_lazy_glBlitFramebuffer); if (glad_glBlitFramebuffer != glad_lazy_glBlitFramebuffer) glad_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter); }
+static void APIENTRY glad_lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) { glad_glBufferData = (PFNGLBUFFERDATAPROC)glad_lazy_resolve("glBufferData", (GLADlazyproc)glad_lazy_glBufferData); if (glad_glBufferData != glad_lazy_glBufferData) glad_glBufferData(target, size, data, usage); }
+static void APIENTRY glad_lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) { glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)glad_lazy_resolve("glBufferSubData", (GLADlazyproc)glad_lazy_glBufferSubData); if (glad_glBufferSubData != glad_lazy_glBufferSubData) glad_glBufferSubData(target, offset, size, data); }
+static void APIENTRY glad_lazy_glCallList(GLuint list) { glad_glCallList = (PFNGLCALLLISTPROC)glad_lazy_resolve("glCallList", (GLADlazyproc)glad_lazy_glCallList); if (glad_glCallList != glad_lazy_glCallList) glad_glCallList(list); }
+static void APIENTRY glad_lazy_glCallLists(GLsizei n, GLenum type, const void *lists) { glad_glCallLists = (PFNGLCALLLISTSPROC)glad_lazy_resolve("glCallLists", (GLADlazyproc)glad_lazy_glCallLists); if (glad_glCallLists != glad_lazy_glCallLists) glad_glCallLists(n, type, lists); }
+static GLenum APIENTRY glad_lazy_glCheckFramebufferStatus(GLenum target) { glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)glad_lazy_resolve("glCheckFramebufferStatus", (GLADlazyproc)glad_lazy_glCheckFramebufferStatus); if (glad_glCheckFramebufferStatus == glad_lazy_glCheckFramebufferStatus) return (GLenum)0; return glad_glCheckFramebufferStatus(target); }
+static void APIENTRY glad_lazy_glClampColor(GLenum target, GLenum clamp) { glad_glClampColor = (PFNGLCLAMPCOLORPROC)glad_lazy_resolve("glClampColor", (GLADlazyproc)glad_lazy_glClampColor); if (glad_glClampColor != glad_lazy_glClampColor) glad_glClampColor(target, clamp); }
+static void APIENTRY glad_lazy_glClear(GLbitfield mask) { glad_glClear = (PFNGLCLEARPROC)glad_lazy_resolve("glClear", (GLADlazyproc)glad_lazy_glClear); if (glad_glClear != glad_lazy_glClear) glad_glClear(mask); }
+static void APIENTRY glad_lazy_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { glad_glClearAccum = (PFNGLCLEARACCUMPROC)glad_lazy_resolve("glClearAccum", (GLADlazyproc)glad_lazy_glClearAccum); if (glad_glClearAccum != glad_lazy_glClearAccum) glad_glClearAccum(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) { glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)glad_lazy_resolve("glClearBufferfi", (GLADlazyproc)glad_lazy_glClearBufferfi); if (glad_glClearBufferfi != glad_lazy_glClearBufferfi) glad_glClearBufferfi(buffer, drawbuffer, depth, stencil); }
+static void APIENTRY glad_lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) { glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)glad_lazy_resolve("glClearBufferfv", (GLADlazyproc)glad_lazy_glClearBufferfv); if (glad_glClearBufferfv != glad_lazy_glClearBufferfv) glad_glClearBufferfv(buffer, drawbuffer, value); }
+static void APIENTRY glad_lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) { glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)glad_lazy_resolve("glClearBufferiv", (GLADlazyproc)glad_lazy_glClearBufferiv); if (glad_glClearBufferiv != glad_lazy_glClearBufferiv) glad_glClearBufferiv(buffer, drawbuffer, value); }
+static void APIENTRY glad_lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) { glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)glad_lazy_resolve("glClearBufferuiv", (GLADlazyproc)glad_lazy_glClearBufferuiv); if (glad_glClearBufferuiv != glad_lazy_glClearBufferuiv) glad_glClearBufferuiv(buffer, drawbuffer, value); }
+static void APIENTRY glad_lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { glad_glClearColor = (PFNGLCLEARCOLORPROC)glad_lazy_resolve("glClearColor", (GLADlazyproc)glad_lazy_glClearColor); if (glad_glClearColor != glad_lazy_glClearColor) glad_glClearColor(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glClearDepth(GLdouble depth) { glad_glClearDepth = (PFNGLCLEARDEPTHPROC)glad_lazy_resolve("glClearDepth", (GLADlazyproc)glad_lazy_glClearDepth); if (glad_glClearDepth != glad_lazy_glClearDepth) glad_glClearDepth(depth); }
+static void APIENTRY glad_lazy_glClearIndex(GLfloat c) { glad_glClearIndex = (PFNGLCLEARINDEXPROC)glad_lazy_resolve("glClearIndex", (GLADlazyproc)glad_lazy_glClearIndex); if (glad_glClearIndex != glad_lazy_glClearIndex) glad_glClearIndex(c); }
+static void APIENTRY glad_lazy_glClearStencil(GLint s) { glad_glClearStencil = (PFNGLCLEARSTENCILPROC)glad_lazy_resolve("glClearStencil", (GLADlazyproc)glad_lazy_glClearStencil); if (glad_glClearStencil != glad_lazy_glClearStencil) glad_glClearStencil(s); }
+static void APIENTRY glad_lazy_glClientActiveTexture(GLenum texture) { glad_glClientActiveTexture = (PFNGLCLIENTACTIVETEXTUREPROC)glad_lazy_resolve("glClientActiveTexture", (GLADlazyproc)glad_lazy_glClientActiveTexture); if (glad_glClientActiveTexture != glad_lazy_glClientActiveTexture) glad_glClientActiveTexture(texture); }
+static GLenum APIENTRY glad_lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)glad_lazy_resolve("glClientWaitSync", (GLADlazyproc)glad_lazy_glClientWaitSync); if (glad_glClientWaitSync == glad_lazy_glClientWaitSync) return (GLenum)0; return glad_glClientWaitSync(sync, flags, timeout); }
+static void APIENTRY glad_lazy_glClipPlane(GLenum plane, const GLdouble *equation) { glad_glClipPlane = (PFNGLCLIPPLANEPROC)glad_lazy_resolve("glClipPlane", (GLADlazyproc)glad_lazy_glClipPlane); if (glad_glClipPlane != glad_lazy_glClipPlane) glad_glClipPlane(plane, equation); }
+static void APIENTRY glad_lazy_glColor3b(GLbyte red, GLbyte green, GLbyte blue) { glad_glColor3b = (PFNGLCOLOR3BPROC)glad_lazy_resolve("glColor3b", (GLADlazyproc)glad_lazy_glColor3b); if (glad_glColor3b != glad_lazy_glColor3b) glad_glColor3b(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3bv(const GLbyte *v) { glad_glColor3bv = (PFNGLCOLOR3BVPROC)glad_lazy_resolve("glColor3bv", (GLADlazyproc)glad_lazy_glColor3bv); if (glad_glColor3bv != glad_lazy_glColor3bv) glad_glColor3bv(v); }
+static void APIENTRY glad_lazy_glColor3d(GLdouble red, GLdouble green, GLdouble blue) { glad_glColor3d = (PFNGLCOLOR3DPROC)glad_lazy_resolve("glColor3d", (GLADlazyproc)glad_lazy_glColor3d); if (glad_glColor3d != glad_lazy_glColor3d) glad_glColor3d(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3dv(const GLdouble *v) { glad_glColor3dv = (PFNGLCOLOR3DVPROC)glad_lazy_resolve("glColor3dv", (GLADlazyproc)glad_lazy_glColor3dv); if (glad_glColor3dv != glad_lazy_glColor3dv) glad_glColor3dv(v); }
+static void APIENTRY glad_lazy_glColor3f(GLfloat red, GLfloat green, GLfloat blue) { glad_glColor3f = (PFNGLCOLOR3FPROC)glad_lazy_resolve("glColor3f", (GLADlazyproc)glad_lazy_glColor3f); if (glad_glColor3f != glad_lazy_glColor3f) glad_glColor3f(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3fv(const GLfloat *v) { glad_glColor3fv = (PFNGLCOLOR3FVPROC)glad_lazy_resolve("glColor3fv", (GLADlazyproc)glad_lazy_glColor3fv); if (glad_glColor3fv != glad_lazy_glColor3fv) glad_glColor3fv(v); }
+static void APIENTRY glad_lazy_glColor3i(GLint red, GLint green, GLint blue) { glad_glColor3i = (PFNGLCOLOR3IPROC)glad_lazy_resolve("glColor3i", (GLADlazyproc)glad_lazy_glColor3i); if (glad_glColor3i != glad_lazy_glColor3i) glad_glColor3i(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3iv(const GLint *v) { glad_glColor3iv = (PFNGLCOLOR3IVPROC)glad_lazy_resolve("glColor3iv", (GLADlazyproc)glad_lazy_glColor3iv); if (glad_glColor3iv != glad_lazy_glColor3iv) glad_glColor3iv(v); }
+static void APIENTRY glad_lazy_glColor3s(GLshort red, GLshort green, GLshort blue) { glad_glColor3s = (PFNGLCOLOR3SPROC)glad_lazy_resolve("glColor3s", (GLADlazyproc)glad_lazy_glColor3s); if (glad_glColor3s != glad_lazy_glColor3s) glad_glColor3s(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3sv(const GLshort *v) { glad_glColor3sv = (PFNGLCOLOR3SVPROC)glad_lazy_resolve("glColor3sv", (GLADlazyproc)glad_lazy_glColor3sv); if (glad_glColor3sv != glad_lazy_glColor3sv) glad_glColor3sv(v); }
+static void APIENTRY glad_lazy_glColor3ub(GLubyte red, GLubyte green, GLubyte blue) { glad_glColor3ub = (PFNGLCOLOR3UBPROC)glad_lazy_resolve("glColor3ub", (GLADlazyproc)glad_lazy_glColor3ub); if (glad_glColor3ub != glad_lazy_glColor3ub) glad_glColor3ub(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3ubv(const GLubyte *v) { glad_glColor3ubv = (PFNGLCOLOR3UBVPROC)glad_lazy_resolve("glColor3ubv", (GLADlazyproc)glad_lazy_glColor3ubv); if (glad_glColor3ubv != glad_lazy_glColor3ubv) glad_glColor3ubv(v); }
+static void APIENTRY glad_lazy_glColor3ui(GLuint red, GLuint green, GLuint blue) { glad_glColor3ui = (PFNGLCOLOR3UIPROC)glad_lazy_resolve("glColor3ui", (GLADlazyproc)glad_lazy_glColor3ui); if (glad_glColor3ui != glad_lazy_glColor3ui) glad_glColor3ui(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3uiv(const GLuint *v) { glad_glColor3uiv = (PFNGLCOLOR3UIVPROC)glad_lazy_resolve("glColor3uiv", (GLADlazyproc)glad_lazy_glColor3uiv); if (glad_glColor3uiv != glad_lazy_glColor3uiv) glad_glColor3uiv(v); }
+static void APIENTRY glad_lazy_glColor3us(GLushort red, GLushort green, GLushort blue) { glad_glColor3us = (PFNGLCOLOR3USPROC)glad_lazy_resolve("glColor3us", (GLADlazyproc)glad_lazy_glColor3us); if (glad_glColor3us != glad_lazy_glColor3us) glad_glColor3us(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3usv(const GLushort *v) { glad_glColor3usv = (PFNGLCOLOR3USVPROC)glad_lazy_resolve("glColor3usv", (GLADlazyproc)glad_lazy_glColor3usv); if (glad_glColor3usv != glad_lazy_glColor3usv) glad_glColor3usv(v); }
+static void APIENTRY glad_lazy_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha) { glad_glColor4b = (PFNGLCOLOR4BPROC)glad_lazy_resolve("glColor4b", (GLADlazyproc)glad_lazy_glColor4b); if (glad_glColor4b != glad_lazy_glColor4b) glad_glColor4b(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4bv(const GLbyte *v) { glad_glColor4bv = (PFNGLCOLOR4BVPROC)glad_lazy_resolve("glColor4bv", (GLADlazyproc)glad_lazy_glColor4bv); if (glad_glColor4bv != glad_lazy_glColor4bv) glad_glColor4bv(v); }
+static void APIENTRY glad_lazy_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha) { glad_glColor4d = (PFNGLCOLOR4DPROC)glad_lazy_resolve("glColor4d", (GLADlazyproc)glad_lazy_glColor4d); if (glad_glColor4d != glad_lazy_glColor4d) glad_glColor4d(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4dv(const GLdouble *v) { glad_glColor4dv = (PFNGLCOLOR4DVPROC)glad_lazy_resolve("glColor4dv", (GLADlazyproc)glad_lazy_glColor4dv); if (glad_glColor4dv != glad_lazy_glColor4dv) glad_glColor4dv(v); }
+static void APIENTRY glad_lazy_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { glad_glColor4f = (PFNGLCOLOR4FPROC)glad_lazy_resolve("glColor4f", (GLADlazyproc)glad_lazy_glColor4f); if (glad_glColor4f != glad_lazy_glColor4f) glad_glColor4f(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4fv(const GLfloat *v) { glad_glColor4fv = (PFNGLCOLOR4FVPROC)glad_lazy_resolve("glColor4fv", (GLADlazyproc)glad_lazy_glColor4fv); if (glad_glColor4fv != glad_lazy_glColor4fv) glad_glColor4fv(v); }
+static void APIENTRY glad_lazy_glColor4i(GLint red, GLint green, GLint blue, GLint alpha) { glad_glColor4i = (PFNGLCOLOR4IPROC)glad_lazy_resolve("glColor4i", (GLADlazyproc)glad_lazy_glColor4i); if (glad_glColor4i != glad_lazy_glColor4i) glad_glColor4i(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4iv(const GLint *v) { glad_glColor4iv = (PFNGLCOLOR4IVPROC)glad_lazy_resolve("glColor4iv", (GLADlazyproc)glad_lazy_glColor4iv); if (glad_glColor4iv != glad_lazy_glColor4iv) glad_glColor4iv(v); }
+static void APIENTRY glad_lazy_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha) { glad_glColor4s = (PFNGLCOLOR4SPROC)glad_lazy_resolve("glColor4s", (GLADlazyproc)glad_lazy_glColor4s); if (glad_glColor4s != glad_lazy_glColor4s) glad_glColor4s(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4sv(const GLshort *v) { glad_glColor4sv = (PFNGLCOLOR4SVPROC)glad_lazy_resolve("glColor4sv", (GLADlazyproc)glad_lazy_glColor4sv); if (glad_glColor4sv != glad_lazy_glColor4sv) glad_glColor4sv(v); }
+static void APIENTRY glad_lazy_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) { glad_glColor4ub = (PFNGLCOLOR4UBPROC)glad_lazy_resolve("glColor4ub", (GLADlazyproc)glad_lazy_glColor4ub); if (glad_glColor4ub != glad_lazy_glColor4ub) glad_glColor4ub(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4ubv(const GLubyte *v) { glad_glColor4ubv = (PFNGLCOLOR4UBVPROC)glad_lazy_resolve("glColor4ubv", (GLADlazyproc)glad_lazy_glColor4ubv); if (glad_glColor4ubv != glad_lazy_glColor4ubv) glad_glColor4ubv(v); }
+static void APIENTRY glad_lazy_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha) { glad_glColor4ui = (PFNGLCOLOR4UIPROC)glad_lazy_resolve("glColor4ui", (GLADlazyproc)glad_lazy_glColor4ui); if (glad_glColor4ui != glad_lazy_glColor4ui) glad_glColor4ui(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4uiv(const GLuint *v) { glad_glColor4uiv = (PFNGLCOLOR4UIVPROC)glad_lazy_resolve("glColor4uiv", (GLADlazyproc)glad_lazy_glColor4uiv); if (glad_glColor4uiv != glad_lazy_glColor4uiv) glad_glColor4uiv(v); }
+static void APIENTRY glad_lazy_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha) { glad_glColor4us = (PFNGLCOLOR4USPROC)glad_lazy_resolve("glColor4us", (GLADlazyproc)glad_lazy_glColor4us); if (glad_glColor4us != glad_lazy_glColor4us) glad_glColor4us(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4usv(const GLushort *v) { glad_glColor4usv = (PFNGLCOLOR4USVPROC)glad_lazy_resolve("glColor4usv", (GLADlazyproc)glad_lazy_glColor4usv); if (glad_glColor4usv != glad_lazy_glColor4usv) glad_glColor4usv(v); }
+static void APIENTRY glad_lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) { glad_glColorMask = (PFNGLCOLORMASKPROC)glad_lazy_resolve("glColorMask", (GLADlazyproc)glad_lazy_glColorMask); if (glad_glColorMask != glad_lazy_glColorMask) glad_glColorMask(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) { glad_glColorMaski = (PFNGLCOLORMASKIPROC)glad_lazy_resolve("glColorMaski", (GLADlazyproc)glad_lazy_glColorMaski); if (glad_glColorMaski != glad_lazy_glColorMaski) glad_glColorMaski(index, r, g, b, a); }
+static void APIENTRY glad_lazy_glColorMaterial(GLenum face, GLenum mode) { glad_glColorMaterial = (PFNGLCOLORMATERIALPROC)glad_lazy_resolve("glColorMaterial", (GLADlazyproc)glad_lazy_glColorMaterial); if (glad_glColorMaterial != glad_lazy_glColorMaterial) glad_glColorMaterial(face, mode); }
+static void APIENTRY glad_lazy_glColorP3ui(GLenum type, GLuint color) { glad_glColorP3ui = (PFNGLCOLORP3UIPROC)glad_lazy_resolve("glColorP3ui", (GLADlazyproc)glad_lazy_glColorP3ui); if (glad_glColorP3ui != glad_lazy_glColorP3ui) glad_glColorP3ui(type, color); }
+static void APIENTRY glad_lazy_glColorP3uiv(GLenum type, const GLuint *color) { glad_glColorP3uiv = (PFNGLCOLORP3UIVPROC)glad_lazy_resolve("glColorP3uiv", (GLADlazyproc)glad_lazy_glColorP3uiv); if (glad_glColorP3uiv != glad_lazy_glColorP3uiv) glad_glColorP3uiv(type, color); }
+static void APIENTRY glad_lazy_glColorP4ui(GLenum type, GLuint color) { glad_glColorP4ui = (PFNGLCOLORP4UIPROC)glad_lazy_resolve("glColorP4ui", (GLADlazyproc)glad_lazy_glColorP4ui); if (glad_glColorP4ui != glad_lazy_glColorP4ui) glad_glColorP4ui(type, color); }
+static void APIENTRY glad_lazy_glColorP4uiv(GLenum type, const GLuint *color) { glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)glad_lazy_resolve("glColorP4uiv", (GLADlazyproc)glad_lazy_glColorP4uiv); if (glad_glColorP4uiv != glad_lazy_glColorP4uiv) glad_glColorP4uiv(type, color); }
+static void APIENTRY glad_lazy_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) { glad_glColorPointer = (PFNGLCOLORPOINTERPROC)glad_lazy_resolve("glColorPointer", (GLADlazyproc)glad_lazy_glColorPointer); if (glad_glColorPointer != glad_lazy_glColorPointer) glad_glColorPointer(size, type, stride, pointer); }
+static void APIENTRY glad_lazy_glCompileShader(GLuint shader) { glad_glCompileShader = (PFNGLCOMPILESHADERPROC)glad_lazy_resolve("glCompileShader", (GLADlazyproc)glad_lazy_glCompileShader); if (glad_glCompileShader != glad_lazy_glCompileShader) glad_glCompileShader(shader); }
+static void APIENTRY glad_lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) { glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)glad_lazy_resolve("glCompressedTexImage1D", (GLADlazyproc)glad_lazy_glCompressedTexImage1D); if (glad_glCompressedTexImage1D != glad_lazy_glCompressedTexImage1D) glad_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data); }
+static void APIENTRY glad_lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) { glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)glad_lazy_resolve("glCompressedTexImage2D", (GLADlazyproc)glad_lazy_glCompressedTexImage2D); if (glad_glCompressedTexImage2D != glad_lazy_glCompressedTexImage2D) glad_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data); }
+static void APIENTRY glad_lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) { glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)glad_lazy_resolve("glCompressedTexImage3D", (GLADlazyproc)glad_lazy_glCompressedTexImage3D); if (glad_glCompressedTexImage3D != glad_lazy_glCompressedTexImage3D) glad_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data); }
+static void APIENTRY glad_lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) { glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)glad_lazy_resolve("glCompressedTexSubImage1D", (GLADlazyproc)glad_lazy_glCompressedTexSubImage1D); if (glad_glCompressedTexSubImage1D != glad_lazy_glCompressedTexSubImage1D) glad_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data); }
+static void APIENTRY glad_lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) { glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)glad_lazy_resolve("glCompressedTexSubImage2D", (GLADlazyproc)glad_lazy_glCompressedTexSubImage2D); if (glad_glCompressedTexSubImage2D != glad_lazy_glCompressedTexSubImage2D) glad_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data); }
+static void APIENTRY glad_lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) { glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)glad_lazy_resolve("glCompressedTexSubImage3D", (GLADlazyproc)glad_lazy_glCompressedTexSubImage3D); if (glad_glCompressedTexSubImage3D != glad_lazy_glCompressedTexSubImage3D) glad_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data); }
+static void APIENTRY glad_lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) { glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)glad_lazy_resolve("glCopyBufferSubData", (GLADlazyproc)glad_lazy_glCopyBufferSubData); if (glad_glCopyBufferSubData != glad_lazy_glCopyBufferSubData) glad_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size); }
+static void APIENTRY glad_lazy_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type) { glad_glCopyPixels = (PFNGLCOPYPIXELSPROC)glad_lazy_resolve("glCopyPixels", (GLADlazyproc)glad_lazy_glCopyPixels); if (glad_glCopyPixels != glad_lazy_glCopyPixels) glad_glCopyPixels(x, y, width, height, type); }
+static void APIENTRY glad_lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) { glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)glad_lazy_resolve("glCopyTexImage1D", (GLADlazyproc)glad_lazy_glCopyTexImage1D); if (glad_glCopyTexImage1D != glad_lazy_glCopyTexImage1D) glad_glCopyTexImage1D(target, level, internalformat, x, y, width, border); }
+static void APIENTRY glad_lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) { glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)glad_lazy_resolve("glCopyTexImage2D", (GLADlazyproc)glad_lazy_glCopyTexImage2D); if (glad_glCopyTexImage2D != glad_lazy_glCopyTexImage2D) glad_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border); }
+static void APIENTRY glad_lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) { glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)glad_lazy_resolve("glCopyTexSubImage1D", (GLADlazyproc)glad_lazy_glCopyTexSubImage1D); if (glad_glCopyTexSubImage1D != glad_lazy_glCopyTexSubImage1D) glad_glCopyTexSubImage1D(target, level, xoffset, x, y, width); }
+static void APIENTRY glad_lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) { glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)glad_lazy_resolve("glCopyTexSubImage2D", (GLADlazyproc)glad_lazy_glCopyTexSubImage2D); if (glad_glCopyTexSubImage2D != glad_lazy_glCopyTexSubImage2D) glad_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height); }
+static void APIENTRY glad_lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) { glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)glad_lazy_resolve("glCopyTexSubImage3D", (GLADlazyproc)glad_lazy_glCopyTexSubImage3D); if (glad_glCopyTexSubImage3D != glad_lazy_glCopyTexSubImage3D) glad_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height); }
+static GLuint APIENTRY glad_lazy_glCreateProgram(void) { glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC)glad_lazy_resolve("glCreateProgram", (GLADlazyproc)glad_lazy_glCreateProgram); if (glad_glCreateProgram == glad_lazy_glCreateProgram) return (GLuint)0; return glad_glCreateProgram(); }
+static GLuint APIENTRY glad_lazy_glCreateShader(GLenum type) { glad_glCreateShader = (PFNGLCREATESHADERPROC)glad_lazy_resolve("glCreateShader", (GLADlazyproc)glad_lazy_glCreateShader); if (glad_glCreateShader == glad_lazy_glCreateShader) return (GLuint)0; return glad_glCreateShader(type); }
+static void APIENTRY glad_lazy_glCullFace(GLenum mode) { glad_glCullFace = (PFNGLCULLFACEPROC)glad_lazy_resolve("glCullFace", (GLADlazyproc)glad_lazy_glCullFace); if (glad_glCullFace != glad_lazy_glCullFace) glad_glCullFace(mode); }
+static void APIENTRY glad_lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers) { glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)glad_lazy_resolve("glDeleteBuffers", (GLADlazyproc)glad_lazy_glDeleteBuffers); if (glad_glDeleteBuffers != glad_lazy_glDeleteBuffers) glad_glDeleteBuffers(n, buffers); }
+static void APIENTRY glad_lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) { glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)glad_lazy_resolve("glDeleteFramebuffers", (GLADlazyproc)glad_lazy_glDeleteFramebuffers); if (glad_glDeleteFramebuffers != glad_lazy_glDeleteFramebuffers) glad_glDeleteFramebuffers(n, framebuffers); }
+static void APIENTRY glad_lazy_glDeleteLists(GLuint list, GLsizei range) { glad_glDeleteLists = (PFNGLDELETELISTSPROC)glad_lazy_resolve("glDeleteLists", (GLADlazyproc)glad_lazy_glDeleteLists); if (glad_glDeleteLists != glad_lazy_glDeleteLists) glad_glDeleteLists(list, range); }
+static void APIENTRY glad_lazy_glDeleteProgram(GLuint program) { glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)glad_lazy_resolve("glDeleteProgram", (GLADlazyproc)glad_lazy_glDeleteProgram); if (glad_glDeleteProgram != glad_lazy_glDeleteProgram) glad_glDeleteProgram(program); }
+static void APIENTRY glad_lazy_glDeleteQueries(GLsizei n, const GLuint *ids) { glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)glad_lazy_resolve("glDeleteQueries", (GLADlazyproc)glad_lazy_glDeleteQueries); if (glad_glDeleteQueries != glad_lazy_glDeleteQueries) glad_glDeleteQueries(n, ids); }
+static void APIENTRY glad_lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) { glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)glad_lazy_resolve("glDeleteRenderbuffers", (GLADlazyproc)glad_lazy_glDeleteRenderbuffers); if (glad_glDeleteRenderbuffers != glad_lazy_glDeleteRenderbuffers) glad_glDeleteRenderbuffers(n, renderbuffers); }
+static void APIENTRY glad_lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers) { glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)glad_lazy_resolve("glDeleteSamplers", (GLADlazyproc)glad_lazy_glDeleteSamplers); if (glad_glDeleteSamplers != glad_lazy_glDeleteSamplers) glad_glDeleteSamplers(count, samplers); }
+static void APIENTRY glad_lazy_glDeleteShader(GLuint shader) { glad_glDeleteShader = (PFNGLDELETESHADERPROC)glad_lazy_resolve("glDeleteShader", (GLADlazyproc)glad_lazy_glDeleteShader); if (glad_glDeleteShader != glad_lazy_glDeleteShader) glad_glDeleteShader(shader); }
+static void APIENTRY glad_lazy_glDeleteSync(GLsync sync) { glad_glDeleteSync = (PFNGLDELETESYNCPROC)glad_lazy_resolve("glDeleteSync", (GLADlazyproc)glad_lazy_glDeleteSync); if (glad_glDeleteSync != glad_lazy_glDeleteSync) glad_glDeleteSync(sync); }
+static void APIENTRY glad_lazy_glDeleteTextures(GLsizei n, const GLuint *textures) { glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)glad_lazy_resolve("glDeleteTextures", (GLADlazyproc)glad_lazy_glDeleteTextures); if (glad_glDeleteTextures != glad_lazy_glDeleteTextures) glad_glDeleteTextures(n, textures); }
+static void APIENTRY glad_lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) { glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)glad_lazy_resolve("glDeleteVertexArrays", (GLADlazyproc)glad_lazy_glDeleteVertexArrays); if (glad_glDeleteVertexArrays != glad_lazy_glDeleteVertexArrays) glad_glDeleteVertexArrays(n, arrays); }
+static void APIENTRY glad_lazy_glDepthFunc(GLenum func) { glad_glDepthFunc = (PFNGLDEPTHFUNCPROC)glad_lazy_resolve("glDepthFunc", (GLADlazyproc)glad_lazy_glDepthFunc); if (glad_glDepthFunc != glad_lazy_glDepthFunc) glad_glDepthFunc(func); }
+static void APIENTRY glad_lazy_glDepthMask(GLboolean flag) { glad_glDepthMask = (PFNGLDEPTHMASKPROC)glad_lazy_resolve("glDepthMask", (GLADlazyproc)glad_lazy_glDepthMask); if (glad_glDepthMask != glad_lazy_glDepthMask) glad_glDepthMask(flag); }
+static void APIENTRY glad_lazy_glDepthRange(GLdouble n, GLdouble f) { glad_glDepthRange = (PFNGLDEPTHRANGEPROC)glad_lazy_resolve("glDepthRange", (GLADlazyproc)glad_lazy_glDepthRange); if (glad_glDepthRange != glad_lazy_glDepthRange) glad_glDepthRange(n, f); }
+static void APIENTRY glad_lazy_glDetachShader(GLuint program, GLuint shader) { glad_glDetachShader = (PFNGLDETACHSHADERPROC)glad_lazy_resolve("glDetachShader", (GLADlazyproc)glad_lazy_glDetachShader); if (glad_glDetachShader != glad_lazy_glDetachShader) glad_glDetachShader(program, shader); }
+static void APIENTRY glad_lazy_glDisable(GLenum cap) { glad_glDisable = (PFNGLDISABLEPROC)glad_lazy_resolve("glDisable", (GLADlazyproc)glad_lazy_glDisable); if (glad_glDisable != glad_lazy_glDisable) glad_glDisable(cap); }
+static void APIENTRY glad_lazy_glDisableClientState(GLenum array) { glad_glDisableClientState = (PFNGLDISABLECLIENTSTATEPROC)glad_lazy_resolve("glDisableClientState", (GLADlazyproc)glad_lazy_glDisableClientState); if (glad_glDisableClientState != glad_lazy_glDisableClientState) glad_glDisableClientState(array); }
+static void APIENTRY glad_lazy_glDisableVertexAttribArray(GLuint index) { glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)glad_lazy_resolve("glDisableVertexAttribArray", (GLADlazyproc)glad_lazy_glDisableVertexAttribArray); if (glad_glDisableVertexAttribArray != glad_lazy_glDisableVertexAttribArray) glad_glDisableVertexAttribArray(index); }
+static void APIENTRY glad_lazy_glDisablei(GLenum target, GLuint index) { glad_glDisablei = (PFNGLDISABLEIPROC)glad_lazy_resolve("glDisablei", (GLADlazyproc)glad_lazy_glDisablei); if (glad_glDisablei != glad_lazy_glDisablei) glad_glDisablei(target, index); }
+static void APIENTRY glad_lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count) { glad_glDrawArrays = (PFNGLDRAWARRAYSPROC)glad_lazy_resolve("glDrawArrays", (GLADlazyproc)glad_lazy_glDrawArrays); if (glad_glDrawArrays != glad_lazy_glDrawArrays) glad_glDrawArrays(mode, first, count); }
+static void APIENTRY glad_lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) { glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)glad_lazy_resolve("glDrawArraysInstanced", (GLADlazyproc)glad_lazy_glDrawArraysInstanced); if (glad_glDrawArraysInstanced != glad_lazy_glDrawArraysInstanced) glad_glDrawArraysInstanced(mode, first, count, instancecount); }
+static void APIENTRY glad_lazy_glDrawBuffer(GLenum buf) { glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC)glad_lazy_resolve("glDrawBuffer", (GLADlazyproc)glad_lazy_glDrawBuffer); if (glad_glDrawBuffer != glad_lazy_glDrawBuffer) glad_glDrawBuffer(buf); }
+static void APIENTRY glad_lazy_glDrawBuffers(GLsizei n, const GLenum *bufs) { glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)glad_lazy_resolve("glDrawBuffers", (GLADlazyproc)glad_lazy_glDrawBuffers); if (glad_glDrawBuffers != glad_lazy_glDrawBuffers) glad_glDrawBuffers(n, bufs); }
+static void APIENTRY glad_lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) { glad_glDrawElements = (PFNGLDRAWELEMENTSPROC)glad_lazy_resolve("glDrawElements", (GLADlazyproc)glad_lazy_glDrawElements); if (glad_glDrawElements != glad_lazy_glDrawElements) glad_glDrawElements(mode, count, type, indices); }
+static void APIENTRY glad_lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) { glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)glad_lazy_resolve("glDrawElementsBaseVertex", (GLADlazyproc)glad_lazy_glDrawElementsBaseVertex); if (glad_glDrawElementsBaseVertex != glad_lazy_glDrawElementsBaseVertex) glad_glDrawElementsBaseVertex(mode, count, type, indices, basevertex); }
+static void APIENTRY glad_lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) { glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)glad_lazy_resolve("glDrawElementsInstanced", (GLADlazyproc)glad_lazy_glDrawElementsInstanced); if (glad_glDrawElementsInstanced != glad_lazy_glDrawElementsInstanced) glad_glDrawElementsInstanced(mode, count, type, indices, instancecount); }
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) { glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)glad_lazy_resolve("glDrawElementsInstancedBaseVertex", (GLADlazyproc)glad_lazy_glDrawElementsInstancedBaseVertex); if (glad_glDrawElementsInstancedBaseVertex != glad_lazy_glDrawElementsInstancedBaseVertex) glad_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex); }
+static void APIENTRY glad_lazy_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) { glad_glDrawPixels = (PFNGLDRAWPIXELSPROC)glad_lazy_resolve("glDrawPixels", (GLADlazyproc)glad_lazy_glDrawPixels); if (glad_glDrawPixels != glad_lazy_glDrawPixels) glad_glDrawPixels(width, height, format, type, pixels); }
+static void APIENTRY glad_lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) { glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)glad_lazy_resolve("glDrawRangeElements", (GLADlazyproc)glad_lazy_glDrawRangeElements); if (glad_glDrawRangeElements != glad_lazy_glDrawRangeElements) glad_glDrawRangeElements(mode, start, end, count, type, indices); }
+static void APIENTRY glad_lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) { glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)glad_lazy_resolve("glDrawRangeElementsBaseVertex", (GLADlazyproc)glad_lazy_glDrawRangeElementsBaseVertex); if (glad_glDrawRangeElementsBaseVertex != glad_lazy_glDrawRangeElementsBaseVertex) glad_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex); }
+static void APIENTRY glad_lazy_glEdgeFlag(GLboolean flag) { glad_glEdgeFlag = (PFNGLEDGEFLAGPROC)glad_lazy_resolve("glEdgeFlag", (GLADlazyproc)glad_lazy_glEdgeFlag); if (glad_glEdgeFlag != glad_lazy_glEdgeFlag) glad_glEdgeFlag(flag); }
+static void APIENTRY glad_lazy_glEdgeFlagPointer(GLsizei stride, const void *pointer) { glad_glEdgeFlagPointer = (PFNGLEDGEFLAGPOINTERPROC)glad_lazy_resolve("glEdgeFlagPointer", (GLADlazyproc)glad_lazy_glEdgeFlagPointer); if (glad_glEdgeFlagPointer != glad_lazy_glEdgeFlagPointer) glad_glEdgeFlagPointer(stride, pointer); }
+static void APIENTRY glad_lazy_glEdgeFlagv(const GLboolean *flag) { glad_glEdgeFlagv = (PFNGLEDGEFLAGVPROC)glad_lazy_resolve("glEdgeFlagv", (GLADlazyproc)glad_lazy_glEdgeFlagv); if (glad_glEdgeFlagv != glad_lazy_glEdgeFlagv) glad_glEdgeFlagv(flag); }
+static void APIENTRY glad_lazy_glEnable(GLenum cap) { glad_glEnable = (PFNGLENABLEPROC)glad_lazy_resolve("glEnable", (GLADlazyproc)glad_lazy_glEnable); if (glad_glEnable != glad_lazy_glEnable) glad_glEnable(cap); }
+static void APIENTRY glad_lazy_glEnableClientState(GLenum array) { glad_glEnableClientState = (PFNGLENABLECLIENTSTATEPROC)glad_lazy_resolve("glEnableClientState", (GLADlazyproc)glad_lazy_glEnableClientState); if (glad_glEnableClientState != glad_lazy_glEnableClientState) glad_glEnableClientState(array); }
+static void APIENTRY glad_lazy_glEnableVertexAttribArray(GLuint index) { glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)glad_lazy_resolve("glEnableVertexAttribArray", (GLADlazyproc)glad_lazy_glEnableVertexAttribArray); if (glad_glEnableVertexAttribArray != glad_lazy_glEnableVertexAttribArray) glad_glEnableVertexAttribArray(index); }
+static void APIENTRY glad_lazy_glEnablei(GLenum target, GLuint index) { glad_glEnablei = (PFNGLENABLEIPROC)glad_lazy_resolve("glEnablei", (GLADlazyproc)glad_lazy_glEnablei); if (glad_glEnablei != glad_lazy_glEnablei) glad_glEnablei(target, index); }
+static void APIENTRY glad_lazy_glEnd(void) { glad_glEnd = (PFNGLENDPROC)glad_lazy_resolve("glEnd", (GLADlazyproc)glad_lazy_glEnd); if (glad_glEnd != glad_lazy_glEnd) glad_glEnd(); }
+static void APIENTRY glad_lazy_glEndConditionalRender(void) { glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)glad_lazy_resolve("glEndConditionalRender", (GLADlazyproc)glad_lazy_glEndConditionalRender); if (glad_glEndConditionalRender != glad_lazy_glEndConditionalRender) glad_glEndConditionalRender(); }
+static void APIENTRY glad_lazy_glEndList(void) { glad_glEndList = (PFNGLENDLISTPROC)glad_lazy_resolve("glEndList", (GLADlazyproc)glad_lazy_glEndList); if (glad_glEndList != glad_lazy_glEndList) glad_glEndList(); }
+static void APIENTRY glad_lazy_glEndQuery(GLenum target) { glad_glEndQuery = (PFNGLENDQUERYPROC)glad_lazy_resolve("glEndQuery", (GLADlazyproc)glad_lazy_glEndQuery); if (glad_glEndQuery != glad_lazy_glEndQuery) glad_glEndQuery(target); }
+static void APIENTRY glad_lazy_glEndTransformFeedback(void) { glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)glad_lazy_resolve("glEndTransformFeedback", (GLADlazyproc)glad_lazy_glEndTransformFeedback); if (glad_glEndTransformFeedback != glad_lazy_glEndTransformFeedback) glad_glEndTransformFeedback(); }
+static void APIENTRY glad_lazy_glEvalCoord1d(GLdouble u) { glad_glEvalCoord1d = (PFNGLEVALCOORD1DPROC)glad_lazy_resolve("glEvalCoord1d", (GLADlazyproc)glad_lazy_glEvalCoord1d); if (glad_glEvalCoord1d != glad_lazy_glEvalCoord1d) glad_glEvalCoord1d(u); }
+static void APIENTRY glad_lazy_glEvalCoord1dv(const GLdouble *u) { glad_glEvalCoord1dv = (PFNGLEVALCOORD1DVPROC)glad_lazy_resolve("glEvalCoord1dv", (GLADlazyproc)glad_lazy_glEvalCoord1dv); if (glad_glEvalCoord1dv != glad_lazy_glEvalCoord1dv) glad_glEvalCoord1dv(u); }
+static void APIENTRY glad_lazy_glEvalCoord1f(GLfloat u) { glad_glEvalCoord1f = (PFNGLEVALCOORD1FPROC)glad_lazy_resolve("glEvalCoord1f", (GLADlazyproc)glad_lazy_glEvalCoord1f); if (glad_glEvalCoord1f != glad_lazy_glEvalCoord1f) glad_glEvalCoord1f(u); }
+static void APIENTRY glad_lazy_glEvalCoord1fv(const GLfloat *u) { glad_glEvalCoord1fv = (PFNGLEVALCOORD1FVPROC)glad_lazy_resolve("glEvalCoord1fv", (GLADlazyproc)glad_lazy_glEvalCoord1fv); if (glad_glEvalCoord1fv != glad_lazy_glEvalCoord1fv) glad_glEvalCoord1fv(u); }
+static void APIENTRY glad_lazy_glEvalCoord2d(GLdouble u, GLdouble v) { glad_glEvalCoord2d = (PFNGLEVALCOORD2DPROC)glad_lazy_resolve("glEvalCoord2d", (GLADlazyproc)glad_lazy_glEvalCoord2d); if (glad_glEvalCoord2d != glad_lazy_glEvalCoord2d) glad_glEvalCoord2d(u, v); }
+static void APIENTRY glad_lazy_glEvalCoord2dv(const GLdouble *u) { glad_glEvalCoord2dv = (PFNGLEVALCOORD2DVPROC)glad_lazy_resolve("glEvalCoord2dv", (GLADlazyproc)glad_lazy_glEvalCoord2dv); if (glad_glEvalCoord2dv != glad_lazy_glEvalCoord2dv) glad_glEvalCoord2dv(u); }
+static void APIENTRY glad_lazy_glEvalCoord2f(GLfloat u, GLfloat v) { glad_glEvalCoord2f = (PFNGLEVALCOORD2FPROC)glad_lazy_resolve("glEvalCoord2f", (GLADlazyproc)glad_lazy_glEvalCoord2f); if (glad_glEvalCoord2f != glad_lazy_glEvalCoord2f) glad_glEvalCoord2f(u, v); }
+static void APIENTRY glad_lazy_glEvalCoord2fv(const GLfloat *u) { glad_glEvalCoord2fv = (PFNGLEVALCOORD2FVPROC)glad_lazy_resolve("glEvalCoord2fv", (GLADlazyproc)glad_lazy_glEvalCoord2fv); if (glad_glEvalCoord2fv != glad_lazy_glEvalCoord2fv) glad_glEvalCoord2fv(u); }
+static void APIENTRY glad_lazy_glEvalMesh1(GLenum mode, GLint i1, GLint i2) { glad_glEvalMesh1 = (PFNGLEVALMESH1PROC)glad_lazy_resolve("glEvalMesh1", (GLADlazyproc)glad_lazy_glEvalMesh1); if (glad_glEvalMesh1 != glad_lazy_glEvalMesh1) glad_glEvalMesh1(mode, i1, i2); }
+static void APIENTRY glad_lazy_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2) { glad_glEvalMesh2 = (PFNGLEVALMESH2PROC)glad_lazy_resolve("glEvalMesh2", (GLADlazyproc)glad_lazy_glEvalMesh2); if (glad_glEvalMesh2 != glad_lazy_glEvalMesh2) glad_glEvalMesh2(mode, i1, i2, j1, j2); }
+static void APIENTRY glad_lazy_glEvalPoint1(GLint i) { glad_glEvalPoint1 = (PFNGLEVALPOINT1PROC)glad_lazy_resolve("glEvalPoint1", (GLADlazyproc)glad_lazy_glEvalPoint1); if (glad_glEvalPoint1 != glad_lazy_glEvalPoint1) glad_glEvalPoint1(i); }
+static void APIENTRY glad_lazy_glEvalPoint2(GLint i, GLint j) { glad_glEvalPoint2 = (PFNGLEVALPOINT2PROC)glad_lazy_resolve("glEvalPoint2", (GLADlazyproc)glad_lazy_glEvalPoint2); if (glad_glEvalPoint2 != glad_lazy_glEvalPoint2) glad_glEvalPoint2(i, j); }
+static void APIENTRY glad_lazy_glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer) { glad_glFeedbackBuffer = (PFNGLFEEDBACKBUFFERPROC)glad_lazy_resolve("glFeedbackBuffer", (GLADlazyproc)glad_lazy_glFeedbackBuffer); if (glad_glFeedbackBuffer != glad_lazy_glFeedbackBuffer) glad_glFeedbackBuffer(size, type, buffer); }
+static GLsync APIENTRY glad_lazy_glFenceSync(GLenum condition, GLbitfield flags) { glad_glFenceSync = (PFNGLFENCESYNCPROC)glad_lazy_resolve("glFenceSync", (GLADlazyproc)glad_lazy_glFenceSync); if (glad_glFenceSync == glad_lazy_glFenceSync) return (GLsync)0; return glad_glFenceSync(condition, flags); }
+static void APIENTRY glad_lazy_glFinish(void) { glad_glFinish = (PFNGLFINISHPROC)glad_lazy_resolve("glFinish", (GLADlazyproc)glad_lazy_glFinish); if (glad_glFinish != glad_lazy_glFinish) glad_glFinish(); }
+static void APIENTRY glad_lazy_glFlush(void) { glad_glFlush = (PFNGLFLUSHPROC)glad_lazy_resolve("glFlush", (GLADlazyproc)glad_lazy_glFlush); if (glad_glFlush != glad_lazy_glFlush) glad_glFlush(); }
+static void APIENTRY glad_lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) { glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)glad_lazy_resolve("glFlushMappedBufferRange", (GLADlazyproc)glad_lazy_glFlushMappedBufferRange); if (glad_glFlushMappedBufferRange != glad_lazy_glFlushMappedBufferRange) glad_glFlushMappedBufferRange(target, offset, length); }
+static void APIENTRY glad_lazy_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer) { glad_glFogCoordPointer = (PFNGLFOGCOORDPOINTERPROC)glad_lazy_resolve("glFogCoordPointer", (GLADlazyproc)glad_lazy_glFogCoordPointer); if (glad_glFogCoordPointer != glad_lazy_glFogCoordPointer) glad_glFogCoordPointer(type, stride, pointer); }
+static void APIENTRY glad_lazy_glFogCoordd(GLdouble coord) { glad_glFogCoordd = (PFNGLFOGCOORDDPROC)glad_lazy_resolve("glFogCoordd", (GLADlazyproc)glad_lazy_glFogCoordd); if (glad_glFogCoordd != glad_lazy_glFogCoordd) glad_glFogCoordd(coord); }
+static void APIENTRY glad_lazy_glFogCoorddv(const GLdouble *coord) { glad_glFogCoorddv = (PFNGLFOGCOORDDVPROC)glad_lazy_resolve("glFogCoorddv", (GLADlazyproc)glad_lazy_glFogCoorddv); if (glad_glFogCoorddv != glad_lazy_glFogCoorddv) glad_glFogCoorddv(coord); }
+static void APIENTRY glad_lazy_glFogCoordf(GLfloat coord) { glad_glFogCoordf = (PFNGLFOGCOORDFPROC)glad_lazy_resolve("glFogCoordf", (GLADlazyproc)glad_lazy_glFogCoordf); if (glad_glFogCoordf != glad_lazy_glFogCoordf) glad_glFogCoordf(coord); }
+static void APIENTRY glad_lazy_glFogCoordfv(const GLfloat *coord) { glad_glFogCoordfv = (PFNGLFOGCOORDFVPROC)glad_lazy_resolve("glFogCoordfv", (GLADlazyproc)glad_lazy_glFogCoordfv); if (glad_glFogCoordfv != glad_lazy_glFogCoordfv) glad_glFogCoordfv(coord); }
+static void APIENTRY glad_lazy_glFogf(GLenum pname, GLfloat param) { glad_glFogf = (PFNGLFOGFPROC)glad_lazy_resolve("glFogf", (GLADlazyproc)glad_lazy_glFogf); if (glad_glFogf != glad_lazy_glFogf) glad_glFogf(pname, param); }
+static void APIENTRY glad_lazy_glFogfv(GLenum pname, const GLfloat *params) { glad_glFogfv = (PFNGLFOGFVPROC)glad_lazy_resolve("glFogfv", (GLADlazyproc)glad_lazy_glFogfv); if (glad_glFogfv != glad_lazy_glFogfv) glad_glFogfv(pname, params); }
+static void APIENTRY glad_lazy_glFogi(GLenum pname, GLint param) { glad_glFogi = (PFNGLFOGIPROC)glad_lazy_resolve("glFogi", (GLADlazyproc)glad_lazy_glFogi); if (glad_glFogi != glad_lazy_glFogi) glad_glFogi(pname, param); }
+static void APIENTRY glad_lazy_glFogiv(GLenum pname, const GLint *params) { glad_glFogiv = (PFNGLFOGIVPROC)glad_lazy_resolve("glFogiv", (GLADlazyproc)glad_lazy_glFogiv); if (glad_glFogiv != glad_lazy_glFogiv) glad_glFogiv(pname, params); }
+static void APIENTRY glad_lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)glad_lazy_resolve("glFramebufferRenderbuffer", (GLADlazyproc)glad_lazy_glFramebufferRenderbuffer); if (glad_glFramebufferRenderbuffer != glad_lazy_glFramebufferRenderbuffer) glad_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer); }
+static void APIENTRY glad_lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) { glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)glad_lazy_resolve("glFramebufferTexture", (GLADlazyproc)glad_lazy_glFramebufferTexture); if (glad_glFramebufferTexture != glad_lazy_glFramebufferTexture) glad_glFramebufferTexture(target, attachment, texture, level); }
+static void APIENTRY glad_lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)glad_lazy_resolve("glFramebufferTexture1D", (GLADlazyproc)glad_lazy_glFramebufferTexture1D); if (glad_glFramebufferTexture1D != glad_lazy_glFramebufferTexture1D) glad_glFramebufferTexture1D(target, attachment, textarget, texture, level); }
+static void APIENTRY glad_lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)glad_lazy_resolve("glFramebufferTexture2D", (GLADlazyproc)glad_lazy_glFramebufferTexture2D); if (glad_glFramebufferTexture2D != glad_lazy_glFramebufferTexture2D) glad_glFramebufferTexture2D(target, attachment, textarget, texture, level); }
+static void APIENTRY glad_lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) { glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)glad_lazy_resolve("glFramebufferTexture3D", (GLADlazyproc)glad_lazy_glFramebufferTexture3D); if (glad_glFramebufferTexture3D != glad_lazy_glFramebufferTexture3D) glad_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset); }
+static void APIENTRY glad_lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) { glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)glad_lazy_resolve("glFramebufferTextureLayer", (GLADlazyproc)glad_lazy_glFramebufferTextureLayer); if (glad_glFramebufferTextureLayer != glad_lazy_glFramebufferTextureLayer) glad_glFramebufferTextureLayer(target, attachment, texture, level, layer); }
+static void APIENTRY glad_lazy_glFrontFace(GLenum mode) { glad_glFrontFace = (PFNGLFRONTFACEPROC)glad_lazy_resolve("glFrontFace", (GLADlazyproc)glad_lazy_glFrontFace); if (glad_glFrontFace != glad_lazy_glFrontFace) glad_glFrontFace(mode); }
+static void APIENTRY glad_lazy_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) { glad_glFrustum = (PFNGLFRUSTUMPROC)glad_lazy_resolve("glFrustum", (GLADlazyproc)glad_lazy_glFrustum); if (glad_glFrustum != glad_lazy_glFrustum) glad_glFrustum(left, right, bottom, top, zNear, zFar); }
+static void APIENTRY glad_lazy_glGenBuffers(GLsizei n, GLuint *buffers) { glad_glGenBuffers = (PFNGLGENBUFFERSPROC)glad_lazy_resolve("glGenBuffers", (GLADlazyproc)glad_lazy_glGenBuffers); if (glad_glGenBuffers != glad_lazy_glGenBuffers) glad_glGenBuffers(n, buffers); }
+static void APIENTRY glad_lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers) { glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)glad_lazy_resolve("glGenFramebuffers", (GLADlazyproc)glad_lazy_glGenFramebuffers); if (glad_glGenFramebuffers != glad_lazy_glGenFramebuffers) glad_glGenFramebuffers(n, framebuffers); }
+static GLuint APIENTRY glad_lazy_glGenLists(GLsizei range) { glad_glGenLists = (PFNGLGENLISTSPROC)glad_lazy_resolve("glGenLists", (GLADlazyproc)glad_lazy_glGenLists); if (glad_glGenLists == glad_lazy_glGenLists) return (GLuint)0; return glad_glGenLists(range); }
+static void APIENTRY glad_lazy_glGenQueries(GLsizei n, GLuint *ids) { glad_glGenQueries = (PFNGLGENQUERIESPROC)glad_lazy_resolve("glGenQueries", (GLADlazyproc)glad_lazy_glGenQueries); if (glad_glGenQueries != glad_lazy_glGenQueries) glad_glGenQueries(n, ids); }
+static void APIENTRY glad_lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) { glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)glad_lazy_resolve("glGenRenderbuffers", (GLADlazyproc)glad_lazy_glGenRenderbuffers); if (glad_glGenRenderbuffers != glad_lazy_glGenRenderbuffers) glad_glGenRenderbuffers(n, renderbuffers); }
+static void APIENTRY glad_lazy_glGenSamplers(GLsizei count, GLuint *samplers) { glad_glGenSamplers = (PFNGLGENSAMPLERSPROC)glad_lazy_resolve("glGenSamplers", (GLADlazyproc)glad_lazy_glGenSamplers); if (glad_glGenSamplers != glad_lazy_glGenSamplers) glad_glGenSamplers(count, samplers); }
+static void APIENTRY glad_lazy_glGenTextures(GLsizei n, GLuint *textures) { glad_glGenTextures = (PFNGLGENTEXTURESPROC)glad_lazy_resolve("glGenTextures", (GLADlazyproc)glad_lazy_glGenTextures); if (glad_glGenTextures != glad_lazy_glGenTextures) glad_glGenTextures(n, textures); }
+static void APIENTRY glad_lazy_glGenVertexArrays(GLsizei n, GLuint *arrays) { glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)glad_lazy_resolve("glGenVertexArrays", (GLADlazyproc)glad_lazy_glGenVertexArrays); if (glad_glGenVertexArrays != glad_lazy_glGenVertexArrays) glad_glGenVertexArrays(n, arrays); }
+static void APIENTRY glad_lazy_glGenerateMipmap(GLenum target) { glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)glad_lazy_resolve("glGenerateMipmap", (GLADlazyproc)glad_lazy_glGenerateMipmap); if (glad_glGenerateMipmap != glad_lazy_glGenerateMipmap) glad_glGenerateMipmap(target); }
+static void APIENTRY glad_lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)glad_lazy_resolve("glGetActiveAttrib", (GLADlazyproc)glad_lazy_glGetActiveAttrib); if (glad_glGetActiveAttrib != glad_lazy_glGetActiveAttrib) glad_glGetActiveAttrib(program, index, bufSize, length, size, type, name); }
+static void APIENTRY glad_lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)glad_lazy_resolve("glGetActiveUniform", (GLADlazyproc)glad_lazy_glGetActiveUniform); if (glad_glGetActiveUniform != glad_lazy_glGetActiveUniform) glad_glGetActiveUniform(program, index, bufSize, length, size, type, name); }
+static void APIENTRY glad_lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) { glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)glad_lazy_resolve("glGetActiveUniformBlockName", (GLADlazyproc)glad_lazy_glGetActiveUniformBlockName); if (glad_glGetActiveUniformBlockName != glad_lazy_glGetActiveUniformBlockName) glad_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName); }
+static void APIENTRY glad_lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) { glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)glad_lazy_resolve("glGetActiveUniformBlockiv", (GLADlazyproc)glad_lazy_glGetActiveUniformBlockiv); if (glad_glGetActiveUniformBlockiv != glad_lazy_glGetActiveUniformBlockiv) glad_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params); }
+static void APIENTRY glad_lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) { glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)glad_lazy_resolve("glGetActiveUniformName", (GLADlazyproc)glad_lazy_glGetActiveUniformName); if (glad_glGetActiveUniformName != glad_lazy_glGetActiveUniformName) glad_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName); }
+static void APIENTRY glad_lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) { glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)glad_lazy_resolve("glGetActiveUniformsiv", (GLADlazyproc)glad_lazy_glGetActiveUniformsiv); if (glad_glGetActiveUniformsiv != glad_lazy_glGetActiveUniformsiv) glad_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params); }
+static void APIENTRY glad_lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) { glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)glad_lazy_resolve("glGetAttachedShaders", (GLADlazyproc)glad_lazy_glGetAttachedShaders); if (glad_glGetAttachedShaders != glad_lazy_glGetAttachedShaders) glad_glGetAttachedShaders(program, maxCount, count, shaders); }
+static GLint APIENTRY glad_lazy_glGetAttribLocation(GLuint program, const GLchar *name) { glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)glad_lazy_resolve("glGetAttribLocation", (GLADlazyproc)glad_lazy_glGetAttribLocation); if (glad_glGetAttribLocation == glad_lazy_glGetAttribLocation) return (GLint)0; return glad_glGetAttribLocation(program, name); }
+static void APIENTRY glad_lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) { glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)glad_lazy_resolve("glGetBooleani_v", (GLADlazyproc)glad_lazy_glGetBooleani_v); if (glad_glGetBooleani_v != glad_lazy_glGetBooleani_v) glad_glGetBooleani_v(target, index, data); }
+static void APIENTRY glad_lazy_glGetBooleanv(GLenum pname, GLboolean *data) { glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC)glad_lazy_resolve("glGetBooleanv", (GLADlazyproc)glad_lazy_glGetBooleanv); if (glad_glGetBooleanv != glad_lazy_glGetBooleanv) glad_glGetBooleanv(pname, data); }
+static void APIENTRY glad_lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) { glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)glad_lazy_resolve("glGetBufferParameteri64v", (GLADlazyproc)glad_lazy_glGetBufferParameteri64v); if (glad_glGetBufferParameteri64v != glad_lazy_glGetBufferParameteri64v) glad_glGetBufferParameteri64v(target, pname, params); }
+static void APIENTRY glad_lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) { glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)glad_lazy_resolve("glGetBufferParameteriv", (GLADlazyproc)glad_lazy_glGetBufferParameteriv); if (glad_glGetBufferParameteriv != glad_lazy_glGetBufferParameteriv) glad_glGetBufferParameteriv(target, pname, params); }
+static void APIENTRY glad_lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params) { glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)glad_lazy_resolve("glGetBufferPointerv", (GLADlazyproc)glad_lazy_glGetBufferPointerv); if (glad_glGetBufferPointerv != glad_lazy_glGetBufferPointerv) glad_glGetBufferPointerv(target, pname, params); }
+static void APIENTRY glad_lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) { glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)glad_lazy_resolve("glGetBufferSubData", (GLADlazyproc)glad_lazy_glGetBufferSubData); if (glad_glGetBufferSubData != glad_lazy_glGetBufferSubData) glad_glGetBufferSubData(target, offset, size, data); }
+static void APIENTRY glad_lazy_glGetClipPlane(GLenum plane, GLdouble *equation) { glad_glGetClipPlane = (PFNGLGETCLIPPLANEPROC)glad_lazy_resolve("glGetClipPlane", (GLADlazyproc)glad_lazy_glGetClipPlane); if (glad_glGetClipPlane != glad_lazy_glGetClipPlane) glad_glGetClipPlane(plane, equation); }
+static void APIENTRY glad_lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img) { glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)glad_lazy_resolve("glGetCompressedTexImage", (GLADlazyproc)glad_lazy_glGetCompressedTexImage); if (glad_glGetCompressedTexImage != glad_lazy_glGetCompressedTexImage) glad_glGetCompressedTexImage(target, level, img); }
+static void APIENTRY glad_lazy_glGetDoublev(GLenum pname, GLdouble *data) { glad_glGetDoublev = (PFNGLGETDOUBLEVPROC)glad_lazy_resolve("glGetDoublev", (GLADlazyproc)glad_lazy_glGetDoublev); if (glad_glGetDoublev != glad_lazy_glGetDoublev) glad_glGetDoublev(pname, data); }
+static GLenum APIENTRY glad_lazy_glGetError(void) { glad_glGetError = (PFNGLGETERRORPROC)glad_lazy_resolve("glGetError", (GLADlazyproc)glad_lazy_glGetError); if (glad_glGetError == glad_lazy_glGetError) return (GLenum)0; return glad_glGetError(); }
+static void APIENTRY glad_lazy_glGetFloatv(GLenum pname, GLfloat *data) { glad_glGetFloatv = (PFNGLGETFLOATVPROC)glad_lazy_resolve("glGetFloatv", (GLADlazyproc)glad_lazy_glGetFloatv); if (glad_glGetFloatv != glad_lazy_glGetFloatv) glad_glGetFloatv(pname, data); }
+static GLint APIENTRY glad_lazy_glGetFragDataIndex(GLuint program, const GLchar *name) { glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)glad_lazy_resolve("glGetFragDataIndex", (GLADlazyproc)glad_lazy_glGetFragDataIndex); if (glad_glGetFragDataIndex == glad_lazy_glGetFragDataIndex) return (GLint)0; return glad_glGetFragDataIndex(program, name); }
+static GLint APIENTRY glad_lazy_glGetFragDataLocation(GLuint program, const GLchar *name) { glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)glad_lazy_resolve("glGetFragDataLocation", (GLADlazyproc)glad_lazy_glGetFragDataLocation); if (glad_glGetFragDataLocation == glad_lazy_glGetFragDataLocation) return (GLint)0; return glad_glGetFragDataLocation(program, name); }
+static void APIENTRY glad_lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) { glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_lazy_resolve("glGetFramebufferAttachmentParameteriv", (GLADlazyproc)glad_lazy_glGetFramebufferAttachmentParameteriv); if (glad_glGetFramebufferAttachmentParameteriv != glad_lazy_glGetFramebufferAttachmentParameteriv) glad_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params); }
+static void APIENTRY glad_lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) { glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)glad_lazy_resolve("glGetInteger64i_v", (GLADlazyproc)glad_lazy_glGetInteger64i_v); if (glad_glGetInteger64i_v != glad_lazy_glGetInteger64i_v) glad_glGetInteger64i_v(target, index, data); }
+static void APIENTRY glad_lazy_glGetInteger64v(GLenum pname, GLint64 *data) { glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC)glad_lazy_resolve("glGetInteger64v", (GLADlazyproc)glad_lazy_glGetInteger64v); if (glad_glGetInteger64v != glad_lazy_glGetInteger64v) glad_glGetInteger64v(pname, data); }
+static void APIENTRY glad_lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) { glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)glad_lazy_resolve("glGetIntegeri_v", (GLADlazyproc)glad_lazy_glGetIntegeri_v); if (glad_glGetIntegeri_v != glad_lazy_glGetIntegeri_v) glad_glGetIntegeri_v(target, index, data); }
+static void APIENTRY glad_lazy_glGetIntegerv(GLenum pname, GLint *data) { glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)glad_lazy_resolve("glGetIntegerv", (GLADlazyproc)glad_lazy_glGetIntegerv); if (glad_glGetIntegerv != glad_lazy_glGetIntegerv) glad_glGetIntegerv(pname, data); }
+static void APIENTRY glad_lazy_glGetLightfv(GLenum light, GLenum pname, GLfloat *params) { glad_glGetLightfv = (PFNGLGETLIGHTFVPROC)glad_lazy_resolve("glGetLightfv", (GLADlazyproc)glad_lazy_glGetLightfv); if (glad_glGetLightfv != glad_lazy_glGetLightfv) glad_glGetLightfv(light, pname, params); }
+static void APIENTRY glad_lazy_glGetLightiv(GLenum light, GLenum pname, GLint *params) { glad_glGetLightiv = (PFNGLGETLIGHTIVPROC)glad_lazy_resolve("glGetLightiv", (GLADlazyproc)glad_lazy_glGetLightiv); if (glad_glGetLightiv != glad_lazy_glGetLightiv) glad_glGetLightiv(light, pname, params); }
+static void APIENTRY glad_lazy_glGetMapdv(GLenum target, GLenum query, GLdouble *v) { glad_glGetMapdv = (PFNGLGETMAPDVPROC)glad_lazy_resolve("glGetMapdv", (GLADlazyproc)glad_lazy_glGetMapdv); if (glad_glGetMapdv != glad_lazy_glGetMapdv) glad_glGetMapdv(target, query, v); }
+static void APIENTRY glad_lazy_glGetMapfv(GLenum target, GLenum query, GLfloat *v) { glad_glGetMapfv = (PFNGLGETMAPFVPROC)glad_lazy_resolve("glGetMapfv", (GLADlazyproc)glad_lazy_glGetMapfv); if (glad_glGetMapfv != glad_lazy_glGetMapfv) glad_glGetMapfv(target, query, v); }
+static void APIENTRY glad_lazy_glGetMapiv(GLenum target, GLenum query, GLint *v) { glad_glGetMapiv = (PFNGLGETMAPIVPROC)glad_lazy_resolve("glGetMapiv", (GLADlazyproc)glad_lazy_glGetMapiv); if (glad_glGetMapiv != glad_lazy_glGetMapiv) glad_glGetMapiv(target, query, v); }
+static void APIENTRY glad_lazy_glGetMaterialfv(GLenum face, GLenum pname, GLfloat *params) { glad_glGetMaterialfv = (PFNGLGETMATERIALFVPROC)glad_lazy_resolve("glGetMaterialfv", (GLADlazyproc)glad_lazy_glGetMaterialfv); if (glad_glGetMaterialfv != glad_lazy_glGetMaterialfv) glad_glGetMaterialfv(face, pname, params); }
+static void APIENTRY glad_lazy_glGetMaterialiv(GLenum face, GLenum pname, GLint *params) { glad_glGetMaterialiv = (PFNGLGETMATERIALIVPROC)glad_lazy_resolve("glGetMaterialiv", (GLADlazyproc)glad_lazy_glGetMaterialiv); if (glad_glGetMaterialiv != glad_lazy_glGetMaterialiv) glad_glGetMaterialiv(face, pname, params); }
+static void APIENTRY glad_lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) { glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)glad_lazy_resolve("glGetMultisamplefv", (GLADlazyproc)glad_lazy_glGetMultisamplefv); if (glad_glGetMultisamplefv != glad_lazy_glGetMultisamplefv) glad_glGetMultisamplefv(pname, index, val); }
+static void APIENTRY glad_lazy_glGetPixelMapfv(GLenum map, GLfloat *values) { glad_glGetPixelMapfv = (PFNGLGETPIXELMAPFVPROC)glad_lazy_resolve("glGetPixelMapfv", (GLADlazyproc)glad_lazy_glGetPixelMapfv); if (glad_glGetPixelMapfv != glad_lazy_glGetPixelMapfv) glad_glGetPixelMapfv(map, values); }
+static void APIENTRY glad_lazy_glGetPixelMapuiv(GLenum map, GLuint *values) { glad_glGetPixelMapuiv = (PFNGLGETPIXELMAPUIVPROC)glad_lazy_resolve("glGetPixelMapuiv", (GLADlazyproc)glad_lazy_glGetPixelMapuiv); if (glad_glGetPixelMapuiv != glad_lazy_glGetPixelMapuiv) glad_glGetPixelMapuiv(map, values); }
+static void APIENTRY glad_lazy_glGetPixelMapusv(GLenum map, GLushort *values) { glad_glGetPixelMapusv = (PFNGLGETPIXELMAPUSVPROC)glad_lazy_resolve("glGetPixelMapusv", (GLADlazyproc)glad_lazy_glGetPixelMapusv); if (glad_glGetPixelMapusv != glad_lazy_glGetPixelMapusv) glad_glGetPixelMapusv(map, values); }
+static void APIENTRY glad_lazy_glGetPointerv(GLenum pname, void **params) { glad_glGetPointerv = (PFNGLGETPOINTERVPROC)glad_lazy_resolve("glGetPointerv", (GLADlazyproc)glad_lazy_glGetPointerv); if (glad_glGetPointerv != glad_lazy_glGetPointerv) glad_glGetPointerv(pname, params); }
+static void APIENTRY glad_lazy_glGetPolygonStipple(GLubyte *mask) { glad_glGetPolygonStipple = (PFNGLGETPOLYGONSTIPPLEPROC)glad_lazy_resolve("glGetPolygonStipple", (GLADlazyproc)glad_lazy_glGetPolygonStipple); if (glad_glGetPolygonStipple != glad_lazy_glGetPolygonStipple) glad_glGetPolygonStipple(mask); }
+static void APIENTRY glad_lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)glad_lazy_resolve("glGetProgramInfoLog", (GLADlazyproc)glad_lazy_glGetProgramInfoLog); if (glad_glGetProgramInfoLog != glad_lazy_glGetProgramInfoLog) glad_glGetProgramInfoLog(program, bufSize, length, infoLog); }
+static void APIENTRY glad_lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params) { glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC)glad_lazy_resolve("glGetProgramiv", (GLADlazyproc)glad_lazy_glGetProgramiv); if (glad_glGetProgramiv != glad_lazy_glGetProgramiv) glad_glGetProgramiv(program, pname, params); }
+static void APIENTRY glad_lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) { glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)glad_lazy_resolve("glGetQueryObjecti64v", (GLADlazyproc)glad_lazy_glGetQueryObjecti64v); if (glad_glGetQueryObjecti64v != glad_lazy_glGetQueryObjecti64v) glad_glGetQueryObjecti64v(id, pname, params); }
+static void APIENTRY glad_lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) { glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)glad_lazy_resolve("glGetQueryObjectiv", (GLADlazyproc)glad_lazy_glGetQueryObjectiv); if (glad_glGetQueryObjectiv != glad_lazy_glGetQueryObjectiv) glad_glGetQueryObjectiv(id, pname, params); }
+static void APIENTRY glad_lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) { glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)glad_lazy_resolve("glGetQueryObjectui64v", (GLADlazyproc)glad_lazy_glGetQueryObjectui64v); if (glad_glGetQueryObjectui64v != glad_lazy_glGetQueryObjectui64v) glad_glGetQueryObjectui64v(id, pname, params); }
+static void APIENTRY glad_lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) { glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)glad_lazy_resolve("glGetQueryObjectuiv", (GLADlazyproc)glad_lazy_glGetQueryObjectuiv); if (glad_glGetQueryObjectuiv != glad_lazy_glGetQueryObjectuiv) glad_glGetQueryObjectuiv(id, pname, params); }
+static void APIENTRY glad_lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params) { glad_glGetQueryiv = (PFNGLGETQUERYIVPROC)glad_lazy_resolve("glGetQueryiv", (GLADlazyproc)glad_lazy_glGetQueryiv); if (glad_glGetQueryiv != glad_lazy_glGetQueryiv) glad_glGetQueryiv(target, pname, params); }
+static void APIENTRY glad_lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) { glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)glad_lazy_resolve("glGetRenderbufferParameteriv", (GLADlazyproc)glad_lazy_glGetRenderbufferParameteriv); if (glad_glGetRenderbufferParameteriv != glad_lazy_glGetRenderbufferParameteriv) glad_glGetRenderbufferParameteriv(target, pname, params); }
+static void APIENTRY glad_lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) { glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)glad_lazy_resolve("glGetSamplerParameterIiv", (GLADlazyproc)glad_lazy_glGetSamplerParameterIiv); if (glad_glGetSamplerParameterIiv != glad_lazy_glGetSamplerParameterIiv) glad_glGetSamplerParameterIiv(sampler, pname, params); }
+static void APIENTRY glad_lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) { glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)glad_lazy_resolve("glGetSamplerParameterIuiv", (GLADlazyproc)glad_lazy_glGetSamplerParameterIuiv); if (glad_glGetSamplerParameterIuiv != glad_lazy_glGetSamplerParameterIuiv) glad_glGetSamplerParameterIuiv(sampler, pname, params); }
+static void APIENTRY glad_lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) { glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)glad_lazy_resolve("glGetSamplerParameterfv", (GLADlazyproc)glad_lazy_glGetSamplerParameterfv); if (glad_glGetSamplerParameterfv != glad_lazy_glGetSamplerParameterfv) glad_glGetSamplerParameterfv(sampler, pname, params); }
+static void APIENTRY glad_lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) { glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)glad_lazy_resolve("glGetSamplerParameteriv", (GLADlazyproc)glad_lazy_glGetSamplerParameteriv); if (glad_glGetSamplerParameteriv != glad_lazy_glGetSamplerParameteriv) glad_glGetSamplerParameteriv(sampler, pname, params); }
+static void APIENTRY glad_lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)glad_lazy_resolve("glGetShaderInfoLog", (GLADlazyproc)glad_lazy_glGetShaderInfoLog); if (glad_glGetShaderInfoLog != glad_lazy_glGetShaderInfoLog) glad_glGetShaderInfoLog(shader, bufSize, length, infoLog); }
+static void APIENTRY glad_lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) { glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)glad_lazy_resolve("glGetShaderSource", (GLADlazyproc)glad_lazy_glGetShaderSource); if (glad_glGetShaderSource != glad_lazy_glGetShaderSource) glad_glGetShaderSource(shader, bufSize, length, source); }
+static void APIENTRY glad_lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) { glad_glGetShaderiv = (PFNGLGETSHADERIVPROC)glad_lazy_resolve("glGetShaderiv", (GLADlazyproc)glad_lazy_glGetShaderiv); if (glad_glGetShaderiv != glad_lazy_glGetShaderiv) glad_glGetShaderiv(shader, pname, params); }
+static const GLubyte *APIENTRY glad_lazy_glGetString(GLenum name) { glad_glGetString = (PFNGLGETSTRINGPROC)glad_lazy_resolve("glGetString", (GLADlazyproc)glad_lazy_glGetString); if (glad_glGetString == glad_lazy_glGetString) return (const GLubyte *)0; return glad_glGetString(name); }
+static const GLubyte *APIENTRY glad_lazy_glGetStringi(GLenum name, GLuint index) { glad_glGetStringi = (PFNGLGETSTRINGIPROC)glad_lazy_resolve("glGetStringi", (GLADlazyproc)glad_lazy_glGetStringi); if (glad_glGetStringi == glad_lazy_glGetStringi) return (const GLubyte *)0; return glad_glGetStringi(name, index); }
+static void APIENTRY glad_lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) { glad_glGetSynciv = (PFNGLGETSYNCIVPROC)glad_lazy_resolve("glGetSynciv", (GLADlazyproc)glad_lazy_glGetSynciv); if (glad_glGetSynciv != glad_lazy_glGetSynciv) glad_glGetSynciv(sync, pname, count, length, values); }
+static void APIENTRY glad_lazy_glGetTexEnvfv(GLenum target, GLenum pname, GLfloat *params) { glad_glGetTexEnvfv = (PFNGLGETTEXENVFVPROC)glad_lazy_resolve("glGetTexEnvfv", (GLADlazyproc)glad_lazy_glGetTexEnvfv); if (glad_glGetTexEnvfv != glad_lazy_glGetTexEnvfv) glad_glGetTexEnvfv(target, pname, params); }
+static void APIENTRY glad_lazy_glGetTexEnviv(GLenum target, GLenum pname, GLint *params) { glad_glGetTexEnviv = (PFNGLGETTEXENVIVPROC)glad_lazy_resolve("glGetTexEnviv", (GLADlazyproc)glad_lazy_glGetTexEnviv); if (glad_glGetTexEnviv != glad_lazy_glGetTexEnviv) glad_glGetTexEnviv(target, pname, params); }
+static void APIENTRY glad_lazy_glGetTexGendv(GLenum coord, GLenum pname, GLdouble *params) { glad_glGetTexGendv = (PFNGLGETTEXGENDVPROC)glad_lazy_resolve("glGetTexGendv", (GLADlazyproc)glad_lazy_glGetTexGendv); if (glad_glGetTexGendv != glad_lazy_glGetTexGendv) glad_glGetTexGendv(coord, pname, params); }
+static void APIENTRY glad_lazy_glGetTexGenfv(GLenum coord, GLenum pname, GLfloat *params) { glad_glGetTexGenfv = (PFNGLGETTEXGENFVPROC)glad_lazy_resolve("glGetTexGenfv", (GLADlazyproc)glad_lazy_glGetTexGenfv); if (glad_glGetTexGenfv != glad_lazy_glGetTexGenfv) glad_glGetTexGenfv(coord, pname, params); }
+static void APIENTRY glad_lazy_glGetTexGeniv(GLenum coord, GLenum pname, GLint *params) { glad_glGetTexGeniv = (PFNGLGETTEXGENIVPROC)glad_lazy_resolve("glGetTexGeniv", (GLADlazyproc)glad_lazy_glGetTexGeniv); if (glad_glGetTexGeniv != glad_lazy_glGetTexGeniv) glad_glGetTexGeniv(coord, pname, params); }
+static void APIENTRY glad_lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) { glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC)glad_lazy_resolve("glGetTexImage", (GLADlazyproc)glad_lazy_glGetTexImage); if (glad_glGetTexImage != glad_lazy_glGetTexImage) glad_glGetTexImage(target, level, format, type, pixels); }
+static void APIENTRY glad_lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) { glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)glad_lazy_resolve("glGetTexLevelParameterfv", (GLADlazyproc)glad_lazy_glGetTexLevelParameterfv); if (glad_glGetTexLevelParameterfv != glad_lazy_glGetTexLevelParameterfv) glad_glGetTexLevelParameterfv(target, level, pname, params); }
+static void APIENTRY glad_lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) { glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)glad_lazy_resolve("glGetTexLevelParameteriv", (GLADlazyproc)glad_lazy_glGetTexLevelParameteriv); if (glad_glGetTexLevelParameteriv != glad_lazy_glGetTexLevelParameteriv) glad_glGetTexLevelParameteriv(target, level, pname, params); }
+static void APIENTRY glad_lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) { glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)glad_lazy_resolve("glGetTexParameterIiv", (GLADlazyproc)glad_lazy_glGetTexParameterIiv); if (glad_glGetTexParameterIiv != glad_lazy_glGetTexParameterIiv) glad_glGetTexParameterIiv(target, pname, params); }
+static void APIENTRY glad_lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) { glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)glad_lazy_resolve("glGetTexParameterIuiv", (GLADlazyproc)glad_lazy_glGetTexParameterIuiv); if (glad_glGetTexParameterIuiv != glad_lazy_glGetTexParameterIuiv) glad_glGetTexParameterIuiv(target, pname, params); }
+static void APIENTRY glad_lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) { glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)glad_lazy_resolve("glGetTexParameterfv", (GLADlazyproc)glad_lazy_glGetTexParameterfv); if (glad_glGetTexParameterfv != glad_lazy_glGetTexParameterfv) glad_glGetTexParameterfv(target, pname, params); }
+static void APIENTRY glad_lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) { glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)glad_lazy_resolve("glGetTexParameteriv", (GLADlazyproc)glad_lazy_glGetTexParameteriv); if (glad_glGetTexParameteriv != glad_lazy_glGetTexParameteriv) glad_glGetTexParameteriv(target, pname, params); }
+static void APIENTRY glad_lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) { glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)glad_lazy_resolve("glGetTransformFeedbackVarying", (GLADlazyproc)glad_lazy_glGetTransformFeedbackVarying); if (glad_glGetTransformFeedbackVarying != glad_lazy_glGetTransformFeedbackVarying) glad_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name); }
+static GLuint APIENTRY glad_lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) { glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)glad_lazy_resolve("glGetUniformBlockIndex", (GLADlazyproc)glad_lazy_glGetUniformBlockIndex); if (glad_glGetUniformBlockIndex == glad_lazy_glGetUniformBlockIndex) return (GLuint)0; return glad_glGetUniformBlockIndex(program, uniformBlockName); }
+static void APIENTRY glad_lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) { glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)glad_lazy_resolve("glGetUniformIndices", (GLADlazyproc)glad_lazy_glGetUniformIndices); if (glad_glGetUniformIndices != glad_lazy_glGetUniformIndices) glad_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices); }
+static GLint APIENTRY glad_lazy_glGetUniformLocation(GLuint program, const GLchar *name) { glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)glad_lazy_resolve("glGetUniformLocation", (GLADlazyproc)glad_lazy_glGetUniformLocation); if (glad_glGetUniformLocation == glad_lazy_glGetUniformLocation) return (GLint)0; return glad_glGetUniformLocation(program, name); }
+static void APIENTRY glad_lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params) { glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC)glad_lazy_resolve("glGetUniformfv", (GLADlazyproc)glad_lazy_glGetUniformfv); if (glad_glGetUniformfv != glad_lazy_glGetUniformfv) glad_glGetUniformfv(program, location, params); }
+static void APIENTRY glad_lazy_glGetUniformiv(GLuint program, GLint location, GLint *params) { glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC)glad_lazy_resolve("glGetUniformiv", (GLADlazyproc)glad_lazy_glGetUniformiv); if (glad_glGetUniformiv != glad_lazy_glGetUniformiv) glad_glGetUniformiv(program, location, params); }
+static void APIENTRY glad_lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params) { glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)glad_lazy_resolve("glGetUniformuiv", (GLADlazyproc)glad_lazy_glGetUniformuiv); if (glad_glGetUniformuiv != glad_lazy_glGetUniformuiv) glad_glGetUniformuiv(program, location, params); }
+static void APIENTRY glad_lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) { glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)glad_lazy_resolve("glGetVertexAttribIiv", (GLADlazyproc)glad_lazy_glGetVertexAttribIiv); if (glad_glGetVertexAttribIiv != glad_lazy_glGetVertexAttribIiv) glad_glGetVertexAttribIiv(index, pname, params); }
+static void APIENTRY glad_lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) { glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)glad_lazy_resolve("glGetVertexAttribIuiv", (GLADlazyproc)glad_lazy_glGetVertexAttribIuiv); if (glad_glGetVertexAttribIuiv != glad_lazy_glGetVertexAttribIuiv) glad_glGetVertexAttribIuiv(index, pname, params); }
+static void APIENTRY glad_lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) { glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)glad_lazy_resolve("glGetVertexAttribPointerv", (GLADlazyproc)glad_lazy_glGetVertexAttribPointerv); if (glad_glGetVertexAttribPointerv != glad_lazy_glGetVertexAttribPointerv) glad_glGetVertexAttribPointerv(index, pname, pointer); }
+static void APIENTRY glad_lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) { glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)glad_lazy_resolve("glGetVertexAttribdv", (GLADlazyproc)glad_lazy_glGetVertexAttribdv); if (glad_glGetVertexAttribdv != glad_lazy_glGetVertexAttribdv) glad_glGetVertexAttribdv(index, pname, params); }
+static void APIENTRY glad_lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) { glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)glad_lazy_resolve("glGetVertexAttribfv", (GLADlazyproc)glad_lazy_glGetVertexAttribfv); if (glad_glGetVertexAttribfv != glad_lazy_glGetVertexAttribfv) glad_glGetVertexAttribfv(index, pname, params); }
+static void APIENTRY glad_lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) { glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)glad_lazy_resolve("glGetVertexAttribiv", (GLADlazyproc)glad_lazy_glGetVertexAttribiv); if (glad_glGetVertexAttribiv != glad_lazy_glGetVertexAttribiv) glad_glGetVertexAttribiv(index, pname, params); }
+static void APIENTRY glad_lazy_glHint(GLenum target, GLenum mode) { glad_glHint = (PFNGLHINTPROC)glad_lazy_resolve("glHint", (GLADlazyproc)glad_lazy_glHint); if (glad_glHint != glad_lazy_glHint) glad_glHint(target, mode); }
+static void APIENTRY glad_lazy_glIndexMask(GLuint mask) { glad_glIndexMask = (PFNGLINDEXMASKPROC)glad_lazy_resolve("glIndexMask", (GLADlazyproc)glad_lazy_glIndexMask); if (glad_glIndexMask != glad_lazy_glIndexMask) glad_glIndexMask(mask); }
+static void APIENTRY glad_lazy_glIndexPointer(GLenum type, GLsizei stride, const void *pointer) { glad_glIndexPointer = (PFNGLINDEXPOINTERPROC)glad_lazy_resolve("glIndexPointer", (GLADlazyproc)glad_lazy_glIndexPointer); if (glad_glIndexPointer != glad_lazy_glIndexPointer) glad_glIndexPointer(type, stride, pointer); }
+static void APIENTRY glad_lazy_glIndexd(GLdouble c) { glad_glIndexd = (PFNGLINDEXDPROC)glad_lazy_resolve("glIndexd", (GLADlazyproc)glad_lazy_glIndexd); if (glad_glIndexd != glad_lazy_glIndexd) glad_glIndexd(c); }
+static void APIENTRY glad_lazy_glIndexdv(const GLdouble *c) { glad_glIndexdv = (PFNGLINDEXDVPROC)glad_lazy_resolve("glIndexdv", (GLADlazyproc)glad_lazy_glIndexdv); if (glad_glIndexdv != glad_lazy_glIndexdv) glad_glIndexdv(c); }
+static void APIENTRY glad_lazy_glIndexf(GLfloat c) { glad_glIndexf = (PFNGLINDEXFPROC)glad_lazy_resolve("glIndexf", (GLADlazyproc)glad_lazy_glIndexf); if (glad_glIndexf != glad_lazy_glIndexf) glad_glIndexf(c); }
+static void APIENTRY glad_lazy_glIndexfv(const GLfloat *c) { glad_glIndexfv = (PFNGLINDEXFVPROC)glad_lazy_resolve("glIndexfv", (GLADlazyproc)glad_lazy_glIndexfv); if (glad_glIndexfv != glad_lazy_glIndexfv) glad_glIndexfv(c); }
+static void APIENTRY glad_lazy_glIndexi(GLint c) { glad_glIndexi = (PFNGLINDEXIPROC)glad_lazy_resolve("glIndexi", (GLADlazyproc)glad_lazy_glIndexi); if (glad_glIndexi != glad_lazy_glIndexi) glad_glIndexi(c); }
+static void APIENTRY glad_lazy_glIndexiv(const GLint *c) { glad_glIndexiv = (PFNGLINDEXIVPROC)glad_lazy_resolve("glIndexiv", (GLADlazyproc)glad_lazy_glIndexiv); if (glad_glIndexiv != glad_lazy_glIndexiv) glad_glIndexiv(c); }
+static void APIENTRY glad_lazy_glIndexs(GLshort c) { glad_glIndexs = (PFNGLINDEXSPROC)glad_lazy_resolve("glIndexs", (GLADlazyproc)glad_lazy_glIndexs); if (glad_glIndexs != glad_lazy_glIndexs) glad_glIndexs(c); }
+static void APIENTRY glad_lazy_glIndexsv(const GLshort *c) { glad_glIndexsv = (PFNGLINDEXSVPROC)glad_lazy_resolve("glIndexsv", (GLADlazyproc)glad_lazy_glIndexsv); if (glad_glIndexsv != glad_lazy_glIndexsv) glad_glIndexsv(c); }
+static void APIENTRY glad_lazy_glIndexub(GLubyte c) { glad_glIndexub = (PFNGLINDEXUBPROC)glad_lazy_resolve("glIndexub", (GLADlazyproc)glad_lazy_glIndexub); if (glad_glIndexub != glad_lazy_glIndexub) glad_glIndexub(c); }
+static void APIENTRY glad_lazy_glIndexubv(const GLubyte *c) { glad_glIndexubv = (PFNGLINDEXUBVPROC)glad_lazy_resolve("glIndexubv", (GLADlazyproc)glad_lazy_glIndexubv); if (glad_glIndexubv != glad_lazy_glIndexubv) glad_glIndexubv(c); }
+static void APIENTRY glad_lazy_glInitNames(void) { glad_glInitNames = (PFNGLINITNAMESPROC)glad_lazy_resolve("glInitNames", (GLADlazyproc)glad_lazy_glInitNames); if (glad_glInitNames != glad_lazy_glInitNames) glad_glInitNames(); }
+static void APIENTRY glad_lazy_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer) { glad_glInterleavedArrays = (PFNGLINTERLEAVEDARRAYSPROC)glad_lazy_resolve("glInterleavedArrays", (GLADlazyproc)glad_lazy_glInterleavedArrays); if (glad_glInterleavedArrays != glad_lazy_glInterleavedArrays) glad_glInterleavedArrays(format, stride, pointer); }
+static GLboolean APIENTRY glad_lazy_glIsBuffer(GLuint buffer) { glad_glIsBuffer = (PFNGLISBUFFERPROC)glad_lazy_resolve("glIsBuffer", (GLADlazyproc)glad_lazy_glIsBuffer); if (glad_glIsBuffer == glad_lazy_glIsBuffer) return (GLboolean)0; return glad_glIsBuffer(buffer); }
+static GLboolean APIENTRY glad_lazy_glIsEnabled(GLenum cap) { glad_glIsEnabled = (PFNGLISENABLEDPROC)glad_lazy_resolve("glIsEnabled", (GLADlazyproc)glad_lazy_glIsEnabled); if (glad_glIsEnabled == glad_lazy_glIsEnabled) return (GLboolean)0; return glad_glIsEnabled(cap); }
+static GLboolean APIENTRY glad_lazy_glIsEnabledi(GLenum target, GLuint index) { glad_glIsEnabledi = (PFNGLISENABLEDIPROC)glad_lazy_resolve("glIsEnabledi", (GLADlazyproc)glad_lazy_glIsEnabledi); if (glad_glIsEnabledi == glad_lazy_glIsEnabledi) return (GLboolean)0; return glad_glIsEnabledi(target, index); }
+static GLboolean APIENTRY glad_lazy_glIsFramebuffer(GLuint framebuffer) { glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)glad_lazy_resolve("glIsFramebuffer", (GLADlazyproc)glad_lazy_glIsFramebuffer); if (glad_glIsFramebuffer == glad_lazy_glIsFramebuffer) return (GLboolean)0; return glad_glIsFramebuffer(framebuffer); }
+static GLboolean APIENTRY glad_lazy_glIsList(GLuint list) { glad_glIsList = (PFNGLISLISTPROC)glad_lazy_resolve("glIsList", (GLADlazyproc)glad_lazy_glIsList); if (glad_glIsList == glad_lazy_glIsList) return (GLboolean)0; return glad_glIsList(list); }
+static GLboolean APIENTRY glad_lazy_glIsProgram(GLuint program) { glad_glIsProgram = (PFNGLISPROGRAMPROC)glad_lazy_resolve("glIsProgram", (GLADlazyproc)glad_lazy_glIsProgram); if (glad_glIsProgram == glad_lazy_glIsProgram) return (GLboolean)0; return glad_glIsProgram(program); }
+static GLboolean APIENTRY glad_lazy_glIsQuery(GLuint id) { glad_glIsQuery = (PFNGLISQUERYPROC)glad_lazy_resolve("glIsQuery", (GLADlazyproc)glad_lazy_glIsQuery); if (glad_glIsQuery == glad_lazy_glIsQuery) return (GLboolean)0; return glad_glIsQuery(id); }
+static GLboolean APIENTRY glad_lazy_glIsRenderbuffer(GLuint renderbuffer) { glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)glad_lazy_resolve("glIsRenderbuffer", (GLADlazyproc)glad_lazy_glIsRenderbuffer); if (glad_glIsRenderbuffer == glad_lazy_glIsRenderbuffer) return (GLboolean)0; return glad_glIsRenderbuffer(renderbuffer); }
+static GLboolean APIENTRY glad_lazy_glIsSampler(GLuint sampler) { glad_glIsSampler = (PFNGLISSAMPLERPROC)glad_lazy_resolve("glIsSampler", (GLADlazyproc)glad_lazy_glIsSampler); if (glad_glIsSampler == glad_lazy_glIsSampler) return (GLboolean)0; return glad_glIsSampler(sampler); }
+static GLboolean APIENTRY glad_lazy_glIsShader(GLuint shader) { glad_glIsShader = (PFNGLISSHADERPROC)glad_lazy_resolve("glIsShader", (GLADlazyproc)glad_lazy_glIsShader); if (glad_glIsShader == glad_lazy_glIsShader) return (GLboolean)0; return glad_glIsShader(shader); }
+static GLboolean APIENTRY glad_lazy_glIsSync(GLsync sync) { glad_glIsSync = (PFNGLISSYNCPROC)glad_lazy_resolve("glIsSync", (GLADlazyproc)glad_lazy_glIsSync); if (glad_glIsSync == glad_lazy_glIsSync) return (GLboolean)0; return glad_glIsSync(sync); }
+static GLboolean APIENTRY glad_lazy_glIsTexture(GLuint texture) { glad_glIsTexture = (PFNGLISTEXTUREPROC)glad_lazy_resolve("glIsTexture", (GLADlazyproc)glad_lazy_glIsTexture); if (glad_glIsTexture == glad_lazy_glIsTexture) return (GLboolean)0; return glad_glIsTexture(texture); }
+static GLboolean APIENTRY glad_lazy_glIsVertexArray(GLuint array) { glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC)glad_lazy_resolve("glIsVertexArray", (GLADlazyproc)glad_lazy_glIsVertexArray); if (glad_glIsVertexArray == glad_lazy_glIsVertexArray) return (GLboolean)0; return glad_glIsVertexArray(array); }
+static void APIENTRY glad_lazy_glLightModelf(GLenum pname, GLfloat param) { glad_glLightModelf = (PFNGLLIGHTMODELFPROC)glad_lazy_resolve("glLightModelf", (GLADlazyproc)glad_lazy_glLightModelf); if (glad_glLightModelf != glad_lazy_glLightModelf) glad_glLightModelf(pname, param); }
+static void APIENTRY glad_lazy_glLightModelfv(GLenum pname, const GLfloat *params) { glad_glLightModelfv = (PFNGLLIGHTMODELFVPROC)glad_lazy_resolve("glLightModelfv", (GLADlazyproc)glad_lazy_glLightModelfv); if (glad_glLightModelfv != glad_lazy_glLightModelfv) glad_glLightModelfv(pname, params); }
+static void APIENTRY glad_lazy_glLightModeli(GLenum pname, GLint param) { glad_glLightModeli = (PFNGLLIGHTMODELIPROC)glad_lazy_resolve("glLightModeli", (GLADlazyproc)glad_lazy_glLightModeli); if (glad_glLightModeli != glad_lazy_glLightModeli) glad_glLightModeli(pname, param); }
+static void APIENTRY glad_lazy_glLightModeliv(GLenum pname, const GLint *params) { glad_glLightModeliv = (PFNGLLIGHTMODELIVPROC)glad_lazy_resolve("glLightModeliv", (GLADlazyproc)glad_lazy_glLightModeliv); if (glad_glLightModeliv != glad_lazy_glLightModeliv) glad_glLightModeliv(pname, params); }
+static void APIENTRY glad_lazy_glLightf(GLenum light, GLenum pname, GLfloat param) { glad_glLightf = (PFNGLLIGHTFPROC)glad_lazy_resolve("glLightf", (GLADlazyproc)glad_lazy_glLightf); if (glad_glLightf != glad_lazy_glLightf) glad_glLightf(light, pname, param); }
+static void APIENTRY glad_lazy_glLightfv(GLenum light, GLenum pname, const GLfloat *params) { glad_glLightfv = (PFNGLLIGHTFVPROC)glad_lazy_resolve("glLightfv", (GLADlazyproc)glad_lazy_glLightfv); if (glad_glLightfv != glad_lazy_glLightfv) glad_glLightfv(light, pname, params); }
+static void APIENTRY glad_lazy_glLighti(GLenum light, GLenum pname, GLint param) { glad_glLighti = (PFNGLLIGHTIPROC)glad_lazy_resolve("glLighti", (GLADlazyproc)glad_lazy_glLighti); if (glad_glLighti != glad_lazy_glLighti) glad_glLighti(light, pname, param); }
+static void APIENTRY glad_lazy_glLightiv(GLenum light, GLenum pname, const GLint *params) { glad_glLightiv = (PFNGLLIGHTIVPROC)glad_lazy_resolve("glLightiv", (GLADlazyproc)glad_lazy_glLightiv); if (glad_glLightiv != glad_lazy_glLightiv) glad_glLightiv(light, pname, params); }
+static void APIENTRY glad_lazy_glLineStipple(GLint factor, GLushort pattern) { glad_glLineStipple = (PFNGLLINESTIPPLEPROC)glad_lazy_resolve("glLineStipple", (GLADlazyproc)glad_lazy_glLineStipple); if (glad_glLineStipple != glad_lazy_glLineStipple) glad_glLineStipple(factor, pattern); }
+static void APIENTRY glad_lazy_glLineWidth(GLfloat width) { glad_glLineWidth = (PFNGLLINEWIDTHPROC)glad_lazy_resolve("glLineWidth", (GLADlazyproc)glad_lazy_glLineWidth); if (glad_glLineWidth != glad_lazy_glLineWidth) glad_glLineWidth(width); }
+static void APIENTRY glad_lazy_glLinkProgram(GLuint program) { glad_glLinkProgram = (PFNGLLINKPROGRAMPROC)glad_lazy_resolve("glLinkProgram", (GLADlazyproc)glad_lazy_glLinkProgram); if (glad_glLinkProgram != glad_lazy_glLinkProgram) glad_glLinkProgram(program); }
+static void APIENTRY glad_lazy_glListBase(GLuint base) { glad_glListBase = (PFNGLLISTBASEPROC)glad_lazy_resolve("glListBase", (GLADlazyproc)glad_lazy_glListBase); if (glad_glListBase != glad_lazy_glListBase) glad_glListBase(base); }
+static void APIENTRY glad_lazy_glLoadIdentity(void) { glad_glLoadIdentity = (PFNGLLOADIDENTITYPROC)glad_lazy_resolve("glLoadIdentity", (GLADlazyproc)glad_lazy_glLoadIdentity); if (glad_glLoadIdentity != glad_lazy_glLoadIdentity) glad_glLoadIdentity(); }
+static void APIENTRY glad_lazy_glLoadMatrixd(const GLdouble *m) { glad_glLoadMatrixd = (PFNGLLOADMATRIXDPROC)glad_lazy_resolve("glLoadMatrixd", (GLADlazyproc)glad_lazy_glLoadMatrixd); if (glad_glLoadMatrixd != glad_lazy_glLoadMatrixd) glad_glLoadMatrixd(m); }
+static void APIENTRY glad_lazy_glLoadMatrixf(const GLfloat *m) { glad_glLoadMatrixf = (PFNGLLOADMATRIXFPROC)glad_lazy_resolve("glLoadMatrixf", (GLADlazyproc)glad_lazy_glLoadMatrixf); if (glad_glLoadMatrixf != glad_lazy_glLoadMatrixf) glad_glLoadMatrixf(m); }
+static void APIENTRY glad_lazy_glLoadName(GLuint name) { glad_glLoadName = (PFNGLLOADNAMEPROC)glad_lazy_resolve("glLoadName", (GLADlazyproc)glad_lazy_glLoadName); if (glad_glLoadName != glad_lazy_glLoadName) glad_glLoadName(name); }
+static void APIENTRY glad_lazy_glLoadTransposeMatrixd(const GLdouble *m) { glad_glLoadTransposeMatrixd = (PFNGLLOADTRANSPOSEMATRIXDPROC)glad_lazy_resolve("glLoadTransposeMatrixd", (GLADlazyproc)glad_lazy_glLoadTransposeMatrixd); if (glad_glLoadTransposeMatrixd != glad_lazy_glLoadTransposeMatrixd) glad_glLoadTransposeMatrixd(m); }
+static void APIENTRY glad_lazy_glLoadTransposeMatrixf(const GLfloat *m) { glad_glLoadTransposeMatrixf = (PFNGLLOADTRANSPOSEMATRIXFPROC)glad_lazy_resolve("glLoadTransposeMatrixf", (GLADlazyproc)glad_lazy_glLoadTransposeMatrixf); if (glad_glLoadTransposeMatrixf != glad_lazy_glLoadTransposeMatrixf) glad_glLoadTransposeMatrixf(m); }
+static void APIENTRY glad_lazy_glLogicOp(GLenum opcode) { glad_glLogicOp = (PFNGLLOGICOPPROC)glad_lazy_resolve("glLogicOp", (GLADlazyproc)glad_lazy_glLogicOp); if (glad_glLogicOp != glad_lazy_glLogicOp) glad_glLogicOp(opcode); }
+static void APIENTRY glad_lazy_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points) { glad_glMap1d = (PFNGLMAP1DPROC)glad_lazy_resolve("glMap1d", (GLADlazyproc)glad_lazy_glMap1d); if (glad_glMap1d != glad_lazy_glMap1d) glad_glMap1d(target, u1, u2, stride, order, points); }
+static void APIENTRY glad_lazy_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points) { glad_glMap1f = (PFNGLMAP1FPROC)glad_lazy_resolve("glMap1f", (GLADlazyproc)glad_lazy_glMap1f); if (glad_glMap1f != glad_lazy_glMap1f) glad_glMap1f(target, u1, u2, stride, order, points); }
+static void APIENTRY glad_lazy_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points) { glad_glMap2d = (PFNGLMAP2DPROC)glad_lazy_resolve("glMap2d", (GLADlazyproc)glad_lazy_glMap2d); if (glad_glMap2d != glad_lazy_glMap2d) glad_glMap2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points); }
+static void APIENTRY glad_lazy_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points) { glad_glMap2f = (PFNGLMAP2FPROC)glad_lazy_resolve("glMap2f", (GLADlazyproc)glad_lazy_glMap2f); if (glad_glMap2f != glad_lazy_glMap2f) glad_glMap2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points); }
+static void *APIENTRY glad_lazy_glMapBuffer(GLenum target, GLenum access) { glad_glMapBuffer = (PFNGLMAPBUFFERPROC)glad_lazy_resolve("glMapBuffer", (GLADlazyproc)glad_lazy_glMapBuffer); if (glad_glMapBuffer == glad_lazy_glMapBuffer) return (void *)0; return glad_glMapBuffer(target, access); }
+static void *APIENTRY glad_lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) { glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)glad_lazy_resolve("glMapBufferRange", (GLADlazyproc)glad_lazy_glMapBufferRange); if (glad_glMapBufferRange == glad_lazy_glMapBufferRange) return (void *)0; return glad_glMapBufferRange(target, offset, length, access); }
+static void APIENTRY glad_lazy_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2) { glad_glMapGrid1d = (PFNGLMAPGRID1DPROC)glad_lazy_resolve("glMapGrid1d", (GLADlazyproc)glad_lazy_glMapGrid1d); if (glad_glMapGrid1d != glad_lazy_glMapGrid1d) glad_glMapGrid1d(un, u1, u2); }
+static void APIENTRY glad_lazy_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2) { glad_glMapGrid1f = (PFNGLMAPGRID1FPROC)glad_lazy_resolve("glMapGrid1f", (GLADlazyproc)glad_lazy_glMapGrid1f); if (glad_glMapGrid1f != glad_lazy_glMapGrid1f) glad_glMapGrid1f(un, u1, u2); }
+static void APIENTRY glad_lazy_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2) { glad_glMapGrid2d = (PFNGLMAPGRID2DPROC)glad_lazy_resolve("glMapGrid2d", (GLADlazyproc)glad_lazy_glMapGrid2d); if (glad_glMapGrid2d != glad_lazy_glMapGrid2d) glad_glMapGrid2d(un, u1, u2, vn, v1, v2); }
+static void APIENTRY glad_lazy_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2) { glad_glMapGrid2f = (PFNGLMAPGRID2FPROC)glad_lazy_resolve("glMapGrid2f", (GLADlazyproc)glad_lazy_glMapGrid2f); if (glad_glMapGrid2f != glad_lazy_glMapGrid2f) glad_glMapGrid2f(un, u1, u2, vn, v1, v2); }
+static void APIENTRY glad_lazy_glMaterialf(GLenum face, GLenum pname, GLfloat param) { glad_glMaterialf = (PFNGLMATERIALFPROC)glad_lazy_resolve("glMaterialf", (GLADlazyproc)glad_lazy_glMaterialf); if (glad_glMaterialf != glad_lazy_glMaterialf) glad_glMaterialf(face, pname, param); }
+static void APIENTRY glad_lazy_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) { glad_glMaterialfv = (PFNGLMATERIALFVPROC)glad_lazy_resolve("glMaterialfv", (GLADlazyproc)glad_lazy_glMaterialfv); if (glad_glMaterialfv != glad_lazy_glMaterialfv) glad_glMaterialfv(face, pname, params); }
+static void APIENTRY glad_lazy_glMateriali(GLenum face, GLenum pname, GLint param) { glad_glMateriali = (PFNGLMATERIALIPROC)glad_lazy_resolve("glMateriali", (GLADlazyproc)glad_lazy_glMateriali); if (glad_glMateriali != glad_lazy_glMateriali) glad_glMateriali(face, pname, param); }
+static void APIENTRY glad_lazy_glMaterialiv(GLenum face, GLenum pname, const GLint *params) { glad_glMaterialiv = (PFNGLMATERIALIVPROC)glad_lazy_resolve("glMaterialiv", (GLADlazyproc)glad_lazy_glMaterialiv); if (glad_glMaterialiv != glad_lazy_glMaterialiv) glad_glMaterialiv(face, pname, params); }
+static void APIENTRY glad_lazy_glMatrixMode(GLenum mode) { glad_glMatrixMode = (PFNGLMATRIXMODEPROC)glad_lazy_resolve("glMatrixMode", (GLADlazyproc)glad_lazy_glMatrixMode); if (glad_glMatrixMode != glad_lazy_glMatrixMode) glad_glMatrixMode(mode); }
+static void APIENTRY glad_lazy_glMultMatrixd(const GLdouble *m) { glad_glMultMatrixd = (PFNGLMULTMATRIXDPROC)glad_lazy_resolve("glMultMatrixd", (GLADlazyproc)glad_lazy_glMultMatrixd); if (glad_glMultMatrixd != glad_lazy_glMultMatrixd) glad_glMultMatrixd(m); }
+static void APIENTRY glad_lazy_glMultMatrixf(const GLfloat *m) { glad_glMultMatrixf = (PFNGLMULTMATRIXFPROC)glad_lazy_resolve("glMultMatrixf", (GLADlazyproc)glad_lazy_glMultMatrixf); if (glad_glMultMatrixf != glad_lazy_glMultMatrixf) glad_glMultMatrixf(m); }
+static void APIENTRY glad_lazy_glMultTransposeMatrixd(const GLdouble *m) { glad_glMultTransposeMatrixd = (PFNGLMULTTRANSPOSEMATRIXDPROC)glad_lazy_resolve("glMultTransposeMatrixd", (GLADlazyproc)glad_lazy_glMultTransposeMatrixd); if (glad_glMultTransposeMatrixd != glad_lazy_glMultTransposeMatrixd) glad_glMultTransposeMatrixd(m); }
+static void APIENTRY glad_lazy_glMultTransposeMatrixf(const GLfloat *m) { glad_glMultTransposeMatrixf = (PFNGLMULTTRANSPOSEMATRIXFPROC)glad_lazy_resolve("glMultTransposeMatrixf", (GLADlazyproc)glad_lazy_glMultTransposeMatrixf); if (glad_glMultTransposeMatrixf != glad_lazy_glMultTransposeMatrixf) glad_glMultTransposeMatrixf(m); }
+static void APIENTRY glad_lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) { glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)glad_lazy_resolve("glMultiDrawArrays", (GLADlazyproc)glad_lazy_glMultiDrawArrays); if (glad_glMultiDrawArrays != glad_lazy_glMultiDrawArrays) glad_glMultiDrawArrays(mode, first, count, drawcount); }
+static void APIENTRY glad_lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) { glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)glad_lazy_resolve("glMultiDrawElements", (GLADlazyproc)glad_lazy_glMultiDrawElements); if (glad_glMultiDrawElements != glad_lazy_glMultiDrawElements) glad_glMultiDrawElements(mode, count, type, indices, drawcount); }
+static void APIENTRY glad_lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) { glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)glad_lazy_resolve("glMultiDrawElementsBaseVertex", (GLADlazyproc)glad_lazy_glMultiDrawElementsBaseVertex); if (glad_glMultiDrawElementsBaseVertex != glad_lazy_glMultiDrawElementsBaseVertex) glad_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex); }
+static void APIENTRY glad_lazy_glMultiTexCoord1d(GLenum target, GLdouble s) { glad_glMultiTexCoord1d = (PFNGLMULTITEXCOORD1DPROC)glad_lazy_resolve("glMultiTexCoord1d", (GLADlazyproc)glad_lazy_glMultiTexCoord1d); if (glad_glMultiTexCoord1d != glad_lazy_glMultiTexCoord1d) glad_glMultiTexCoord1d(target, s); }
+static void APIENTRY glad_lazy_glMultiTexCoord1dv(GLenum target, const GLdouble *v) { glad_glMultiTexCoord1dv = (PFNGLMULTITEXCOORD1DVPROC)glad_lazy_resolve("glMultiTexCoord1dv", (GLADlazyproc)glad_lazy_glMultiTexCoord1dv); if (glad_glMultiTexCoord1dv != glad_lazy_glMultiTexCoord1dv) glad_glMultiTexCoord1dv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord1f(GLenum target, GLfloat s) { glad_glMultiTexCoord1f = (PFNGLMULTITEXCOORD1FPROC)glad_lazy_resolve("glMultiTexCoord1f", (GLADlazyproc)glad_lazy_glMultiTexCoord1f); if (glad_glMultiTexCoord1f != glad_lazy_glMultiTexCoord1f) glad_glMultiTexCoord1f(target, s); }
+static void APIENTRY glad_lazy_glMultiTexCoord1fv(GLenum target, const GLfloat *v) { glad_glMultiTexCoord1fv = (PFNGLMULTITEXCOORD1FVPROC)glad_lazy_resolve("glMultiTexCoord1fv", (GLADlazyproc)glad_lazy_glMultiTexCoord1fv); if (glad_glMultiTexCoord1fv != glad_lazy_glMultiTexCoord1fv) glad_glMultiTexCoord1fv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord1i(GLenum target, GLint s) { glad_glMultiTexCoord1i = (PFNGLMULTITEXCOORD1IPROC)glad_lazy_resolve("glMultiTexCoord1i", (GLADlazyproc)glad_lazy_glMultiTexCoord1i); if (glad_glMultiTexCoord1i != glad_lazy_glMultiTexCoord1i) glad_glMultiTexCoord1i(target, s); }
+static void APIENTRY glad_lazy_glMultiTexCoord1iv(GLenum target, const GLint *v) { glad_glMultiTexCoord1iv = (PFNGLMULTITEXCOORD1IVPROC)glad_lazy_resolve("glMultiTexCoord1iv", (GLADlazyproc)glad_lazy_glMultiTexCoord1iv); if (glad_glMultiTexCoord1iv != glad_lazy_glMultiTexCoord1iv) glad_glMultiTexCoord1iv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord1s(GLenum target, GLshort s) { glad_glMultiTexCoord1s = (PFNGLMULTITEXCOORD1SPROC)glad_lazy_resolve("glMultiTexCoord1s", (GLADlazyproc)glad_lazy_glMultiTexCoord1s); if (glad_glMultiTexCoord1s != glad_lazy_glMultiTexCoord1s) glad_glMultiTexCoord1s(target, s); }
+static void APIENTRY glad_lazy_glMultiTexCoord1sv(GLenum target, const GLshort *v) { glad_glMultiTexCoord1sv = (PFNGLMULTITEXCOORD1SVPROC)glad_lazy_resolve("glMultiTexCoord1sv", (GLADlazyproc)glad_lazy_glMultiTexCoord1sv); if (glad_glMultiTexCoord1sv != glad_lazy_glMultiTexCoord1sv) glad_glMultiTexCoord1sv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t) { glad_glMultiTexCoord2d = (PFNGLMULTITEXCOORD2DPROC)glad_lazy_resolve("glMultiTexCoord2d", (GLADlazyproc)glad_lazy_glMultiTexCoord2d); if (glad_glMultiTexCoord2d != glad_lazy_glMultiTexCoord2d) glad_glMultiTexCoord2d(target, s, t); }
+static void APIENTRY glad_lazy_glMultiTexCoord2dv(GLenum target, const GLdouble *v) { glad_glMultiTexCoord2dv = (PFNGLMULTITEXCOORD2DVPROC)glad_lazy_resolve("glMultiTexCoord2dv", (GLADlazyproc)glad_lazy_glMultiTexCoord2dv); if (glad_glMultiTexCoord2dv != glad_lazy_glMultiTexCoord2dv) glad_glMultiTexCoord2dv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t) { glad_glMultiTexCoord2f = (PFNGLMULTITEXCOORD2FPROC)glad_lazy_resolve("glMultiTexCoord2f", (GLADlazyproc)glad_lazy_glMultiTexCoord2f); if (glad_glMultiTexCoord2f != glad_lazy_glMultiTexCoord2f) glad_glMultiTexCoord2f(target, s, t); }
+static void APIENTRY glad_lazy_glMultiTexCoord2fv(GLenum target, const GLfloat *v) { glad_glMultiTexCoord2fv = (PFNGLMULTITEXCOORD2FVPROC)glad_lazy_resolve("glMultiTexCoord2fv", (GLADlazyproc)glad_lazy_glMultiTexCoord2fv); if (glad_glMultiTexCoord2fv != glad_lazy_glMultiTexCoord2fv) glad_glMultiTexCoord2fv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord2i(GLenum target, GLint s, GLint t) { glad_glMultiTexCoord2i = (PFNGLMULTITEXCOORD2IPROC)glad_lazy_resolve("glMultiTexCoord2i", (GLADlazyproc)glad_lazy_glMultiTexCoord2i); if (glad_glMultiTexCoord2i != glad_lazy_glMultiTexCoord2i) glad_glMultiTexCoord2i(target, s, t); }
+static void APIENTRY glad_lazy_glMultiTexCoord2iv(GLenum target, const GLint *v) { glad_glMultiTexCoord2iv = (PFNGLMULTITEXCOORD2IVPROC)glad_lazy_resolve("glMultiTexCoord2iv", (GLADlazyproc)glad_lazy_glMultiTexCoord2iv); if (glad_glMultiTexCoord2iv != glad_lazy_glMultiTexCoord2iv) glad_glMultiTexCoord2iv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t) { glad_glMultiTexCoord2s = (PFNGLMULTITEXCOORD2SPROC)glad_lazy_resolve("glMultiTexCoord2s", (GLADlazyproc)glad_lazy_glMultiTexCoord2s); if (glad_glMultiTexCoord2s != glad_lazy_glMultiTexCoord2s) glad_glMultiTexCoord2s(target, s, t); }
+static void APIENTRY glad_lazy_glMultiTexCoord2sv(GLenum target, const GLshort *v) { glad_glMultiTexCoord2sv = (PFNGLMULTITEXCOORD2SVPROC)glad_lazy_resolve("glMultiTexCoord2sv", (GLADlazyproc)glad_lazy_glMultiTexCoord2sv); if (glad_glMultiTexCoord2sv != glad_lazy_glMultiTexCoord2sv) glad_glMultiTexCoord2sv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r) { glad_glMultiTexCoord3d = (PFNGLMULTITEXCOORD3DPROC)glad_lazy_resolve("glMultiTexCoord3d", (GLADlazyproc)glad_lazy_glMultiTexCoord3d); if (glad_glMultiTexCoord3d != glad_lazy_glMultiTexCoord3d) glad_glMultiTexCoord3d(target, s, t, r); }
+static void APIENTRY glad_lazy_glMultiTexCoord3dv(GLenum target, const GLdouble *v) { glad_glMultiTexCoord3dv = (PFNGLMULTITEXCOORD3DVPROC)glad_lazy_resolve("glMultiTexCoord3dv", (GLADlazyproc)glad_lazy_glMultiTexCoord3dv); if (glad_glMultiTexCoord3dv != glad_lazy_glMultiTexCoord3dv) glad_glMultiTexCoord3dv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r) { glad_glMultiTexCoord3f = (PFNGLMULTITEXCOORD3FPROC)glad_lazy_resolve("glMultiTexCoord3f", (GLADlazyproc)glad_lazy_glMultiTexCoord3f); if (glad_glMultiTexCoord3f != glad_lazy_glMultiTexCoord3f) glad_glMultiTexCoord3f(target, s, t, r); }
+static void APIENTRY glad_lazy_glMultiTexCoord3fv(GLenum target, const GLfloat *v) { glad_glMultiTexCoord3fv = (PFNGLMULTITEXCOORD3FVPROC)glad_lazy_resolve("glMultiTexCoord3fv", (GLADlazyproc)glad_lazy_glMultiTexCoord3fv); if (glad_glMultiTexCoord3fv != glad_lazy_glMultiTexCoord3fv) glad_glMultiTexCoord3fv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r) { glad_glMultiTexCoord3i = (PFNGLMULTITEXCOORD3IPROC)glad_lazy_resolve("glMultiTexCoord3i", (GLADlazyproc)glad_lazy_glMultiTexCoord3i); if (glad_glMultiTexCoord3i != glad_lazy_glMultiTexCoord3i) glad_glMultiTexCoord3i(target, s, t, r); }
+static void APIENTRY glad_lazy_glMultiTexCoord3iv(GLenum target, const GLint *v) { glad_glMultiTexCoord3iv = (PFNGLMULTITEXCOORD3IVPROC)glad_lazy_resolve("glMultiTexCoord3iv", (GLADlazyproc)glad_lazy_glMultiTexCoord3iv); if (glad_glMultiTexCoord3iv != glad_lazy_glMultiTexCoord3iv) glad_glMultiTexCoord3iv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r) { glad_glMultiTexCoord3s = (PFNGLMULTITEXCOORD3SPROC)glad_lazy_resolve("glMultiTexCoord3s", (GLADlazyproc)glad_lazy_glMultiTexCoord3s); if (glad_glMultiTexCoord3s != glad_lazy_glMultiTexCoord3s) glad_glMultiTexCoord3s(target, s, t, r); }
+static void APIENTRY glad_lazy_glMultiTexCoord3sv(GLenum target, const GLshort *v) { glad_glMultiTexCoord3sv = (PFNGLMULTITEXCOORD3SVPROC)glad_lazy_resolve("glMultiTexCoord3sv", (GLADlazyproc)glad_lazy_glMultiTexCoord3sv); if (glad_glMultiTexCoord3sv != glad_lazy_glMultiTexCoord3sv) glad_glMultiTexCoord3sv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) { glad_glMultiTexCoord4d = (PFNGLMULTITEXCOORD4DPROC)glad_lazy_resolve("glMultiTexCoord4d", (GLADlazyproc)glad_lazy_glMultiTexCoord4d); if (glad_glMultiTexCoord4d != glad_lazy_glMultiTexCoord4d) glad_glMultiTexCoord4d(target, s, t, r, q); }
+static void APIENTRY glad_lazy_glMultiTexCoord4dv(GLenum target, const GLdouble *v) { glad_glMultiTexCoord4dv = (PFNGLMULTITEXCOORD4DVPROC)glad_lazy_resolve("glMultiTexCoord4dv", (GLADlazyproc)glad_lazy_glMultiTexCoord4dv); if (glad_glMultiTexCoord4dv != glad_lazy_glMultiTexCoord4dv) glad_glMultiTexCoord4dv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) { glad_glMultiTexCoord4f = (PFNGLMULTITEXCOORD4FPROC)glad_lazy_resolve("glMultiTexCoord4f", (GLADlazyproc)glad_lazy_glMultiTexCoord4f); if (glad_glMultiTexCoord4f != glad_lazy_glMultiTexCoord4f) glad_glMultiTexCoord4f(target, s, t, r, q); }
+static void APIENTRY glad_lazy_glMultiTexCoord4fv(GLenum target, const GLfloat *v) { glad_glMultiTexCoord4fv = (PFNGLMULTITEXCOORD4FVPROC)glad_lazy_resolve("glMultiTexCoord4fv", (GLADlazyproc)glad_lazy_glMultiTexCoord4fv); if (glad_glMultiTexCoord4fv != glad_lazy_glMultiTexCoord4fv) glad_glMultiTexCoord4fv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q) { glad_glMultiTexCoord4i = (PFNGLMULTITEXCOORD4IPROC)glad_lazy_resolve("glMultiTexCoord4i", (GLADlazyproc)glad_lazy_glMultiTexCoord4i); if (glad_glMultiTexCoord4i != glad_lazy_glMultiTexCoord4i) glad_glMultiTexCoord4i(target, s, t, r, q); }
+static void APIENTRY glad_lazy_glMultiTexCoord4iv(GLenum target, const GLint *v) { glad_glMultiTexCoord4iv = (PFNGLMULTITEXCOORD4IVPROC)glad_lazy_resolve("glMultiTexCoord4iv", (GLADlazyproc)glad_lazy_glMultiTexCoord4iv); if (glad_glMultiTexCoord4iv != glad_lazy_glMultiTexCoord4iv) glad_glMultiTexCoord4iv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) { glad_glMultiTexCoord4s = (PFNGLMULTITEXCOORD4SPROC)glad_lazy_resolve("glMultiTexCoord4s", (GLADlazyproc)glad_lazy_glMultiTexCoord4s); if (glad_glMultiTexCoord4s != glad_lazy_glMultiTexCoord4s) glad_glMultiTexCoord4s(target, s, t, r, q); }
+static void APIENTRY glad_lazy_glMultiTexCoord4sv(GLenum target, const GLshort *v) { glad_glMultiTexCoord4sv = (PFNGLMULTITEXCOORD4SVPROC)glad_lazy_resolve("glMultiTexCoord4sv", (GLADlazyproc)glad_lazy_glMultiTexCoord4sv); if (glad_glMultiTexCoord4sv != glad_lazy_glMultiTexCoord4sv) glad_glMultiTexCoord4sv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) { glad_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)glad_lazy_resolve("glMultiTexCoordP1ui", (GLADlazyproc)glad_lazy_glMultiTexCoordP1ui); if (glad_glMultiTexCoordP1ui != glad_lazy_glMultiTexCoordP1ui) glad_glMultiTexCoordP1ui(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) { glad_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)glad_lazy_resolve("glMultiTexCoordP1uiv", (GLADlazyproc)glad_lazy_glMultiTexCoordP1uiv); if (glad_glMultiTexCoordP1uiv != glad_lazy_glMultiTexCoordP1uiv) glad_glMultiTexCoordP1uiv(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) { glad_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)glad_lazy_resolve("glMultiTexCoordP2ui", (GLADlazyproc)glad_lazy_glMultiTexCoordP2ui); if (glad_glMultiTexCoordP2ui != glad_lazy_glMultiTexCoordP2ui) glad_glMultiTexCoordP2ui(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) { glad_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)glad_lazy_resolve("glMultiTexCoordP2uiv", (GLADlazyproc)glad_lazy_glMultiTexCoordP2uiv); if (glad_glMultiTexCoordP2uiv != glad_lazy_glMultiTexCoordP2uiv) glad_glMultiTexCoordP2uiv(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) { glad_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)glad_lazy_resolve("glMultiTexCoordP3ui", (GLADlazyproc)glad_lazy_glMultiTexCoordP3ui); if (glad_glMultiTexCoordP3ui != glad_lazy_glMultiTexCoordP3ui) glad_glMultiTexCoordP3ui(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) { glad_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)glad_lazy_resolve("glMultiTexCoordP3uiv", (GLADlazyproc)glad_lazy_glMultiTexCoordP3uiv); if (glad_glMultiTexCoordP3uiv != glad_lazy_glMultiTexCoordP3uiv) glad_glMultiTexCoordP3uiv(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) { glad_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)glad_lazy_resolve("glMultiTexCoordP4ui", (GLADlazyproc)glad_lazy_glMultiTexCoordP4ui); if (glad_glMultiTexCoordP4ui != glad_lazy_glMultiTexCoordP4ui) glad_glMultiTexCoordP4ui(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) { glad_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)glad_lazy_resolve("glMultiTexCoordP4uiv", (GLADlazyproc)glad_lazy_glMultiTexCoordP4uiv); if (glad_glMultiTexCoordP4uiv != glad_lazy_glMultiTexCoordP4uiv) glad_glMultiTexCoordP4uiv(texture, type, coords); }
+static void APIENTRY glad_lazy_glNewList(GLuint list, GLenum mode) { glad_glNewList = (PFNGLNEWLISTPROC)glad_lazy_resolve("glNewList", (GLADlazyproc)glad_lazy_glNewList); if (glad_glNewList != glad_lazy_glNewList) glad_glNewList(list, mode); }
+static void APIENTRY glad_lazy_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz) { glad_glNormal3b = (PFNGLNORMAL3BPROC)glad_lazy_resolve("glNormal3b", (GLADlazyproc)glad_lazy_glNormal3b); if (glad_glNormal3b != glad_lazy_glNormal3b) glad_glNormal3b(nx, ny, nz); }
+static void APIENTRY glad_lazy_glNormal3bv(const GLbyte *v) { glad_glNormal3bv = (PFNGLNORMAL3BVPROC)glad_lazy_resolve("glNormal3bv", (GLADlazyproc)glad_lazy_glNormal3bv); if (glad_glNormal3bv != glad_lazy_glNormal3bv) glad_glNormal3bv(v); }
+static void APIENTRY glad_lazy_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz) { glad_glNormal3d = (PFNGLNORMAL3DPROC)glad_lazy_resolve("glNormal3d", (GLADlazyproc)glad_lazy_glNormal3d); if (glad_glNormal3d != glad_lazy_glNormal3d) glad_glNormal3d(nx, ny, nz); }
+static void APIENTRY glad_lazy_glNormal3dv(const GLdouble *v) { glad_glNormal3dv = (PFNGLNORMAL3DVPROC)glad_lazy_resolve("glNormal3dv", (GLADlazyproc)glad_lazy_glNormal3dv); if (glad_glNormal3dv != glad_lazy_glNormal3dv) glad_glNormal3dv(v); }
+static void APIENTRY glad_lazy_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) { glad_glNormal3f = (PFNGLNORMAL3FPROC)glad_lazy_resolve("glNormal3f", (GLADlazyproc)glad_lazy_glNormal3f); if (glad_glNormal3f != glad_lazy_glNormal3f) glad_glNormal3f(nx, ny, nz); }
+static void APIENTRY glad_lazy_glNormal3fv(const GLfloat *v) { glad_glNormal3fv = (PFNGLNORMAL3FVPROC)glad_lazy_resolve("glNormal3fv", (GLADlazyproc)glad_lazy_glNormal3fv); if (glad_glNormal3fv != glad_lazy_glNormal3fv) glad_glNormal3fv(v); }
+static void APIENTRY glad_lazy_glNormal3i(GLint nx, GLint ny, GLint nz) { glad_glNormal3i = (PFNGLNORMAL3IPROC)glad_lazy_resolve("glNormal3i", (GLADlazyproc)glad_lazy_glNormal3i); if (glad_glNormal3i != glad_lazy_glNormal3i) glad_glNormal3i(nx, ny, nz); }
+static void APIENTRY glad_lazy_glNormal3iv(const GLint *v) { glad_glNormal3iv = (PFNGLNORMAL3IVPROC)glad_lazy_resolve("glNormal3iv", (GLADlazyproc)glad_lazy_glNormal3iv); if (glad_glNormal3iv != glad_lazy_glNormal3iv) glad_glNormal3iv(v); }
+static void APIENTRY glad_lazy_glNormal3s(GLshort nx, GLshort ny, GLshort nz) { glad_glNormal3s = (PFNGLNORMAL3SPROC)glad_lazy_resolve("glNormal3s", (GLADlazyproc)glad_lazy_glNormal3s); if (glad_glNormal3s != glad_lazy_glNormal3s) glad_glNormal3s(nx, ny, nz); }
+static void APIENTRY glad_lazy_glNormal3sv(const GLshort *v) { glad_glNormal3sv = (PFNGLNORMAL3SVPROC)glad_lazy_resolve("glNormal3sv", (GLADlazyproc)glad_lazy_glNormal3sv); if (glad_glNormal3sv != glad_lazy_glNormal3sv) glad_glNormal3sv(v); }
+static void APIENTRY glad_lazy_glNormalP3ui(GLenum type, GLuint coords) { glad_glNormalP3ui = (PFNGLNORMALP3UIPROC)glad_lazy_resolve("glNormalP3ui", (GLADlazyproc)glad_lazy_glNormalP3ui); if (glad_glNormalP3ui != glad_lazy_glNormalP3ui) glad_glNormalP3ui(type, coords); }
+static void APIENTRY glad_lazy_glNormalP3uiv(GLenum type, const GLuint *coords) { glad_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)glad_lazy_resolve("glNormalP3uiv", (GLADlazyproc)glad_lazy_glNormalP3uiv); if (glad_glNormalP3uiv != glad_lazy_glNormalP3uiv) glad_glNormalP3uiv(type, coords); }
+static void APIENTRY glad_lazy_glNormalPointer(GLenum type, GLsizei stride, const void *pointer) { glad_glNormalPointer = (PFNGLNORMALPOINTERPROC)glad_lazy_resolve("glNormalPointer", (GLADlazyproc)glad_lazy_glNormalPointer); if (glad_glNormalPointer != glad_lazy_glNormalPointer) glad_glNormalPointer(type, stride, pointer); }
+static void APIENTRY glad_lazy_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) { glad_glOrtho = (PFNGLORTHOPROC)glad_lazy_resolve("glOrtho", (GLADlazyproc)glad_lazy_glOrtho); if (glad_glOrtho != glad_lazy_glOrtho) glad_glOrtho(left, right, bottom, top, zNear, zFar); }
+static void APIENTRY glad_lazy_glPassThrough(GLfloat token) { glad_glPassThrough = (PFNGLPASSTHROUGHPROC)glad_lazy_resolve("glPassThrough", (GLADlazyproc)glad_lazy_glPassThrough); if (glad_glPassThrough != glad_lazy_glPassThrough) glad_glPassThrough(token); }
+static void APIENTRY glad_lazy_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values) { glad_glPixelMapfv = (PFNGLPIXELMAPFVPROC)glad_lazy_resolve("glPixelMapfv", (GLADlazyproc)glad_lazy_glPixelMapfv); if (glad_glPixelMapfv != glad_lazy_glPixelMapfv) glad_glPixelMapfv(map, mapsize, values); }
+static void APIENTRY glad_lazy_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values) { glad_glPixelMapuiv = (PFNGLPIXELMAPUIVPROC)glad_lazy_resolve("glPixelMapuiv", (GLADlazyproc)glad_lazy_glPixelMapuiv); if (glad_glPixelMapuiv != glad_lazy_glPixelMapuiv) glad_glPixelMapuiv(map, mapsize, values); }
+static void APIENTRY glad_lazy_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values) { glad_glPixelMapusv = (PFNGLPIXELMAPUSVPROC)glad_lazy_resolve("glPixelMapusv", (GLADlazyproc)glad_lazy_glPixelMapusv); if (glad_glPixelMapusv != glad_lazy_glPixelMapusv) glad_glPixelMapusv(map, mapsize, values); }
+static void APIENTRY glad_lazy_glPixelStoref(GLenum pname, GLfloat param) { glad_glPixelStoref = (PFNGLPIXELSTOREFPROC)glad_lazy_resolve("glPixelStoref", (GLADlazyproc)glad_lazy_glPixelStoref); if (glad_glPixelStoref != glad_lazy_glPixelStoref) glad_glPixelStoref(pname, param); }
+static void APIENTRY glad_lazy_glPixelStorei(GLenum pname, GLint param) { glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)glad_lazy_resolve("glPixelStorei", (GLADlazyproc)glad_lazy_glPixelStorei); if (glad_glPixelStorei != glad_lazy_glPixelStorei) glad_glPixelStorei(pname, param); }
+static void APIENTRY glad_lazy_glPixelTransferf(GLenum pname, GLfloat param) { glad_glPixelTransferf = (PFNGLPIXELTRANSFERFPROC)glad_lazy_resolve("glPixelTransferf", (GLADlazyproc)glad_lazy_glPixelTransferf); if (glad_glPixelTransferf != glad_lazy_glPixelTransferf) glad_glPixelTransferf(pname, param); }
+static void APIENTRY glad_lazy_glPixelTransferi(GLenum pname, GLint param) { glad_glPixelTransferi = (PFNGLPIXELTRANSFERIPROC)glad_lazy_resolve("glPixelTransferi", (GLADlazyproc)glad_lazy_glPixelTransferi); if (glad_glPixelTransferi != glad_lazy_glPixelTransferi) glad_glPixelTransferi(pname, param); }
+static void APIENTRY glad_lazy_glPixelZoom(GLfloat xfactor, GLfloat yfactor) { glad_glPixelZoom = (PFNGLPIXELZOOMPROC)glad_lazy_resolve("glPixelZoom", (GLADlazyproc)glad_lazy_glPixelZoom); if (glad_glPixelZoom != glad_lazy_glPixelZoom) glad_glPixelZoom(xfactor, yfactor); }
+static void APIENTRY glad_lazy_glPointParameterf(GLenum pname, GLfloat param) { glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)glad_lazy_resolve("glPointParameterf", (GLADlazyproc)glad_lazy_glPointParameterf); if (glad_glPointParameterf != glad_lazy_glPointParameterf) glad_glPointParameterf(pname, param); }
+static void APIENTRY glad_lazy_glPointParameterfv(GLenum pname, const GLfloat *params) { glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)glad_lazy_resolve("glPointParameterfv", (GLADlazyproc)glad_lazy_glPointParameterfv); if (glad_glPointParameterfv != glad_lazy_glPointParameterfv) glad_glPointParameterfv(pname, params); }
+static void APIENTRY glad_lazy_glPointParameteri(GLenum pname, GLint param) { glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)glad_lazy_resolve("glPointParameteri", (GLADlazyproc)glad_lazy_glPointParameteri); if (glad_glPointParameteri != glad_lazy_glPointParameteri) glad_glPointParameteri(pname, param); }
+static void APIENTRY glad_lazy_glPointParameteriv(GLenum pname, const GLint *params) { glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)glad_lazy_resolve("glPointParameteriv", (GLADlazyproc)glad_lazy_glPointParameteriv); if (glad_glPointParameteriv != glad_lazy_glPointParameteriv) glad_glPointParameteriv(pname, params); }
+static void APIENTRY glad_lazy_glPointSize(GLfloat size) { glad_glPointSize = (PFNGLPOINTSIZEPROC)glad_lazy_resolve("glPointSize", (GLADlazyproc)glad_lazy_glPointSize); if (glad_glPointSize != glad_lazy_glPointSize) glad_glPointSize(size); }
+static void APIENTRY glad_lazy_glPolygonMode(GLenum face, GLenum mode) { glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)glad_lazy_resolve("glPolygonMode", (GLADlazyproc)glad_lazy_glPolygonMode); if (glad_glPolygonMode != glad_lazy_glPolygonMode) glad_glPolygonMode(face, mode); }
+static void APIENTRY glad_lazy_glPolygonOffset(GLfloat factor, GLfloat units) { glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)glad_lazy_resolve("glPolygonOffset", (GLADlazyproc)glad_lazy_glPolygonOffset); if (glad_glPolygonOffset != glad_lazy_glPolygonOffset) glad_glPolygonOffset(factor, units); }
+static void APIENTRY glad_lazy_glPolygonStipple(const GLubyte *mask) { glad_glPolygonStipple = (PFNGLPOLYGONSTIPPLEPROC)glad_lazy_resolve("glPolygonStipple", (GLADlazyproc)glad_lazy_glPolygonStipple); if (glad_glPolygonStipple != glad_lazy_glPolygonStipple) glad_glPolygonStipple(mask); }
+static void APIENTRY glad_lazy_glPopAttrib(void) { glad_glPopAttrib = (PFNGLPOPATTRIBPROC)glad_lazy_resolve("glPopAttrib", (GLADlazyproc)glad_lazy_glPopAttrib); if (glad_glPopAttrib != glad_lazy_glPopAttrib) glad_glPopAttrib(); }
+static void APIENTRY glad_lazy_glPopClientAttrib(void) { glad_glPopClientAttrib = (PFNGLPOPCLIENTATTRIBPROC)glad_lazy_resolve("glPopClientAttrib", (GLADlazyproc)glad_lazy_glPopClientAttrib); if (glad_glPopClientAttrib != glad_lazy_glPopClientAttrib) glad_glPopClientAttrib(); }
+static void APIENTRY glad_lazy_glPopMatrix(void) { glad_glPopMatrix = (PFNGLPOPMATRIXPROC)glad_lazy_resolve("glPopMatrix", (GLADlazyproc)glad_lazy_glPopMatrix); if (glad_glPopMatrix != glad_lazy_glPopMatrix) glad_glPopMatrix(); }
+static void APIENTRY glad_lazy_glPopName(void) { glad_glPopName = (PFNGLPOPNAMEPROC)glad_lazy_resolve("glPopName", (GLADlazyproc)glad_lazy_glPopName); if (glad_glPopName != glad_lazy_glPopName) glad_glPopName(); }
+static void APIENTRY glad_lazy_glPrimitiveRestartIndex(GLuint index) { glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)glad_lazy_resolve("glPrimitiveRestartIndex", (GLADlazyproc)glad_lazy_glPrimitiveRestartIndex); if (glad_glPrimitiveRestartIndex != glad_lazy_glPrimitiveRestartIndex) glad_glPrimitiveRestartIndex(index); }
+static void APIENTRY glad_lazy_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *priorities) { glad_glPrioritizeTextures = (PFNGLPRIORITIZETEXTURESPROC)glad_lazy_resolve("glPrioritizeTextures", (GLADlazyproc)glad_lazy_glPrioritizeTextures); if (glad_glPrioritizeTextures != glad_lazy_glPrioritizeTextures) glad_glPrioritizeTextures(n, textures, priorities); }
+static void APIENTRY glad_lazy_glProvokingVertex(GLenum mode) { glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)glad_lazy_resolve("glProvokingVertex", (GLADlazyproc)glad_lazy_glProvokingVertex); if (glad_glProvokingVertex != glad_lazy_glProvokingVertex) glad_glProvokingVertex(mode); }
+static void APIENTRY glad_lazy_glPushAttrib(GLbitfield mask) { glad_glPushAttrib = (PFNGLPUSHATTRIBPROC)glad_lazy_resolve("glPushAttrib", (GLADlazyproc)glad_lazy_glPushAttrib); if (glad_glPushAttrib != glad_lazy_glPushAttrib) glad_glPushAttrib(mask); }
+static void APIENTRY glad_lazy_glPushClientAttrib(GLbitfield mask) { glad_glPushClientAttrib = (PFNGLPUSHCLIENTATTRIBPROC)glad_lazy_resolve("glPushClientAttrib", (GLADlazyproc)glad_lazy_glPushClientAttrib); if (glad_glPushClientAttrib != glad_lazy_glPushClientAttrib) glad_glPushClientAttrib(mask); }
+static void APIENTRY glad_lazy_glPushMatrix(void) { glad_glPushMatrix = (PFNGLPUSHMATRIXPROC)glad_lazy_resolve("glPushMatrix", (GLADlazyproc)glad_lazy_glPushMatrix); if (glad_glPushMatrix != glad_lazy_glPushMatrix) glad_glPushMatrix(); }
+static void APIENTRY glad_lazy_glPushName(GLuint name) { glad_glPushName = (PFNGLPUSHNAMEPROC)glad_lazy_resolve("glPushName", (GLADlazyproc)glad_lazy_glPushName); if (glad_glPushName != glad_lazy_glPushName) glad_glPushName(name); }
+static void APIENTRY glad_lazy_glQueryCounter(GLuint id, GLenum target) { glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)glad_lazy_resolve("glQueryCounter", (GLADlazyproc)glad_lazy_glQueryCounter); if (glad_glQueryCounter != glad_lazy_glQueryCounter) glad_glQueryCounter(id, target); }
+static void APIENTRY glad_lazy_glRasterPos2d(GLdouble x, GLdouble y) { glad_glRasterPos2d = (PFNGLRASTERPOS2DPROC)glad_lazy_resolve("glRasterPos2d", (GLADlazyproc)glad_lazy_glRasterPos2d); if (glad_glRasterPos2d != glad_lazy_glRasterPos2d) glad_glRasterPos2d(x, y); }
+static void APIENTRY glad_lazy_glRasterPos2dv(const GLdouble *v) { glad_glRasterPos2dv = (PFNGLRASTERPOS2DVPROC)glad_lazy_resolve("glRasterPos2dv", (GLADlazyproc)glad_lazy_glRasterPos2dv); if (glad_glRasterPos2dv != glad_lazy_glRasterPos2dv) glad_glRasterPos2dv(v); }
+static void APIENTRY glad_lazy_glRasterPos2f(GLfloat x, GLfloat y) { glad_glRasterPos2f = (PFNGLRASTERPOS2FPROC)glad_lazy_resolve("glRasterPos2f", (GLADlazyproc)glad_lazy_glRasterPos2f); if (glad_glRasterPos2f != glad_lazy_glRasterPos2f) glad_glRasterPos2f(x, y); }
+static void APIENTRY glad_lazy_glRasterPos2fv(const GLfloat *v) { glad_glRasterPos2fv = (PFNGLRASTERPOS2FVPROC)glad_lazy_resolve("glRasterPos2fv", (GLADlazyproc)glad_lazy_glRasterPos2fv); if (glad_glRasterPos2fv != glad_lazy_glRasterPos2fv) glad_glRasterPos2fv(v); }
+static void APIENTRY glad_lazy_glRasterPos2i(GLint x, GLint y) { glad_glRasterPos2i = (PFNGLRASTERPOS2IPROC)glad_lazy_resolve("glRasterPos2i", (GLADlazyproc)glad_lazy_glRasterPos2i); if (glad_glRasterPos2i != glad_lazy_glRasterPos2i) glad_glRasterPos2i(x, y); }
+static void APIENTRY glad_lazy_glRasterPos2iv(const GLint *v) { glad_glRasterPos2iv = (PFNGLRASTERPOS2IVPROC)glad_lazy_resolve("glRasterPos2iv", (GLADlazyproc)glad_lazy_glRasterPos2iv); if (glad_glRasterPos2iv != glad_lazy_glRasterPos2iv) glad_glRasterPos2iv(v); }
+static void APIENTRY glad_lazy_glRasterPos2s(GLshort x, GLshort y) { glad_glRasterPos2s = (PFNGLRASTERPOS2SPROC)glad_lazy_resolve("glRasterPos2s", (GLADlazyproc)glad_lazy_glRasterPos2s); if (glad_glRasterPos2s != glad_lazy_glRasterPos2s) glad_glRasterPos2s(x, y); }
+static void APIENTRY glad_lazy_glRasterPos2sv(const GLshort *v) { glad_glRasterPos2sv = (PFNGLRASTERPOS2SVPROC)glad_lazy_resolve("glRasterPos2sv", (GLADlazyproc)glad_lazy_glRasterPos2sv); if (glad_glRasterPos2sv != glad_lazy_glRasterPos2sv) glad_glRasterPos2sv(v); }
+static void APIENTRY glad_lazy_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z) { glad_glRasterPos3d = (PFNGLRASTERPOS3DPROC)glad_lazy_resolve("glRasterPos3d", (GLADlazyproc)glad_lazy_glRasterPos3d); if (glad_glRasterPos3d != glad_lazy_glRasterPos3d) glad_glRasterPos3d(x, y, z); }
+static void APIENTRY glad_lazy_glRasterPos3dv(const GLdouble *v) { glad_glRasterPos3dv = (PFNGLRASTERPOS3DVPROC)glad_lazy_resolve("glRasterPos3dv", (GLADlazyproc)glad_lazy_glRasterPos3dv); if (glad_glRasterPos3dv != glad_lazy_glRasterPos3dv) glad_glRasterPos3dv(v); }
+static void APIENTRY glad_lazy_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z) { glad_glRasterPos3f = (PFNGLRASTERPOS3FPROC)glad_lazy_resolve("glRasterPos3f", (GLADlazyproc)glad_lazy_glRasterPos3f); if (glad_glRasterPos3f != glad_lazy_glRasterPos3f) glad_glRasterPos3f(x, y, z); }
+static void APIENTRY glad_lazy_glRasterPos3fv(const GLfloat *v) { glad_glRasterPos3fv = (PFNGLRASTERPOS3FVPROC)glad_lazy_resolve("glRasterPos3fv", (GLADlazyproc)glad_lazy_glRasterPos3fv); if (glad_glRasterPos3fv != glad_lazy_glRasterPos3fv) glad_glRasterPos3fv(v); }
+static void APIENTRY glad_lazy_glRasterPos3i(GLint x, GLint y, GLint z) { glad_glRasterPos3i = (PFNGLRASTERPOS3IPROC)glad_lazy_resolve("glRasterPos3i", (GLADlazyproc)glad_lazy_glRasterPos3i); if (glad_glRasterPos3i != glad_lazy_glRasterPos3i) glad_glRasterPos3i(x, y, z); }
+static void APIENTRY glad_lazy_glRasterPos3iv(const GLint *v) { glad_glRasterPos3iv = (PFNGLRASTERPOS3IVPROC)glad_lazy_resolve("glRasterPos3iv", (GLADlazyproc)glad_lazy_glRasterPos3iv); if (glad_glRasterPos3iv != glad_lazy_glRasterPos3iv) glad_glRasterPos3iv(v); }
+static void APIENTRY glad_lazy_glRasterPos3s(GLshort x, GLshort y, GLshort z) { glad_glRasterPos3s = (PFNGLRASTERPOS3SPROC)glad_lazy_resolve("glRasterPos3s", (GLADlazyproc)glad_lazy_glRasterPos3s); if (glad_glRasterPos3s != glad_lazy_glRasterPos3s) glad_glRasterPos3s(x, y, z); }
+static void APIENTRY glad_lazy_glRasterPos3sv(const GLshort *v) { glad_glRasterPos3sv = (PFNGLRASTERPOS3SVPROC)glad_lazy_resolve("glRasterPos3sv", (GLADlazyproc)glad_lazy_glRasterPos3sv); if (glad_glRasterPos3sv != glad_lazy_glRasterPos3sv) glad_glRasterPos3sv(v); }
+static void APIENTRY glad_lazy_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) { glad_glRasterPos4d = (PFNGLRASTERPOS4DPROC)glad_lazy_resolve("glRasterPos4d", (GLADlazyproc)glad_lazy_glRasterPos4d); if (glad_glRasterPos4d != glad_lazy_glRasterPos4d) glad_glRasterPos4d(x, y, z, w); }
+static void APIENTRY glad_lazy_glRasterPos4dv(const GLdouble *v) { glad_glRasterPos4dv = (PFNGLRASTERPOS4DVPROC)glad_lazy_resolve("glRasterPos4dv", (GLADlazyproc)glad_lazy_glRasterPos4dv); if (glad_glRasterPos4dv != glad_lazy_glRasterPos4dv) glad_glRasterPos4dv(v); }
+static void APIENTRY glad_lazy_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) { glad_glRasterPos4f = (PFNGLRASTERPOS4FPROC)glad_lazy_resolve("glRasterPos4f", (GLADlazyproc)glad_lazy_glRasterPos4f); if (glad_glRasterPos4f != glad_lazy_glRasterPos4f) glad_glRasterPos4f(x, y, z, w); }
+static void APIENTRY glad_lazy_glRasterPos4fv(const GLfloat *v) { glad_glRasterPos4fv = (PFNGLRASTERPOS4FVPROC)glad_lazy_resolve("glRasterPos4fv", (GLADlazyproc)glad_lazy_glRasterPos4fv); if (glad_glRasterPos4fv != glad_lazy_glRasterPos4fv) glad_glRasterPos4fv(v); }
+static void APIENTRY glad_lazy_glRasterPos4i(GLint x, GLint y, GLint z, GLint w) { glad_glRasterPos4i = (PFNGLRASTERPOS4IPROC)glad_lazy_resolve("glRasterPos4i", (GLADlazyproc)glad_lazy_glRasterPos4i); if (glad_glRasterPos4i != glad_lazy_glRasterPos4i) glad_glRasterPos4i(x, y, z, w); }
+static void APIENTRY glad_lazy_glRasterPos4iv(const GLint *v) { glad_glRasterPos4iv = (PFNGLRASTERPOS4IVPROC)glad_lazy_resolve("glRasterPos4iv", (GLADlazyproc)glad_lazy_glRasterPos4iv); if (glad_glRasterPos4iv != glad_lazy_glRasterPos4iv) glad_glRasterPos4iv(v); }
+static void APIENTRY glad_lazy_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w) { glad_glRasterPos4s = (PFNGLRASTERPOS4SPROC)glad_lazy_resolve("glRasterPos4s", (GLADlazyproc)glad_lazy_glRasterPos4s); if (glad_glRasterPos4s != glad_lazy_glRasterPos4s) glad_glRasterPos4s(x, y, z, w); }
+static void APIENTRY glad_lazy_glRasterPos4sv(const GLshort *v) { glad_glRasterPos4sv = (PFNGLRASTERPOS4SVPROC)glad_lazy_resolve("glRasterPos4sv", (GLADlazyproc)glad_lazy_glRasterPos4sv); if (glad_glRasterPos4sv != glad_lazy_glRasterPos4sv) glad_glRasterPos4sv(v); }
+static void APIENTRY glad_lazy_glReadBuffer(GLenum src) { glad_glReadBuffer = (PFNGLREADBUFFERPROC)glad_lazy_resolve("glReadBuffer", (GLADlazyproc)glad_lazy_glReadBuffer); if (glad_glReadBuffer != glad_lazy_glReadBuffer) glad_glReadBuffer(src); }
+static void APIENTRY glad_lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) { glad_glReadPixels = (PFNGLREADPIXELSPROC)glad_lazy_resolve("glReadPixels", (GLADlazyproc)glad_lazy_glReadPixels); if (glad_glReadPixels != glad_lazy_glReadPixels) glad_glReadPixels(x, y, width, height, format, type, pixels); }
+static void APIENTRY glad_lazy_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2) { glad_glRectd = (PFNGLRECTDPROC)glad_lazy_resolve("glRectd", (GLADlazyproc)glad_lazy_glRectd); if (glad_glRectd != glad_lazy_glRectd) glad_glRectd(x1, y1, x2, y2); }
+static void APIENTRY glad_lazy_glRectdv(const GLdouble *v1, const GLdouble *v2) { glad_glRectdv = (PFNGLRECTDVPROC)glad_lazy_resolve("glRectdv", (GLADlazyproc)glad_lazy_glRectdv); if (glad_glRectdv != glad_lazy_glRectdv) glad_glRectdv(v1, v2); }
+static void APIENTRY glad_lazy_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2) { glad_glRectf = (PFNGLRECTFPROC)glad_lazy_resolve("glRectf", (GLADlazyproc)glad_lazy_glRectf); if (glad_glRectf != glad_lazy_glRectf) glad_glRectf(x1, y1, x2, y2); }
+static void APIENTRY glad_lazy_glRectfv(const GLfloat *v1, const GLfloat *v2) { glad_glRectfv = (PFNGLRECTFVPROC)glad_lazy_resolve("glRectfv", (GLADlazyproc)glad_lazy_glRectfv); if (glad_glRectfv != glad_lazy_glRectfv) glad_glRectfv(v1, v2); }
+static void APIENTRY glad_lazy_glRecti(GLint x1, GLint y1, GLint x2, GLint y2) { glad_glRecti = (PFNGLRECTIPROC)glad_lazy_resolve("glRecti", (GLADlazyproc)glad_lazy_glRecti); if (glad_glRecti != glad_lazy_glRecti) glad_glRecti(x1, y1, x2, y2); }
+static void APIENTRY glad_lazy_glRectiv(const GLint *v1, const GLint *v2) { glad_glRectiv = (PFNGLRECTIVPROC)glad_lazy_resolve("glRectiv", (GLADlazyproc)glad_lazy_glRectiv); if (glad_glRectiv != glad_lazy_glRectiv) glad_glRectiv(v1, v2); }
+static void APIENTRY glad_lazy_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2) { glad_glRects = (PFNGLRECTSPROC)glad_lazy_resolve("glRects", (GLADlazyproc)glad_lazy_glRects); if (glad_glRects != glad_lazy_glRects) glad_glRects(x1, y1, x2, y2); }
+static void APIENTRY glad_lazy_glRectsv(const GLshort *v1, const GLshort *v2) { glad_glRectsv = (PFNGLRECTSVPROC)glad_lazy_resolve("glRectsv", (GLADlazyproc)glad_lazy_glRectsv); if (glad_glRectsv != glad_lazy_glRectsv) glad_glRectsv(v1, v2); }
+static GLint APIENTRY glad_lazy_glRenderMode(GLenum mode) { glad_glRenderMode = (PFNGLRENDERMODEPROC)glad_lazy_resolve("glRenderMode", (GLADlazyproc)glad_lazy_glRenderMode); if (glad_glRenderMode == glad_lazy_glRenderMode) return (GLint)0; return glad_glRenderMode(mode); }
+static void APIENTRY glad_lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) { glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)glad_lazy_resolve("glRenderbufferStorage", (GLADlazyproc)glad_lazy_glRenderbufferStorage); if (glad_glRenderbufferStorage != glad_lazy_glRenderbufferStorage) glad_glRenderbufferStorage(target, internalformat, width, height); }
+static void APIENTRY glad_lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) { glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_lazy_resolve("glRenderbufferStorageMultisample", (GLADlazyproc)glad_lazy_glRenderbufferStorageMultisample); if (glad_glRenderbufferStorageMultisample != glad_lazy_glRenderbufferStorageMultisample) glad_glRenderbufferStorageMultisample(target, samples, internalformat, width, height); }
+static void APIENTRY glad_lazy_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z) { glad_glRotated = (PFNGLROTATEDPROC)glad_lazy_resolve("glRotated", (GLADlazyproc)glad_lazy_glRotated); if (glad_glRotated != glad_lazy_glRotated) glad_glRotated(angle, x, y, z); }
+static void APIENTRY glad_lazy_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) { glad_glRotatef = (PFNGLROTATEFPROC)glad_lazy_resolve("glRotatef", (GLADlazyproc)glad_lazy_glRotatef); if (glad_glRotatef != glad_lazy_glRotatef) glad_glRotatef(angle, x, y, z); }
+static void APIENTRY glad_lazy_glSampleCoverage(GLfloat value, GLboolean invert) { glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)glad_lazy_resolve("glSampleCoverage", (GLADlazyproc)glad_lazy_glSampleCoverage); if (glad_glSampleCoverage != glad_lazy_glSampleCoverage) glad_glSampleCoverage(value, invert); }
+static void APIENTRY glad_lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask) { glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC)glad_lazy_resolve("glSampleMaski", (GLADlazyproc)glad_lazy_glSampleMaski); if (glad_glSampleMaski != glad_lazy_glSampleMaski) glad_glSampleMaski(maskNumber, mask); }
+static void APIENTRY glad_lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) { glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)glad_lazy_resolve("glSamplerParameterIiv", (GLADlazyproc)glad_lazy_glSamplerParameterIiv); if (glad_glSamplerParameterIiv != glad_lazy_glSamplerParameterIiv) glad_glSamplerParameterIiv(sampler, pname, param); }
+static void APIENTRY glad_lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) { glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)glad_lazy_resolve("glSamplerParameterIuiv", (GLADlazyproc)glad_lazy_glSamplerParameterIuiv); if (glad_glSamplerParameterIuiv != glad_lazy_glSamplerParameterIuiv) glad_glSamplerParameterIuiv(sampler, pname, param); }
+static void APIENTRY glad_lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) { glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)glad_lazy_resolve("glSamplerParameterf", (GLADlazyproc)glad_lazy_glSamplerParameterf); if (glad_glSamplerParameterf != glad_lazy_glSamplerParameterf) glad_glSamplerParameterf(sampler, pname, param); }
+static void APIENTRY glad_lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) { glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)glad_lazy_resolve("glSamplerParameterfv", (GLADlazyproc)glad_lazy_glSamplerParameterfv); if (glad_glSamplerParameterfv != glad_lazy_glSamplerParameterfv) glad_glSamplerParameterfv(sampler, pname, param); }
+static void APIENTRY glad_lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) { glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)glad_lazy_resolve("glSamplerParameteri", (GLADlazyproc)glad_lazy_glSamplerParameteri); if (glad_glSamplerParameteri != glad_lazy_glSamplerParameteri) glad_glSamplerParameteri(sampler, pname, param); }
+static void APIENTRY glad_lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) { glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)glad_lazy_resolve("glSamplerParameteriv", (GLADlazyproc)glad_lazy_glSamplerParameteriv); if (glad_glSamplerParameteriv != glad_lazy_glSamplerParameteriv) glad_glSamplerParameteriv(sampler, pname, param); }
+static void APIENTRY glad_lazy_glScaled(GLdouble x, GLdouble y, GLdouble z) { glad_glScaled = (PFNGLSCALEDPROC)glad_lazy_resolve("glScaled", (GLADlazyproc)glad_lazy_glScaled); if (glad_glScaled != glad_lazy_glScaled) glad_glScaled(x, y, z); }
+static void APIENTRY glad_lazy_glScalef(GLfloat x, GLfloat y, GLfloat z) { glad_glScalef = (PFNGLSCALEFPROC)glad_lazy_resolve("glScalef", (GLADlazyproc)glad_lazy_glScalef); if (glad_glScalef != glad_lazy_glScalef) glad_glScalef(x, y, z); }
+static void APIENTRY glad_lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) { glad_glScissor = (PFNGLSCISSORPROC)glad_lazy_resolve("glScissor", (GLADlazyproc)glad_lazy_glScissor); if (glad_glScissor != glad_lazy_glScissor) glad_glScissor(x, y, width, height); }
+static void APIENTRY glad_lazy_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue) { glad_glSecondaryColor3b = (PFNGLSECONDARYCOLOR3BPROC)glad_lazy_resolve("glSecondaryColor3b", (GLADlazyproc)glad_lazy_glSecondaryColor3b); if (glad_glSecondaryColor3b != glad_lazy_glSecondaryColor3b) glad_glSecondaryColor3b(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3bv(const GLbyte *v) { glad_glSecondaryColor3bv = (PFNGLSECONDARYCOLOR3BVPROC)glad_lazy_resolve("glSecondaryColor3bv", (GLADlazyproc)glad_lazy_glSecondaryColor3bv); if (glad_glSecondaryColor3bv != glad_lazy_glSecondaryColor3bv) glad_glSecondaryColor3bv(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue) { glad_glSecondaryColor3d = (PFNGLSECONDARYCOLOR3DPROC)glad_lazy_resolve("glSecondaryColor3d", (GLADlazyproc)glad_lazy_glSecondaryColor3d); if (glad_glSecondaryColor3d != glad_lazy_glSecondaryColor3d) glad_glSecondaryColor3d(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3dv(const GLdouble *v) { glad_glSecondaryColor3dv = (PFNGLSECONDARYCOLOR3DVPROC)glad_lazy_resolve("glSecondaryColor3dv", (GLADlazyproc)glad_lazy_glSecondaryColor3dv); if (glad_glSecondaryColor3dv != glad_lazy_glSecondaryColor3dv) glad_glSecondaryColor3dv(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue) { glad_glSecondaryColor3f = (PFNGLSECONDARYCOLOR3FPROC)glad_lazy_resolve("glSecondaryColor3f", (GLADlazyproc)glad_lazy_glSecondaryColor3f); if (glad_glSecondaryColor3f != glad_lazy_glSecondaryColor3f) glad_glSecondaryColor3f(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3fv(const GLfloat *v) { glad_glSecondaryColor3fv = (PFNGLSECONDARYCOLOR3FVPROC)glad_lazy_resolve("glSecondaryColor3fv", (GLADlazyproc)glad_lazy_glSecondaryColor3fv); if (glad_glSecondaryColor3fv != glad_lazy_glSecondaryColor3fv) glad_glSecondaryColor3fv(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3i(GLint red, GLint green, GLint blue) { glad_glSecondaryColor3i = (PFNGLSECONDARYCOLOR3IPROC)glad_lazy_resolve("glSecondaryColor3i", (GLADlazyproc)glad_lazy_glSecondaryColor3i); if (glad_glSecondaryColor3i != glad_lazy_glSecondaryColor3i) glad_glSecondaryColor3i(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3iv(const GLint *v) { glad_glSecondaryColor3iv = (PFNGLSECONDARYCOLOR3IVPROC)glad_lazy_resolve("glSecondaryColor3iv", (GLADlazyproc)glad_lazy_glSecondaryColor3iv); if (glad_glSecondaryColor3iv != glad_lazy_glSecondaryColor3iv) glad_glSecondaryColor3iv(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue) { glad_glSecondaryColor3s = (PFNGLSECONDARYCOLOR3SPROC)glad_lazy_resolve("glSecondaryColor3s", (GLADlazyproc)glad_lazy_glSecondaryColor3s); if (glad_glSecondaryColor3s != glad_lazy_glSecondaryColor3s) glad_glSecondaryColor3s(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3sv(const GLshort *v) { glad_glSecondaryColor3sv = (PFNGLSECONDARYCOLOR3SVPROC)glad_lazy_resolve("glSecondaryColor3sv", (GLADlazyproc)glad_lazy_glSecondaryColor3sv); if (glad_glSecondaryColor3sv != glad_lazy_glSecondaryColor3sv) glad_glSecondaryColor3sv(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue) { glad_glSecondaryColor3ub = (PFNGLSECONDARYCOLOR3UBPROC)glad_lazy_resolve("glSecondaryColor3ub", (GLADlazyproc)glad_lazy_glSecondaryColor3ub); if (glad_glSecondaryColor3ub != glad_lazy_glSecondaryColor3ub) glad_glSecondaryColor3ub(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3ubv(const GLubyte *v) { glad_glSecondaryColor3ubv = (PFNGLSECONDARYCOLOR3UBVPROC)glad_lazy_resolve("glSecondaryColor3ubv", (GLADlazyproc)glad_lazy_glSecondaryColor3ubv); if (glad_glSecondaryColor3ubv != glad_lazy_glSecondaryColor3ubv) glad_glSecondaryColor3ubv(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue) { glad_glSecondaryColor3ui = (PFNGLSECONDARYCOLOR3UIPROC)glad_lazy_resolve("glSecondaryColor3ui", (GLADlazyproc)glad_lazy_glSecondaryColor3ui); if (glad_glSecondaryColor3ui != glad_lazy_glSecondaryColor3ui) glad_glSecondaryColor3ui(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3uiv(const GLuint *v) { glad_glSecondaryColor3uiv = (PFNGLSECONDARYCOLOR3UIVPROC)glad_lazy_resolve("glSecondaryColor3uiv", (GLADlazyproc)glad_lazy_glSecondaryColor3uiv); if (glad_glSecondaryColor3uiv != glad_lazy_glSecondaryColor3uiv) glad_glSecondaryColor3uiv(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue) { glad_glSecondaryColor3us = (PFNGLSECONDARYCOLOR3USPROC)glad_lazy_resolve("glSecondaryColor3us", (GLADlazyproc)glad_lazy_glSecondaryColor3us); if (glad_glSecondaryColor3us != glad_lazy_glSecondaryColor3us) glad_glSecondaryColor3us(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3usv(const GLushort *v) { glad_glSecondaryColor3usv = (PFNGLSECONDARYCOLOR3USVPROC)glad_lazy_resolve("glSecondaryColor3usv", (GLADlazyproc)glad_lazy_glSecondaryColor3usv); if (glad_glSecondaryColor3usv != glad_lazy_glSecondaryColor3usv) glad_glSecondaryColor3usv(v); }
+static void APIENTRY glad_lazy_glSecondaryColorP3ui(GLenum type, GLuint color) { glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)glad_lazy_resolve("glSecondaryColorP3ui", (GLADlazyproc)glad_lazy_glSecondaryColorP3ui); if (glad_glSecondaryColorP3ui != glad_lazy_glSecondaryColorP3ui) glad_glSecondaryColorP3ui(type, color); }
+static void APIENTRY glad_lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color) { glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)glad_lazy_resolve("glSecondaryColorP3uiv", (GLADlazyproc)glad_lazy_glSecondaryColorP3uiv); if (glad_glSecondaryColorP3uiv != glad_lazy_glSecondaryColorP3uiv) glad_glSecondaryColorP3uiv(type, color); }
+static void APIENTRY glad_lazy_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) { glad_glSecondaryColorPointer = (PFNGLSECONDARYCOLORPOINTERPROC)glad_lazy_resolve("glSecondaryColorPointer", (GLADlazyproc)glad_lazy_glSecondaryColorPointer); if (glad_glSecondaryColorPointer != glad_lazy_glSecondaryColorPointer) glad_glSecondaryColorPointer(size, type, stride, pointer); }
+static void APIENTRY glad_lazy_glSelectBuffer(GLsizei size, GLuint *buffer) { glad_glSelectBuffer = (PFNGLSELECTBUFFERPROC)glad_lazy_resolve("glSelectBuffer", (GLADlazyproc)glad_lazy_glSelectBuffer); if (glad_glSelectBuffer != glad_lazy_glSelectBuffer) glad_glSelectBuffer(size, buffer); }
+static void APIENTRY glad_lazy_glShadeModel(GLenum mode) { glad_glShadeModel = (PFNGLSHADEMODELPROC)glad_lazy_resolve("glShadeModel", (GLADlazyproc)glad_lazy_glShadeModel); if (glad_glShadeModel != glad_lazy_glShadeModel) glad_glShadeModel(mode); }
+static void APIENTRY glad_lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) { glad_glShaderSource = (PFNGLSHADERSOURCEPROC)glad_lazy_resolve("glShaderSource", (GLADlazyproc)glad_lazy_glShaderSource); if (glad_glShaderSource != glad_lazy_glShaderSource) glad_glShaderSource(shader, count, string, length); }
+static void APIENTRY glad_lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask) { glad_glStencilFunc = (PFNGLSTENCILFUNCPROC)glad_lazy_resolve("glStencilFunc", (GLADlazyproc)glad_lazy_glStencilFunc); if (glad_glStencilFunc != glad_lazy_glStencilFunc) glad_glStencilFunc(func, ref, mask); }
+static void APIENTRY glad_lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) { glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)glad_lazy_resolve("glStencilFuncSeparate", (GLADlazyproc)glad_lazy_glStencilFuncSeparate); if (glad_glStencilFuncSeparate != glad_lazy_glStencilFuncSeparate) glad_glStencilFuncSeparate(face, func, ref, mask); }
+static void APIENTRY glad_lazy_glStencilMask(GLuint mask) { glad_glStencilMask = (PFNGLSTENCILMASKPROC)glad_lazy_resolve("glStencilMask", (GLADlazyproc)glad_lazy_glStencilMask); if (glad_glStencilMask != glad_lazy_glStencilMask) glad_glStencilMask(mask); }
+static void APIENTRY glad_lazy_glStencilMaskSeparate(GLenum face, GLuint mask) { glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)glad_lazy_resolve("glStencilMaskSeparate", (GLADlazyproc)glad_lazy_glStencilMaskSeparate); if (glad_glStencilMaskSeparate != glad_lazy_glStencilMaskSeparate) glad_glStencilMaskSeparate(face, mask); }
+static void APIENTRY glad_lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) { glad_glStencilOp = (PFNGLSTENCILOPPROC)glad_lazy_resolve("glStencilOp", (GLADlazyproc)glad_lazy_glStencilOp); if (glad_glStencilOp != glad_lazy_glStencilOp) glad_glStencilOp(fail, zfail, zpass); }
+static void APIENTRY glad_lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) { glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)glad_lazy_resolve("glStencilOpSeparate", (GLADlazyproc)glad_lazy_glStencilOpSeparate); if (glad_glStencilOpSeparate != glad_lazy_glStencilOpSeparate) glad_glStencilOpSeparate(face, sfail, dpfail, dppass); }
+static void APIENTRY glad_lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) { glad_glTexBuffer = (PFNGLTEXBUFFERPROC)glad_lazy_resolve("glTexBuffer", (GLADlazyproc)glad_lazy_glTexBuffer); if (glad_glTexBuffer != glad_lazy_glTexBuffer) glad_glTexBuffer(target, internalformat, buffer); }
+static void APIENTRY glad_lazy_glTexCoord1d(GLdouble s) { glad_glTexCoord1d = (PFNGLTEXCOORD1DPROC)glad_lazy_resolve("glTexCoord1d", (GLADlazyproc)glad_lazy_glTexCoord1d); if (glad_glTexCoord1d != glad_lazy_glTexCoord1d) glad_glTexCoord1d(s); }
+static void APIENTRY glad_lazy_glTexCoord1dv(const GLdouble *v) { glad_glTexCoord1dv = (PFNGLTEXCOORD1DVPROC)glad_lazy_resolve("glTexCoord1dv", (GLADlazyproc)glad_lazy_glTexCoord1dv); if (glad_glTexCoord1dv != glad_lazy_glTexCoord1dv) glad_glTexCoord1dv(v); }
+static void APIENTRY glad_lazy_glTexCoord1f(GLfloat s) { glad_glTexCoord1f = (PFNGLTEXCOORD1FPROC)glad_lazy_resolve("glTexCoord1f", (GLADlazyproc)glad_lazy_glTexCoord1f); if (glad_glTexCoord1f != glad_lazy_glTexCoord1f) glad_glTexCoord1f(s); }
+static void APIENTRY glad_lazy_glTexCoord1fv(const GLfloat *v) { glad_glTexCoord1fv = (PFNGLTEXCOORD1FVPROC)glad_lazy_resolve("glTexCoord1fv", (GLADlazyproc)glad_lazy_glTexCoord1fv); if (glad_glTexCoord1fv != glad_lazy_glTexCoord1fv) glad_glTexCoord1fv(v); }
+static void APIENTRY glad_lazy_glTexCoord1i(GLint s) { glad_glTexCoord1i = (PFNGLTEXCOORD1IPROC)glad_lazy_resolve("glTexCoord1i", (GLADlazyproc)glad_lazy_glTexCoord1i); if (glad_glTexCoord1i != glad_lazy_glTexCoord1i) glad_glTexCoord1i(s); }
+static void APIENTRY glad_lazy_glTexCoord1iv(const GLint *v) { glad_glTexCoord1iv = (PFNGLTEXCOORD1IVPROC)glad_lazy_resolve("glTexCoord1iv", (GLADlazyproc)glad_lazy_glTexCoord1iv); if (glad_glTexCoord1iv != glad_lazy_glTexCoord1iv) glad_glTexCoord1iv(v); }
+static void APIENTRY glad_lazy_glTexCoord1s(GLshort s) { glad_glTexCoord1s = (PFNGLTEXCOORD1SPROC)glad_lazy_resolve("glTexCoord1s", (GLADlazyproc)glad_lazy_glTexCoord1s); if (glad_glTexCoord1s != glad_lazy_glTexCoord1s) glad_glTexCoord1s(s); }
+static void APIENTRY glad_lazy_glTexCoord1sv(const GLshort *v) { glad_glTexCoord1sv = (PFNGLTEXCOORD1SVPROC)glad_lazy_resolve("glTexCoord1sv", (GLADlazyproc)glad_lazy_glTexCoord1sv); if (glad_glTexCoord1sv != glad_lazy_glTexCoord1sv) glad_glTexCoord1sv(v); }
+static void APIENTRY glad_lazy_glTexCoord2d(GLdouble s, GLdouble t) { glad_glTexCoord2d = (PFNGLTEXCOORD2DPROC)glad_lazy_resolve("glTexCoord2d", (GLADlazyproc)glad_lazy_glTexCoord2d); if (glad_glTexCoord2d != glad_lazy_glTexCoord2d) glad_glTexCoord2d(s, t); }
+static void APIENTRY glad_lazy_glTexCoord2dv(const GLdouble *v) { glad_glTexCoord2dv = (PFNGLTEXCOORD2DVPROC)glad_lazy_resolve("glTexCoord2dv", (GLADlazyproc)glad_lazy_glTexCoord2dv); if (glad_glTexCoord2dv != glad_lazy_glTexCoord2dv) glad_glTexCoord2dv(v); }
+static void APIENTRY glad_lazy_glTexCoord2f(GLfloat s, GLfloat t) { glad_glTexCoord2f = (PFNGLTEXCOORD2FPROC)glad_lazy_resolve("glTexCoord2f", (GLADlazyproc)glad_lazy_glTexCoord2f); if (glad_glTexCoord2f != glad_lazy_glTexCoord2f) glad_glTexCoord2f(s, t); }
+static void APIENTRY glad_lazy_glTexCoord2fv(const GLfloat *v) { glad_glTexCoord2fv = (PFNGLTEXCOORD2FVPROC)glad_lazy_resolve("glTexCoord2fv", (GLADlazyproc)glad_lazy_glTexCoord2fv); if (glad_glTexCoord2fv != glad_lazy_glTexCoord2fv) glad_glTexCoord2fv(v); }
+static void APIENTRY glad_lazy_glTexCoord2i(GLint s, GLint t) { glad_glTexCoord2i = (PFNGLTEXCOORD2IPROC)glad_lazy_resolve("glTexCoord2i", (GLADlazyproc)glad_lazy_glTexCoord2i); if (glad_glTexCoord2i != glad_lazy_glTexCoord2i) glad_glTexCoord2i(s, t); }
+static void APIENTRY glad_lazy_glTexCoord2iv(const GLint *v) { glad_glTexCoord2iv = (PFNGLTEXCOORD2IVPROC)glad_lazy_resolve("glTexCoord2iv", (GLADlazyproc)glad_lazy_glTexCoord2iv); if (glad_glTexCoord2iv != glad_lazy_glTexCoord2iv) glad_glTexCoord2iv(v); }
+static void APIENTRY glad_lazy_glTexCoord2s(GLshort s, GLshort t) { glad_glTexCoord2s = (PFNGLTEXCOORD2SPROC)glad_lazy_resolve("glTexCoord2s", (GLADlazyproc)glad_lazy_glTexCoord2s); if (glad_glTexCoord2s != glad_lazy_glTexCoord2s) glad_glTexCoord2s(s, t); }
+static void APIENTRY glad_lazy_glTexCoord2sv(const GLshort *v) { glad_glTexCoord2sv = (PFNGLTEXCOORD2SVPROC)glad_lazy_resolve("glTexCoord2sv", (GLADlazyproc)glad_lazy_glTexCoord2sv); if (glad_glTexCoord2sv != glad_lazy_glTexCoord2sv) glad_glTexCoord2sv(v); }
+static void APIENTRY glad_lazy_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r) { glad_glTexCoord3d = (PFNGLTEXCOORD3DPROC)glad_lazy_resolve("glTexCoord3d", (GLADlazyproc)glad_lazy_glTexCoord3d); if (glad_glTexCoord3d != glad_lazy_glTexCoord3d) glad_glTexCoord3d(s, t, r); }
+static void APIENTRY glad_lazy_glTexCoord3dv(const GLdouble *v) { glad_glTexCoord3dv = (PFNGLTEXCOORD3DVPROC)glad_lazy_resolve("glTexCoord3dv", (GLADlazyproc)glad_lazy_glTexCoord3dv); if (glad_glTexCoord3dv != glad_lazy_glTexCoord3dv) glad_glTexCoord3dv(v); }
+static void APIENTRY glad_lazy_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r) { glad_glTexCoord3f = (PFNGLTEXCOORD3FPROC)glad_lazy_resolve("glTexCoord3f", (GLADlazyproc)glad_lazy_glTexCoord3f); if (glad_glTexCoord3f != glad_lazy_glTexCoord3f) glad_glTexCoord3f(s, t, r); }
+static void APIENTRY glad_lazy_glTexCoord3fv(const GLfloat *v) { glad_glTexCoord3fv = (PFNGLTEXCOORD3FVPROC)glad_lazy_resolve("glTexCoord3fv", (GLADlazyproc)glad_lazy_glTexCoord3fv); if (glad_glTexCoord3fv != glad_lazy_glTexCoord3fv) glad_glTexCoord3fv(v); }
+static void APIENTRY glad_lazy_glTexCoord3i(GLint s, GLint t, GLint r) { glad_glTexCoord3i = (PFNGLTEXCOORD3IPROC)glad_lazy_resolve("glTexCoord3i", (GLADlazyproc)glad_lazy_glTexCoord3i); if (glad_glTexCoord3i != glad_lazy_glTexCoord3i) glad_glTexCoord3i(s, t, r); }
+static void APIENTRY glad_lazy_glTexCoord3iv(const GLint *v) { glad_glTexCoord3iv = (PFNGLTEXCOORD3IVPROC)glad_lazy_resolve("glTexCoord3iv", (GLADlazyproc)glad_lazy_glTexCoord3iv); if (glad_glTexCoord3iv != glad_lazy_glTexCoord3iv) glad_glTexCoord3iv(v); }
+static void APIENTRY glad_lazy_glTexCoord3s(GLshort s, GLshort t, GLshort r) { glad_glTexCoord3s = (PFNGLTEXCOORD3SPROC)glad_lazy_resolve("glTexCoord3s", (GLADlazyproc)glad_lazy_glTexCoord3s); if (glad_glTexCoord3s != glad_lazy_glTexCoord3s) glad_glTexCoord3s(s, t, r); }
+static void APIENTRY glad_lazy_glTexCoord3sv(const GLshort *v) { glad_glTexCoord3sv = (PFNGLTEXCOORD3SVPROC)glad_lazy_resolve("glTexCoord3sv", (GLADlazyproc)glad_lazy_glTexCoord3sv); if (glad_glTexCoord3sv != glad_lazy_glTexCoord3sv) glad_glTexCoord3sv(v); }
+static void APIENTRY glad_lazy_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q) { glad_glTexCoord4d = (PFNGLTEXCOORD4DPROC)glad_lazy_resolve("glTexCoord4d", (GLADlazyproc)glad_lazy_glTexCoord4d); if (glad_glTexCoord4d != glad_lazy_glTexCoord4d) glad_glTexCoord4d(s, t, r, q); }
+static void APIENTRY glad_lazy_glTexCoord4dv(const GLdouble *v) { glad_glTexCoord4dv = (PFNGLTEXCOORD4DVPROC)glad_lazy_resolve("glTexCoord4dv", (GLADlazyproc)glad_lazy_glTexCoord4dv); if (glad_glTexCoord4dv != glad_lazy_glTexCoord4dv) glad_glTexCoord4dv(v); }
+static void APIENTRY glad_lazy_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q) { glad_glTexCoord4f = (PFNGLTEXCOORD4FPROC)glad_lazy_resolve("glTexCoord4f", (GLADlazyproc)glad_lazy_glTexCoord4f); if (glad_glTexCoord4f != glad_lazy_glTexCoord4f) glad_glTexCoord4f(s, t, r, q); }
+static void APIENTRY glad_lazy_glTexCoord4fv(const GLfloat *v) { glad_glTexCoord4fv = (PFNGLTEXCOORD4FVPROC)glad_lazy_resolve("glTexCoord4fv", (GLADlazyproc)glad_lazy_glTexCoord4fv); if (glad_glTexCoord4fv != glad_lazy_glTexCoord4fv) glad_glTexCoord4fv(v); }
+static void APIENTRY glad_lazy_glTexCoord4i(GLint s, GLint t, GLint r, GLint q) { glad_glTexCoord4i = (PFNGLTEXCOORD4IPROC)glad_lazy_resolve("glTexCoord4i", (GLADlazyproc)glad_lazy_glTexCoord4i); if (glad_glTexCoord4i != glad_lazy_glTexCoord4i) glad_glTexCoord4i(s, t, r, q); }
+static void APIENTRY glad_lazy_glTexCoord4iv(const GLint *v) { glad_glTexCoord4iv = (PFNGLTEXCOORD4IVPROC)glad_lazy_resolve("glTexCoord4iv", (GLADlazyproc)glad_lazy_glTexCoord4iv); if (glad_glTexCoord4iv != glad_lazy_glTexCoord4iv) glad_glTexCoord4iv(v); }
+static void APIENTRY glad_lazy_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q) { glad_glTexCoord4s = (PFNGLTEXCOORD4SPROC)glad_lazy_resolve("glTexCoord4s", (GLADlazyproc)glad_lazy_glTexCoord4s); if (glad_glTexCoord4s != glad_lazy_glTexCoord4s) glad_glTexCoord4s(s, t, r, q); }
+static void APIENTRY glad_lazy_glTexCoord4sv(const GLshort *v) { glad_glTexCoord4sv = (PFNGLTEXCOORD4SVPROC)glad_lazy_resolve("glTexCoord4sv", (GLADlazyproc)glad_lazy_glTexCoord4sv); if (glad_glTexCoord4sv != glad_lazy_glTexCoord4sv) glad_glTexCoord4sv(v); }
+static void APIENTRY glad_lazy_glTexCoordP1ui(GLenum type, GLuint coords) { glad_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)glad_lazy_resolve("glTexCoordP1ui", (GLADlazyproc)glad_lazy_glTexCoordP1ui); if (glad_glTexCoordP1ui != glad_lazy_glTexCoordP1ui) glad_glTexCoordP1ui(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords) { glad_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)glad_lazy_resolve("glTexCoordP1uiv", (GLADlazyproc)glad_lazy_glTexCoordP1uiv); if (glad_glTexCoordP1uiv != glad_lazy_glTexCoordP1uiv) glad_glTexCoordP1uiv(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP2ui(GLenum type, GLuint coords) { glad_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)glad_lazy_resolve("glTexCoordP2ui", (GLADlazyproc)glad_lazy_glTexCoordP2ui); if (glad_glTexCoordP2ui != glad_lazy_glTexCoordP2ui) glad_glTexCoordP2ui(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords) { glad_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)glad_lazy_resolve("glTexCoordP2uiv", (GLADlazyproc)glad_lazy_glTexCoordP2uiv); if (glad_glTexCoordP2uiv != glad_lazy_glTexCoordP2uiv) glad_glTexCoordP2uiv(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP3ui(GLenum type, GLuint coords) { glad_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)glad_lazy_resolve("glTexCoordP3ui", (GLADlazyproc)glad_lazy_glTexCoordP3ui); if (glad_glTexCoordP3ui != glad_lazy_glTexCoordP3ui) glad_glTexCoordP3ui(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords) { glad_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)glad_lazy_resolve("glTexCoordP3uiv", (GLADlazyproc)glad_lazy_glTexCoordP3uiv); if (glad_glTexCoordP3uiv != glad_lazy_glTexCoordP3uiv) glad_glTexCoordP3uiv(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP4ui(GLenum type, GLuint coords) { glad_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)glad_lazy_resolve("glTexCoordP4ui", (GLADlazyproc)glad_lazy_glTexCoordP4ui); if (glad_glTexCoordP4ui != glad_lazy_glTexCoordP4ui) glad_glTexCoordP4ui(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords) { glad_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)glad_lazy_resolve("glTexCoordP4uiv", (GLADlazyproc)glad_lazy_glTexCoordP4uiv); if (glad_glTexCoordP4uiv != glad_lazy_glTexCoordP4uiv) glad_glTexCoordP4uiv(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) { glad_glTexCoordPointer = (PFNGLTEXCOORDPOINTERPROC)glad_lazy_resolve("glTexCoordPointer", (GLADlazyproc)glad_lazy_glTexCoordPointer); if (glad_glTexCoordPointer != glad_lazy_glTexCoordPointer) glad_glTexCoordPointer(size, type, stride, pointer); }
+static void APIENTRY glad_lazy_glTexEnvf(GLenum target, GLenum pname, GLfloat param) { glad_glTexEnvf = (PFNGLTEXENVFPROC)glad_lazy_resolve("glTexEnvf", (GLADlazyproc)glad_lazy_glTexEnvf); if (glad_glTexEnvf != glad_lazy_glTexEnvf) glad_glTexEnvf(target, pname, param); }
+static void APIENTRY glad_lazy_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params) { glad_glTexEnvfv = (PFNGLTEXENVFVPROC)glad_lazy_resolve("glTexEnvfv", (GLADlazyproc)glad_lazy_glTexEnvfv); if (glad_glTexEnvfv != glad_lazy_glTexEnvfv) glad_glTexEnvfv(target, pname, params); }
+static void APIENTRY glad_lazy_glTexEnvi(GLenum target, GLenum pname, GLint param) { glad_glTexEnvi = (PFNGLTEXENVIPROC)glad_lazy_resolve("glTexEnvi", (GLADlazyproc)glad_lazy_glTexEnvi); if (glad_glTexEnvi != glad_lazy_glTexEnvi) glad_glTexEnvi(target, pname, param); }
+static void APIENTRY glad_lazy_glTexEnviv(GLenum target, GLenum pname, const GLint *params) { glad_glTexEnviv = (PFNGLTEXENVIVPROC)glad_lazy_resolve("glTexEnviv", (GLADlazyproc)glad_lazy_glTexEnviv); if (glad_glTexEnviv != glad_lazy_glTexEnviv) glad_glTexEnviv(target, pname, params); }
+static void APIENTRY glad_lazy_glTexGend(GLenum coord, GLenum pname, GLdouble param) { glad_glTexGend = (PFNGLTEXGENDPROC)glad_lazy_resolve("glTexGend", (GLADlazyproc)glad_lazy_glTexGend); if (glad_glTexGend != glad_lazy_glTexGend) glad_glTexGend(coord, pname, param); }
+static void APIENTRY glad_lazy_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params) { glad_glTexGendv = (PFNGLTEXGENDVPROC)glad_lazy_resolve("glTexGendv", (GLADlazyproc)glad_lazy_glTexGendv); if (glad_glTexGendv != glad_lazy_glTexGendv) glad_glTexGendv(coord, pname, params); }
+static void APIENTRY glad_lazy_glTexGenf(GLenum coord, GLenum pname, GLfloat param) { glad_glTexGenf = (PFNGLTEXGENFPROC)glad_lazy_resolve("glTexGenf", (GLADlazyproc)glad_lazy_glTexGenf); if (glad_glTexGenf != glad_lazy_glTexGenf) glad_glTexGenf(coord, pname, param); }
+static void APIENTRY glad_lazy_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params) { glad_glTexGenfv = (PFNGLTEXGENFVPROC)glad_lazy_resolve("glTexGenfv", (GLADlazyproc)glad_lazy_glTexGenfv); if (glad_glTexGenfv != glad_lazy_glTexGenfv) glad_glTexGenfv(coord, pname, params); }
+static void APIENTRY glad_lazy_glTexGeni(GLenum coord, GLenum pname, GLint param) { glad_glTexGeni = (PFNGLTEXGENIPROC)glad_lazy_resolve("glTexGeni", (GLADlazyproc)glad_lazy_glTexGeni); if (glad_glTexGeni != glad_lazy_glTexGeni) glad_glTexGeni(coord, pname, param); }
+static void APIENTRY glad_lazy_glTexGeniv(GLenum coord, GLenum pname, const GLint *params) { glad_glTexGeniv = (PFNGLTEXGENIVPROC)glad_lazy_resolve("glTexGeniv", (GLADlazyproc)glad_lazy_glTexGeniv); if (glad_glTexGeniv != glad_lazy_glTexGeniv) glad_glTexGeniv(coord, pname, params); }
+static void APIENTRY glad_lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) { glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC)glad_lazy_resolve("glTexImage1D", (GLADlazyproc)glad_lazy_glTexImage1D); if (glad_glTexImage1D != glad_lazy_glTexImage1D) glad_glTexImage1D(target, level, internalformat, width, border, format, type, pixels); }
+static void APIENTRY glad_lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) { glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)glad_lazy_resolve("glTexImage2D", (GLADlazyproc)glad_lazy_glTexImage2D); if (glad_glTexImage2D != glad_lazy_glTexImage2D) glad_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels); }
+static void APIENTRY glad_lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) { glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)glad_lazy_resolve("glTexImage2DMultisample", (GLADlazyproc)glad_lazy_glTexImage2DMultisample); if (glad_glTexImage2DMultisample != glad_lazy_glTexImage2DMultisample) glad_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations); }
+static void APIENTRY glad_lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) { glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC)glad_lazy_resolve("glTexImage3D", (GLADlazyproc)glad_lazy_glTexImage3D); if (glad_glTexImage3D != glad_lazy_glTexImage3D) glad_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels); }
+static void APIENTRY glad_lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) { glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)glad_lazy_resolve("glTexImage3DMultisample", (GLADlazyproc)glad_lazy_glTexImage3DMultisample); if (glad_glTexImage3DMultisample != glad_lazy_glTexImage3DMultisample) glad_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations); }
+static void APIENTRY glad_lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) { glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)glad_lazy_resolve("glTexParameterIiv", (GLADlazyproc)glad_lazy_glTexParameterIiv); if (glad_glTexParameterIiv != glad_lazy_glTexParameterIiv) glad_glTexParameterIiv(target, pname, params); }
+static void APIENTRY glad_lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) { glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)glad_lazy_resolve("glTexParameterIuiv", (GLADlazyproc)glad_lazy_glTexParameterIuiv); if (glad_glTexParameterIuiv != glad_lazy_glTexParameterIuiv) glad_glTexParameterIuiv(target, pname, params); }
+static void APIENTRY glad_lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param) { glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC)glad_lazy_resolve("glTexParameterf", (GLADlazyproc)glad_lazy_glTexParameterf); if (glad_glTexParameterf != glad_lazy_glTexParameterf) glad_glTexParameterf(target, pname, param); }
+static void APIENTRY glad_lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) { glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)glad_lazy_resolve("glTexParameterfv", (GLADlazyproc)glad_lazy_glTexParameterfv); if (glad_glTexParameterfv != glad_lazy_glTexParameterfv) glad_glTexParameterfv(target, pname, params); }
+static void APIENTRY glad_lazy_glTexParameteri(GLenum target, GLenum pname, GLint param) { glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)glad_lazy_resolve("glTexParameteri", (GLADlazyproc)glad_lazy_glTexParameteri); if (glad_glTexParameteri != glad_lazy_glTexParameteri) glad_glTexParameteri(target, pname, param); }
+static void APIENTRY glad_lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) { glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)glad_lazy_resolve("glTexParameteriv", (GLADlazyproc)glad_lazy_glTexParameteriv); if (glad_glTexParameteriv != glad_lazy_glTexParameteriv) glad_glTexParameteriv(target, pname, params); }
+static void APIENTRY glad_lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) { glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)glad_lazy_resolve("glTexSubImage1D", (GLADlazyproc)glad_lazy_glTexSubImage1D); if (glad_glTexSubImage1D != glad_lazy_glTexSubImage1D) glad_glTexSubImage1D(target, level, xoffset, width, format, type, pixels); }
+static void APIENTRY glad_lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) { glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)glad_lazy_resolve("glTexSubImage2D", (GLADlazyproc)glad_lazy_glTexSubImage2D); if (glad_glTexSubImage2D != glad_lazy_glTexSubImage2D) glad_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels); }
+static void APIENTRY glad_lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) { glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)glad_lazy_resolve("glTexSubImage3D", (GLADlazyproc)glad_lazy_glTexSubImage3D); if (glad_glTexSubImage3D != glad_lazy_glTexSubImage3D) glad_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels); }
+static void APIENTRY glad_lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) { glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)glad_lazy_resolve("glTransformFeedbackVaryings", (GLADlazyproc)glad_lazy_glTransformFeedbackVaryings); if (glad_glTransformFeedbackVaryings != glad_lazy_glTransformFeedbackVaryings) glad_glTransformFeedbackVaryings(program, count, varyings, bufferMode); }
+static void APIENTRY glad_lazy_glTranslated(GLdouble x, GLdouble y, GLdouble z) { glad_glTranslated = (PFNGLTRANSLATEDPROC)glad_lazy_resolve("glTranslated", (GLADlazyproc)glad_lazy_glTranslated); if (glad_glTranslated != glad_lazy_glTranslated) glad_glTranslated(x, y, z); }
+static void APIENTRY glad_lazy_glTranslatef(GLfloat x, GLfloat y, GLfloat z) { glad_glTranslatef = (PFNGLTRANSLATEFPROC)glad_lazy_resolve("glTranslatef", (GLADlazyproc)glad_lazy_glTranslatef); if (glad_glTranslatef != glad_lazy_glTranslatef) glad_glTranslatef(x, y, z); }
+static void APIENTRY glad_lazy_glUniform1f(GLint location, GLfloat v0) { glad_glUniform1f = (PFNGLUNIFORM1FPROC)glad_lazy_resolve("glUniform1f", (GLADlazyproc)glad_lazy_glUniform1f); if (glad_glUniform1f != glad_lazy_glUniform1f) glad_glUniform1f(location, v0); }
+static void APIENTRY glad_lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) { glad_glUniform1fv = (PFNGLUNIFORM1FVPROC)glad_lazy_resolve("glUniform1fv", (GLADlazyproc)glad_lazy_glUniform1fv); if (glad_glUniform1fv != glad_lazy_glUniform1fv) glad_glUniform1fv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform1i(GLint location, GLint v0) { glad_glUniform1i = (PFNGLUNIFORM1IPROC)glad_lazy_resolve("glUniform1i", (GLADlazyproc)glad_lazy_glUniform1i); if (glad_glUniform1i != glad_lazy_glUniform1i) glad_glUniform1i(location, v0); }
+static void APIENTRY glad_lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value) { glad_glUniform1iv = (PFNGLUNIFORM1IVPROC)glad_lazy_resolve("glUniform1iv", (GLADlazyproc)glad_lazy_glUniform1iv); if (glad_glUniform1iv != glad_lazy_glUniform1iv) glad_glUniform1iv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform1ui(GLint location, GLuint v0) { glad_glUniform1ui = (PFNGLUNIFORM1UIPROC)glad_lazy_resolve("glUniform1ui", (GLADlazyproc)glad_lazy_glUniform1ui); if (glad_glUniform1ui != glad_lazy_glUniform1ui) glad_glUniform1ui(location, v0); }
+static void APIENTRY glad_lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) { glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)glad_lazy_resolve("glUniform1uiv", (GLADlazyproc)glad_lazy_glUniform1uiv); if (glad_glUniform1uiv != glad_lazy_glUniform1uiv) glad_glUniform1uiv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1) { glad_glUniform2f = (PFNGLUNIFORM2FPROC)glad_lazy_resolve("glUniform2f", (GLADlazyproc)glad_lazy_glUniform2f); if (glad_glUniform2f != glad_lazy_glUniform2f) glad_glUniform2f(location, v0, v1); }
+static void APIENTRY glad_lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) { glad_glUniform2fv = (PFNGLUNIFORM2FVPROC)glad_lazy_resolve("glUniform2fv", (GLADlazyproc)glad_lazy_glUniform2fv); if (glad_glUniform2fv != glad_lazy_glUniform2fv) glad_glUniform2fv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform2i(GLint location, GLint v0, GLint v1) { glad_glUniform2i = (PFNGLUNIFORM2IPROC)glad_lazy_resolve("glUniform2i", (GLADlazyproc)glad_lazy_glUniform2i); if (glad_glUniform2i != glad_lazy_glUniform2i) glad_glUniform2i(location, v0, v1); }
+static void APIENTRY glad_lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value) { glad_glUniform2iv = (PFNGLUNIFORM2IVPROC)glad_lazy_resolve("glUniform2iv", (GLADlazyproc)glad_lazy_glUniform2iv); if (glad_glUniform2iv != glad_lazy_glUniform2iv) glad_glUniform2iv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1) { glad_glUniform2ui = (PFNGLUNIFORM2UIPROC)glad_lazy_resolve("glUniform2ui", (GLADlazyproc)glad_lazy_glUniform2ui); if (glad_glUniform2ui != glad_lazy_glUniform2ui) glad_glUniform2ui(location, v0, v1); }
+static void APIENTRY glad_lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) { glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)glad_lazy_resolve("glUniform2uiv", (GLADlazyproc)glad_lazy_glUniform2uiv); if (glad_glUniform2uiv != glad_lazy_glUniform2uiv) glad_glUniform2uiv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) { glad_glUniform3f = (PFNGLUNIFORM3FPROC)glad_lazy_resolve("glUniform3f", (GLADlazyproc)glad_lazy_glUniform3f); if (glad_glUniform3f != glad_lazy_glUniform3f) glad_glUniform3f(location, v0, v1, v2); }
+static void APIENTRY glad_lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) { glad_glUniform3fv = (PFNGLUNIFORM3FVPROC)glad_lazy_resolve("glUniform3fv", (GLADlazyproc)glad_lazy_glUniform3fv); if (glad_glUniform3fv != glad_lazy_glUniform3fv) glad_glUniform3fv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) { glad_glUniform3i = (PFNGLUNIFORM3IPROC)glad_lazy_resolve("glUniform3i", (GLADlazyproc)glad_lazy_glUniform3i); if (glad_glUniform3i != glad_lazy_glUniform3i) glad_glUniform3i(location, v0, v1, v2); }
+static void APIENTRY glad_lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value) { glad_glUniform3iv = (PFNGLUNIFORM3IVPROC)glad_lazy_resolve("glUniform3iv", (GLADlazyproc)glad_lazy_glUniform3iv); if (glad_glUniform3iv != glad_lazy_glUniform3iv) glad_glUniform3iv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) { glad_glUniform3ui = (PFNGLUNIFORM3UIPROC)glad_lazy_resolve("glUniform3ui", (GLADlazyproc)glad_lazy_glUniform3ui); if (glad_glUniform3ui != glad_lazy_glUniform3ui) glad_glUniform3ui(location, v0, v1, v2); }
+static void APIENTRY glad_lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) { glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)glad_lazy_resolve("glUniform3uiv", (GLADlazyproc)glad_lazy_glUniform3uiv); if (glad_glUniform3uiv != glad_lazy_glUniform3uiv) glad_glUniform3uiv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { glad_glUniform4f = (PFNGLUNIFORM4FPROC)glad_lazy_resolve("glUniform4f", (GLADlazyproc)glad_lazy_glUniform4f); if (glad_glUniform4f != glad_lazy_glUniform4f) glad_glUniform4f(location, v0, v1, v2, v3); }
+static void APIENTRY glad_lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) { glad_glUniform4fv = (PFNGLUNIFORM4FVPROC)glad_lazy_resolve("glUniform4fv", (GLADlazyproc)glad_lazy_glUniform4fv); if (glad_glUniform4fv != glad_lazy_glUniform4fv) glad_glUniform4fv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) { glad_glUniform4i = (PFNGLUNIFORM4IPROC)glad_lazy_resolve("glUniform4i", (GLADlazyproc)glad_lazy_glUniform4i); if (glad_glUniform4i != glad_lazy_glUniform4i) glad_glUniform4i(location, v0, v1, v2, v3); }
+static void APIENTRY glad_lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value) { glad_glUniform4iv = (PFNGLUNIFORM4IVPROC)glad_lazy_resolve("glUniform4iv", (GLADlazyproc)glad_lazy_glUniform4iv); if (glad_glUniform4iv != glad_lazy_glUniform4iv) glad_glUniform4iv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) { glad_glUniform4ui = (PFNGLUNIFORM4UIPROC)glad_lazy_resolve("glUniform4ui", (GLADlazyproc)glad_lazy_glUniform4ui); if (glad_glUniform4ui != glad_lazy_glUniform4ui) glad_glUniform4ui(location, v0, v1, v2, v3); }
+static void APIENTRY glad_lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) { glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)glad_lazy_resolve("glUniform4uiv", (GLADlazyproc)glad_lazy_glUniform4uiv); if (glad_glUniform4uiv != glad_lazy_glUniform4uiv) glad_glUniform4uiv(location, count, value); }
+static void APIENTRY glad_lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) { glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)glad_lazy_resolve("glUniformBlockBinding", (GLADlazyproc)glad_lazy_glUniformBlockBinding); if (glad_glUniformBlockBinding != glad_lazy_glUniformBlockBinding) glad_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding); }
+static void APIENTRY glad_lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)glad_lazy_resolve("glUniformMatrix2fv", (GLADlazyproc)glad_lazy_glUniformMatrix2fv); if (glad_glUniformMatrix2fv != glad_lazy_glUniformMatrix2fv) glad_glUniformMatrix2fv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)glad_lazy_resolve("glUniformMatrix2x3fv", (GLADlazyproc)glad_lazy_glUniformMatrix2x3fv); if (glad_glUniformMatrix2x3fv != glad_lazy_glUniformMatrix2x3fv) glad_glUniformMatrix2x3fv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)glad_lazy_resolve("glUniformMatrix2x4fv", (GLADlazyproc)glad_lazy_glUniformMatrix2x4fv); if (glad_glUniformMatrix2x4fv != glad_lazy_glUniformMatrix2x4fv) glad_glUniformMatrix2x4fv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)glad_lazy_resolve("glUniformMatrix3fv", (GLADlazyproc)glad_lazy_glUniformMatrix3fv); if (glad_glUniformMatrix3fv != glad_lazy_glUniformMatrix3fv) glad_glUniformMatrix3fv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)glad_lazy_resolve("glUniformMatrix3x2fv", (GLADlazyproc)glad_lazy_glUniformMatrix3x2fv); if (glad_glUniformMatrix3x2fv != glad_lazy_glUniformMatrix3x2fv) glad_glUniformMatrix3x2fv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)glad_lazy_resolve("glUniformMatrix3x4fv", (GLADlazyproc)glad_lazy_glUniformMatrix3x4fv); if (glad_glUniformMatrix3x4fv != glad_lazy_glUniformMatrix3x4fv) glad_glUniformMatrix3x4fv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)glad_lazy_resolve("glUniformMatrix4fv", (GLADlazyproc)glad_lazy_glUniformMatrix4fv); if (glad_glUniformMatrix4fv != glad_lazy_glUniformMatrix4fv) glad_glUniformMatrix4fv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)glad_lazy_resolve("glUniformMatrix4x2fv", (GLADlazyproc)glad_lazy_glUniformMatrix4x2fv); if (glad_glUniformMatrix4x2fv != glad_lazy_glUniformMatrix4x2fv) glad_glUniformMatrix4x2fv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)glad_lazy_resolve("glUniformMatrix4x3fv", (GLADlazyproc)glad_lazy_glUniformMatrix4x3fv); if (glad_glUniformMatrix4x3fv != glad_lazy_glUniformMatrix4x3fv) glad_glUniformMatrix4x3fv(location, count, transpose, value); }
+static GLboolean APIENTRY glad_lazy_glUnmapBuffer(GLenum target) { glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)glad_lazy_resolve("glUnmapBuffer", (GLADlazyproc)glad_lazy_glUnmapBuffer); if (glad_glUnmapBuffer == glad_lazy_glUnmapBuffer) return (GLboolean)0; return glad_glUnmapBuffer(target); }
+static void APIENTRY glad_lazy_glUseProgram(GLuint program) { glad_glUseProgram = (PFNGLUSEPROGRAMPROC)glad_lazy_resolve("glUseProgram", (GLADlazyproc)glad_lazy_glUseProgram); if (glad_glUseProgram != glad_lazy_glUseProgram) glad_glUseProgram(program); }
+static void APIENTRY glad_lazy_glValidateProgram(GLuint program) { glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)glad_lazy_resolve("glValidateProgram", (GLADlazyproc)glad_lazy_glValidateProgram); if (glad_glValidateProgram != glad_lazy_glValidateProgram) glad_glValidateProgram(program); }
+static void APIENTRY glad_lazy_glVertex2d(GLdouble x, GLdouble y) { glad_glVertex2d = (PFNGLVERTEX2DPROC)glad_lazy_resolve("glVertex2d", (GLADlazyproc)glad_lazy_glVertex2d); if (glad_glVertex2d != glad_lazy_glVertex2d) glad_glVertex2d(x, y); }
+static void APIENTRY glad_lazy_glVertex2dv(const GLdouble *v) { glad_glVertex2dv = (PFNGLVERTEX2DVPROC)glad_lazy_resolve("glVertex2dv", (GLADlazyproc)glad_lazy_glVertex2dv); if (glad_glVertex2dv != glad_lazy_glVertex2dv) glad_glVertex2dv(v); }
+static void APIENTRY glad_lazy_glVertex2f(GLfloat x, GLfloat y) { glad_glVertex2f = (PFNGLVERTEX2FPROC)glad_lazy_resolve("glVertex2f", (GLADlazyproc)glad_lazy_glVertex2f); if (glad_glVertex2f != glad_lazy_glVertex2f) glad_glVertex2f(x, y); }
+static void APIENTRY glad_lazy_glVertex2fv(const GLfloat *v) { glad_glVertex2fv = (PFNGLVERTEX2FVPROC)glad_lazy_resolve("glVertex2fv", (GLADlazyproc)glad_lazy_glVertex2fv); if (glad_glVertex2fv != glad_lazy_glVertex2fv) glad_glVertex2fv(v); }
+static void APIENTRY glad_lazy_glVertex2i(GLint x, GLint y) { glad_glVertex2i = (PFNGLVERTEX2IPROC)glad_lazy_resolve("glVertex2i", (GLADlazyproc)glad_lazy_glVertex2i); if (glad_glVertex2i != glad_lazy_glVertex2i) glad_glVertex2i(x, y); }
+static void APIENTRY glad_lazy_glVertex2iv(const GLint *v) { glad_glVertex2iv = (PFNGLVERTEX2IVPROC)glad_lazy_resolve("glVertex2iv", (GLADlazyproc)glad_lazy_glVertex2iv); if (glad_glVertex2iv != glad_lazy_glVertex2iv) glad_glVertex2iv(v); }
+static void APIENTRY glad_lazy_glVertex2s(GLshort x, GLshort y) { glad_glVertex2s = (PFNGLVERTEX2SPROC)glad_lazy_resolve("glVertex2s", (GLADlazyproc)glad_lazy_glVertex2s); if (glad_glVertex2s != glad_lazy_glVertex2s) glad_glVertex2s(x, y); }
+static void APIENTRY glad_lazy_glVertex2sv(const GLshort *v) { glad_glVertex2sv = (PFNGLVERTEX2SVPROC)glad_lazy_resolve("glVertex2sv", (GLADlazyproc)glad_lazy_glVertex2sv); if (glad_glVertex2sv != glad_lazy_glVertex2sv) glad_glVertex2sv(v); }
+static void APIENTRY glad_lazy_glVertex3d(GLdouble x, GLdouble y, GLdouble z) { glad_glVertex3d = (PFNGLVERTEX3DPROC)glad_lazy_resolve("glVertex3d", (GLADlazyproc)glad_lazy_glVertex3d); if (glad_glVertex3d != glad_lazy_glVertex3d) glad_glVertex3d(x, y, z); }
+static void APIENTRY glad_lazy_glVertex3dv(const GLdouble *v) { glad_glVertex3dv = (PFNGLVERTEX3DVPROC)glad_lazy_resolve("glVertex3dv", (GLADlazyproc)glad_lazy_glVertex3dv); if (glad_glVertex3dv != glad_lazy_glVertex3dv) glad_glVertex3dv(v); }
+static void APIENTRY glad_lazy_glVertex3f(GLfloat x, GLfloat y, GLfloat z) { glad_glVertex3f = (PFNGLVERTEX3FPROC)glad_lazy_resolve("glVertex3f", (GLADlazyproc)glad_lazy_glVertex3f); if (glad_glVertex3f != glad_lazy_glVertex3f) glad_glVertex3f(x, y, z); }
+static void APIENTRY glad_lazy_glVertex3fv(const GLfloat *v) { glad_glVertex3fv = (PFNGLVERTEX3FVPROC)glad_lazy_resolve("glVertex3fv", (GLADlazyproc)glad_lazy_glVertex3fv); if (glad_glVertex3fv != glad_lazy_glVertex3fv) glad_glVertex3fv(v); }
+static void APIENTRY glad_lazy_glVertex3i(GLint x, GLint y, GLint z) { glad_glVertex3i = (PFNGLVERTEX3IPROC)glad_lazy_resolve("glVertex3i", (GLADlazyproc)glad_lazy_glVertex3i); if (glad_glVertex3i != glad_lazy_glVertex3i) glad_glVertex3i(x, y, z); }
+static void APIENTRY glad_lazy_glVertex3iv(const GLint *v) { glad_glVertex3iv = (PFNGLVERTEX3IVPROC)glad_lazy_resolve("glVertex3iv", (GLADlazyproc)glad_lazy_glVertex3iv); if (glad_glVertex3iv != glad_lazy_glVertex3iv) glad_glVertex3iv(v); }
+static void APIENTRY glad_lazy_glVertex3s(GLshort x, GLshort y, GLshort z) { glad_glVertex3s = (PFNGLVERTEX3SPROC)glad_lazy_resolve("glVertex3s", (GLADlazyproc)glad_lazy_glVertex3s); if (glad_glVertex3s != glad_lazy_glVertex3s) glad_glVertex3s(x, y, z); }
+static void APIENTRY glad_lazy_glVertex3sv(const GLshort *v) { glad_glVertex3sv = (PFNGLVERTEX3SVPROC)glad_lazy_resolve("glVertex3sv", (GLADlazyproc)glad_lazy_glVertex3sv); if (glad_glVertex3sv != glad_lazy_glVertex3sv) glad_glVertex3sv(v); }
+static void APIENTRY glad_lazy_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) { glad_glVertex4d = (PFNGLVERTEX4DPROC)glad_lazy_resolve("glVertex4d", (GLADlazyproc)glad_lazy_glVertex4d); if (glad_glVertex4d != glad_lazy_glVertex4d) glad_glVertex4d(x, y, z, w); }
+static void APIENTRY glad_lazy_glVertex4dv(const GLdouble *v) { glad_glVertex4dv = (PFNGLVERTEX4DVPROC)glad_lazy_resolve("glVertex4dv", (GLADlazyproc)glad_lazy_glVertex4dv); if (glad_glVertex4dv != glad_lazy_glVertex4dv) glad_glVertex4dv(v); }
+static void APIENTRY glad_lazy_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) { glad_glVertex4f = (PFNGLVERTEX4FPROC)glad_lazy_resolve("glVertex4f", (GLADlazyproc)glad_lazy_glVertex4f); if (glad_glVertex4f != glad_lazy_glVertex4f) glad_glVertex4f(x, y, z, w); }
+static void APIENTRY glad_lazy_glVertex4fv(const GLfloat *v) { glad_glVertex4fv = (PFNGLVERTEX4FVPROC)glad_lazy_resolve("glVertex4fv", (GLADlazyproc)glad_lazy_glVertex4fv); if (glad_glVertex4fv != glad_lazy_glVertex4fv) glad_glVertex4fv(v); }
+static void APIENTRY glad_lazy_glVertex4i(GLint x, GLint y, GLint z, GLint w) { glad_glVertex4i = (PFNGLVERTEX4IPROC)glad_lazy_resolve("glVertex4i", (GLADlazyproc)glad_lazy_glVertex4i); if (glad_glVertex4i != glad_lazy_glVertex4i) glad_glVertex4i(x, y, z, w); }
+static void APIENTRY glad_lazy_glVertex4iv(const GLint *v) { glad_glVertex4iv = (PFNGLVERTEX4IVPROC)glad_lazy_resolve("glVertex4iv", (GLADlazyproc)glad_lazy_glVertex4iv); if (glad_glVertex4iv != glad_lazy_glVertex4iv) glad_glVertex4iv(v); }
+static void APIENTRY glad_lazy_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w) { glad_glVertex4s = (PFNGLVERTEX4SPROC)glad_lazy_resolve("glVertex4s", (GLADlazyproc)glad_lazy_glVertex4s); if (glad_glVertex4s != glad_lazy_glVertex4s) glad_glVertex4s(x, y, z, w); }
+static void APIENTRY glad_lazy_glVertex4sv(const GLshort *v) { glad_glVertex4sv = (PFNGLVERTEX4SVPROC)glad_lazy_resolve("glVertex4sv", (GLADlazyproc)glad_lazy_glVertex4sv); if (glad_glVertex4sv != glad_lazy_glVertex4sv) glad_glVertex4sv(v); }
+static void APIENTRY glad_lazy_glVertexAttrib1d(GLuint index, GLdouble x) { glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)glad_lazy_resolve("glVertexAttrib1d", (GLADlazyproc)glad_lazy_glVertexAttrib1d); if (glad_glVertexAttrib1d != glad_lazy_glVertexAttrib1d) glad_glVertexAttrib1d(index, x); }
+static void APIENTRY glad_lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v) { glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)glad_lazy_resolve("glVertexAttrib1dv", (GLADlazyproc)glad_lazy_glVertexAttrib1dv); if (glad_glVertexAttrib1dv != glad_lazy_glVertexAttrib1dv) glad_glVertexAttrib1dv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib1f(GLuint index, GLfloat x) { glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)glad_lazy_resolve("glVertexAttrib1f", (GLADlazyproc)glad_lazy_glVertexAttrib1f); if (glad_glVertexAttrib1f != glad_lazy_glVertexAttrib1f) glad_glVertexAttrib1f(index, x); }
+static void APIENTRY glad_lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v) { glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)glad_lazy_resolve("glVertexAttrib1fv", (GLADlazyproc)glad_lazy_glVertexAttrib1fv); if (glad_glVertexAttrib1fv != glad_lazy_glVertexAttrib1fv) glad_glVertexAttrib1fv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib1s(GLuint index, GLshort x) { glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)glad_lazy_resolve("glVertexAttrib1s", (GLADlazyproc)glad_lazy_glVertexAttrib1s); if (glad_glVertexAttrib1s != glad_lazy_glVertexAttrib1s) glad_glVertexAttrib1s(index, x); }
+static void APIENTRY glad_lazy_glVertexAttrib1sv(GLuint index, const GLshort *v) { glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)glad_lazy_resolve("glVertexAttrib1sv", (GLADlazyproc)glad_lazy_glVertexAttrib1sv); if (glad_glVertexAttrib1sv != glad_lazy_glVertexAttrib1sv) glad_glVertexAttrib1sv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) { glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)glad_lazy_resolve("glVertexAttrib2d", (GLADlazyproc)glad_lazy_glVertexAttrib2d); if (glad_glVertexAttrib2d != glad_lazy_glVertexAttrib2d) glad_glVertexAttrib2d(index, x, y); }
+static void APIENTRY glad_lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v) { glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)glad_lazy_resolve("glVertexAttrib2dv", (GLADlazyproc)glad_lazy_glVertexAttrib2dv); if (glad_glVertexAttrib2dv != glad_lazy_glVertexAttrib2dv) glad_glVertexAttrib2dv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) { glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)glad_lazy_resolve("glVertexAttrib2f", (GLADlazyproc)glad_lazy_glVertexAttrib2f); if (glad_glVertexAttrib2f != glad_lazy_glVertexAttrib2f) glad_glVertexAttrib2f(index, x, y); }
+static void APIENTRY glad_lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v) { glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)glad_lazy_resolve("glVertexAttrib2fv", (GLADlazyproc)glad_lazy_glVertexAttrib2fv); if (glad_glVertexAttrib2fv != glad_lazy_glVertexAttrib2fv) glad_glVertexAttrib2fv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) { glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)glad_lazy_resolve("glVertexAttrib2s", (GLADlazyproc)glad_lazy_glVertexAttrib2s); if (glad_glVertexAttrib2s != glad_lazy_glVertexAttrib2s) glad_glVertexAttrib2s(index, x, y); }
+static void APIENTRY glad_lazy_glVertexAttrib2sv(GLuint index, const GLshort *v) { glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)glad_lazy_resolve("glVertexAttrib2sv", (GLADlazyproc)glad_lazy_glVertexAttrib2sv); if (glad_glVertexAttrib2sv != glad_lazy_glVertexAttrib2sv) glad_glVertexAttrib2sv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) { glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)glad_lazy_resolve("glVertexAttrib3d", (GLADlazyproc)glad_lazy_glVertexAttrib3d); if (glad_glVertexAttrib3d != glad_lazy_glVertexAttrib3d) glad_glVertexAttrib3d(index, x, y, z); }
+static void APIENTRY glad_lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v) { glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)glad_lazy_resolve("glVertexAttrib3dv", (GLADlazyproc)glad_lazy_glVertexAttrib3dv); if (glad_glVertexAttrib3dv != glad_lazy_glVertexAttrib3dv) glad_glVertexAttrib3dv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) { glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)glad_lazy_resolve("glVertexAttrib3f", (GLADlazyproc)glad_lazy_glVertexAttrib3f); if (glad_glVertexAttrib3f != glad_lazy_glVertexAttrib3f) glad_glVertexAttrib3f(index, x, y, z); }
+static void APIENTRY glad_lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v) { glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)glad_lazy_resolve("glVertexAttrib3fv", (GLADlazyproc)glad_lazy_glVertexAttrib3fv); if (glad_glVertexAttrib3fv != glad_lazy_glVertexAttrib3fv) glad_glVertexAttrib3fv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) { glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)glad_lazy_resolve("glVertexAttrib3s", (GLADlazyproc)glad_lazy_glVertexAttrib3s); if (glad_glVertexAttrib3s != glad_lazy_glVertexAttrib3s) glad_glVertexAttrib3s(index, x, y, z); }
+static void APIENTRY glad_lazy_glVertexAttrib3sv(GLuint index, const GLshort *v) { glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)glad_lazy_resolve("glVertexAttrib3sv", (GLADlazyproc)glad_lazy_glVertexAttrib3sv); if (glad_glVertexAttrib3sv != glad_lazy_glVertexAttrib3sv) glad_glVertexAttrib3sv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) { glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)glad_lazy_resolve("glVertexAttrib4Nbv", (GLADlazyproc)glad_lazy_glVertexAttrib4Nbv); if (glad_glVertexAttrib4Nbv != glad_lazy_glVertexAttrib4Nbv) glad_glVertexAttrib4Nbv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4Niv(GLuint index, const GLint *v) { glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)glad_lazy_resolve("glVertexAttrib4Niv", (GLADlazyproc)glad_lazy_glVertexAttrib4Niv); if (glad_glVertexAttrib4Niv != glad_lazy_glVertexAttrib4Niv) glad_glVertexAttrib4Niv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v) { glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)glad_lazy_resolve("glVertexAttrib4Nsv", (GLADlazyproc)glad_lazy_glVertexAttrib4Nsv); if (glad_glVertexAttrib4Nsv != glad_lazy_glVertexAttrib4Nsv) glad_glVertexAttrib4Nsv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) { glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)glad_lazy_resolve("glVertexAttrib4Nub", (GLADlazyproc)glad_lazy_glVertexAttrib4Nub); if (glad_glVertexAttrib4Nub != glad_lazy_glVertexAttrib4Nub) glad_glVertexAttrib4Nub(index, x, y, z, w); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) { glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)glad_lazy_resolve("glVertexAttrib4Nubv", (GLADlazyproc)glad_lazy_glVertexAttrib4Nubv); if (glad_glVertexAttrib4Nubv != glad_lazy_glVertexAttrib4Nubv) glad_glVertexAttrib4Nubv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) { glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)glad_lazy_resolve("glVertexAttrib4Nuiv", (GLADlazyproc)glad_lazy_glVertexAttrib4Nuiv); if (glad_glVertexAttrib4Nuiv != glad_lazy_glVertexAttrib4Nuiv) glad_glVertexAttrib4Nuiv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v) { glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)glad_lazy_resolve("glVertexAttrib4Nusv", (GLADlazyproc)glad_lazy_glVertexAttrib4Nusv); if (glad_glVertexAttrib4Nusv != glad_lazy_glVertexAttrib4Nusv) glad_glVertexAttrib4Nusv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v) { glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)glad_lazy_resolve("glVertexAttrib4bv", (GLADlazyproc)glad_lazy_glVertexAttrib4bv); if (glad_glVertexAttrib4bv != glad_lazy_glVertexAttrib4bv) glad_glVertexAttrib4bv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) { glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)glad_lazy_resolve("glVertexAttrib4d", (GLADlazyproc)glad_lazy_glVertexAttrib4d); if (glad_glVertexAttrib4d != glad_lazy_glVertexAttrib4d) glad_glVertexAttrib4d(index, x, y, z, w); }
+static void APIENTRY glad_lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v) { glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)glad_lazy_resolve("glVertexAttrib4dv", (GLADlazyproc)glad_lazy_glVertexAttrib4dv); if (glad_glVertexAttrib4dv != glad_lazy_glVertexAttrib4dv) glad_glVertexAttrib4dv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) { glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)glad_lazy_resolve("glVertexAttrib4f", (GLADlazyproc)glad_lazy_glVertexAttrib4f); if (glad_glVertexAttrib4f != glad_lazy_glVertexAttrib4f) glad_glVertexAttrib4f(index, x, y, z, w); }
+static void APIENTRY glad_lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v) { glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)glad_lazy_resolve("glVertexAttrib4fv", (GLADlazyproc)glad_lazy_glVertexAttrib4fv); if (glad_glVertexAttrib4fv != glad_lazy_glVertexAttrib4fv) glad_glVertexAttrib4fv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4iv(GLuint index, const GLint *v) { glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)glad_lazy_resolve("glVertexAttrib4iv", (GLADlazyproc)glad_lazy_glVertexAttrib4iv); if (glad_glVertexAttrib4iv != glad_lazy_glVertexAttrib4iv) glad_glVertexAttrib4iv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) { glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)glad_lazy_resolve("glVertexAttrib4s", (GLADlazyproc)glad_lazy_glVertexAttrib4s); if (glad_glVertexAttrib4s != glad_lazy_glVertexAttrib4s) glad_glVertexAttrib4s(index, x, y, z, w); }
+static void APIENTRY glad_lazy_glVertexAttrib4sv(GLuint index, const GLshort *v) { glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)glad_lazy_resolve("glVertexAttrib4sv", (GLADlazyproc)glad_lazy_glVertexAttrib4sv); if (glad_glVertexAttrib4sv != glad_lazy_glVertexAttrib4sv) glad_glVertexAttrib4sv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v) { glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)glad_lazy_resolve("glVertexAttrib4ubv", (GLADlazyproc)glad_lazy_glVertexAttrib4ubv); if (glad_glVertexAttrib4ubv != glad_lazy_glVertexAttrib4ubv) glad_glVertexAttrib4ubv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v) { glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)glad_lazy_resolve("glVertexAttrib4uiv", (GLADlazyproc)glad_lazy_glVertexAttrib4uiv); if (glad_glVertexAttrib4uiv != glad_lazy_glVertexAttrib4uiv) glad_glVertexAttrib4uiv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4usv(GLuint index, const GLushort *v) { glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)glad_lazy_resolve("glVertexAttrib4usv", (GLADlazyproc)glad_lazy_glVertexAttrib4usv); if (glad_glVertexAttrib4usv != glad_lazy_glVertexAttrib4usv) glad_glVertexAttrib4usv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribDivisor(GLuint index, GLuint divisor) { glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)glad_lazy_resolve("glVertexAttribDivisor", (GLADlazyproc)glad_lazy_glVertexAttribDivisor); if (glad_glVertexAttribDivisor != glad_lazy_glVertexAttribDivisor) glad_glVertexAttribDivisor(index, divisor); }
+static void APIENTRY glad_lazy_glVertexAttribI1i(GLuint index, GLint x) { glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)glad_lazy_resolve("glVertexAttribI1i", (GLADlazyproc)glad_lazy_glVertexAttribI1i); if (glad_glVertexAttribI1i != glad_lazy_glVertexAttribI1i) glad_glVertexAttribI1i(index, x); }
+static void APIENTRY glad_lazy_glVertexAttribI1iv(GLuint index, const GLint *v) { glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)glad_lazy_resolve("glVertexAttribI1iv", (GLADlazyproc)glad_lazy_glVertexAttribI1iv); if (glad_glVertexAttribI1iv != glad_lazy_glVertexAttribI1iv) glad_glVertexAttribI1iv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI1ui(GLuint index, GLuint x) { glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)glad_lazy_resolve("glVertexAttribI1ui", (GLADlazyproc)glad_lazy_glVertexAttribI1ui); if (glad_glVertexAttribI1ui != glad_lazy_glVertexAttribI1ui) glad_glVertexAttribI1ui(index, x); }
+static void APIENTRY glad_lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v) { glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)glad_lazy_resolve("glVertexAttribI1uiv", (GLADlazyproc)glad_lazy_glVertexAttribI1uiv); if (glad_glVertexAttribI1uiv != glad_lazy_glVertexAttribI1uiv) glad_glVertexAttribI1uiv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y) { glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)glad_lazy_resolve("glVertexAttribI2i", (GLADlazyproc)glad_lazy_glVertexAttribI2i); if (glad_glVertexAttribI2i != glad_lazy_glVertexAttribI2i) glad_glVertexAttribI2i(index, x, y); }
+static void APIENTRY glad_lazy_glVertexAttribI2iv(GLuint index, const GLint *v) { glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)glad_lazy_resolve("glVertexAttribI2iv", (GLADlazyproc)glad_lazy_glVertexAttribI2iv); if (glad_glVertexAttribI2iv != glad_lazy_glVertexAttribI2iv) glad_glVertexAttribI2iv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) { glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)glad_lazy_resolve("glVertexAttribI2ui", (GLADlazyproc)glad_lazy_glVertexAttribI2ui); if (glad_glVertexAttribI2ui != glad_lazy_glVertexAttribI2ui) glad_glVertexAttribI2ui(index, x, y); }
+static void APIENTRY glad_lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v) { glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)glad_lazy_resolve("glVertexAttribI2uiv", (GLADlazyproc)glad_lazy_glVertexAttribI2uiv); if (glad_glVertexAttribI2uiv != glad_lazy_glVertexAttribI2uiv) glad_glVertexAttribI2uiv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) { glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)glad_lazy_resolve("glVertexAttribI3i", (GLADlazyproc)glad_lazy_glVertexAttribI3i); if (glad_glVertexAttribI3i != glad_lazy_glVertexAttribI3i) glad_glVertexAttribI3i(index, x, y, z); }
+static void APIENTRY glad_lazy_glVertexAttribI3iv(GLuint index, const GLint *v) { glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)glad_lazy_resolve("glVertexAttribI3iv", (GLADlazyproc)glad_lazy_glVertexAttribI3iv); if (glad_glVertexAttribI3iv != glad_lazy_glVertexAttribI3iv) glad_glVertexAttribI3iv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) { glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)glad_lazy_resolve("glVertexAttribI3ui", (GLADlazyproc)glad_lazy_glVertexAttribI3ui); if (glad_glVertexAttribI3ui != glad_lazy_glVertexAttribI3ui) glad_glVertexAttribI3ui(index, x, y, z); }
+static void APIENTRY glad_lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v) { glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)glad_lazy_resolve("glVertexAttribI3uiv", (GLADlazyproc)glad_lazy_glVertexAttribI3uiv); if (glad_glVertexAttribI3uiv != glad_lazy_glVertexAttribI3uiv) glad_glVertexAttribI3uiv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v) { glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)glad_lazy_resolve("glVertexAttribI4bv", (GLADlazyproc)glad_lazy_glVertexAttribI4bv); if (glad_glVertexAttribI4bv != glad_lazy_glVertexAttribI4bv) glad_glVertexAttribI4bv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) { glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)glad_lazy_resolve("glVertexAttribI4i", (GLADlazyproc)glad_lazy_glVertexAttribI4i); if (glad_glVertexAttribI4i != glad_lazy_glVertexAttribI4i) glad_glVertexAttribI4i(index, x, y, z, w); }
+static void APIENTRY glad_lazy_glVertexAttribI4iv(GLuint index, const GLint *v) { glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)glad_lazy_resolve("glVertexAttribI4iv", (GLADlazyproc)glad_lazy_glVertexAttribI4iv); if (glad_glVertexAttribI4iv != glad_lazy_glVertexAttribI4iv) glad_glVertexAttribI4iv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI4sv(GLuint index, const GLshort *v) { glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)glad_lazy_resolve("glVertexAttribI4sv", (GLADlazyproc)glad_lazy_glVertexAttribI4sv); if (glad_glVertexAttribI4sv != glad_lazy_glVertexAttribI4sv) glad_glVertexAttribI4sv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v) { glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)glad_lazy_resolve("glVertexAttribI4ubv", (GLADlazyproc)glad_lazy_glVertexAttribI4ubv); if (glad_glVertexAttribI4ubv != glad_lazy_glVertexAttribI4ubv) glad_glVertexAttribI4ubv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) { glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)glad_lazy_resolve("glVertexAttribI4ui", (GLADlazyproc)glad_lazy_glVertexAttribI4ui); if (glad_glVertexAttribI4ui != glad_lazy_glVertexAttribI4ui) glad_glVertexAttribI4ui(index, x, y, z, w); }
+static void APIENTRY glad_lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v) { glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)glad_lazy_resolve("glVertexAttribI4uiv", (GLADlazyproc)glad_lazy_glVertexAttribI4uiv); if (glad_glVertexAttribI4uiv != glad_lazy_glVertexAttribI4uiv) glad_glVertexAttribI4uiv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI4usv(GLuint index, const GLushort *v) { glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)glad_lazy_resolve("glVertexAttribI4usv", (GLADlazyproc)glad_lazy_glVertexAttribI4usv); if (glad_glVertexAttribI4usv != glad_lazy_glVertexAttribI4usv) glad_glVertexAttribI4usv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) { glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)glad_lazy_resolve("glVertexAttribIPointer", (GLADlazyproc)glad_lazy_glVertexAttribIPointer); if (glad_glVertexAttribIPointer != glad_lazy_glVertexAttribIPointer) glad_glVertexAttribIPointer(index, size, type, stride, pointer); }
+static void APIENTRY glad_lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)glad_lazy_resolve("glVertexAttribP1ui", (GLADlazyproc)glad_lazy_glVertexAttribP1ui); if (glad_glVertexAttribP1ui != glad_lazy_glVertexAttribP1ui) glad_glVertexAttribP1ui(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)glad_lazy_resolve("glVertexAttribP1uiv", (GLADlazyproc)glad_lazy_glVertexAttribP1uiv); if (glad_glVertexAttribP1uiv != glad_lazy_glVertexAttribP1uiv) glad_glVertexAttribP1uiv(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)glad_lazy_resolve("glVertexAttribP2ui", (GLADlazyproc)glad_lazy_glVertexAttribP2ui); if (glad_glVertexAttribP2ui != glad_lazy_glVertexAttribP2ui) glad_glVertexAttribP2ui(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)glad_lazy_resolve("glVertexAttribP2uiv", (GLADlazyproc)glad_lazy_glVertexAttribP2uiv); if (glad_glVertexAttribP2uiv != glad_lazy_glVertexAttribP2uiv) glad_glVertexAttribP2uiv(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)glad_lazy_resolve("glVertexAttribP3ui", (GLADlazyproc)glad_lazy_glVertexAttribP3ui); if (glad_glVertexAttribP3ui != glad_lazy_glVertexAttribP3ui) glad_glVertexAttribP3ui(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)glad_lazy_resolve("glVertexAttribP3uiv", (GLADlazyproc)glad_lazy_glVertexAttribP3uiv); if (glad_glVertexAttribP3uiv != glad_lazy_glVertexAttribP3uiv) glad_glVertexAttribP3uiv(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)glad_lazy_resolve("glVertexAttribP4ui", (GLADlazyproc)glad_lazy_glVertexAttribP4ui); if (glad_glVertexAttribP4ui != glad_lazy_glVertexAttribP4ui) glad_glVertexAttribP4ui(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)glad_lazy_resolve("glVertexAttribP4uiv", (GLADlazyproc)glad_lazy_glVertexAttribP4uiv); if (glad_glVertexAttribP4uiv != glad_lazy_glVertexAttribP4uiv) glad_glVertexAttribP4uiv(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) { glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)glad_lazy_resolve("glVertexAttribPointer", (GLADlazyproc)glad_lazy_glVertexAttribPointer); if (glad_glVertexAttribPointer != glad_lazy_glVertexAttribPointer) glad_glVertexAttribPointer(index, size, type, normalized, stride, pointer); }
+static void APIENTRY glad_lazy_glVertexP2ui(GLenum type, GLuint value) { glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)glad_lazy_resolve("glVertexP2ui", (GLADlazyproc)glad_lazy_glVertexP2ui); if (glad_glVertexP2ui != glad_lazy_glVertexP2ui) glad_glVertexP2ui(type, value); }
+static void APIENTRY glad_lazy_glVertexP2uiv(GLenum type, const GLuint *value) { glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)glad_lazy_resolve("glVertexP2uiv", (GLADlazyproc)glad_lazy_glVertexP2uiv); if (glad_glVertexP2uiv != glad_lazy_glVertexP2uiv) glad_glVertexP2uiv(type, value); }
+static void APIENTRY glad_lazy_glVertexP3ui(GLenum type, GLuint value) { glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)glad_lazy_resolve("glVertexP3ui", (GLADlazyproc)glad_lazy_glVertexP3ui); if (glad_glVertexP3ui != glad_lazy_glVertexP3ui) glad_glVertexP3ui(type, value); }
+static void APIENTRY glad_lazy_glVertexP3uiv(GLenum type, const GLuint *value) { glad_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)glad_lazy_resolve("glVertexP3uiv", (GLADlazyproc)glad_lazy_glVertexP3uiv); if (glad_glVertexP3uiv != glad_lazy_glVertexP3uiv) glad_glVertexP3uiv(type, value); }
+static void APIENTRY glad_lazy_glVertexP4ui(GLenum type, GLuint value) { glad_glVertexP4ui = (PFNGLVERTEXP4UIPROC)glad_lazy_resolve("glVertexP4ui", (GLADlazyproc)glad_lazy_glVertexP4ui); if (glad_glVertexP4ui != glad_lazy_glVertexP4ui) glad_glVertexP4ui(type, value); }
+static void APIENTRY glad_lazy_glVertexP4uiv(GLenum type, const GLuint *value) { glad_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)glad_lazy_resolve("glVertexP4uiv", (GLADlazyproc)glad_lazy_glVertexP4uiv); if (glad_glVertexP4uiv != glad_lazy_glVertexP4uiv) glad_glVertexP4uiv(type, value); }
+static void APIENTRY glad_lazy_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) { glad_glVertexPointer = (PFNGLVERTEXPOINTERPROC)glad_lazy_resolve("glVertexPointer", (GLADlazyproc)glad_lazy_glVertexPointer); if (glad_glVertexPointer != glad_lazy_glVertexPointer) glad_glVertexPointer(size, type, stride, pointer); }
+static void APIENTRY glad_lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) { glad_glViewport = (PFNGLVIEWPORTPROC)glad_lazy_resolve("glViewport", (GLADlazyproc)glad_lazy_glViewport); if (glad_glViewport != glad_lazy_glViewport) glad_glViewport(x, y, width, height); }
+static void APIENTRY glad_lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { glad_glWaitSync = (PFNGLWAITSYNCPROC)glad_lazy_resolve("glWaitSync", (GLADlazyproc)glad_lazy_glWaitSync); if (glad_glWaitSync != glad_lazy_glWaitSync) glad_glWaitSync(sync, flags, timeout); }
+static void APIENTRY glad_lazy_glWindowPos2d(GLdouble x, GLdouble y) { glad_glWindowPos2d = (PFNGLWINDOWPOS2DPROC)glad_lazy_resolve("glWindowPos2d", (GLADlazyproc)glad_lazy_glWindowPos2d); if (glad_glWindowPos2d != glad_lazy_glWindowPos2d) glad_glWindowPos2d(x, y); }
+static void APIENTRY glad_lazy_glWindowPos2dv(const GLdouble *v) { glad_glWindowPos2dv = (PFNGLWINDOWPOS2DVPROC)glad_lazy_resolve("glWindowPos2dv", (GLADlazyproc)glad_lazy_glWindowPos2dv); if (glad_glWindowPos2dv != glad_lazy_glWindowPos2dv) glad_glWindowPos2dv(v); }
+static void APIENTRY glad_lazy_glWindowPos2f(GLfloat x, GLfloat y) { glad_glWindowPos2f = (PFNGLWINDOWPOS2FPROC)glad_lazy_resolve("glWindowPos2f", (GLADlazyproc)glad_lazy_glWindowPos2f); if (glad_glWindowPos2f != glad_lazy_glWindowPos2f) glad_glWindowPos2f(x, y); }
+static void APIENTRY glad_lazy_glWindowPos2fv(const GLfloat *v) { glad_glWindowPos2fv = (PFNGLWINDOWPOS2FVPROC)glad_lazy_resolve("glWindowPos2fv", (GLADlazyproc)glad_lazy_glWindowPos2fv); if (glad_glWindowPos2fv != glad_lazy_glWindowPos2fv) glad_glWindowPos2fv(v); }
+static void APIENTRY glad_lazy_glWindowPos2i(GLint x, GLint y) { glad_glWindowPos2i = (PFNGLWINDOWPOS2IPROC)glad_lazy_resolve("glWindowPos2i", (GLADlazyproc)glad_lazy_glWindowPos2i); if (glad_glWindowPos2i != glad_lazy_glWindowPos2i) glad_glWindowPos2i(x, y); }
+static void APIENTRY glad_lazy_glWindowPos2iv(const GLint *v) { glad_glWindowPos2iv = (PFNGLWINDOWPOS2IVPROC)glad_lazy_resolve("glWindowPos2iv", (GLADlazyproc)glad_lazy_glWindowPos2iv); if (glad_glWindowPos2iv != glad_lazy_glWindowPos2iv) glad_glWindowPos2iv(v); }
+static void APIENTRY glad_lazy_glWindowPos2s(GLshort x, GLshort y) { glad_glWindowPos2s = (PFNGLWINDOWPOS2SPROC)glad_lazy_resolve("glWindowPos2s", (GLADlazyproc)glad_lazy_glWindowPos2s); if (glad_glWindowPos2s != glad_lazy_glWindowPos2s) glad_glWindowPos2s(x, y); }
+static void APIENTRY glad_lazy_glWindowPos2sv(const GLshort *v) { glad_glWindowPos2sv = (PFNGLWINDOWPOS2SVPROC)glad_lazy_resolve("glWindowPos2sv", (GLADlazyproc)glad_lazy_glWindowPos2sv); if (glad_glWindowPos2sv != glad_lazy_glWindowPos2sv) glad_glWindowPos2sv(v); }
+static void APIENTRY glad_lazy_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z) { glad_glWindowPos3d = (PFNGLWINDOWPOS3DPROC)glad_lazy_resolve("glWindowPos3d", (GLADlazyproc)glad_lazy_glWindowPos3d); if (glad_glWindowPos3d != glad_lazy_glWindowPos3d) glad_glWindowPos3d(x, y, z); }
+static void APIENTRY glad_lazy_glWindowPos3dv(const GLdouble *v) { glad_glWindowPos3dv = (PFNGLWINDOWPOS3DVPROC)glad_lazy_resolve("glWindowPos3dv", (GLADlazyproc)glad_lazy_glWindowPos3dv); if (glad_glWindowPos3dv != glad_lazy_glWindowPos3dv) glad_glWindowPos3dv(v); }
+static void APIENTRY glad_lazy_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z) { glad_glWindowPos3f = (PFNGLWINDOWPOS3FPROC)glad_lazy_resolve("glWindowPos3f", (GLADlazyproc)glad_lazy_glWindowPos3f); if (glad_glWindowPos3f != glad_lazy_glWindowPos3f) glad_glWindowPos3f(x, y, z); }
+static void APIENTRY glad_lazy_glWindowPos3fv(const GLfloat *v) { glad_glWindowPos3fv = (PFNGLWINDOWPOS3FVPROC)glad_lazy_resolve("glWindowPos3fv", (GLADlazyproc)glad_lazy_glWindowPos3fv); if (glad_glWindowPos3fv != glad_lazy_glWindowPos3fv) glad_glWindowPos3fv(v); }
+static void APIENTRY glad_lazy_glWindowPos3i(GLint x, GLint y, GLint z) { glad_glWindowPos3i = (PFNGLWINDOWPOS3IPROC)glad_lazy_resolve("glWindowPos3i", (GLADlazyproc)glad_lazy_glWindowPos3i); if (glad_glWindowPos3i != glad_lazy_glWindowPos3i) glad_glWindowPos3i(x, y, z); }
+static void APIENTRY glad_lazy_glWindowPos3iv(const GLint *v) { glad_glWindowPos3iv = (PFNGLWINDOWPOS3IVPROC)glad_lazy_resolve("glWindowPos3iv", (GLADlazyproc)glad_lazy_glWindowPos3iv); if (glad_glWindowPos3iv != glad_lazy_glWindowPos3iv) glad_glWindowPos3iv(v); }
+static void APIENTRY glad_lazy_glWindowPos3s(GLshort x, GLshort y, GLshort z) { glad_glWindowPos3s = (PFNGLWINDOWPOS3SPROC)glad_lazy_resolve("glWindowPos3s", (GLADlazyproc)glad_lazy_glWindowPos3s); if (glad_glWindowPos3s != glad_lazy_glWindowPos3s) glad_glWindowPos3s(x, y, z); }
+static void APIENTRY glad_lazy_glWindowPos3sv(const GLshort *v) { glad_glWindowPos3sv = (PFNGLWINDOWPOS3SVPROC)glad_lazy_resolve("glWindowPos3sv", (GLADlazyproc)glad_lazy_glWindowPos3sv); if (glad_glWindowPos3sv != glad_lazy_glWindowPos3sv) glad_glWindowPos3sv(v); }
+/* Puts every pointer back on its trampoline (for a new gladLoadGLLoader()) */
+static void glad_lazy_reset(void) {
+	glad_glAccum = glad_lazy_glAccum;
+	glad_glActiveTexture = glad_lazy_glActiveTexture;
+	glad_glAlphaFunc = glad_lazy_glAlphaFunc;
+	glad_glAreTexturesResident = glad_lazy_glAreTexturesResident;
+	glad_glArrayElement = glad_lazy_glArrayElement;
+	glad_glAttachShader = glad_lazy_glAttachShader;
+	glad_glBegin = glad_lazy_glBegin;
+	glad_glBeginConditionalRender = glad_lazy_glBeginConditionalRender;
+	glad_glBeginQuery = glad_lazy_glBeginQuery;
+	glad_glBeginTransformFeedback = glad_lazy_glBeginTransformFeedback;
+	glad_glBindAttribLocation = glad_lazy_glBindAttribLocation;
+	glad_glBindBuffer = glad_lazy_glBindBuffer;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindFragDataLocation = glad_lazy_glBindFragDataLocation;
+	glad_glBindFragDataLocationIndexed = glad_lazy_glBindFragDataLocationIndexed;
+	glad_glBindFramebuffer = glad_lazy_glBindFramebuffer;
+	glad_glBindRenderbuffer = glad_lazy_glBindRenderbuffer;
+	glad_glBindSampler = glad_lazy_glBindSampler;
+	glad_glBindTexture = glad_lazy_glBindTexture;
+	glad_glBindVertexArray = glad_lazy_glBindVertexArray;
+	glad_glBitmap = glad_lazy_glBitmap;
+	glad_glBlendColor = glad_lazy_glBlendColor;
+	glad_glBlendEquation = glad_lazy_glBlendEquation;
+	glad_glBlendEquationSeparate = glad_lazy_glBlendEquationSeparate;
+	glad_glBlendFunc = glad_lazy_glBlendFunc;
+	glad_glBlendFuncSeparate = glad_lazy_glBlendFuncSeparate;
+	glad_glBlitFramebuffer = glad_lazy_glBlitFramebuffer;
+	glad_glBufferData = glad_lazy_glBufferData;
+	glad_glBufferSubData = glad_lazy_glBufferSubData;
+	glad_glCallList = glad_lazy_glCallList;
+	glad_glCallLists = glad_lazy_glCallLists;
+	glad_glCheckFramebufferStatus = glad_lazy_glCheckFramebufferStatus;
+	glad_glClampColor = glad_lazy_glClampColor;
+	glad_glClear = glad_lazy_glClear;
+	glad_glClearAccum = glad_lazy_glClearAccum;
+	glad_glClearBufferfi = glad_lazy_glClearBufferfi;
+	glad_glClearBufferfv = glad_lazy_glClearBufferfv;
+	glad_glClearBufferiv = glad_lazy_glClearBufferiv;
+	glad_glClearBufferuiv = glad_lazy_glClearBufferuiv;
+	glad_glClearColor = glad_lazy_glClearColor;
+	glad_glClearDepth = glad_lazy_glClearDepth;
+	glad_glClearIndex = glad_lazy_glClearIndex;
+	glad_glClearStencil = glad_lazy_glClearStencil;
+	glad_glClientActiveTexture = glad_lazy_glClientActiveTexture;
+	glad_glClientWaitSync = glad_lazy_glClientWaitSync;
+	glad_glClipPlane = glad_lazy_glClipPlane;
+	glad_glColor3b = glad_lazy_glColor3b;
+	glad_glColor3bv = glad_lazy_glColor3bv;
+	glad_glColor3d = glad_lazy_glColor3d;
+	glad_glColor3dv = glad_lazy_glColor3dv;
+	glad_glColor3f = glad_lazy_glColor3f;
+	glad_glColor3fv = glad_lazy_glColor3fv;
+	glad_glColor3i = glad_lazy_glColor3i;
+	glad_glColor3iv = glad_lazy_glColor3iv;
+	glad_glColor3s = glad_lazy_glColor3s;
+	glad_glColor3sv = glad_lazy_glColor3sv;
+	glad_glColor3ub = glad_lazy_glColor3ub;
+	glad_glColor3ubv = glad_lazy_glColor3ubv;
+	glad_glColor3ui = glad_lazy_glColor3ui;
+	glad_glColor3uiv = glad_lazy_glColor3uiv;
+	glad_glColor3us = glad_lazy_glColor3us;
+	glad_glColor3usv = glad_lazy_glColor3usv;
+	glad_glColor4b = glad_lazy_glColor4b;
+	glad_glColor4bv = glad_lazy_glColor4bv;
+	glad_glColor4d = glad_lazy_glColor4d;
+	glad_glColor4dv = glad_lazy_glColor4dv;
+	glad_glColor4f = glad_lazy_glColor4f;
+	glad_glColor4fv = glad_lazy_glColor4fv;
+	glad_glColor4i = glad_lazy_glColor4i;
+	glad_glColor4iv = glad_lazy_glColor4iv;
+	glad_glColor4s = glad_lazy_glColor4s;
+	glad_glColor4sv = glad_lazy_glColor4sv;
+	glad_glColor4ub = glad_lazy_glColor4ub;
+	glad_glColor4ubv = glad_lazy_glColor4ubv;
+	glad_glColor4ui = glad_lazy_glColor4ui;
+	glad_glColor4uiv = glad_lazy_glColor4uiv;
+	glad_glColor4us = glad_lazy_glColor4us;
+	glad_glColor4usv = glad_lazy_glColor4usv;
+	glad_glColorMask = glad_lazy_glColorMask;
+	glad_glColorMaski = glad_lazy_glColorMaski;
+	glad_glColorMaterial = glad_lazy_glColorMaterial;
+	glad_glColorP3ui = glad_lazy_glColorP3ui;
+	glad_glColorP3uiv = glad_lazy_glColorP3uiv;
+	glad_glColorP4ui = glad_lazy_glColorP4ui;
+	glad_glColorP4uiv = glad_lazy_glColorP4uiv;
+	glad_glColorPointer = glad_lazy_glColorPointer;
+	glad_glCompileShader = glad_lazy_glCompileShader;
+	glad_glCompressedTexImage1D = glad_lazy_glCompressedTexImage1D;
+	glad_glCompressedTexImage2D = glad_lazy_glCompressedTexImage2D;
+	glad_glCompressedTexImage3D = glad_lazy_glCompressedTexImage3D;
+	glad_glCompressedTexSubImage1D = glad_lazy_glCompressedTexSubImage1D;
+	glad_glCompressedTexSubImage2D = glad_lazy_glCompressedTexSubImage2D;
+	glad_glCompressedTexSubImage3D = glad_lazy_glCompressedTexSubImage3D;
+	glad_glCopyBufferSubData = glad_lazy_glCopyBufferSubData;
+	glad_glCopyPixels = glad_lazy_glCopyPixels;
+	glad_glCopyTexImage1D = glad_lazy_glCopyTexImage1D;
+	glad_glCopyTexImage2D = glad_lazy_glCopyTexImage2D;
+	glad_glCopyTexSubImage1D = glad_lazy_glCopyTexSubImage1D;
+	glad_glCopyTexSubImage2D = glad_lazy_glCopyTexSubImage2D;
+	glad_glCopyTexSubImage3D = glad_lazy_glCopyTexSubImage3D;
+	glad_glCreateProgram = glad_lazy_glCreateProgram;
+	glad_glCreateShader = glad_lazy_glCreateShader;
+	glad_glCullFace = glad_lazy_glCullFace;
+	glad_glDeleteBuffers = glad_lazy_glDeleteBuffers;
+	glad_glDeleteFramebuffers = glad_lazy_glDeleteFramebuffers;
+	glad_glDeleteLists = glad_lazy_glDeleteLists;
+	glad_glDeleteProgram = glad_lazy_glDeleteProgram;
+	glad_glDeleteQueries = glad_lazy_glDeleteQueries;
+	glad_glDeleteRenderbuffers = glad_lazy_glDeleteRenderbuffers;
+	glad_glDeleteSamplers = glad_lazy_glDeleteSamplers;
+	glad_glDeleteShader = glad_lazy_glDeleteShader;
+	glad_glDeleteSync = glad_lazy_glDeleteSync;
+	glad_glDeleteTextures = glad_lazy_glDeleteTextures;
+	glad_glDeleteVertexArrays = glad_lazy_glDeleteVertexArrays;
+	glad_glDepthFunc = glad_lazy_glDepthFunc;
+	glad_glDepthMask = glad_lazy_glDepthMask;
+	glad_glDepthRange = glad_lazy_glDepthRange;
+	glad_glDetachShader = glad_lazy_glDetachShader;
+	glad_glDisable = glad_lazy_glDisable;
+	glad_glDisableClientState = glad_lazy_glDisableClientState;
+	glad_glDisableVertexAttribArray = glad_lazy_glDisableVertexAttribArray;
+	glad_glDisablei = glad_lazy_glDisablei;
+	glad_glDrawArrays = glad_lazy_glDrawArrays;
+	glad_glDrawArraysInstanced = glad_lazy_glDrawArraysInstanced;
+	glad_glDrawBuffer = glad_lazy_glDrawBuffer;
+	glad_glDrawBuffers = glad_lazy_glDrawBuffers;
+	glad_glDrawElements = glad_lazy_glDrawElements;
+	glad_glDrawElementsBaseVertex = glad_lazy_glDrawElementsBaseVertex;
+	glad_glDrawElementsInstanced = glad_lazy_glDrawElementsInstanced;
+	glad_glDrawElementsInstancedBaseVertex = glad_lazy_glDrawElementsInstancedBaseVertex;
+	glad_glDrawPixels = glad_lazy_glDrawPixels;
+	glad_glDrawRangeElements = glad_lazy_glDrawRangeElements;
+	glad_glDrawRangeElementsBaseVertex = glad_lazy_glDrawRangeElementsBaseVertex;
+	glad_glEdgeFlag = glad_lazy_glEdgeFlag;
+	glad_glEdgeFlagPointer = glad_lazy_glEdgeFlagPointer;
+	glad_glEdgeFlagv = glad_lazy_glEdgeFlagv;
+	glad_glEnable = glad_lazy_glEnable;
+	glad_glEnableClientState = glad_lazy_glEnableClientState;
+	glad_glEnableVertexAttribArray = glad_lazy_glEnableVertexAttribArray;
+	glad_glEnablei = glad_lazy_glEnablei;
+	glad_glEnd = glad_lazy_glEnd;
+	glad_glEndConditionalRender = glad_lazy_glEndConditionalRender;
+	glad_glEndList = glad_lazy_glEndList;
+	glad_glEndQuery = glad_lazy_glEndQuery;
+	glad_glEndTransformFeedback = glad_lazy_glEndTransformFeedback;
+	glad_glEvalCoord1d = glad_lazy_glEvalCoord1d;
+	glad_glEvalCoord1dv = glad_lazy_glEvalCoord1dv;
+	glad_glEvalCoord1f = glad_lazy_glEvalCoord1f;
+	glad_glEvalCoord1fv = glad_lazy_glEvalCoord1fv;
+	glad_glEvalCoord2d = glad_lazy_glEvalCoord2d;
+	glad_glEvalCoord2dv = glad_lazy_glEvalCoord2dv;
+	glad_glEvalCoord2f = glad_lazy_glEvalCoord2f;
+	glad_glEvalCoord2fv = glad_lazy_glEvalCoord2fv;
+	glad_glEvalMesh1 = glad_lazy_glEvalMesh1;
+	glad_glEvalMesh2 = glad_lazy_glEvalMesh2;
+	glad_glEvalPoint1 = glad_lazy_glEvalPoint1;
+	glad_glEvalPoint2 = glad_lazy_glEvalPoint2;
+	glad_glFeedbackBuffer = glad_lazy_glFeedbackBuffer;
+	glad_glFenceSync = glad_lazy_glFenceSync;
+	glad_glFinish = glad_lazy_glFinish;
+	glad_glFlush = glad_lazy_glFlush;
+	glad_glFlushMappedBufferRange = glad_lazy_glFlushMappedBufferRange;
+	glad_glFogCoordPointer = glad_lazy_glFogCoordPointer;
+	glad_glFogCoordd = glad_lazy_glFogCoordd;
+	glad_glFogCoorddv = glad_lazy_glFogCoorddv;
+	glad_glFogCoordf = glad_lazy_glFogCoordf;
+	glad_glFogCoordfv = glad_lazy_glFogCoordfv;
+	glad_glFogf = glad_lazy_glFogf;
+	glad_glFogfv = glad_lazy_glFogfv;
+	glad_glFogi = glad_lazy_glFogi;
+	glad_glFogiv = glad_lazy_glFogiv;
+	glad_glFramebufferRenderbuffer = glad_lazy_glFramebufferRenderbuffer;
+	glad_glFramebufferTexture = glad_lazy_glFramebufferTexture;
+	glad_glFramebufferTexture1D = glad_lazy_glFramebufferTexture1D;
+	glad_glFramebufferTexture2D = glad_lazy_glFramebufferTexture2D;
+	glad_glFramebufferTexture3D = glad_lazy_glFramebufferTexture3D;
+	glad_glFramebufferTextureLayer = glad_lazy_glFramebufferTextureLayer;
+	glad_glFrontFace = glad_lazy_glFrontFace;
+	glad_glFrustum = glad_lazy_glFrustum;
+	glad_glGenBuffers = glad_lazy_glGenBuffers;
+	glad_glGenFramebuffers = glad_lazy_glGenFramebuffers;
+	glad_glGenLists = glad_lazy_glGenLists;
+	glad_glGenQueries = glad_lazy_glGenQueries;
+	glad_glGenRenderbuffers = glad_lazy_glGenRenderbuffers;
+	glad_glGenSamplers = glad_lazy_glGenSamplers;
+	glad_glGenTextures = glad_lazy_glGenTextures;
+	glad_glGenVertexArrays = glad_lazy_glGenVertexArrays;
+	glad_glGenerateMipmap = glad_lazy_glGenerateMipmap;
+	glad_glGetActiveAttrib = glad_lazy_glGetActiveAttrib;
+	glad_glGetActiveUniform = glad_lazy_glGetActiveUniform;
+	glad_glGetActiveUniformBlockName = glad_lazy_glGetActiveUniformBlockName;
+	glad_glGetActiveUniformBlockiv = glad_lazy_glGetActiveUniformBlockiv;
+	glad_glGetActiveUniformName = glad_lazy_glGetActiveUniformName;
+	glad_glGetActiveUniformsiv = glad_lazy_glGetActiveUniformsiv;
+	glad_glGetAttachedShaders = glad_lazy_glGetAttachedShaders;
+	glad_glGetAttribLocation = glad_lazy_glGetAttribLocation;
+	glad_glGetBooleani_v = glad_lazy_glGetBooleani_v;
+	glad_glGetBooleanv = glad_lazy_glGetBooleanv;
+	glad_glGetBufferParameteri64v = glad_lazy_glGetBufferParameteri64v;
+	glad_glGetBufferParameteriv = glad_lazy_glGetBufferParameteriv;
+	glad_glGetBufferPointerv = glad_lazy_glGetBufferPointerv;
+	glad_glGetBufferSubData = glad_lazy_glGetBufferSubData;
+	glad_glGetClipPlane = glad_lazy_glGetClipPlane;
+	glad_glGetCompressedTexImage = glad_lazy_glGetCompressedTexImage;
+	glad_glGetDoublev = glad_lazy_glGetDoublev;
+	glad_glGetError = glad_lazy_glGetError;
+	glad_glGetFloatv = glad_lazy_glGetFloatv;
+	glad_glGetFragDataIndex = glad_lazy_glGetFragDataIndex;
+	glad_glGetFragDataLocation = glad_lazy_glGetFragDataLocation;
+	glad_glGetFramebufferAttachmentParameteriv = glad_lazy_glGetFramebufferAttachmentParameteriv;
+	glad_glGetInteger64i_v = glad_lazy_glGetInteger64i_v;
+	glad_glGetInteger64v = glad_lazy_glGetInteger64v;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+	glad_glGetIntegerv = glad_lazy_glGetIntegerv;
+	glad_glGetLightfv = glad_lazy_glGetLightfv;
+	glad_glGetLightiv = glad_lazy_glGetLightiv;
+	glad_glGetMapdv = glad_lazy_glGetMapdv;
+	glad_glGetMapfv = glad_lazy_glGetMapfv;
+	glad_glGetMapiv = glad_lazy_glGetMapiv;
+	glad_glGetMaterialfv = glad_lazy_glGetMaterialfv;
+	glad_glGetMaterialiv = glad_lazy_glGetMaterialiv;
+	glad_glGetMultisamplefv = glad_lazy_glGetMultisamplefv;
+	glad_glGetPixelMapfv = glad_lazy_glGetPixelMapfv;
+	glad_glGetPixelMapuiv = glad_lazy_glGetPixelMapuiv;
+	glad_glGetPixelMapusv = glad_lazy_glGetPixelMapusv;
+	glad_glGetPointerv = glad_lazy_glGetPointerv;
+	glad_glGetPolygonStipple = glad_lazy_glGetPolygonStipple;
+	glad_glGetProgramInfoLog = glad_lazy_glGetProgramInfoLog;
+	glad_glGetProgramiv = glad_lazy_glGetProgramiv;
+	glad_glGetQueryObjecti64v = glad_lazy_glGetQueryObjecti64v;
+	glad_glGetQueryObjectiv = glad_lazy_glGetQueryObjectiv;
+	glad_glGetQueryObjectui64v = glad_lazy_glGetQueryObjectui64v;
+	glad_glGetQueryObjectuiv = glad_lazy_glGetQueryObjectuiv;
+	glad_glGetQueryiv = glad_lazy_glGetQueryiv;
+	glad_glGetRenderbufferParameteriv = glad_lazy_glGetRenderbufferParameteriv;
+	glad_glGetSamplerParameterIiv = glad_lazy_glGetSamplerParameterIiv;
+	glad_glGetSamplerParameterIuiv = glad_lazy_glGetSamplerParameterIuiv;
+	glad_glGetSamplerParameterfv = glad_lazy_glGetSamplerParameterfv;
+	glad_glGetSamplerParameteriv = glad_lazy_glGetSamplerParameteriv;
+	glad_glGetShaderInfoLog = glad_lazy_glGetShaderInfoLog;
+	glad_glGetShaderSource = glad_lazy_glGetShaderSource;
+	glad_glGetShaderiv = glad_lazy_glGetShaderiv;
+	glad_glGetString = glad_lazy_glGetString;
+	glad_glGetStringi = glad_lazy_glGetStringi;
+	glad_glGetSynciv = glad_lazy_glGetSynciv;
+	glad_glGetTexEnvfv = glad_lazy_glGetTexEnvfv;
+	glad_glGetTexEnviv = glad_lazy_glGetTexEnviv;
+	glad_glGetTexGendv = glad_lazy_glGetTexGendv;
+	glad_glGetTexGenfv = glad_lazy_glGetTexGenfv;
+	glad_glGetTexGeniv = glad_lazy_glGetTexGeniv;
+	glad_glGetTexImage = glad_lazy_glGetTexImage;
+	glad_glGetTexLevelParameterfv = glad_lazy_glGetTexLevelParameterfv;
+	glad_glGetTexLevelParameteriv = glad_lazy_glGetTexLevelParameteriv;
+	glad_glGetTexParameterIiv = glad_lazy_glGetTexParameterIiv;
+	glad_glGetTexParameterIuiv = glad_lazy_glGetTexParameterIuiv;
+	glad_glGetTexParameterfv = glad_lazy_glGetTexParameterfv;
+	glad_glGetTexParameteriv = glad_lazy_glGetTexParameteriv;
+	glad_glGetTransformFeedbackVarying = glad_lazy_glGetTransformFeedbackVarying;
+	glad_glGetUniformBlockIndex = glad_lazy_glGetUniformBlockIndex;
+	glad_glGetUniformIndices = glad_lazy_glGetUniformIndices;
+	glad_glGetUniformLocation = glad_lazy_glGetUniformLocation;
+	glad_glGetUniformfv = glad_lazy_glGetUniformfv;
+	glad_glGetUniformiv = glad_lazy_glGetUniformiv;
+	glad_glGetUniformuiv = glad_lazy_glGetUniformuiv;
+	glad_glGetVertexAttribIiv = glad_lazy_glGetVertexAttribIiv;
+	glad_glGetVertexAttribIuiv = glad_lazy_glGetVertexAttribIuiv;
+	glad_glGetVertexAttribPointerv = glad_lazy_glGetVertexAttribPointerv;
+	glad_glGetVertexAttribdv = glad_lazy_glGetVertexAttribdv;
+	glad_glGetVertexAttribfv = glad_lazy_glGetVertexAttribfv;
+	glad_glGetVertexAttribiv = glad_lazy_glGetVertexAttribiv;
+	glad_glHint = glad_lazy_glHint;
+	glad_glIndexMask = glad_lazy_glIndexMask;
+	glad_glIndexPointer = glad_lazy_glIndexPointer;
+	glad_glIndexd = glad_lazy_glIndexd;
+	glad_glIndexdv = glad_lazy_glIndexdv;
+	glad_glIndexf = glad_lazy_glIndexf;
+	glad_glIndexfv = glad_lazy_glIndexfv;
+	glad_glIndexi = glad_lazy_glIndexi;
+	glad_glIndexiv = glad_lazy_glIndexiv;
+	glad_glIndexs = glad_lazy_glIndexs;
+	glad_glIndexsv = glad_lazy_glIndexsv;
+	glad_glIndexub = glad_lazy_glIndexub;
+	glad_glIndexubv = glad_lazy_glIndexubv;
+	glad_glInitNames = glad_lazy_glInitNames;
+	glad_glInterleavedArrays = glad_lazy_glInterleavedArrays;
+	glad_glIsBuffer = glad_lazy_glIsBuffer;
+	glad_glIsEnabled = glad_lazy_glIsEnabled;
+	glad_glIsEnabledi = glad_lazy_glIsEnabledi;
+	glad_glIsFramebuffer = glad_lazy_glIsFramebuffer;
+	glad_glIsList = glad_lazy_glIsList;
+	glad_glIsProgram = glad_lazy_glIsProgram;
+	glad_glIsQuery = glad_lazy_glIsQuery;
+	glad_glIsRenderbuffer = glad_lazy_glIsRenderbuffer;
+	glad_glIsSampler = glad_lazy_glIsSampler;
+	glad_glIsShader = glad_lazy_glIsShader;
+	glad_glIsSync = glad_lazy_glIsSync;
+	glad_glIsTexture = glad_lazy_glIsTexture;
+	glad_glIsVertexArray = glad_lazy_glIsVertexArray;
+	glad_glLightModelf = glad_lazy_glLightModelf;
+	glad_glLightModelfv = glad_lazy_glLightModelfv;
+	glad_glLightModeli = glad_lazy_glLightModeli;
+	glad_glLightModeliv = glad_lazy_glLightModeliv;
+	glad_glLightf = glad_lazy_glLightf;
+	glad_glLightfv = glad_lazy_glLightfv;
+	glad_glLighti = glad_lazy_glLighti;
+	glad_glLightiv = glad_lazy_glLightiv;
+	glad_glLineStipple = glad_lazy_glLineStipple;
+	glad_glLineWidth = glad_lazy_glLineWidth;
+	glad_glLinkProgram = glad_lazy_glLinkProgram;
+	glad_glListBase = glad_lazy_glListBase;
+	glad_glLoadIdentity = glad_lazy_glLoadIdentity;
+	glad_glLoadMatrixd = glad_lazy_glLoadMatrixd;
+	glad_glLoadMatrixf = glad_lazy_glLoadMatrixf;
+	glad_glLoadName = glad_lazy_glLoadName;
+	glad_glLoadTransposeMatrixd = glad_lazy_glLoadTransposeMatrixd;
+	glad_glLoadTransposeMatrixf = glad_lazy_glLoadTransposeMatrixf;
+	glad_glLogicOp = glad_lazy_glLogicOp;
+	glad_glMap1d = glad_lazy_glMap1d;
+	glad_glMap1f = glad_lazy_glMap1f;
+	glad_glMap2d = glad_lazy_glMap2d;
+	glad_glMap2f = glad_lazy_glMap2f;
+	glad_glMapBuffer = glad_lazy_glMapBuffer;
+	glad_glMapBufferRange = glad_lazy_glMapBufferRange;
+	glad_glMapGrid1d = glad_lazy_glMapGrid1d;
+	glad_glMapGrid1f = glad_lazy_glMapGrid1f;
+	glad_glMapGrid2d = glad_lazy_glMapGrid2d;
+	glad_glMapGrid2f = glad_lazy_glMapGrid2f;
+	glad_glMaterialf = glad_lazy_glMaterialf;
+	glad_glMaterialfv = glad_lazy_glMaterialfv;
+	glad_glMateriali = glad_lazy_glMateriali;
+	glad_glMaterialiv = glad_lazy_glMaterialiv;
+	glad_glMatrixMode = glad_lazy_glMatrixMode;
+	glad_glMultMatrixd = glad_lazy_glMultMatrixd;
+	glad_glMultMatrixf = glad_lazy_glMultMatrixf;
+	glad_glMultTransposeMatrixd = glad_lazy_glMultTransposeMatrixd;
+	glad_glMultTransposeMatrixf = glad_lazy_glMultTransposeMatrixf;
+	glad_glMultiDrawArrays = glad_lazy_glMultiDrawArrays;
+	glad_glMultiDrawElements = glad_lazy_glMultiDrawElements;
+	glad_glMultiDrawElementsBaseVertex = glad_lazy_glMultiDrawElementsBaseVertex;
+	glad_glMultiTexCoord1d = glad_lazy_glMultiTexCoord1d;
+	glad_glMultiTexCoord1dv = glad_lazy_glMultiTexCoord1dv;
+	glad_glMultiTexCoord1f = glad_lazy_glMultiTexCoord1f;
+	glad_glMultiTexCoord1fv = glad_lazy_glMultiTexCoord1fv;
+	glad_glMultiTexCoord1i = glad_lazy_glMultiTexCoord1i;
+	glad_glMultiTexCoord1iv = glad_lazy_glMultiTexCoord1iv;
+	glad_glMultiTexCoord1s = glad_lazy_glMultiTexCoord1s;
+	glad_glMultiTexCoord1sv = glad_lazy_glMultiTexCoord1sv;
+	glad_glMultiTexCoord2d = glad_lazy_glMultiTexCoord2d;
+	glad_glMultiTexCoord2dv = glad_lazy_glMultiTexCoord2dv;
+	glad_glMultiTexCoord2f = glad_lazy_glMultiTexCoord2f;
+	glad_glMultiTexCoord2fv = glad_lazy_glMultiTexCoord2fv;
+	glad_glMultiTexCoord2i = glad_lazy_glMultiTexCoord2i;
+	glad_glMultiTexCoord2iv = glad_lazy_glMultiTexCoord2iv;
+	glad_glMultiTexCoord2s = glad_lazy_glMultiTexCoord2s;
+	glad_glMultiTexCoord2sv = glad_lazy_glMultiTexCoord2sv;
+	glad_glMultiTexCoord3d = glad_lazy_glMultiTexCoord3d;
+	glad_glMultiTexCoord3dv = glad_lazy_glMultiTexCoord3dv;
+	glad_glMultiTexCoord3f = glad_lazy_glMultiTexCoord3f;
+	glad_glMultiTexCoord3fv = glad_lazy_glMultiTexCoord3fv;
+	glad_glMultiTexCoord3i = glad_lazy_glMultiTexCoord3i;
+	glad_glMultiTexCoord3iv = glad_lazy_glMultiTexCoord3iv;
+	glad_glMultiTexCoord3s = glad_lazy_glMultiTexCoord3s;
+	glad_glMultiTexCoord3sv = glad_lazy_glMultiTexCoord3sv;
+	glad_glMultiTexCoord4d = glad_lazy_glMultiTexCoord4d;
+	glad_glMultiTexCoord4dv = glad_lazy_glMultiTexCoord4dv;
+	glad_glMultiTexCoord4f = glad_lazy_glMultiTexCoord4f;
+	glad_glMultiTexCoord4fv = glad_lazy_glMultiTexCoord4fv;
+	glad_glMultiTexCoord4i = glad_lazy_glMultiTexCoord4i;
+	glad_glMultiTexCoord4iv = glad_lazy_glMultiTexCoord4iv;
+	glad_glMultiTexCoord4s = glad_lazy_glMultiTexCoord4s;
+	glad_glMultiTexCoord4sv = glad_lazy_glMultiTexCoord4sv;
+	glad_glMultiTexCoordP1ui = glad_lazy_glMultiTexCoordP1ui;
+	glad_glMultiTexCoordP1uiv = glad_lazy_glMultiTexCoordP1uiv;
+	glad_glMultiTexCoordP2ui = glad_lazy_glMultiTexCoordP2ui;
+	glad_glMultiTexCoordP2uiv = glad_lazy_glMultiTexCoordP2uiv;
+	glad_glMultiTexCoordP3ui = glad_lazy_glMultiTexCoordP3ui;
+	glad_glMultiTexCoordP3uiv = glad_lazy_glMultiTexCoordP3uiv;
+	glad_glMultiTexCoordP4ui = glad_lazy_glMultiTexCoordP4ui;
+	glad_glMultiTexCoordP4uiv = glad_lazy_glMultiTexCoordP4uiv;
+	glad_glNewList = glad_lazy_glNewList;
+	glad_glNormal3b = glad_lazy_glNormal3b;
+	glad_glNormal3bv = glad_lazy_glNormal3bv;
+	glad_glNormal3d = glad_lazy_glNormal3d;
+	glad_glNormal3dv = glad_lazy_glNormal3dv;
+	glad_glNormal3f = glad_lazy_glNormal3f;
+	glad_glNormal3fv = glad_lazy_glNormal3fv;
+	glad_glNormal3i = glad_lazy_glNormal3i;
+	glad_glNormal3iv = glad_lazy_glNormal3iv;
+	glad_glNormal3s = glad_lazy_glNormal3s;
+	glad_glNormal3sv = glad_lazy_glNormal3sv;
+	glad_glNormalP3ui = glad_lazy_glNormalP3ui;
+	glad_glNormalP3uiv = glad_lazy_glNormalP3uiv;
+	glad_glNormalPointer = glad_lazy_glNormalPointer;
+	glad_glOrtho = glad_lazy_glOrtho;
+	glad_glPassThrough = glad_lazy_glPassThrough;
+	glad_glPixelMapfv = glad_lazy_glPixelMapfv;
+	glad_glPixelMapuiv = glad_lazy_glPixelMapuiv;
+	glad_glPixelMapusv = glad_lazy_glPixelMapusv;
+	glad_glPixelStoref = glad_lazy_glPixelStoref;
+	glad_glPixelStorei = glad_lazy_glPixelStorei;
+	glad_glPixelTransferf = glad_lazy_glPixelTransferf;
+	glad_glPixelTransferi = glad_lazy_glPixelTransferi;
+	glad_glPixelZoom = glad_lazy_glPixelZoom;
+	glad_glPointParameterf = glad_lazy_glPointParameterf;
+	glad_glPointParameterfv = glad_lazy_glPointParameterfv;
+	glad_glPointParameteri = glad_lazy_glPointParameteri;
+	glad_glPointParameteriv = glad_lazy_glPointParameteriv;
+	glad_glPointSize = glad_lazy_glPointSize;
+	glad_glPolygonMode = glad_lazy_glPolygonMode;
+	glad_glPolygonOffset = glad_lazy_glPolygonOffset;
+	glad_glPolygonStipple = glad_lazy_glPolygonStipple;
+	glad_glPopAttrib = glad_lazy_glPopAttrib;
+	glad_glPopClientAttrib = glad_lazy_glPopClientAttrib;
+	glad_glPopMatrix = glad_lazy_glPopMatrix;
+	glad_glPopName = glad_lazy_glPopName;
+	glad_glPrimitiveRestartIndex = glad_lazy_glPrimitiveRestartIndex;
+	glad_glPrioritizeTextures = glad_lazy_glPrioritizeTextures;
+	glad_glProvokingVertex = glad_lazy_glProvokingVertex;
+	glad_glPushAttrib = glad_lazy_glPushAttrib;
+	glad_glPushClientAttrib = glad_lazy_glPushClientAttrib;
+	glad_glPushMatrix = glad_lazy_glPushMatrix;
+	glad_glPushName = glad_lazy_glPushName;
+	glad_glQueryCounter = glad_lazy_glQueryCounter;
+	glad_glRasterPos2d = glad_lazy_glRasterPos2d;
+	glad_glRasterPos2dv = glad_lazy_glRasterPos2dv;
+	glad_glRasterPos2f = glad_lazy_glRasterPos2f;
+	glad_glRasterPos2fv = glad_lazy_glRasterPos2fv;
+	glad_glRasterPos2i = glad_lazy_glRasterPos2i;
+	glad_glRasterPos2iv = glad_lazy_glRasterPos2iv;
+	glad_glRasterPos2s = glad_lazy_glRasterPos2s;
+	glad_glRasterPos2sv = glad_lazy_glRasterPos2sv;
+	glad_glRasterPos3d = glad_lazy_glRasterPos3d;
+	glad_glRasterPos3dv = glad_lazy_glRasterPos3dv;
+	glad_glRasterPos3f = glad_lazy_glRasterPos3f;
+	glad_glRasterPos3fv = glad_lazy_glRasterPos3fv;
+	glad_glRasterPos3i = glad_lazy_glRasterPos3i;
+	glad_glRasterPos3iv = glad_lazy_glRasterPos3iv;
+	glad_glRasterPos3s = glad_lazy_glRasterPos3s;
+	glad_glRasterPos3sv = glad_lazy_glRasterPos3sv;
+	glad_glRasterPos4d = glad_lazy_glRasterPos4d;
+	glad_glRasterPos4dv = glad_lazy_glRasterPos4dv;
+	glad_glRasterPos4f = glad_lazy_glRasterPos4f;
+	glad_glRasterPos4fv = glad_lazy_glRasterPos4fv;
+	glad_glRasterPos4i = glad_lazy_glRasterPos4i;
+	glad_glRasterPos4iv = glad_lazy_glRasterPos4iv;
+	glad_glRasterPos4s = glad_lazy_glRasterPos4s;
+	glad_glRasterPos4sv = glad_lazy_glRasterPos4sv;
+	glad_glReadBuffer = glad_lazy_glReadBuffer;
+	glad_glReadPixels = glad_lazy_glReadPixels;
+	glad_glRectd = glad_lazy_glRectd;
+	glad_glRectdv = glad_lazy_glRectdv;
+	glad_glRectf = glad_lazy_glRectf;
+	glad_glRectfv = glad_lazy_glRectfv;
+	glad_glRecti = glad_lazy_glRecti;
+	glad_glRectiv = glad_lazy_glRectiv;
+	glad_glRects = glad_lazy_glRects;
+	glad_glRectsv = glad_lazy_glRectsv;
+	glad_glRenderMode = glad_lazy_glRenderMode;
+	glad_glRenderbufferStorage = glad_lazy_glRenderbufferStorage;
+	glad_glRenderbufferStorageMultisample = glad_lazy_glRenderbufferStorageMultisample;
+	glad_glRotated = glad_lazy_glRotated;
+	glad_glRotatef = glad_lazy_glRotatef;
+	glad_glSampleCoverage = glad_lazy_glSampleCoverage;
+	glad_glSampleMaski = glad_lazy_glSampleMaski;
+	glad_glSamplerParameterIiv = glad_lazy_glSamplerParameterIiv;
+	glad_glSamplerParameterIuiv = glad_lazy_glSamplerParameterIuiv;
+	glad_glSamplerParameterf = glad_lazy_glSamplerParameterf;
+	glad_glSamplerParameterfv = glad_lazy_glSamplerParameterfv;
+	glad_glSamplerParameteri = glad_lazy_glSamplerParameteri;
+	glad_glSamplerParameteriv = glad_lazy_glSamplerParameteriv;
+	glad_glScaled = glad_lazy_glScaled;
+	glad_glScalef = glad_lazy_glScalef;
+	glad_glScissor = glad_lazy_glScissor;
+	glad_glSecondaryColor3b = glad_lazy_glSecondaryColor3b;
+	glad_glSecondaryColor3bv = glad_lazy_glSecondaryColor3bv;
+	glad_glSecondaryColor3d = glad_lazy_glSecondaryColor3d;
+	glad_glSecondaryColor3dv = glad_lazy_glSecondaryColor3dv;
+	glad_glSecondaryColor3f = glad_lazy_glSecondaryColor3f;
+	glad_glSecondaryColor3fv = glad_lazy_glSecondaryColor3fv;
+	glad_glSecondaryColor3i = glad_lazy_glSecondaryColor3i;
+	glad_glSecondaryColor3iv = glad_lazy_glSecondaryColor3iv;
+	glad_glSecondaryColor3s = glad_lazy_glSecondaryColor3s;
+	glad_glSecondaryColor3sv = glad_lazy_glSecondaryColor3sv;
+	glad_glSecondaryColor3ub = glad_lazy_glSecondaryColor3ub;
+	glad_glSecondaryColor3ubv = glad_lazy_glSecondaryColor3ubv;
+	glad_glSecondaryColor3ui = glad_lazy_glSecondaryColor3ui;
+	glad_glSecondaryColor3uiv = glad_lazy_glSecondaryColor3uiv;
+	glad_glSecondaryColor3us = glad_lazy_glSecondaryColor3us;
+	glad_glSecondaryColor3usv = glad_lazy_glSecondaryColor3usv;
+	glad_glSecondaryColorP3ui = glad_lazy_glSecondaryColorP3ui;
+	glad_glSecondaryColorP3uiv = glad_lazy_glSecondaryColorP3uiv;
+	glad_glSecondaryColorPointer = glad_lazy_glSecondaryColorPointer;
+	glad_glSelectBuffer = glad_lazy_glSelectBuffer;
+	glad_glShadeModel = glad_lazy_glShadeModel;
+	glad_glShaderSource = glad_lazy_glShaderSource;
+	glad_glStencilFunc = glad_lazy_glStencilFunc;
+	glad_glStencilFuncSeparate = glad_lazy_glStencilFuncSeparate;
+	glad_glStencilMask = glad_lazy_glStencilMask;
+	glad_glStencilMaskSeparate = glad_lazy_glStencilMaskSeparate;
+	glad_glStencilOp = glad_lazy_glStencilOp;
+	glad_glStencilOpSeparate = glad_lazy_glStencilOpSeparate;
+	glad_glTexBuffer = glad_lazy_glTexBuffer;
+	glad_glTexCoord1d = glad_lazy_glTexCoord1d;
+	glad_glTexCoord1dv = glad_lazy_glTexCoord1dv;
+	glad_glTexCoord1f = glad_lazy_glTexCoord1f;
+	glad_glTexCoord1fv = glad_lazy_glTexCoord1fv;
+	glad_glTexCoord1i = glad_lazy_glTexCoord1i;
+	glad_glTexCoord1iv = glad_lazy_glTexCoord1iv;
+	glad_glTexCoord1s = glad_lazy_glTexCoord1s;
+	glad_glTexCoord1sv = glad_lazy_glTexCoord1sv;
+	glad_glTexCoord2d = glad_lazy_glTexCoord2d;
+	glad_glTexCoord2dv = glad_lazy_glTexCoord2dv;
+	glad_glTexCoord2f = glad_lazy_glTexCoord2f;
+	glad_glTexCoord2fv = glad_lazy_glTexCoord2fv;
+	glad_glTexCoord2i = glad_lazy_glTexCoord2i;
+	glad_glTexCoord2iv = glad_lazy_glTexCoord2iv;
+	glad_glTexCoord2s = glad_lazy_glTexCoord2s;
+	glad_glTexCoord2sv = glad_lazy_glTexCoord2sv;
+	glad_glTexCoord3d = glad_lazy_glTexCoord3d;
+	glad_glTexCoord3dv = glad_lazy_glTexCoord3dv;
+	glad_glTexCoord3f = glad_lazy_glTexCoord3f;
+	glad_glTexCoord3fv = glad_lazy_glTexCoord3fv;
+	glad_glTexCoord3i = glad_lazy_glTexCoord3i;
+	glad_glTexCoord3iv = glad_lazy_glTexCoord3iv;
+	glad_glTexCoord3s = glad_lazy_glTexCoord3s;
+	glad_glTexCoord3sv = glad_lazy_glTexCoord3sv;
+	glad_glTexCoord4d = glad_lazy_glTexCoord4d;
+	glad_glTexCoord4dv = glad_lazy_glTexCoord4dv;
+	glad_glTexCoord4f = glad_lazy_glTexCoord4f;
+	glad_glTexCoord4fv = glad_lazy_glTexCoord4fv;
+	glad_glTexCoord4i = glad_lazy_glTexCoord4i;
+	glad_glTexCoord4iv = glad_lazy_glTexCoord4iv;
+	glad_glTexCoord4s = glad_lazy_glTexCoord4s;
+	glad_glTexCoord4sv = glad_lazy_glTexCoord4sv;
+	glad_glTexCoordP1ui = glad_lazy_glTexCoordP1ui;
+	glad_glTexCoordP1uiv = glad_lazy_glTexCoordP1uiv;
+	glad_glTexCoordP2ui = glad_lazy_glTexCoordP2ui;
+	glad_glTexCoordP2uiv = glad_lazy_glTexCoordP2uiv;
+	glad_glTexCoordP3ui = glad_lazy_glTexCoordP3ui;
+	glad_glTexCoordP3uiv = glad_lazy_glTexCoordP3uiv;
+	glad_glTexCoordP4ui = glad_lazy_glTexCoordP4ui;
+	glad_glTexCoordP4uiv = glad_lazy_glTexCoordP4uiv;
+	glad_glTexCoordPointer = glad_lazy_glTexCoordPointer;
+	glad_glTexEnvf = glad_lazy_glTexEnvf;
+	glad_glTexEnvfv = glad_lazy_glTexEnvfv;
+	glad_glTexEnvi = glad_lazy_glTexEnvi;
+	glad_glTexEnviv = glad_lazy_glTexEnviv;
+	glad_glTexGend = glad_lazy_glTexGend;
+	glad_glTexGendv = glad_lazy_glTexGendv;
+	glad_glTexGenf = glad_lazy_glTexGenf;
+	glad_glTexGenfv = glad_lazy_glTexGenfv;
+	glad_glTexGeni = glad_lazy_glTexGeni;
+	glad_glTexGeniv = glad_lazy_glTexGeniv;
+	glad_glTexImage1D = glad_lazy_glTexImage1D;
+	glad_glTexImage2D = glad_lazy_glTexImage2D;
+	glad_glTexImage2DMultisample = glad_lazy_glTexImage2DMultisample;
+	glad_glTexImage3D = glad_lazy_glTexImage3D;
+	glad_glTexImage3DMultisample = glad_lazy_glTexImage3DMultisample;
+	glad_glTexParameterIiv = glad_lazy_glTexParameterIiv;
+	glad_glTexParameterIuiv = glad_lazy_glTexParameterIuiv;
+	glad_glTexParameterf = glad_lazy_glTexParameterf;
+	glad_glTexParameterfv = glad_lazy_glTexParameterfv;
+	glad_glTexParameteri = glad_lazy_glTexParameteri;
+	glad_glTexParameteriv = glad_lazy_glTexParameteriv;
+	glad_glTexSubImage1D = glad_lazy_glTexSubImage1D;
+	glad_glTexSubImage2D = glad_lazy_glTexSubImage2D;
+	glad_glTexSubImage3D = glad_lazy_glTexSubImage3D;
+	glad_glTransformFeedbackVaryings = glad_lazy_glTransformFeedbackVaryings;
+	glad_glTranslated = glad_lazy_glTranslated;
+	glad_glTranslatef = glad_lazy_glTranslatef;
+	glad_glUniform1f = glad_lazy_glUniform1f;
+	glad_glUniform1fv = glad_lazy_glUniform1fv;
+	glad_glUniform1i = glad_lazy_glUniform1i;
+	glad_glUniform1iv = glad_lazy_glUniform1iv;
+	glad_glUniform1ui = glad_lazy_glUniform1ui;
+	glad_glUniform1uiv = glad_lazy_glUniform1uiv;
+	glad_glUniform2f = glad_lazy_glUniform2f;
+	glad_glUniform2fv = glad_lazy_glUniform2fv;
+	glad_glUniform2i = glad_lazy_glUniform2i;
+	glad_glUniform2iv = glad_lazy_glUniform2iv;
+	glad_glUniform2ui = glad_lazy_glUniform2ui;
+	glad_glUniform2uiv = glad_lazy_glUniform2uiv;
+	glad_glUniform3f = glad_lazy_glUniform3f;
+	glad_glUniform3fv = glad_lazy_glUniform3fv;
+	glad_glUniform3i = glad_lazy_glUniform3i;
+	glad_glUniform3iv = glad_lazy_glUniform3iv;
+	glad_glUniform3ui = glad_lazy_glUniform3ui;
+	glad_glUniform3uiv = glad_lazy_glUniform3uiv;
+	glad_glUniform4f = glad_lazy_glUniform4f;
+	glad_glUniform4fv = glad_lazy_glUniform4fv;
+	glad_glUniform4i = glad_lazy_glUniform4i;
+	glad_glUniform4iv = glad_lazy_glUniform4iv;
+	glad_glUniform4ui = glad_lazy_glUniform4ui;
+	glad_glUniform4uiv = glad_lazy_glUniform4uiv;
+	glad_glUniformBlockBinding = glad_lazy_glUniformBlockBinding;
+	glad_glUniformMatrix2fv = glad_lazy_glUniformMatrix2fv;
+	glad_glUniformMatrix2x3fv = glad_lazy_glUniformMatrix2x3fv;
+	glad_glUniformMatrix2x4fv = glad_lazy_glUniformMatrix2x4fv;
+	glad_glUniformMatrix3fv = glad_lazy_glUniformMatrix3fv;
+	glad_glUniformMatrix3x2fv = glad_lazy_glUniformMatrix3x2fv;
+	glad_glUniformMatrix3x4fv = glad_lazy_glUniformMatrix3x4fv;
+	glad_glUniformMatrix4fv = glad_lazy_glUniformMatrix4fv;
+	glad_glUniformMatrix4x2fv = glad_lazy_glUniformMatrix4x2fv;
+	glad_glUniformMatrix4x3fv = glad_lazy_glUniformMatrix4x3fv;
+	glad_glUnmapBuffer = glad_lazy_glUnmapBuffer;
+	glad_glUseProgram = glad_lazy_glUseProgram;
+	glad_glValidateProgram = glad_lazy_glValidateProgram;
+	glad_glVertex2d = glad_lazy_glVertex2d;
+	glad_glVertex2dv = glad_lazy_glVertex2dv;
+	glad_glVertex2f = glad_lazy_glVertex2f;
+	glad_glVertex2fv = glad_lazy_glVertex2fv;
+	glad_glVertex2i = glad_lazy_glVertex2i;
+	glad_glVertex2iv = glad_lazy_glVertex2iv;
+	glad_glVertex2s = glad_lazy_glVertex2s;
+	glad_glVertex2sv = glad_lazy_glVertex2sv;
+	glad_glVertex3d = glad_lazy_glVertex3d;
+	glad_glVertex3dv = glad_lazy_glVertex3dv;
+	glad_glVertex3f = glad_lazy_glVertex3f;
+	glad_glVertex3fv = glad_lazy_glVertex3fv;
+	glad_glVertex3i = glad_lazy_glVertex3i;
+	glad_glVertex3iv = glad_lazy_glVertex3iv;
+	glad_glVertex3s = glad_lazy_glVertex3s;
+	glad_glVertex3sv = glad_lazy_glVertex3sv;
+	glad_glVertex4d = glad_lazy_glVertex4d;
+	glad_glVertex4dv = glad_lazy_glVertex4dv;
+	glad_glVertex4f = glad_lazy_glVertex4f;
+	glad_glVertex4fv = glad_lazy_glVertex4fv;
+	glad_glVertex4i = glad_lazy_glVertex4i;
+	glad_glVertex4iv = glad_lazy_glVertex4iv;
+	glad_glVertex4s = glad_lazy_glVertex4s;
+	glad_glVertex4sv = glad_lazy_glVertex4sv;
+	glad_glVertexAttrib1d = glad_lazy_glVertexAttrib1d;
+	glad_glVertexAttrib1dv = glad_lazy_glVertexAttrib1dv;
+	glad_glVertexAttrib1f = glad_lazy_glVertexAttrib1f;
+	glad_glVertexAttrib1fv = glad_lazy_glVertexAttrib1fv;
+	glad_glVertexAttrib1s = glad_lazy_glVertexAttrib1s;
+	glad_glVertexAttrib1sv = glad_lazy_glVertexAttrib1sv;
+	glad_glVertexAttrib2d = glad_lazy_glVertexAttrib2d;
+	glad_glVertexAttrib2dv = glad_lazy_glVertexAttrib2dv;
+	glad_glVertexAttrib2f = glad_lazy_glVertexAttrib2f;
+	glad_glVertexAttrib2fv = glad_lazy_glVertexAttrib2fv;
+	glad_glVertexAttrib2s = glad_lazy_glVertexAttrib2s;
+	glad_glVertexAttrib2sv = glad_lazy_glVertexAttrib2sv;
+	glad_glVertexAttrib3d = glad_lazy_glVertexAttrib3d;
+	glad_glVertexAttrib3dv = glad_lazy_glVertexAttrib3dv;
+	glad_glVertexAttrib3f = glad_lazy_glVertexAttrib3f;
+	glad_glVertexAttrib3fv = glad_lazy_glVertexAttrib3fv;
+	glad_glVertexAttrib3s = glad_lazy_glVertexAttrib3s;
+	glad_glVertexAttrib3sv = glad_lazy_glVertexAttrib3sv;
+	glad_glVertexAttrib4Nbv = glad_lazy_glVertexAttrib4Nbv;
+	glad_glVertexAttrib4Niv = glad_lazy_glVertexAttrib4Niv;
+	glad_glVertexAttrib4Nsv = glad_lazy_glVertexAttrib4Nsv;
+	glad_glVertexAttrib4Nub = glad_lazy_glVertexAttrib4Nub;
+	glad_glVertexAttrib4Nubv = glad_lazy_glVertexAttrib4Nubv;
+	glad_glVertexAttrib4Nuiv = glad_lazy_glVertexAttrib4Nuiv;
+	glad_glVertexAttrib4Nusv = glad_lazy_glVertexAttrib4Nusv;
+	glad_glVertexAttrib4bv = glad_lazy_glVertexAttrib4bv;
+	glad_glVertexAttrib4d = glad_lazy_glVertexAttrib4d;
+	glad_glVertexAttrib4dv = glad_lazy_glVertexAttrib4dv;
+	glad_glVertexAttrib4f = glad_lazy_glVertexAttrib4f;
+	glad_glVertexAttrib4fv = glad_lazy_glVertexAttrib4fv;
+	glad_glVertexAttrib4iv = glad_lazy_glVertexAttrib4iv;
+	glad_glVertexAttrib4s = glad_lazy_glVertexAttrib4s;
+	glad_glVertexAttrib4sv = glad_lazy_glVertexAttrib4sv;
+	glad_glVertexAttrib4ubv = glad_lazy_glVertexAttrib4ubv;
+	glad_glVertexAttrib4uiv = glad_lazy_glVertexAttrib4uiv;
+	glad_glVertexAttrib4usv = glad_lazy_glVertexAttrib4usv;
+	glad_glVertexAttribDivisor = glad_lazy_glVertexAttribDivisor;
+	glad_glVertexAttribI1i = glad_lazy_glVertexAttribI1i;
+	glad_glVertexAttribI1iv = glad_lazy_glVertexAttribI1iv;
+	glad_glVertexAttribI1ui = glad_lazy_glVertexAttribI1ui;
+	glad_glVertexAttribI1uiv = glad_lazy_glVertexAttribI1uiv;
+	glad_glVertexAttribI2i = glad_lazy_glVertexAttribI2i;
+	glad_glVertexAttribI2iv = glad_lazy_glVertexAttribI2iv;
+	glad_glVertexAttribI2ui = glad_lazy_glVertexAttribI2ui;
+	glad_glVertexAttribI2uiv = glad_lazy_glVertexAttribI2uiv;
+	glad_glVertexAttribI3i = glad_lazy_glVertexAttribI3i;
+	glad_glVertexAttribI3iv = glad_lazy_glVertexAttribI3iv;
+	glad_glVertexAttribI3ui = glad_lazy_glVertexAttribI3ui;
+	glad_glVertexAttribI3uiv = glad_lazy_glVertexAttribI3uiv;
+	glad_glVertexAttribI4bv = glad_lazy_glVertexAttribI4bv;
+	glad_glVertexAttribI4i = glad_lazy_glVertexAttribI4i;
+	glad_glVertexAttribI4iv = glad_lazy_glVertexAttribI4iv;
+	glad_glVertexAttribI4sv = glad_lazy_glVertexAttribI4sv;
+	glad_glVertexAttribI4ubv = glad_lazy_glVertexAttribI4ubv;
+	glad_glVertexAttribI4ui = glad_lazy_glVertexAttribI4ui;
+	glad_glVertexAttribI4uiv = glad_lazy_glVertexAttribI4uiv;
+	glad_glVertexAttribI4usv = glad_lazy_glVertexAttribI4usv;
+	glad_glVertexAttribIPointer = glad_lazy_glVertexAttribIPointer;
+	glad_glVertexAttribP1ui = glad_lazy_glVertexAttribP1ui;
+	glad_glVertexAttribP1uiv = glad_lazy_glVertexAttribP1uiv;
+	glad_glVertexAttribP2ui = glad_lazy_glVertexAttribP2ui;
+	glad_glVertexAttribP2uiv = glad_lazy_glVertexAttribP2uiv;
+	glad_glVertexAttribP3ui = glad_lazy_glVertexAttribP3ui;
+	glad_glVertexAttribP3uiv = glad_lazy_glVertexAttribP3uiv;
+	glad_glVertexAttribP4ui = glad_lazy_glVertexAttribP4ui;
+	glad_glVertexAttribP4uiv = glad_lazy_glVertexAttribP4uiv;
+	glad_glVertexAttribPointer = glad_lazy_glVertexAttribPointer;
+	glad_glVertexP2ui = glad_lazy_glVertexP2ui;
+	glad_glVertexP2uiv = glad_lazy_glVertexP2uiv;
+	glad_glVertexP3ui = glad_lazy_glVertexP3ui;
+	glad_glVertexP3uiv = glad_lazy_glVertexP3uiv;
+	glad_glVertexP4ui = glad_lazy_glVertexP4ui;
+	glad_glVertexP4uiv = glad_lazy_glVertexP4uiv;
+	glad_glVertexPointer = glad_lazy_glVertexPointer;
+	glad_glViewport = glad_lazy_glViewport;
+	glad_glWaitSync = glad_lazy_glWaitSync;
+	glad_glWindowPos2d = glad_lazy_glWindowPos2d;
+	glad_glWindowPos2dv = glad_lazy_glWindowPos2dv;
+	glad_glWindowPos2f = glad_lazy_glWindowPos2f;
+	glad_glWindowPos2fv = glad_lazy_glWindowPos2fv;
+	glad_glWindowPos2i = glad_lazy_glWindowPos2i;
+	glad_glWindowPos2iv = glad_lazy_glWindowPos2iv;
+	glad_glWindowPos2s = glad_lazy_glWindowPos2s;
+	glad_glWindowPos2sv = glad_lazy_glWindowPos2sv;
+	glad_glWindowPos3d = glad_lazy_glWindowPos3d;
+	glad_glWindowPos3dv = glad_lazy_glWindowPos3dv;
+	glad_glWindowPos3f = glad_lazy_glWindowPos3f;
+	glad_glWindowPos3fv = glad_lazy_glWindowPos3fv;
+	glad_glWindowPos3i = glad_lazy_glWindowPos3i;
+	glad_glWindowPos3iv = glad_lazy_glWindowPos3iv;
+	glad_glWindowPos3s = glad_lazy_glWindowPos3s;
+	glad_glWindowPos3sv = glad_lazy_glWindowPos3sv;
 }
+#define GLAD_LAZY_STUB(name) glad_lazy_##name
+#else
+#define GLAD_LAZY_STUB(name) NULL
+#endif
 int GLAD_GL_VERSION_1_0 = 0;
 int GLAD_GL_VERSION_1_1 = 0;
 int GLAD_GL_VERSION_1_2 = 0;
@@ -267,730 +1667,731 @@ int GLAD_GL_VERSION_3_0 = 0;
 int GLAD_GL_VERSION_3_1 = 0;
 int GLAD_GL_VERSION_3_2 = 0;
 int GLAD_GL_VERSION_3_3 = 0;
-PFNGLACCUMPROC glad_glAccum = NULL;
-PFNGLACTIVETEXTUREPROC glad_glActiveTexture = NULL;
-PFNGLALPHAFUNCPROC glad_glAlphaFunc = NULL;
-PFNGLARETEXTURESRESIDENTPROC glad_glAreTexturesResident = NULL;
-PFNGLARRAYELEMENTPROC glad_glArrayElement = NULL;
-PFNGLATTACHSHADERPROC glad_glAttachShader = NULL;
-PFNGLBEGINPROC glad_glBegin = NULL;
-PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender = NULL;
-PFNGLBEGINQUERYPROC glad_glBeginQuery = NULL;
-PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback = NULL;
-PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation = NULL;
-PFNGLBINDBUFFERPROC glad_glBindBuffer = NULL;
-PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase = NULL;
-PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange = NULL;
-PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation = NULL;
-PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed = NULL;
-PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer = NULL;
-PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer = NULL;
-PFNGLBINDSAMPLERPROC glad_glBindSampler = NULL;
-PFNGLBINDTEXTUREPROC glad_glBindTexture = NULL;
-PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray = NULL;
-PFNGLBITMAPPROC glad_glBitmap = NULL;
-PFNGLBLENDCOLORPROC glad_glBlendColor = NULL;
-PFNGLBLENDEQUATIONPROC glad_glBlendEquation = NULL;
-PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate = NULL;
-PFNGLBLENDFUNCPROC glad_glBlendFunc = NULL;
-PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate = NULL;
-PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer = NULL;
-PFNGLBUFFERDATAPROC glad_glBufferData = NULL;
-PFNGLBUFFERSUBDATAPROC glad_glBufferSubData = NULL;
-PFNGLCALLLISTPROC glad_glCallList = NULL;
-PFNGLCALLLISTSPROC glad_glCallLists = NULL;
-PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus = NULL;
-PFNGLCLAMPCOLORPROC glad_glClampColor = NULL;
-PFNGLCLEARPROC glad_glClear = NULL;
-PFNGLCLEARACCUMPROC glad_glClearAccum = NULL;
-PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi = NULL;
-PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv = NULL;
-PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv = NULL;
-PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv = NULL;
-PFNGLCLEARCOLORPROC glad_glClearColor = NULL;
-PFNGLCLEARDEPTHPROC glad_glClearDepth = NULL;
-PFNGLCLEARINDEXPROC glad_glClearIndex = NULL;
-PFNGLCLEARSTENCILPROC glad_glClearStencil = NULL;
-PFNGLCLIENTACTIVETEXTUREPROC glad_glClientActiveTexture = NULL;
-PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync = NULL;
-PFNGLCLIPPLANEPROC glad_glClipPlane = NULL;
-PFNGLCOLOR3BPROC glad_glColor3b = NULL;
-PFNGLCOLOR3BVPROC glad_glColor3bv = NULL;
-PFNGLCOLOR3DPROC glad_glColor3d = NULL;
-PFNGLCOLOR3DVPROC glad_glColor3dv = NULL;
-PFNGLCOLOR3FPROC glad_glColor3f = NULL;
-PFNGLCOLOR3FVPROC glad_glColor3fv = NULL;
-PFNGLCOLOR3IPROC glad_glColor3i = NULL;
-PFNGLCOLOR3IVPROC glad_glColor3iv = NULL;
-PFNGLCOLOR3SPROC glad_glColor3s = NULL;
-PFNGLCOLOR3SVPROC glad_glColor3sv = NULL;
-PFNGLCOLOR3UBPROC glad_glColor3ub = NULL;
-PFNGLCOLOR3UBVPROC glad_glColor3ubv = NULL;
-PFNGLCOLOR3UIPROC glad_glColor3ui = NULL;
-PFNGLCOLOR3UIVPROC glad_glColor3uiv = NULL;
-PFNGLCOLOR3USPROC glad_glColor3us = NULL;
-PFNGLCOLOR3USVPROC glad_glColor3usv = NULL;
-PFNGLCOLOR4BPROC glad_glColor4b = NULL;
-PFNGLCOLOR4BVPROC glad_glColor4bv = NULL;
-PFNGLCOLOR4DPROC glad_glColor4d = NULL;
-PFNGLCOLOR4DVPROC glad_glColor4dv = NULL;
-PFNGLCOLOR4FPROC glad_glColor4f = NULL;
-PFNGLCOLOR4FVPROC glad_glColor4fv = NULL;
-PFNGLCOLOR4IPROC glad_glColor4i = NULL;
-PFNGLCOLOR4IVPROC glad_glColor4iv = NULL;
-PFNGLCOLOR4SPROC glad_glColor4s = NULL;
-PFNGLCOLOR4SVPROC glad_glColor4sv = NULL;
-PFNGLCOLOR4UBPROC glad_glColor4ub = NULL;
-PFNGLCOLOR4UBVPROC glad_glColor4ubv = NULL;
-PFNGLCOLOR4UIPROC glad_glColor4ui = NULL;
-PFNGLCOLOR4UIVPROC glad_glColor4uiv = NULL;
-PFNGLCOLOR4USPROC glad_glColor4us = NULL;
-PFNGLCOLOR4USVPROC glad_glColor4usv = NULL;
-PFNGLCOLORMASKPROC glad_glColorMask = NULL;
-PFNGLCOLORMASKIPROC glad_glColorMaski = NULL;
-PFNGLCOLORMATERIALPROC glad_glColorMaterial = NULL;
-PFNGLCOLORP3UIPROC glad_glColorP3ui = NULL;
-PFNGLCOLORP3UIVPROC glad_glColorP3uiv = NULL;
-PFNGLCOLORP4UIPROC glad_glColorP4ui = NULL;
-PFNGLCOLORP4UIVPROC glad_glColorP4uiv = NULL;
-PFNGLCOLORPOINTERPROC glad_glColorPointer = NULL;
-PFNGLCOMPILESHADERPROC glad_glCompileShader = NULL;
-PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_glCompressedTexImage1D = NULL;
-PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_glCompressedTexImage2D = NULL;
-PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D = NULL;
-PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D = NULL;
-PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D = NULL;
-PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D = NULL;
-PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData = NULL;
-PFNGLCOPYPIXELSPROC glad_glCopyPixels = NULL;
-PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D = NULL;
-PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D = NULL;
-PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D = NULL;
-PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D = NULL;
-PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D = NULL;
-PFNGLCREATEPROGRAMPROC glad_glCreateProgram = NULL;
-PFNGLCREATESHADERPROC glad_glCreateShader = NULL;
-PFNGLCULLFACEPROC glad_glCullFace = NULL;
-PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers = NULL;
-PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers = NULL;
-PFNGLDELETELISTSPROC glad_glDeleteLists = NULL;
-PFNGLDELETEPROGRAMPROC glad_glDeleteProgram = NULL;
-PFNGLDELETEQUERIESPROC glad_glDeleteQueries = NULL;
-PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers = NULL;
-PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers = NULL;
-PFNGLDELETESHADERPROC glad_glDeleteShader = NULL;
-PFNGLDELETESYNCPROC glad_glDeleteSync = NULL;
-PFNGLDELETETEXTURESPROC glad_glDeleteTextures = NULL;
-PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays = NULL;
-PFNGLDEPTHFUNCPROC glad_glDepthFunc = NULL;
-PFNGLDEPTHMASKPROC glad_glDepthMask = NULL;
-PFNGLDEPTHRANGEPROC glad_glDepthRange = NULL;
-PFNGLDETACHSHADERPROC glad_glDetachShader = NULL;
-PFNGLDISABLEPROC glad_glDisable = NULL;
-PFNGLDISABLECLIENTSTATEPROC glad_glDisableClientState = NULL;
-PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray = NULL;
-PFNGLDISABLEIPROC glad_glDisablei = NULL;
-PFNGLDRAWARRAYSPROC glad_glDrawArrays = NULL;
-PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced = NULL;
-PFNGLDRAWBUFFERPROC glad_glDrawBuffer = NULL;
-PFNGLDRAWBUFFERSPROC glad_glDrawBuffers = NULL;
-PFNGLDRAWELEMENTSPROC glad_glDrawElements = NULL;
-PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex = NULL;
-PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced = NULL;
-PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex = NULL;
-PFNGLDRAWPIXELSPROC glad_glDrawPixels = NULL;
-PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements = NULL;
-PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex = NULL;
-PFNGLEDGEFLAGPROC glad_glEdgeFlag = NULL;
-PFNGLEDGEFLAGPOINTERPROC glad_glEdgeFlagPointer = NULL;
-PFNGLEDGEFLAGVPROC glad_glEdgeFlagv = NULL;
-PFNGLENABLEPROC glad_glEnable = NULL;
-PFNGLENABLECLIENTSTATEPROC glad_glEnableClientState = NULL;
-PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray = NULL;
-PFNGLENABLEIPROC glad_glEnablei = NULL;
-PFNGLENDPROC glad_glEnd = NULL;
-PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender = NULL;
-PFNGLENDLISTPROC glad_glEndList = NULL;
-PFNGLENDQUERYPROC glad_glEndQuery = NULL;
-PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback = NULL;
-PFNGLEVALCOORD1DPROC glad_glEvalCoord1d = NULL;
-PFNGLEVALCOORD1DVPROC glad_glEvalCoord1dv = NULL;
-PFNGLEVALCOORD1FPROC glad_glEvalCoord1f = NULL;
-PFNGLEVALCOORD1FVPROC glad_glEvalCoord1fv = NULL;
-PFNGLEVALCOORD2DPROC glad_glEvalCoord2d = NULL;
-PFNGLEVALCOORD2DVPROC glad_glEvalCoord2dv = NULL;
-PFNGLEVALCOORD2FPROC glad_glEvalCoord2f = NULL;
-PFNGLEVALCOORD2FVPROC glad_glEvalCoord2fv = NULL;
-PFNGLEVALMESH1PROC glad_glEvalMesh1 = NULL;
-PFNGLEVALMESH2PROC glad_glEvalMesh2 = NULL;
-PFNGLEVALPOINT1PROC glad_glEvalPoint1 = NULL;
-PFNGLEVALPOINT2PROC glad_glEvalPoint2 = NULL;
-PFNGLFEEDBACKBUFFERPROC glad_glFeedbackBuffer = NULL;
-PFNGLFENCESYNCPROC glad_glFenceSync = NULL;
-PFNGLFINISHPROC glad_glFinish = NULL;
-PFNGLFLUSHPROC glad_glFlush = NULL;
-PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange = NULL;
-PFNGLFOGCOORDPOINTERPROC glad_glFogCoordPointer = NULL;
-PFNGLFOGCOORDDPROC glad_glFogCoordd = NULL;
-PFNGLFOGCOORDDVPROC glad_glFogCoorddv = NULL;
-PFNGLFOGCOORDFPROC glad_glFogCoordf = NULL;
-PFNGLFOGCOORDFVPROC glad_glFogCoordfv = NULL;
-PFNGLFOGFPROC glad_glFogf = NULL;
-PFNGLFOGFVPROC glad_glFogfv = NULL;
-PFNGLFOGIPROC glad_glFogi = NULL;
-PFNGLFOGIVPROC glad_glFogiv = NULL;
-PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer = NULL;
-PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture = NULL;
-PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D = NULL;
-PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D = NULL;
-PFNGLFRAMEBUFFERTEXTURE3DPROC glad_glFramebufferTexture3D = NULL;
-PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer = NULL;
-PFNGLFRONTFACEPROC glad_glFrontFace = NULL;
-PFNGLFRUSTUMPROC glad_glFrustum = NULL;
-PFNGLGENBUFFERSPROC glad_glGenBuffers = NULL;
-PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers = NULL;
-PFNGLGENLISTSPROC glad_glGenLists = NULL;
-PFNGLGENQUERIESPROC glad_glGenQueries = NULL;
-PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers = NULL;
-PFNGLGENSAMPLERSPROC glad_glGenSamplers = NULL;
-PFNGLGENTEXTURESPROC glad_glGenTextures = NULL;
-PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays = NULL;
-PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap = NULL;
-PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib = NULL;
-PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform = NULL;
-PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName = NULL;
-PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv = NULL;
-PFNGLGETACTIVEUNIFORMNAMEPROC glad_glGetActiveUniformName = NULL;
-PFNGLGETACTIVEUNIFORMSIVPROC glad_glGetActiveUniformsiv = NULL;
-PFNGLGETATTACHEDSHADERSPROC glad_glGetAttachedShaders = NULL;
-PFNGLGETATTRIBLOCATIONPROC glad_glGetAttribLocation = NULL;
-PFNGLGETBOOLEANI_VPROC glad_glGetBooleani_v = NULL;
-PFNGLGETBOOLEANVPROC glad_glGetBooleanv = NULL;
-PFNGLGETBUFFERPARAMETERI64VPROC glad_glGetBufferParameteri64v = NULL;
-PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv = NULL;
-PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv = NULL;
-PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData = NULL;
-PFNGLGETCLIPPLANEPROC glad_glGetClipPlane = NULL;
-PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage = NULL;
-PFNGLGETDOUBLEVPROC glad_glGetDoublev = NULL;
-PFNGLGETERRORPROC glad_glGetError = NULL;
-PFNGLGETFLOATVPROC glad_glGetFloatv = NULL;
-PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex = NULL;
-PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation = NULL;
-PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv = NULL;
-PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v = NULL;
-PFNGLGETINTEGER64VPROC glad_glGetInteger64v = NULL;
-PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v = NULL;
-PFNGLGETINTEGERVPROC glad_glGetIntegerv = NULL;
-PFNGLGETLIGHTFVPROC glad_glGetLightfv = NULL;
-PFNGLGETLIGHTIVPROC glad_glGetLightiv = NULL;
-PFNGLGETMAPDVPROC glad_glGetMapdv = NULL;
-PFNGLGETMAPFVPROC glad_glGetMapfv = NULL;
-PFNGLGETMAPIVPROC glad_glGetMapiv = NULL;
-PFNGLGETMATERIALFVPROC glad_glGetMaterialfv = NULL;
-PFNGLGETMATERIALIVPROC glad_glGetMaterialiv = NULL;
-PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv = NULL;
-PFNGLGETPIXELMAPFVPROC glad_glGetPixelMapfv = NULL;
-PFNGLGETPIXELMAPUIVPROC glad_glGetPixelMapuiv = NULL;
-PFNGLGETPIXELMAPUSVPROC glad_glGetPixelMapusv = NULL;
-PFNGLGETPOINTERVPROC glad_glGetPointerv = NULL;
-PFNGLGETPOLYGONSTIPPLEPROC glad_glGetPolygonStipple = NULL;
-PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog = NULL;
-PFNGLGETPROGRAMIVPROC glad_glGetProgramiv = NULL;
-PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v = NULL;
-PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv = NULL;
-PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v = NULL;
-PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv = NULL;
-PFNGLGETQUERYIVPROC glad_glGetQueryiv = NULL;
-PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_glGetRenderbufferParameteriv = NULL;
-PFNGLGETSAMPLERPARAMETERIIVPROC glad_glGetSamplerParameterIiv = NULL;
-PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv = NULL;
-PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv = NULL;
-PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv = NULL;
-PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog = NULL;
-PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource = NULL;
-PFNGLGETSHADERIVPROC glad_glGetShaderiv = NULL;
-PFNGLGETSTRINGPROC glad_glGetString = NULL;
-PFNGLGETSTRINGIPROC glad_glGetStringi = NULL;
-PFNGLGETSYNCIVPROC glad_glGetSynciv = NULL;
-PFNGLGETTEXENVFVPROC glad_glGetTexEnvfv = NULL;
-PFNGLGETTEXENVIVPROC glad_glGetTexEnviv = NULL;
-PFNGLGETTEXGENDVPROC glad_glGetTexGendv = NULL;
-PFNGLGETTEXGENFVPROC glad_glGetTexGenfv = NULL;
-PFNGLGETTEXGENIVPROC glad_glGetTexGeniv = NULL;
-PFNGLGETTEXIMAGEPROC glad_glGetTexImage = NULL;
-PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv = NULL;
-PFNGLGETTEXLEVELPARAMETERIVPROC glad_glGetTexLevelParameteriv = NULL;
-PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv = NULL;
-PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv = NULL;
-PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv = NULL;
-PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv = NULL;
-PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying = NULL;
-PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex = NULL;
-PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices = NULL;
-PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation = NULL;
-PFNGLGETUNIFORMFVPROC glad_glGetUniformfv = NULL;
-PFNGLGETUNIFORMIVPROC glad_glGetUniformiv = NULL;
-PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv = NULL;
-PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv = NULL;
-PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv = NULL;
-PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv = NULL;
-PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv = NULL;
-PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv = NULL;
-PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv = NULL;
-PFNGLHINTPROC glad_glHint = NULL;
-PFNGLINDEXMASKPROC glad_glIndexMask = NULL;
-PFNGLINDEXPOINTERPROC glad_glIndexPointer = NULL;
-PFNGLINDEXDPROC glad_glIndexd = NULL;
-PFNGLINDEXDVPROC glad_glIndexdv = NULL;
-PFNGLINDEXFPROC glad_glIndexf = NULL;
-PFNGLINDEXFVPROC glad_glIndexfv = NULL;
-PFNGLINDEXIPROC glad_glIndexi = NULL;
-PFNGLINDEXIVPROC glad_glIndexiv = NULL;
-PFNGLINDEXSPROC glad_glIndexs = NULL;
-PFNGLINDEXSVPROC glad_glIndexsv = NULL;
-PFNGLINDEXUBPROC glad_glIndexub = NULL;
-PFNGLINDEXUBVPROC glad_glIndexubv = NULL;
-PFNGLINITNAMESPROC glad_glInitNames = NULL;
-PFNGLINTERLEAVEDARRAYSPROC glad_glInterleavedArrays = NULL;
-PFNGLISBUFFERPROC glad_glIsBuffer = NULL;
-PFNGLISENABLEDPROC glad_glIsEnabled = NULL;
-PFNGLISENABLEDIPROC glad_glIsEnabledi = NULL;
-PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer = NULL;
-PFNGLISLISTPROC glad_glIsList = NULL;
-PFNGLISPROGRAMPROC glad_glIsProgram = NULL;
-PFNGLISQUERYPROC glad_glIsQuery = NULL;
-PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer = NULL;
-PFNGLISSAMPLERPROC glad_glIsSampler = NULL;
-PFNGLISSHADERPROC glad_glIsShader = NULL;
-PFNGLISSYNCPROC glad_glIsSync = NULL;
-PFNGLISTEXTUREPROC glad_glIsTexture = NULL;
-PFNGLISVERTEXARRAYPROC glad_glIsVertexArray = NULL;
-PFNGLLIGHTMODELFPROC glad_glLightModelf = NULL;
-PFNGLLIGHTMODELFVPROC glad_glLightModelfv = NULL;
-PFNGLLIGHTMODELIPROC glad_glLightModeli = NULL;
-PFNGLLIGHTMODELIVPROC glad_glLightModeliv = NULL;
-PFNGLLIGHTFPROC glad_glLightf = NULL;
-PFNGLLIGHTFVPROC glad_glLightfv = NULL;
-PFNGLLIGHTIPROC glad_glLighti = NULL;
-PFNGLLIGHTIVPROC glad_glLightiv = NULL;
-PFNGLLINESTIPPLEPROC glad_glLineStipple = NULL;
-PFNGLLINEWIDTHPROC glad_glLineWidth = NULL;
-PFNGLLINKPROGRAMPROC glad_glLinkProgram = NULL;
-PFNGLLISTBASEPROC glad_glListBase = NULL;
-PFNGLLOADIDENTITYPROC glad_glLoadIdentity = NULL;
-PFNGLLOADMATRIXDPROC glad_glLoadMatrixd = NULL;
-PFNGLLOADMATRIXFPROC glad_glLoadMatrixf = NULL;
-PFNGLLOADNAMEPROC glad_glLoadName = NULL;
-PFNGLLOADTRANSPOSEMATRIXDPROC glad_glLoadTransposeMatrixd = NULL;
-PFNGLLOADTRANSPOSEMATRIXFPROC glad_glLoadTransposeMatrixf = NULL;
-PFNGLLOGICOPPROC glad_glLogicOp = NULL;
-PFNGLMAP1DPROC glad_glMap1d = NULL;
-PFNGLMAP1FPROC glad_glMap1f = NULL;
-PFNGLMAP2DPROC glad_glMap2d = NULL;
-PFNGLMAP2FPROC glad_glMap2f = NULL;
-PFNGLMAPBUFFERPROC glad_glMapBuffer = NULL;
-PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange = NULL;
-PFNGLMAPGRID1DPROC glad_glMapGrid1d = NULL;
-PFNGLMAPGRID1FPROC glad_glMapGrid1f = NULL;
-PFNGLMAPGRID2DPROC glad_glMapGrid2d = NULL;
-PFNGLMAPGRID2FPROC glad_glMapGrid2f = NULL;
-PFNGLMATERIALFPROC glad_glMaterialf = NULL;
-PFNGLMATERIALFVPROC glad_glMaterialfv = NULL;
-PFNGLMATERIALIPROC glad_glMateriali = NULL;
-PFNGLMATERIALIVPROC glad_glMaterialiv = NULL;
-PFNGLMATRIXMODEPROC glad_glMatrixMode = NULL;
-PFNGLMULTMATRIXDPROC glad_glMultMatrixd = NULL;
-PFNGLMULTMATRIXFPROC glad_glMultMatrixf = NULL;
-PFNGLMULTTRANSPOSEMATRIXDPROC glad_glMultTransposeMatrixd = NULL;
-PFNGLMULTTRANSPOSEMATRIXFPROC glad_glMultTransposeMatrixf = NULL;
-PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays = NULL;
-PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements = NULL;
-PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex = NULL;
-PFNGLMULTITEXCOORD1DPROC glad_glMultiTexCoord1d = NULL;
-PFNGLMULTITEXCOORD1DVPROC glad_glMultiTexCoord1dv = NULL;
-PFNGLMULTITEXCOORD1FPROC glad_glMultiTexCoord1f = NULL;
-PFNGLMULTITEXCOORD1FVPROC glad_glMultiTexCoord1fv = NULL;
-PFNGLMULTITEXCOORD1IPROC glad_glMultiTexCoord1i = NULL;
-PFNGLMULTITEXCOORD1IVPROC glad_glMultiTexCoord1iv = NULL;
-PFNGLMULTITEXCOORD1SPROC glad_glMultiTexCoord1s = NULL;
-PFNGLMULTITEXCOORD1SVPROC glad_glMultiTexCoord1sv = NULL;
-PFNGLMULTITEXCOORD2DPROC glad_glMultiTexCoord2d = NULL;
-PFNGLMULTITEXCOORD2DVPROC glad_glMultiTexCoord2dv = NULL;
-PFNGLMULTITEXCOORD2FPROC glad_glMultiTexCoord2f = NULL;
-PFNGLMULTITEXCOORD2FVPROC glad_glMultiTexCoord2fv = NULL;
-PFNGLMULTITEXCOORD2IPROC glad_glMultiTexCoord2i = NULL;
-PFNGLMULTITEXCOORD2IVPROC glad_glMultiTexCoord2iv = NULL;
-PFNGLMULTITEXCOORD2SPROC glad_glMultiTexCoord2s = NULL;
-PFNGLMULTITEXCOORD2SVPROC glad_glMultiTexCoord2sv = NULL;
-PFNGLMULTITEXCOORD3DPROC glad_glMultiTexCoord3d = NULL;
-PFNGLMULTITEXCOORD3DVPROC glad_glMultiTexCoord3dv = NULL;
-PFNGLMULTITEXCOORD3FPROC glad_glMultiTexCoord3f = NULL;
-PFNGLMULTITEXCOORD3FVPROC glad_glMultiTexCoord3fv = NULL;
-PFNGLMULTITEXCOORD3IPROC glad_glMultiTexCoord3i = NULL;
-PFNGLMULTITEXCOORD3IVPROC glad_glMultiTexCoord3iv = NULL;
-PFNGLMULTITEXCOORD3SPROC glad_glMultiTexCoord3s = NULL;
-PFNGLMULTITEXCOORD3SVPROC glad_glMultiTexCoord3sv = NULL;
-PFNGLMULTITEXCOORD4DPROC glad_glMultiTexCoord4d = NULL;
-PFNGLMULTITEXCOORD4DVPROC glad_glMultiTexCoord4dv = NULL;
-PFNGLMULTITEXCOORD4FPROC glad_glMultiTexCoord4f = NULL;
-PFNGLMULTITEXCOORD4FVPROC glad_glMultiTexCoord4fv = NULL;
-PFNGLMULTITEXCOORD4IPROC glad_glMultiTexCoord4i = NULL;
-PFNGLMULTITEXCOORD4IVPROC glad_glMultiTexCoord4iv = NULL;
-PFNGLMULTITEXCOORD4SPROC glad_glMultiTexCoord4s = NULL;
-PFNGLMULTITEXCOORD4SVPROC glad_glMultiTexCoord4sv = NULL;
-PFNGLMULTITEXCOORDP1UIPROC glad_glMultiTexCoordP1ui = NULL;
-PFNGLMULTITEXCOORDP1UIVPROC glad_glMultiTexCoordP1uiv = NULL;
-PFNGLMULTITEXCOORDP2UIPROC glad_glMultiTexCoordP2ui = NULL;
-PFNGLMULTITEXCOORDP2UIVPROC glad_glMultiTexCoordP2uiv = NULL;
-PFNGLMULTITEXCOORDP3UIPROC glad_glMultiTexCoordP3ui = NULL;
-PFNGLMULTITEXCOORDP3UIVPROC glad_glMultiTexCoordP3uiv = NULL;
-PFNGLMULTITEXCOORDP4UIPROC glad_glMultiTexCoordP4ui = NULL;
-PFNGLMULTITEXCOORDP4UIVPROC glad_glMultiTexCoordP4uiv = NULL;
-PFNGLNEWLISTPROC glad_glNewList = NULL;
-PFNGLNORMAL3BPROC glad_glNormal3b = NULL;
-PFNGLNORMAL3BVPROC glad_glNormal3bv = NULL;
-PFNGLNORMAL3DPROC glad_glNormal3d = NULL;
-PFNGLNORMAL3DVPROC glad_glNormal3dv = NULL;
-PFNGLNORMAL3FPROC glad_glNormal3f = NULL;
-PFNGLNORMAL3FVPROC glad_glNormal3fv = NULL;
-PFNGLNORMAL3IPROC glad_glNormal3i = NULL;
-PFNGLNORMAL3IVPROC glad_glNormal3iv = NULL;
-PFNGLNORMAL3SPROC glad_glNormal3s = NULL;
-PFNGLNORMAL3SVPROC glad_glNormal3sv = NULL;
-PFNGLNORMALP3UIPROC glad_glNormalP3ui = NULL;
-PFNGLNORMALP3UIVPROC glad_glNormalP3uiv = NULL;
-PFNGLNORMALPOINTERPROC glad_glNormalPointer = NULL;
-PFNGLORTHOPROC glad_glOrtho = NULL;
-PFNGLPASSTHROUGHPROC glad_glPassThrough = NULL;
-PFNGLPIXELMAPFVPROC glad_glPixelMapfv = NULL;
-PFNGLPIXELMAPUIVPROC glad_glPixelMapuiv = NULL;
-PFNGLPIXELMAPUSVPROC glad_glPixelMapusv = NULL;
-PFNGLPIXELSTOREFPROC glad_glPixelStoref = NULL;
-PFNGLPIXELSTOREIPROC glad_glPixelStorei = NULL;
-PFNGLPIXELTRANSFERFPROC glad_glPixelTransferf = NULL;
-PFNGLPIXELTRANSFERIPROC glad_glPixelTransferi = NULL;
-PFNGLPIXELZOOMPROC glad_glPixelZoom = NULL;
-PFNGLPOINTPARAMETERFPROC glad_glPointParameterf = NULL;
-PFNGLPOINTPARAMETERFVPROC glad_glPointParameterfv = NULL;
-PFNGLPOINTPARAMETERIPROC glad_glPointParameteri = NULL;
-PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv = NULL;
-PFNGLPOINTSIZEPROC glad_glPointSize = NULL;
-PFNGLPOLYGONMODEPROC glad_glPolygonMode = NULL;
-PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset = NULL;
-PFNGLPOLYGONSTIPPLEPROC glad_glPolygonStipple = NULL;
-PFNGLPOPATTRIBPROC glad_glPopAttrib = NULL;
-PFNGLPOPCLIENTATTRIBPROC glad_glPopClientAttrib = NULL;
-PFNGLPOPMATRIXPROC glad_glPopMatrix = NULL;
-PFNGLPOPNAMEPROC glad_glPopName = NULL;
-PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex = NULL;
-PFNGLPRIORITIZETEXTURESPROC glad_glPrioritizeTextures = NULL;
-PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex = NULL;
-PFNGLPUSHATTRIBPROC glad_glPushAttrib = NULL;
-PFNGLPUSHCLIENTATTRIBPROC glad_glPushClientAttrib = NULL;
-PFNGLPUSHMATRIXPROC glad_glPushMatrix = NULL;
-PFNGLPUSHNAMEPROC glad_glPushName = NULL;
-PFNGLQUERYCOUNTERPROC glad_glQueryCounter = NULL;
-PFNGLRASTERPOS2DPROC glad_glRasterPos2d = NULL;
-PFNGLRASTERPOS2DVPROC glad_glRasterPos2dv = NULL;
-PFNGLRASTERPOS2FPROC glad_glRasterPos2f = NULL;
-PFNGLRASTERPOS2FVPROC glad_glRasterPos2fv = NULL;
-PFNGLRASTERPOS2IPROC glad_glRasterPos2i = NULL;
-PFNGLRASTERPOS2IVPROC glad_glRasterPos2iv = NULL;
-PFNGLRASTERPOS2SPROC glad_glRasterPos2s = NULL;
-PFNGLRASTERPOS2SVPROC glad_glRasterPos2sv = NULL;
-PFNGLRASTERPOS3DPROC glad_glRasterPos3d = NULL;
-PFNGLRASTERPOS3DVPROC glad_glRasterPos3dv = NULL;
-PFNGLRASTERPOS3FPROC glad_glRasterPos3f = NULL;
-PFNGLRASTERPOS3FVPROC glad_glRasterPos3fv = NULL;
-PFNGLRASTERPOS3IPROC glad_glRasterPos3i = NULL;
-PFNGLRASTERPOS3IVPROC glad_glRasterPos3iv = NULL;
-PFNGLRASTERPOS3SPROC glad_glRasterPos3s = NULL;
-PFNGLRASTERPOS3SVPROC glad_glRasterPos3sv = NULL;
-PFNGLRASTERPOS4DPROC glad_glRasterPos4d = NULL;
-PFNGLRASTERPOS4DVPROC glad_glRasterPos4dv = NULL;
-PFNGLRASTERPOS4FPROC glad_glRasterPos4f = NULL;
-PFNGLRASTERPOS4FVPROC glad_glRasterPos4fv = NULL;
-PFNGLRASTERPOS4IPROC glad_glRasterPos4i = NULL;
-PFNGLRASTERPOS4IVPROC glad_glRasterPos4iv = NULL;
-PFNGLRASTERPOS4SPROC glad_glRasterPos4s = NULL;
-PFNGLRASTERPOS4SVPROC glad_glRasterPos4sv = NULL;
-PFNGLREADBUFFERPROC glad_glReadBuffer = NULL;
-PFNGLREADPIXELSPROC glad_glReadPixels = NULL;
-PFNGLRECTDPROC glad_glRectd = NULL;
-PFNGLRECTDVPROC glad_glRectdv = NULL;
-PFNGLRECTFPROC glad_glRectf = NULL;
-PFNGLRECTFVPROC glad_glRectfv = NULL;
-PFNGLRECTIPROC glad_glRecti = NULL;
-PFNGLRECTIVPROC glad_glRectiv = NULL;
-PFNGLRECTSPROC glad_glRects = NULL;
-PFNGLRECTSVPROC glad_glRectsv = NULL;
-PFNGLRENDERMODEPROC glad_glRenderMode = NULL;
-PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage = NULL;
-PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample = NULL;
-PFNGLROTATEDPROC glad_glRotated = NULL;
-PFNGLROTATEFPROC glad_glRotatef = NULL;
-PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage = NULL;
-PFNGLSAMPLEMASKIPROC glad_glSampleMaski = NULL;
-PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv = NULL;
-PFNGLSAMPLERPARAMETERIUIVPROC glad_glSamplerParameterIuiv = NULL;
-PFNGLSAMPLERPARAMETERFPROC glad_glSamplerParameterf = NULL;
-PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv = NULL;
-PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri = NULL;
-PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv = NULL;
-PFNGLSCALEDPROC glad_glScaled = NULL;
-PFNGLSCALEFPROC glad_glScalef = NULL;
-PFNGLSCISSORPROC glad_glScissor = NULL;
-PFNGLSECONDARYCOLOR3BPROC glad_glSecondaryColor3b = NULL;
-PFNGLSECONDARYCOLOR3BVPROC glad_glSecondaryColor3bv = NULL;
-PFNGLSECONDARYCOLOR3DPROC glad_glSecondaryColor3d = NULL;
-PFNGLSECONDARYCOLOR3DVPROC glad_glSecondaryColor3dv = NULL;
-PFNGLSECONDARYCOLOR3FPROC glad_glSecondaryColor3f = NULL;
-PFNGLSECONDARYCOLOR3FVPROC glad_glSecondaryColor3fv = NULL;
-PFNGLSECONDARYCOLOR3IPROC glad_glSecondaryColor3i = NULL;
-PFNGLSECONDARYCOLOR3IVPROC glad_glSecondaryColor3iv = NULL;
-PFNGLSECONDARYCOLOR3SPROC glad_glSecondaryColor3s = NULL;
-PFNGLSECONDARYCOLOR3SVPROC glad_glSecondaryColor3sv = NULL;
-PFNGLSECONDARYCOLOR3UBPROC glad_glSecondaryColor3ub = NULL;
-PFNGLSECONDARYCOLOR3UBVPROC glad_glSecondaryColor3ubv = NULL;
-PFNGLSECONDARYCOLOR3UIPROC glad_glSecondaryColor3ui = NULL;
-PFNGLSECONDARYCOLOR3UIVPROC glad_glSecondaryColor3uiv = NULL;
-PFNGLSECONDARYCOLOR3USPROC glad_glSecondaryColor3us = NULL;
-PFNGLSECONDARYCOLOR3USVPROC glad_glSecondaryColor3usv = NULL;
-PFNGLSECONDARYCOLORP3UIPROC glad_glSecondaryColorP3ui = NULL;
-PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv = NULL;
-PFNGLSECONDARYCOLORPOINTERPROC glad_glSecondaryColorPointer = NULL;
-PFNGLSELECTBUFFERPROC glad_glSelectBuffer = NULL;
-PFNGLSHADEMODELPROC glad_glShadeModel = NULL;
-PFNGLSHADERSOURCEPROC glad_glShaderSource = NULL;
-PFNGLSTENCILFUNCPROC glad_glStencilFunc = NULL;
-PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate = NULL;
-PFNGLSTENCILMASKPROC glad_glStencilMask = NULL;
-PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate = NULL;
-PFNGLSTENCILOPPROC glad_glStencilOp = NULL;
-PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate = NULL;
-PFNGLTEXBUFFERPROC glad_glTexBuffer = NULL;
-PFNGLTEXCOORD1DPROC glad_glTexCoord1d = NULL;
-PFNGLTEXCOORD1DVPROC glad_glTexCoord1dv = NULL;
-PFNGLTEXCOORD1FPROC glad_glTexCoord1f = NULL;
-PFNGLTEXCOORD1FVPROC glad_glTexCoord1fv = NULL;
-PFNGLTEXCOORD1IPROC glad_glTexCoord1i = NULL;
-PFNGLTEXCOORD1IVPROC glad_glTexCoord1iv = NULL;
-PFNGLTEXCOORD1SPROC glad_glTexCoord1s = NULL;
-PFNGLTEXCOORD1SVPROC glad_glTexCoord1sv = NULL;
-PFNGLTEXCOORD2DPROC glad_glTexCoord2d = NULL;
-PFNGLTEXCOORD2DVPROC glad_glTexCoord2dv = NULL;
-PFNGLTEXCOORD2FPROC glad_glTexCoord2f = NULL;
-PFNGLTEXCOORD2FVPROC glad_glTexCoord2fv = NULL;
-PFNGLTEXCOORD2IPROC glad_glTexCoord2i = NULL;
-PFNGLTEXCOORD2IVPROC glad_glTexCoord2iv = NULL;
-PFNGLTEXCOORD2SPROC glad_glTexCoord2s = NULL;
-PFNGLTEXCOORD2SVPROC glad_glTexCoord2sv = NULL;
-PFNGLTEXCOORD3DPROC glad_glTexCoord3d = NULL;
-PFNGLTEXCOORD3DVPROC glad_glTexCoord3dv = NULL;
-PFNGLTEXCOORD3FPROC glad_glTexCoord3f = NULL;
-PFNGLTEXCOORD3FVPROC glad_glTexCoord3fv = NULL;
-PFNGLTEXCOORD3IPROC glad_glTexCoord3i = NULL;
-PFNGLTEXCOORD3IVPROC glad_glTexCoord3iv = NULL;
-PFNGLTEXCOORD3SPROC glad_glTexCoord3s = NULL;
-PFNGLTEXCOORD3SVPROC glad_glTexCoord3sv = NULL;
-PFNGLTEXCOORD4DPROC glad_glTexCoord4d = NULL;
-PFNGLTEXCOORD4DVPROC glad_glTexCoord4dv = NULL;
-PFNGLTEXCOORD4FPROC glad_glTexCoord4f = NULL;
-PFNGLTEXCOORD4FVPROC glad_glTexCoord4fv = NULL;
-PFNGLTEXCOORD4IPROC glad_glTexCoord4i = NULL;
-PFNGLTEXCOORD4IVPROC glad_glTexCoord4iv = NULL;
-PFNGLTEXCOORD4SPROC glad_glTexCoord4s = NULL;
-PFNGLTEXCOORD4SVPROC glad_glTexCoord4sv = NULL;
-PFNGLTEXCOORDP1UIPROC glad_glTexCoordP1ui = NULL;
-PFNGLTEXCOORDP1UIVPROC glad_glTexCoordP1uiv = NULL;
-PFNGLTEXCOORDP2UIPROC glad_glTexCoordP2ui = NULL;
-PFNGLTEXCOORDP2UIVPROC glad_glTexCoordP2uiv = NULL;
-PFNGLTEXCOORDP3UIPROC glad_glTexCoordP3ui = NULL;
-PFNGLTEXCOORDP3UIVPROC glad_glTexCoordP3uiv = NULL;
-PFNGLTEXCOORDP4UIPROC glad_glTexCoordP4ui = NULL;
-PFNGLTEXCOORDP4UIVPROC glad_glTexCoordP4uiv = NULL;
-PFNGLTEXCOORDPOINTERPROC glad_glTexCoordPointer = NULL;
-PFNGLTEXENVFPROC glad_glTexEnvf = NULL;
-PFNGLTEXENVFVPROC glad_glTexEnvfv = NULL;
-PFNGLTEXENVIPROC glad_glTexEnvi = NULL;
-PFNGLTEXENVIVPROC glad_glTexEnviv = NULL;
-PFNGLTEXGENDPROC glad_glTexGend = NULL;
-PFNGLTEXGENDVPROC glad_glTexGendv = NULL;
-PFNGLTEXGENFPROC glad_glTexGenf = NULL;
-PFNGLTEXGENFVPROC glad_glTexGenfv = NULL;
-PFNGLTEXGENIPROC glad_glTexGeni = NULL;
-PFNGLTEXGENIVPROC glad_glTexGeniv = NULL;
-PFNGLTEXIMAGE1DPROC glad_glTexImage1D = NULL;
-PFNGLTEXIMAGE2DPROC glad_glTexImage2D = NULL;
-PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_glTexImage2DMultisample = NULL;
-PFNGLTEXIMAGE3DPROC glad_glTexImage3D = NULL;
-PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_glTexImage3DMultisample = NULL;
-PFNGLTEXPARAMETERIIVPROC glad_glTexParameterIiv = NULL;
-PFNGLTEXPARAMETERIUIVPROC glad_glTexParameterIuiv = NULL;
-PFNGLTEXPARAMETERFPROC glad_glTexParameterf = NULL;
-PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv = NULL;
-PFNGLTEXPARAMETERIPROC glad_glTexParameteri = NULL;
-PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv = NULL;
-PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D = NULL;
-PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D = NULL;
-PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D = NULL;
-PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings = NULL;
-PFNGLTRANSLATEDPROC glad_glTranslated = NULL;
-PFNGLTRANSLATEFPROC glad_glTranslatef = NULL;
-PFNGLUNIFORM1FPROC glad_glUniform1f = NULL;
-PFNGLUNIFORM1FVPROC glad_glUniform1fv = NULL;
-PFNGLUNIFORM1IPROC glad_glUniform1i = NULL;
-PFNGLUNIFORM1IVPROC glad_glUniform1iv = NULL;
-PFNGLUNIFORM1UIPROC glad_glUniform1ui = NULL;
-PFNGLUNIFORM1UIVPROC glad_glUniform1uiv = NULL;
-PFNGLUNIFORM2FPROC glad_glUniform2f = NULL;
-PFNGLUNIFORM2FVPROC glad_glUniform2fv = NULL;
-PFNGLUNIFORM2IPROC glad_glUniform2i = NULL;
-PFNGLUNIFORM2IVPROC glad_glUniform2iv = NULL;
-PFNGLUNIFORM2UIPROC glad_glUniform2ui = NULL;
-PFNGLUNIFORM2UIVPROC glad_glUniform2uiv = NULL;
-PFNGLUNIFORM3FPROC glad_glUniform3f = NULL;
-PFNGLUNIFORM3FVPROC glad_glUniform3fv = NULL;
-PFNGLUNIFORM3IPROC glad_glUniform3i = NULL;
-PFNGLUNIFORM3IVPROC glad_glUniform3iv = NULL;
-PFNGLUNIFORM3UIPROC glad_glUniform3ui = NULL;
-PFNGLUNIFORM3UIVPROC glad_glUniform3uiv = NULL;
-PFNGLUNIFORM4FPROC glad_glUniform4f = NULL;
-PFNGLUNIFORM4FVPROC glad_glUniform4fv = NULL;
-PFNGLUNIFORM4IPROC glad_glUniform4i = NULL;
-PFNGLUNIFORM4IVPROC glad_glUniform4iv = NULL;
-PFNGLUNIFORM4UIPROC glad_glUniform4ui = NULL;
-PFNGLUNIFORM4UIVPROC glad_glUniform4uiv = NULL;
-PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding = NULL;
-PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv = NULL;
-PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv = NULL;
-PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv = NULL;
-PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv = NULL;
-PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv = NULL;
-PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv = NULL;
-PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv = NULL;
-PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv = NULL;
-PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv = NULL;
-PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer = NULL;
-PFNGLUSEPROGRAMPROC glad_glUseProgram = NULL;
-PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram = NULL;
-PFNGLVERTEX2DPROC glad_glVertex2d = NULL;
-PFNGLVERTEX2DVPROC glad_glVertex2dv = NULL;
-PFNGLVERTEX2FPROC glad_glVertex2f = NULL;
-PFNGLVERTEX2FVPROC glad_glVertex2fv = NULL;
-PFNGLVERTEX2IPROC glad_glVertex2i = NULL;
-PFNGLVERTEX2IVPROC glad_glVertex2iv = NULL;
-PFNGLVERTEX2SPROC glad_glVertex2s = NULL;
-PFNGLVERTEX2SVPROC glad_glVertex2sv = NULL;
-PFNGLVERTEX3DPROC glad_glVertex3d = NULL;
-PFNGLVERTEX3DVPROC glad_glVertex3dv = NULL;
-PFNGLVERTEX3FPROC glad_glVertex3f = NULL;
-PFNGLVERTEX3FVPROC glad_glVertex3fv = NULL;
-PFNGLVERTEX3IPROC glad_glVertex3i = NULL;
-PFNGLVERTEX3IVPROC glad_glVertex3iv = NULL;
-PFNGLVERTEX3SPROC glad_glVertex3s = NULL;
-PFNGLVERTEX3SVPROC glad_glVertex3sv = NULL;
-PFNGLVERTEX4DPROC glad_glVertex4d = NULL;
-PFNGLVERTEX4DVPROC glad_glVertex4dv = NULL;
-PFNGLVERTEX4FPROC glad_glVertex4f = NULL;
-PFNGLVERTEX4FVPROC glad_glVertex4fv = NULL;
-PFNGLVERTEX4IPROC glad_glVertex4i = NULL;
-PFNGLVERTEX4IVPROC glad_glVertex4iv = NULL;
-PFNGLVERTEX4SPROC glad_glVertex4s = NULL;
-PFNGLVERTEX4SVPROC glad_glVertex4sv = NULL;
-PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d = NULL;
-PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv = NULL;
-PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f = NULL;
-PFNGLVERTEXATTRIB1FVPROC glad_glVertexAttrib1fv = NULL;
-PFNGLVERTEXATTRIB1SPROC glad_glVertexAttrib1s = NULL;
-PFNGLVERTEXATTRIB1SVPROC glad_glVertexAttrib1sv = NULL;
-PFNGLVERTEXATTRIB2DPROC glad_glVertexAttrib2d = NULL;
-PFNGLVERTEXATTRIB2DVPROC glad_glVertexAttrib2dv = NULL;
-PFNGLVERTEXATTRIB2FPROC glad_glVertexAttrib2f = NULL;
-PFNGLVERTEXATTRIB2FVPROC glad_glVertexAttrib2fv = NULL;
-PFNGLVERTEXATTRIB2SPROC glad_glVertexAttrib2s = NULL;
-PFNGLVERTEXATTRIB2SVPROC glad_glVertexAttrib2sv = NULL;
-PFNGLVERTEXATTRIB3DPROC glad_glVertexAttrib3d = NULL;
-PFNGLVERTEXATTRIB3DVPROC glad_glVertexAttrib3dv = NULL;
-PFNGLVERTEXATTRIB3FPROC glad_glVertexAttrib3f = NULL;
-PFNGLVERTEXATTRIB3FVPROC glad_glVertexAttrib3fv = NULL;
-PFNGLVERTEXATTRIB3SPROC glad_glVertexAttrib3s = NULL;
-PFNGLVERTEXATTRIB3SVPROC glad_glVertexAttrib3sv = NULL;
-PFNGLVERTEXATTRIB4NBVPROC glad_glVertexAttrib4Nbv = NULL;
-PFNGLVERTEXATTRIB4NIVPROC glad_glVertexAttrib4Niv = NULL;
-PFNGLVERTEXATTRIB4NSVPROC glad_glVertexAttrib4Nsv = NULL;
-PFNGLVERTEXATTRIB4NUBPROC glad_glVertexAttrib4Nub = NULL;
-PFNGLVERTEXATTRIB4NUBVPROC glad_glVertexAttrib4Nubv = NULL;
-PFNGLVERTEXATTRIB4NUIVPROC glad_glVertexAttrib4Nuiv = NULL;
-PFNGLVERTEXATTRIB4NUSVPROC glad_glVertexAttrib4Nusv = NULL;
-PFNGLVERTEXATTRIB4BVPROC glad_glVertexAttrib4bv = NULL;
-PFNGLVERTEXATTRIB4DPROC glad_glVertexAttrib4d = NULL;
-PFNGLVERTEXATTRIB4DVPROC glad_glVertexAttrib4dv = NULL;
-PFNGLVERTEXATTRIB4FPROC glad_glVertexAttrib4f = NULL;
-PFNGLVERTEXATTRIB4FVPROC glad_glVertexAttrib4fv = NULL;
-PFNGLVERTEXATTRIB4IVPROC glad_glVertexAttrib4iv = NULL;
-PFNGLVERTEXATTRIB4SPROC glad_glVertexAttrib4s = NULL;
-PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv = NULL;
-PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv = NULL;
-PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv = NULL;
-PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv = NULL;
-PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor = NULL;
-PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i = NULL;
-PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv = NULL;
-PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui = NULL;
-PFNGLVERTEXATTRIBI1UIVPROC glad_glVertexAttribI1uiv = NULL;
-PFNGLVERTEXATTRIBI2IPROC glad_glVertexAttribI2i = NULL;
-PFNGLVERTEXATTRIBI2IVPROC glad_glVertexAttribI2iv = NULL;
-PFNGLVERTEXATTRIBI2UIPROC glad_glVertexAttribI2ui = NULL;
-PFNGLVERTEXATTRIBI2UIVPROC glad_glVertexAttribI2uiv = NULL;
-PFNGLVERTEXATTRIBI3IPROC glad_glVertexAttribI3i = NULL;
-PFNGLVERTEXATTRIBI3IVPROC glad_glVertexAttribI3iv = NULL;
-PFNGLVERTEXATTRIBI3UIPROC glad_glVertexAttribI3ui = NULL;
-PFNGLVERTEXATTRIBI3UIVPROC glad_glVertexAttribI3uiv = NULL;
-PFNGLVERTEXATTRIBI4BVPROC glad_glVertexAttribI4bv = NULL;
-PFNGLVERTEXATTRIBI4IPROC glad_glVertexAttribI4i = NULL;
-PFNGLVERTEXATTRIBI4IVPROC glad_glVertexAttribI4iv = NULL;
-PFNGLVERTEXATTRIBI4SVPROC glad_glVertexAttribI4sv = NULL;
-PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv = NULL;
-PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui = NULL;
-PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv = NULL;
-PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv = NULL;
-PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer = NULL;
-PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui = NULL;
-PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv = NULL;
-PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui = NULL;
-PFNGLVERTEXATTRIBP2UIVPROC glad_glVertexAttribP2uiv = NULL;
-PFNGLVERTEXATTRIBP3UIPROC glad_glVertexAttribP3ui = NULL;
-PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv = NULL;
-PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui = NULL;
-PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv = NULL;
-PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer = NULL;
-PFNGLVERTEXP2UIPROC glad_glVertexP2ui = NULL;
-PFNGLVERTEXP2UIVPROC glad_glVertexP2uiv = NULL;
-PFNGLVERTEXP3UIPROC glad_glVertexP3ui = NULL;
-PFNGLVERTEXP3UIVPROC glad_glVertexP3uiv = NULL;
-PFNGLVERTEXP4UIPROC glad_glVertexP4ui = NULL;
-PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv = NULL;
-PFNGLVERTEXPOINTERPROC glad_glVertexPointer = NULL;
-PFNGLVIEWPORTPROC glad_glViewport = NULL;
-PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
-PFNGLWINDOWPOS2DPROC glad_glWindowPos2d = NULL;
-PFNGLWINDOWPOS2DVPROC glad_glWindowPos2dv = NULL;
-PFNGLWINDOWPOS2FPROC glad_glWindowPos2f = NULL;
-PFNGLWINDOWPOS2FVPROC glad_glWindowPos2fv = NULL;
-PFNGLWINDOWPOS2IPROC glad_glWindowPos2i = NULL;
-PFNGLWINDOWPOS2IVPROC glad_glWindowPos2iv = NULL;
-PFNGLWINDOWPOS2SPROC glad_glWindowPos2s = NULL;
-PFNGLWINDOWPOS2SVPROC glad_glWindowPos2sv = NULL;
-PFNGLWINDOWPOS3DPROC glad_glWindowPos3d = NULL;
-PFNGLWINDOWPOS3DVPROC glad_glWindowPos3dv = NULL;
-PFNGLWINDOWPOS3FPROC glad_glWindowPos3f = NULL;
-PFNGLWINDOWPOS3FVPROC glad_glWindowPos3fv = NULL;
-PFNGLWINDOWPOS3IPROC glad_glWindowPos3i = NULL;
-PFNGLWINDOWPOS3IVPROC glad_glWindowPos3iv = NULL;
-PFNGLWINDOWPOS3SPROC glad_glWindowPos3s = NULL;
-PFNGLWINDOWPOS3SVPROC glad_glWindowPos3sv = NULL;
+PFNGLACCUMPROC glad_glAccum = GLAD_LAZY_STUB(glAccum);
+PFNGLACTIVETEXTUREPROC glad_glActiveTexture = GLAD_LAZY_STUB(glActiveTexture);
+PFNGLALPHAFUNCPROC glad_glAlphaFunc = GLAD_LAZY_STUB(glAlphaFunc);
+PFNGLARETEXTURESRESIDENTPROC glad_glAreTexturesResident = GLAD_LAZY_STUB(glAreTexturesResident);
+PFNGLARRAYELEMENTPROC glad_glArrayElement = GLAD_LAZY_STUB(glArrayElement);
+PFNGLATTACHSHADERPROC glad_glAttachShader = GLAD_LAZY_STUB(glAttachShader);
+PFNGLBEGINPROC glad_glBegin = GLAD_LAZY_STUB(glBegin);
+PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender = GLAD_LAZY_STUB(glBeginConditionalRender);
+PFNGLBEGINQUERYPROC glad_glBeginQuery = GLAD_LAZY_STUB(glBeginQuery);
+PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback = GLAD_LAZY_STUB(glBeginTransformFeedback);
+PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation = GLAD_LAZY_STUB(glBindAttribLocation);
+PFNGLBINDBUFFERPROC glad_glBindBuffer = GLAD_LAZY_STUB(glBindBuffer);
+PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase = GLAD_LAZY_STUB(glBindBufferBase);
+PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange = GLAD_LAZY_STUB(glBindBufferRange);
+PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation = GLAD_LAZY_STUB(glBindFragDataLocation);
+PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed = GLAD_LAZY_STUB(glBindFragDataLocationIndexed);
+PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer = GLAD_LAZY_STUB(glBindFramebuffer);
+PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer = GLAD_LAZY_STUB(glBindRenderbuffer);
+PFNGLBINDSAMPLERPROC glad_glBindSampler = GLAD_LAZY_STUB(glBindSampler);
+PFNGLBINDTEXTUREPROC glad_glBindTexture = GLAD_LAZY_STUB(glBindTexture);
+PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray = GLAD_LAZY_STUB(glBindVertexArray);
+PFNGLBITMAPPROC glad_glBitmap = GLAD_LAZY_STUB(glBitmap);
+PFNGLBLENDCOLORPROC glad_glBlendColor = GLAD_LAZY_STUB(glBlendColor);
+PFNGLBLENDEQUATIONPROC glad_glBlendEquation = GLAD_LAZY_STUB(glBlendEquation);
+PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate = GLAD_LAZY_STUB(glBlendEquationSeparate);
+PFNGLBLENDFUNCPROC glad_glBlendFunc = GLAD_LAZY_STUB(glBlendFunc);
+PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate = GLAD_LAZY_STUB(glBlendFuncSeparate);
+PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer = GLAD_LAZY_STUB(glBlitFramebuffer);
+PFNGLBUFFERDATAPROC glad_glBufferData = GLAD_LAZY_STUB(glBufferData);
+PFNGLBUFFERSUBDATAPROC glad_glBufferSubData = GLAD_LAZY_STUB(glBufferSubData);
+PFNGLCALLLISTPROC glad_glCallList = GLAD_LAZY_STUB(glCallList);
+PFNGLCALLLISTSPROC glad_glCallLists = GLAD_LAZY_STUB(glCallLists);
+PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus = GLAD_LAZY_STUB(glCheckFramebufferStatus);
+PFNGLCLAMPCOLORPROC glad_glClampColor = GLAD_LAZY_STUB(glClampColor);
+PFNGLCLEARPROC glad_glClear = GLAD_LAZY_STUB(glClear);
+PFNGLCLEARACCUMPROC glad_glClearAccum = GLAD_LAZY_STUB(glClearAccum);
+PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi = GLAD_LAZY_STUB(glClearBufferfi);
+PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv = GLAD_LAZY_STUB(glClearBufferfv);
+PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv = GLAD_LAZY_STUB(glClearBufferiv);
+PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv = GLAD_LAZY_STUB(glClearBufferuiv);
+PFNGLCLEARCOLORPROC glad_glClearColor = GLAD_LAZY_STUB(glClearColor);
+PFNGLCLEARDEPTHPROC glad_glClearDepth = GLAD_LAZY_STUB(glClearDepth);
+PFNGLCLEARINDEXPROC glad_glClearIndex = GLAD_LAZY_STUB(glClearIndex);
+PFNGLCLEARSTENCILPROC glad_glClearStencil = GLAD_LAZY_STUB(glClearStencil);
+PFNGLCLIENTACTIVETEXTUREPROC glad_glClientActiveTexture = GLAD_LAZY_STUB(glClientActiveTexture);
+PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync = GLAD_LAZY_STUB(glClientWaitSync);
+PFNGLCLIPPLANEPROC glad_glClipPlane = GLAD_LAZY_STUB(glClipPlane);
+PFNGLCOLOR3BPROC glad_glColor3b = GLAD_LAZY_STUB(glColor3b);
+PFNGLCOLOR3BVPROC glad_glColor3bv = GLAD_LAZY_STUB(glColor3bv);
+PFNGLCOLOR3DPROC glad_glColor3d = GLAD_LAZY_STUB(glColor3d);
+PFNGLCOLOR3DVPROC glad_glColor3dv = GLAD_LAZY_STUB(glColor3dv);
+PFNGLCOLOR3FPROC glad_glColor3f = GLAD_LAZY_STUB(glColor3f);
+PFNGLCOLOR3FVPROC glad_glColor3fv = GLAD_LAZY_STUB(glColor3fv);
+PFNGLCOLOR3IPROC glad_glColor3i = GLAD_LAZY_STUB(glColor3i);
+PFNGLCOLOR3IVPROC glad_glColor3iv = GLAD_LAZY_STUB(glColor3iv);
+PFNGLCOLOR3SPROC glad_glColor3s = GLAD_LAZY_STUB(glColor3s);
+PFNGLCOLOR3SVPROC glad_glColor3sv = GLAD_LAZY_STUB(glColor3sv);
+PFNGLCOLOR3UBPROC glad_glColor3ub = GLAD_LAZY_STUB(glColor3ub);
+PFNGLCOLOR3UBVPROC glad_glColor3ubv = GLAD_LAZY_STUB(glColor3ubv);
+PFNGLCOLOR3UIPROC glad_glColor3ui = GLAD_LAZY_STUB(glColor3ui);
+PFNGLCOLOR3UIVPROC glad_glColor3uiv = GLAD_LAZY_STUB(glColor3uiv);
+PFNGLCOLOR3USPROC glad_glColor3us = GLAD_LAZY_STUB(glColor3us);
+PFNGLCOLOR3USVPROC glad_glColor3usv = GLAD_LAZY_STUB(glColor3usv);
+PFNGLCOLOR4BPROC glad_glColor4b = GLAD_LAZY_STUB(glColor4b);
+PFNGLCOLOR4BVPROC glad_glColor4bv = GLAD_LAZY_STUB(glColor4bv);
+PFNGLCOLOR4DPROC glad_glColor4d = GLAD_LAZY_STUB(glColor4d);
+PFNGLCOLOR4DVPROC glad_glColor4dv = GLAD_LAZY_STUB(glColor4dv);
+PFNGLCOLOR4FPROC glad_glColor4f = GLAD_LAZY_STUB(glColor4f);
+PFNGLCOLOR4FVPROC glad_glColor4fv = GLAD_LAZY_STUB(glColor4fv);
+PFNGLCOLOR4IPROC glad_glColor4i = GLAD_LAZY_STUB(glColor4i);
+PFNGLCOLOR4IVPROC glad_glColor4iv = GLAD_LAZY_STUB(glColor4iv);
+PFNGLCOLOR4SPROC glad_glColor4s = GLAD_LAZY_STUB(glColor4s);
+PFNGLCOLOR4SVPROC glad_glColor4sv = GLAD_LAZY_STUB(glColor4sv);
+PFNGLCOLOR4UBPROC glad_glColor4ub = GLAD_LAZY_STUB(glColor4ub);
+PFNGLCOLOR4UBVPROC glad_glColor4ubv = GLAD_LAZY_STUB(glColor4ubv);
+PFNGLCOLOR4UIPROC glad_glColor4ui = GLAD_LAZY_STUB(glColor4ui);
+PFNGLCOLOR4UIVPROC glad_glColor4uiv = GLAD_LAZY_STUB(glColor4uiv);
+PFNGLCOLOR4USPROC glad_glColor4us = GLAD_LAZY_STUB(glColor4us);
+PFNGLCOLOR4USVPROC glad_glColor4usv = GLAD_LAZY_STUB(glColor4usv);
+PFNGLCOLORMASKPROC glad_glColorMask = GLAD_LAZY_STUB(glColorMask);
+PFNGLCOLORMASKIPROC glad_glColorMaski = GLAD_LAZY_STUB(glColorMaski);
+PFNGLCOLORMATERIALPROC glad_glColorMaterial = GLAD_LAZY_STUB(glColorMaterial);
+PFNGLCOLORP3UIPROC glad_glColorP3ui = GLAD_LAZY_STUB(glColorP3ui);
+PFNGLCOLORP3UIVPROC glad_glColorP3uiv = GLAD_LAZY_STUB(glColorP3uiv);
+PFNGLCOLORP4UIPROC glad_glColorP4ui = GLAD_LAZY_STUB(glColorP4ui);
+PFNGLCOLORP4UIVPROC glad_glColorP4uiv = GLAD_LAZY_STUB(glColorP4uiv);
+PFNGLCOLORPOINTERPROC glad_glColorPointer = GLAD_LAZY_STUB(glColorPointer);
+PFNGLCOMPILESHADERPROC glad_glCompileShader = GLAD_LAZY_STUB(glCompileShader);
+PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_glCompressedTexImage1D = GLAD_LAZY_STUB(glCompressedTexImage1D);
+PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_glCompressedTexImage2D = GLAD_LAZY_STUB(glCompressedTexImage2D);
+PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D = GLAD_LAZY_STUB(glCompressedTexImage3D);
+PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D = GLAD_LAZY_STUB(glCompressedTexSubImage1D);
+PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D = GLAD_LAZY_STUB(glCompressedTexSubImage2D);
+PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D = GLAD_LAZY_STUB(glCompressedTexSubImage3D);
+PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData = GLAD_LAZY_STUB(glCopyBufferSubData);
+PFNGLCOPYPIXELSPROC glad_glCopyPixels = GLAD_LAZY_STUB(glCopyPixels);
+PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D = GLAD_LAZY_STUB(glCopyTexImage1D);
+PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D = GLAD_LAZY_STUB(glCopyTexImage2D);
+PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D = GLAD_LAZY_STUB(glCopyTexSubImage1D);
+PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D = GLAD_LAZY_STUB(glCopyTexSubImage2D);
+PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D = GLAD_LAZY_STUB(glCopyTexSubImage3D);
+PFNGLCREATEPROGRAMPROC glad_glCreateProgram = GLAD_LAZY_STUB(glCreateProgram);
+PFNGLCREATESHADERPROC glad_glCreateShader = GLAD_LAZY_STUB(glCreateShader);
+PFNGLCULLFACEPROC glad_glCullFace = GLAD_LAZY_STUB(glCullFace);
+PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers = GLAD_LAZY_STUB(glDeleteBuffers);
+PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers = GLAD_LAZY_STUB(glDeleteFramebuffers);
+PFNGLDELETELISTSPROC glad_glDeleteLists = GLAD_LAZY_STUB(glDeleteLists);
+PFNGLDELETEPROGRAMPROC glad_glDeleteProgram = GLAD_LAZY_STUB(glDeleteProgram);
+PFNGLDELETEQUERIESPROC glad_glDeleteQueries = GLAD_LAZY_STUB(glDeleteQueries);
+PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers = GLAD_LAZY_STUB(glDeleteRenderbuffers);
+PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers = GLAD_LAZY_STUB(glDeleteSamplers);
+PFNGLDELETESHADERPROC glad_glDeleteShader = GLAD_LAZY_STUB(glDeleteShader);
+PFNGLDELETESYNCPROC glad_glDeleteSync = GLAD_LAZY_STUB(glDeleteSync);
+PFNGLDELETETEXTURESPROC glad_glDeleteTextures = GLAD_LAZY_STUB(glDeleteTextures);
+PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays = GLAD_LAZY_STUB(glDeleteVertexArrays);
+PFNGLDEPTHFUNCPROC glad_glDepthFunc = GLAD_LAZY_STUB(glDepthFunc);
+PFNGLDEPTHMASKPROC glad_glDepthMask = GLAD_LAZY_STUB(glDepthMask);
+PFNGLDEPTHRANGEPROC glad_glDepthRange = GLAD_LAZY_STUB(glDepthRange);
+PFNGLDETACHSHADERPROC glad_glDetachShader = GLAD_LAZY_STUB(glDetachShader);
+PFNGLDISABLEPROC glad_glDisable = GLAD_LAZY_STUB(glDisable);
+PFNGLDISABLECLIENTSTATEPROC glad_glDisableClientState = GLAD_LAZY_STUB(glDisableClientState);
+PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray = GLAD_LAZY_STUB(glDisableVertexAttribArray);
+PFNGLDISABLEIPROC glad_glDisablei = GLAD_LAZY_STUB(glDisablei);
+PFNGLDRAWARRAYSPROC glad_glDrawArrays = GLAD_LAZY_STUB(glDrawArrays);
+PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced = GLAD_LAZY_STUB(glDrawArraysInstanced);
+PFNGLDRAWBUFFERPROC glad_glDrawBuffer = GLAD_LAZY_STUB(glDrawBuffer);
+PFNGLDRAWBUFFERSPROC glad_glDrawBuffers = GLAD_LAZY_STUB(glDrawBuffers);
+PFNGLDRAWELEMENTSPROC glad_glDrawElements = GLAD_LAZY_STUB(glDrawElements);
+PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex = GLAD_LAZY_STUB(glDrawElementsBaseVertex);
+PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced = GLAD_LAZY_STUB(glDrawElementsInstanced);
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex = GLAD_LAZY_STUB(glDrawElementsInstancedBaseVertex);
+PFNGLDRAWPIXELSPROC glad_glDrawPixels = GLAD_LAZY_STUB(glDrawPixels);
+PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements = GLAD_LAZY_STUB(glDrawRangeElements);
+PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex = GLAD_LAZY_STUB(glDrawRangeElementsBaseVertex);
+PFNGLEDGEFLAGPROC glad_glEdgeFlag = GLAD_LAZY_STUB(glEdgeFlag);
+PFNGLEDGEFLAGPOINTERPROC glad_glEdgeFlagPointer = GLAD_LAZY_STUB(glEdgeFlagPointer);
+PFNGLEDGEFLAGVPROC glad_glEdgeFlagv = GLAD_LAZY_STUB(glEdgeFlagv);
+PFNGLENABLEPROC glad_glEnable = GLAD_LAZY_STUB(glEnable);
+PFNGLENABLECLIENTSTATEPROC glad_glEnableClientState = GLAD_LAZY_STUB(glEnableClientState);
+PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray = GLAD_LAZY_STUB(glEnableVertexAttribArray);
+PFNGLENABLEIPROC glad_glEnablei = GLAD_LAZY_STUB(glEnablei);
+PFNGLENDPROC glad_glEnd = GLAD_LAZY_STUB(glEnd);
+PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender = GLAD_LAZY_STUB(glEndConditionalRender);
+PFNGLENDLISTPROC glad_glEndList = GLAD_LAZY_STUB(glEndList);
+PFNGLENDQUERYPROC glad_glEndQuery = GLAD_LAZY_STUB(glEndQuery);
+PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback = GLAD_LAZY_STUB(glEndTransformFeedback);
+PFNGLEVALCOORD1DPROC glad_glEvalCoord1d = GLAD_LAZY_STUB(glEvalCoord1d);
+PFNGLEVALCOORD1DVPROC glad_glEvalCoord1dv = GLAD_LAZY_STUB(glEvalCoord1dv);
+PFNGLEVALCOORD1FPROC glad_glEvalCoord1f = GLAD_LAZY_STUB(glEvalCoord1f);
+PFNGLEVALCOORD1FVPROC glad_glEvalCoord1fv = GLAD_LAZY_STUB(glEvalCoord1fv);
+PFNGLEVALCOORD2DPROC glad_glEvalCoord2d = GLAD_LAZY_STUB(glEvalCoord2d);
+PFNGLEVALCOORD2DVPROC glad_glEvalCoord2dv = GLAD_LAZY_STUB(glEvalCoord2dv);
+PFNGLEVALCOORD2FPROC glad_glEvalCoord2f = GLAD_LAZY_STUB(glEvalCoord2f);
+PFNGLEVALCOORD2FVPROC glad_glEvalCoord2fv = GLAD_LAZY_STUB(glEvalCoord2fv);
+PFNGLEVALMESH1PROC glad_glEvalMesh1 = GLAD_LAZY_STUB(glEvalMesh1);
+PFNGLEVALMESH2PROC glad_glEvalMesh2 = GLAD_LAZY_STUB(glEvalMesh2);
+PFNGLEVALPOINT1PROC glad_glEvalPoint1 = GLAD_LAZY_STUB(glEvalPoint1);
+PFNGLEVALPOINT2PROC glad_glEvalPoint2 = GLAD_LAZY_STUB(glEvalPoint2);
+PFNGLFEEDBACKBUFFERPROC glad_glFeedbackBuffer = GLAD_LAZY_STUB(glFeedbackBuffer);
+PFNGLFENCESYNCPROC glad_glFenceSync = GLAD_LAZY_STUB(glFenceSync);
+PFNGLFINISHPROC glad_glFinish = GLAD_LAZY_STUB(glFinish);
+PFNGLFLUSHPROC glad_glFlush = GLAD_LAZY_STUB(glFlush);
+PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange = GLAD_LAZY_STUB(glFlushMappedBufferRange);
+PFNGLFOGCOORDPOINTERPROC glad_glFogCoordPointer = GLAD_LAZY_STUB(glFogCoordPointer);
+PFNGLFOGCOORDDPROC glad_glFogCoordd = GLAD_LAZY_STUB(glFogCoordd);
+PFNGLFOGCOORDDVPROC glad_glFogCoorddv = GLAD_LAZY_STUB(glFogCoorddv);
+PFNGLFOGCOORDFPROC glad_glFogCoordf = GLAD_LAZY_STUB(glFogCoordf);
+PFNGLFOGCOORDFVPROC glad_glFogCoordfv = GLAD_LAZY_STUB(glFogCoordfv);
+PFNGLFOGFPROC glad_glFogf = GLAD_LAZY_STUB(glFogf);
+PFNGLFOGFVPROC glad_glFogfv = GLAD_LAZY_STUB(glFogfv);
+PFNGLFOGIPROC glad_glFogi = GLAD_LAZY_STUB(glFogi);
+PFNGLFOGIVPROC glad_glFogiv = GLAD_LAZY_STUB(glFogiv);
+PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer = GLAD_LAZY_STUB(glFramebufferRenderbuffer);
+PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture = GLAD_LAZY_STUB(glFramebufferTexture);
+PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D = GLAD_LAZY_STUB(glFramebufferTexture1D);
+PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D = GLAD_LAZY_STUB(glFramebufferTexture2D);
+PFNGLFRAMEBUFFERTEXTURE3DPROC glad_glFramebufferTexture3D = GLAD_LAZY_STUB(glFramebufferTexture3D);
+PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer = GLAD_LAZY_STUB(glFramebufferTextureLayer);
+PFNGLFRONTFACEPROC glad_glFrontFace = GLAD_LAZY_STUB(glFrontFace);
+PFNGLFRUSTUMPROC glad_glFrustum = GLAD_LAZY_STUB(glFrustum);
+PFNGLGENBUFFERSPROC glad_glGenBuffers = GLAD_LAZY_STUB(glGenBuffers);
+PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers = GLAD_LAZY_STUB(glGenFramebuffers);
+PFNGLGENLISTSPROC glad_glGenLists = GLAD_LAZY_STUB(glGenLists);
+PFNGLGENQUERIESPROC glad_glGenQueries = GLAD_LAZY_STUB(glGenQueries);
+PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers = GLAD_LAZY_STUB(glGenRenderbuffers);
+PFNGLGENSAMPLERSPROC glad_glGenSamplers = GLAD_LAZY_STUB(glGenSamplers);
+PFNGLGENTEXTURESPROC glad_glGenTextures = GLAD_LAZY_STUB(glGenTextures);
+PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays = GLAD_LAZY_STUB(glGenVertexArrays);
+PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap = GLAD_LAZY_STUB(glGenerateMipmap);
+PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib = GLAD_LAZY_STUB(glGetActiveAttrib);
+PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform = GLAD_LAZY_STUB(glGetActiveUniform);
+PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName = GLAD_LAZY_STUB(glGetActiveUniformBlockName);
+PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv = GLAD_LAZY_STUB(glGetActiveUniformBlockiv);
+PFNGLGETACTIVEUNIFORMNAMEPROC glad_glGetActiveUniformName = GLAD_LAZY_STUB(glGetActiveUniformName);
+PFNGLGETACTIVEUNIFORMSIVPROC glad_glGetActiveUniformsiv = GLAD_LAZY_STUB(glGetActiveUniformsiv);
+PFNGLGETATTACHEDSHADERSPROC glad_glGetAttachedShaders = GLAD_LAZY_STUB(glGetAttachedShaders);
+PFNGLGETATTRIBLOCATIONPROC glad_glGetAttribLocation = GLAD_LAZY_STUB(glGetAttribLocation);
+PFNGLGETBOOLEANI_VPROC glad_glGetBooleani_v = GLAD_LAZY_STUB(glGetBooleani_v);
+PFNGLGETBOOLEANVPROC glad_glGetBooleanv = GLAD_LAZY_STUB(glGetBooleanv);
+PFNGLGETBUFFERPARAMETERI64VPROC glad_glGetBufferParameteri64v = GLAD_LAZY_STUB(glGetBufferParameteri64v);
+PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv = GLAD_LAZY_STUB(glGetBufferParameteriv);
+PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv = GLAD_LAZY_STUB(glGetBufferPointerv);
+PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData = GLAD_LAZY_STUB(glGetBufferSubData);
+PFNGLGETCLIPPLANEPROC glad_glGetClipPlane = GLAD_LAZY_STUB(glGetClipPlane);
+PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage = GLAD_LAZY_STUB(glGetCompressedTexImage);
+PFNGLGETDOUBLEVPROC glad_glGetDoublev = GLAD_LAZY_STUB(glGetDoublev);
+PFNGLGETERRORPROC glad_glGetError = GLAD_LAZY_STUB(glGetError);
+PFNGLGETFLOATVPROC glad_glGetFloatv = GLAD_LAZY_STUB(glGetFloatv);
+PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex = GLAD_LAZY_STUB(glGetFragDataIndex);
+PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation = GLAD_LAZY_STUB(glGetFragDataLocation);
+PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv = GLAD_LAZY_STUB(glGetFramebufferAttachmentParameteriv);
+PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v = GLAD_LAZY_STUB(glGetInteger64i_v);
+PFNGLGETINTEGER64VPROC glad_glGetInteger64v = GLAD_LAZY_STUB(glGetInteger64v);
+PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v = GLAD_LAZY_STUB(glGetIntegeri_v);
+PFNGLGETINTEGERVPROC glad_glGetIntegerv = GLAD_LAZY_STUB(glGetIntegerv);
+PFNGLGETLIGHTFVPROC glad_glGetLightfv = GLAD_LAZY_STUB(glGetLightfv);
+PFNGLGETLIGHTIVPROC glad_glGetLightiv = GLAD_LAZY_STUB(glGetLightiv);
+PFNGLGETMAPDVPROC glad_glGetMapdv = GLAD_LAZY_STUB(glGetMapdv);
+PFNGLGETMAPFVPROC glad_glGetMapfv = GLAD_LAZY_STUB(glGetMapfv);
+PFNGLGETMAPIVPROC glad_glGetMapiv = GLAD_LAZY_STUB(glGetMapiv);
+PFNGLGETMATERIALFVPROC glad_glGetMaterialfv = GLAD_LAZY_STUB(glGetMaterialfv);
+PFNGLGETMATERIALIVPROC glad_glGetMaterialiv = GLAD_LAZY_STUB(glGetMaterialiv);
+PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv = GLAD_LAZY_STUB(glGetMultisamplefv);
+PFNGLGETPIXELMAPFVPROC glad_glGetPixelMapfv = GLAD_LAZY_STUB(glGetPixelMapfv);
+PFNGLGETPIXELMAPUIVPROC glad_glGetPixelMapuiv = GLAD_LAZY_STUB(glGetPixelMapuiv);
+PFNGLGETPIXELMAPUSVPROC glad_glGetPixelMapusv = GLAD_LAZY_STUB(glGetPixelMapusv);
+PFNGLGETPOINTERVPROC glad_glGetPointerv = GLAD_LAZY_STUB(glGetPointerv);
+PFNGLGETPOLYGONSTIPPLEPROC glad_glGetPolygonStipple = GLAD_LAZY_STUB(glGetPolygonStipple);
+PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog = GLAD_LAZY_STUB(glGetProgramInfoLog);
+PFNGLGETPROGRAMIVPROC glad_glGetProgramiv = GLAD_LAZY_STUB(glGetProgramiv);
+PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v = GLAD_LAZY_STUB(glGetQueryObjecti64v);
+PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv = GLAD_LAZY_STUB(glGetQueryObjectiv);
+PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v = GLAD_LAZY_STUB(glGetQueryObjectui64v);
+PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv = GLAD_LAZY_STUB(glGetQueryObjectuiv);
+PFNGLGETQUERYIVPROC glad_glGetQueryiv = GLAD_LAZY_STUB(glGetQueryiv);
+PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_glGetRenderbufferParameteriv = GLAD_LAZY_STUB(glGetRenderbufferParameteriv);
+PFNGLGETSAMPLERPARAMETERIIVPROC glad_glGetSamplerParameterIiv = GLAD_LAZY_STUB(glGetSamplerParameterIiv);
+PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv = GLAD_LAZY_STUB(glGetSamplerParameterIuiv);
+PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv = GLAD_LAZY_STUB(glGetSamplerParameterfv);
+PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv = GLAD_LAZY_STUB(glGetSamplerParameteriv);
+PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog = GLAD_LAZY_STUB(glGetShaderInfoLog);
+PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource = GLAD_LAZY_STUB(glGetShaderSource);
+PFNGLGETSHADERIVPROC glad_glGetShaderiv = GLAD_LAZY_STUB(glGetShaderiv);
+PFNGLGETSTRINGPROC glad_glGetString = GLAD_LAZY_STUB(glGetString);
+PFNGLGETSTRINGIPROC glad_glGetStringi = GLAD_LAZY_STUB(glGetStringi);
+PFNGLGETSYNCIVPROC glad_glGetSynciv = GLAD_LAZY_STUB(glGetSynciv);
+PFNGLGETTEXENVFVPROC glad_glGetTexEnvfv = GLAD_LAZY_STUB(glGetTexEnvfv);
+PFNGLGETTEXENVIVPROC glad_glGetTexEnviv = GLAD_LAZY_STUB(glGetTexEnviv);
+PFNGLGETTEXGENDVPROC glad_glGetTexGendv = GLAD_LAZY_STUB(glGetTexGendv);
+PFNGLGETTEXGENFVPROC glad_glGetTexGenfv = GLAD_LAZY_STUB(glGetTexGenfv);
+PFNGLGETTEXGENIVPROC glad_glGetTexGeniv = GLAD_LAZY_STUB(glGetTexGeniv);
+PFNGLGETTEXIMAGEPROC glad_glGetTexImage = GLAD_LAZY_STUB(glGetTexImage);
+PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv = GLAD_LAZY_STUB(glGetTexLevelParameterfv);
+PFNGLGETTEXLEVELPARAMETERIVPROC glad_glGetTexLevelParameteriv = GLAD_LAZY_STUB(glGetTexLevelParameteriv);
+PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv = GLAD_LAZY_STUB(glGetTexParameterIiv);
+PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv = GLAD_LAZY_STUB(glGetTexParameterIuiv);
+PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv = GLAD_LAZY_STUB(glGetTexParameterfv);
+PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv = GLAD_LAZY_STUB(glGetTexParameteriv);
+PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying = GLAD_LAZY_STUB(glGetTransformFeedbackVarying);
+PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex = GLAD_LAZY_STUB(glGetUniformBlockIndex);
+PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices = GLAD_LAZY_STUB(glGetUniformIndices);
+PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation = GLAD_LAZY_STUB(glGetUniformLocation);
+PFNGLGETUNIFORMFVPROC glad_glGetUniformfv = GLAD_LAZY_STUB(glGetUniformfv);
+PFNGLGETUNIFORMIVPROC glad_glGetUniformiv = GLAD_LAZY_STUB(glGetUniformiv);
+PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv = GLAD_LAZY_STUB(glGetUniformuiv);
+PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv = GLAD_LAZY_STUB(glGetVertexAttribIiv);
+PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv = GLAD_LAZY_STUB(glGetVertexAttribIuiv);
+PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv = GLAD_LAZY_STUB(glGetVertexAttribPointerv);
+PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv = GLAD_LAZY_STUB(glGetVertexAttribdv);
+PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv = GLAD_LAZY_STUB(glGetVertexAttribfv);
+PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv = GLAD_LAZY_STUB(glGetVertexAttribiv);
+PFNGLHINTPROC glad_glHint = GLAD_LAZY_STUB(glHint);
+PFNGLINDEXMASKPROC glad_glIndexMask = GLAD_LAZY_STUB(glIndexMask);
+PFNGLINDEXPOINTERPROC glad_glIndexPointer = GLAD_LAZY_STUB(glIndexPointer);
+PFNGLINDEXDPROC glad_glIndexd = GLAD_LAZY_STUB(glIndexd);
+PFNGLINDEXDVPROC glad_glIndexdv = GLAD_LAZY_STUB(glIndexdv);
+PFNGLINDEXFPROC glad_glIndexf = GLAD_LAZY_STUB(glIndexf);
+PFNGLINDEXFVPROC glad_glIndexfv = GLAD_LAZY_STUB(glIndexfv);
+PFNGLINDEXIPROC glad_glIndexi = GLAD_LAZY_STUB(glIndexi);
+PFNGLINDEXIVPROC glad_glIndexiv = GLAD_LAZY_STUB(glIndexiv);
+PFNGLINDEXSPROC glad_glIndexs = GLAD_LAZY_STUB(glIndexs);
+PFNGLINDEXSVPROC glad_glIndexsv = GLAD_LAZY_STUB(glIndexsv);
+PFNGLINDEXUBPROC glad_glIndexub = GLAD_LAZY_STUB(glIndexub);
+PFNGLINDEXUBVPROC glad_glIndexubv = GLAD_LAZY_STUB(glIndexubv);
+PFNGLINITNAMESPROC glad_glInitNames = GLAD_LAZY_STUB(glInitNames);
+PFNGLINTERLEAVEDARRAYSPROC glad_glInterleavedArrays = GLAD_LAZY_STUB(glInterleavedArrays);
+PFNGLISBUFFERPROC glad_glIsBuffer = GLAD_LAZY_STUB(glIsBuffer);
+PFNGLISENABLEDPROC glad_glIsEnabled = GLAD_LAZY_STUB(glIsEnabled);
+PFNGLISENABLEDIPROC glad_glIsEnabledi = GLAD_LAZY_STUB(glIsEnabledi);
+PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer = GLAD_LAZY_STUB(glIsFramebuffer);
+PFNGLISLISTPROC glad_glIsList = GLAD_LAZY_STUB(glIsList);
+PFNGLISPROGRAMPROC glad_glIsProgram = GLAD_LAZY_STUB(glIsProgram);
+PFNGLISQUERYPROC glad_glIsQuery = GLAD_LAZY_STUB(glIsQuery);
+PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer = GLAD_LAZY_STUB(glIsRenderbuffer);
+PFNGLISSAMPLERPROC glad_glIsSampler = GLAD_LAZY_STUB(glIsSampler);
+PFNGLISSHADERPROC glad_glIsShader = GLAD_LAZY_STUB(glIsShader);
+PFNGLISSYNCPROC glad_glIsSync = GLAD_LAZY_STUB(glIsSync);
+PFNGLISTEXTUREPROC glad_glIsTexture = GLAD_LAZY_STUB(glIsTexture);
+PFNGLISVERTEXARRAYPROC glad_glIsVertexArray = GLAD_LAZY_STUB(glIsVertexArray);
+PFNGLLIGHTMODELFPROC glad_glLightModelf = GLAD_LAZY_STUB(glLightModelf);
+PFNGLLIGHTMODELFVPROC glad_glLightModelfv = GLAD_LAZY_STUB(glLightModelfv);
+PFNGLLIGHTMODELIPROC glad_glLightModeli = GLAD_LAZY_STUB(glLightModeli);
+PFNGLLIGHTMODELIVPROC glad_glLightModeliv = GLAD_LAZY_STUB(glLightModeliv);
+PFNGLLIGHTFPROC glad_glLightf = GLAD_LAZY_STUB(glLightf);
+PFNGLLIGHTFVPROC glad_glLightfv = GLAD_LAZY_STUB(glLightfv);
+PFNGLLIGHTIPROC glad_glLighti = GLAD_LAZY_STUB(glLighti);
+PFNGLLIGHTIVPROC glad_glLightiv = GLAD_LAZY_STUB(glLightiv);
+PFNGLLINESTIPPLEPROC glad_glLineStipple = GLAD_LAZY_STUB(glLineStipple);
+PFNGLLINEWIDTHPROC glad_glLineWidth = GLAD_LAZY_STUB(glLineWidth);
+PFNGLLINKPROGRAMPROC glad_glLinkProgram = GLAD_LAZY_STUB(glLinkProgram);
+PFNGLLISTBASEPROC glad_glListBase = GLAD_LAZY_STUB(glListBase);
+PFNGLLOADIDENTITYPROC glad_glLoadIdentity = GLAD_LAZY_STUB(glLoadIdentity);
+PFNGLLOADMATRIXDPROC glad_glLoadMatrixd = GLAD_LAZY_STUB(glLoadMatrixd);
+PFNGLLOADMATRIXFPROC glad_glLoadMatrixf = GLAD_LAZY_STUB(glLoadMatrixf);
+PFNGLLOADNAMEPROC glad_glLoadName = GLAD_LAZY_STUB(glLoadName);
+PFNGLLOADTRANSPOSEMATRIXDPROC glad_glLoadTransposeMatrixd = GLAD_LAZY_STUB(glLoadTransposeMatrixd);
+PFNGLLOADTRANSPOSEMATRIXFPROC glad_glLoadTransposeMatrixf = GLAD_LAZY_STUB(glLoadTransposeMatrixf);
+PFNGLLOGICOPPROC glad_glLogicOp = GLAD_LAZY_STUB(glLogicOp);
+PFNGLMAP1DPROC glad_glMap1d = GLAD_LAZY_STUB(glMap1d);
+PFNGLMAP1FPROC glad_glMap1f = GLAD_LAZY_STUB(glMap1f);
+PFNGLMAP2DPROC glad_glMap2d = GLAD_LAZY_STUB(glMap2d);
+PFNGLMAP2FPROC glad_glMap2f = GLAD_LAZY_STUB(glMap2f);
+PFNGLMAPBUFFERPROC glad_glMapBuffer = GLAD_LAZY_STUB(glMapBuffer);
+PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange = GLAD_LAZY_STUB(glMapBufferRange);
+PFNGLMAPGRID1DPROC glad_glMapGrid1d = GLAD_LAZY_STUB(glMapGrid1d);
+PFNGLMAPGRID1FPROC glad_glMapGrid1f = GLAD_LAZY_STUB(glMapGrid1f);
+PFNGLMAPGRID2DPROC glad_glMapGrid2d = GLAD_LAZY_STUB(glMapGrid2d);
+PFNGLMAPGRID2FPROC glad_glMapGrid2f = GLAD_LAZY_STUB(glMapGrid2f);
+PFNGLMATERIALFPROC glad_glMaterialf = GLAD_LAZY_STUB(glMaterialf);
+PFNGLMATERIALFVPROC glad_glMaterialfv = GLAD_LAZY_STUB(glMaterialfv);
+PFNGLMATERIALIPROC glad_glMateriali = GLAD_LAZY_STUB(glMateriali);
+PFNGLMATERIALIVPROC glad_glMaterialiv = GLAD_LAZY_STUB(glMaterialiv);
+PFNGLMATRIXMODEPROC glad_glMatrixMode = GLAD_LAZY_STUB(glMatrixMode);
+PFNGLMULTMATRIXDPROC glad_glMultMatrixd = GLAD_LAZY_STUB(glMultMatrixd);
+PFNGLMULTMATRIXFPROC glad_glMultMatrixf = GLAD_LAZY_STUB(glMultMatrixf);
+PFNGLMULTTRANSPOSEMATRIXDPROC glad_glMultTransposeMatrixd = GLAD_LAZY_STUB(glMultTransposeMatrixd);
+PFNGLMULTTRANSPOSEMATRIXFPROC glad_glMultTransposeMatrixf = GLAD_LAZY_STUB(glMultTransposeMatrixf);
+PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays = GLAD_LAZY_STUB(glMultiDrawArrays);
+PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements = GLAD_LAZY_STUB(glMultiDrawElements);
+PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex = GLAD_LAZY_STUB(glMultiDrawElementsBaseVertex);
+PFNGLMULTITEXCOORD1DPROC glad_glMultiTexCoord1d = GLAD_LAZY_STUB(glMultiTexCoord1d);
+PFNGLMULTITEXCOORD1DVPROC glad_glMultiTexCoord1dv = GLAD_LAZY_STUB(glMultiTexCoord1dv);
+PFNGLMULTITEXCOORD1FPROC glad_glMultiTexCoord1f = GLAD_LAZY_STUB(glMultiTexCoord1f);
+PFNGLMULTITEXCOORD1FVPROC glad_glMultiTexCoord1fv = GLAD_LAZY_STUB(glMultiTexCoord1fv);
+PFNGLMULTITEXCOORD1IPROC glad_glMultiTexCoord1i = GLAD_LAZY_STUB(glMultiTexCoord1i);
+PFNGLMULTITEXCOORD1IVPROC glad_glMultiTexCoord1iv = GLAD_LAZY_STUB(glMultiTexCoord1iv);
+PFNGLMULTITEXCOORD1SPROC glad_glMultiTexCoord1s = GLAD_LAZY_STUB(glMultiTexCoord1s);
+PFNGLMULTITEXCOORD1SVPROC glad_glMultiTexCoord1sv = GLAD_LAZY_STUB(glMultiTexCoord1sv);
+PFNGLMULTITEXCOORD2DPROC glad_glMultiTexCoord2d = GLAD_LAZY_STUB(glMultiTexCoord2d);
+PFNGLMULTITEXCOORD2DVPROC glad_glMultiTexCoord2dv = GLAD_LAZY_STUB(glMultiTexCoord2dv);
+PFNGLMULTITEXCOORD2FPROC glad_glMultiTexCoord2f = GLAD_LAZY_STUB(glMultiTexCoord2f);
+PFNGLMULTITEXCOORD2FVPROC glad_glMultiTexCoord2fv = GLAD_LAZY_STUB(glMultiTexCoord2fv);
+PFNGLMULTITEXCOORD2IPROC glad_glMultiTexCoord2i = GLAD_LAZY_STUB(glMultiTexCoord2i);
+PFNGLMULTITEXCOORD2IVPROC glad_glMultiTexCoord2iv = GLAD_LAZY_STUB(glMultiTexCoord2iv);
+PFNGLMULTITEXCOORD2SPROC glad_glMultiTexCoord2s = GLAD_LAZY_STUB(glMultiTexCoord2s);
+PFNGLMULTITEXCOORD2SVPROC glad_glMultiTexCoord2sv = GLAD_LAZY_STUB(glMultiTexCoord2sv);
+PFNGLMULTITEXCOORD3DPROC glad_glMultiTexCoord3d = GLAD_LAZY_STUB(glMultiTexCoord3d);
+PFNGLMULTITEXCOORD3DVPROC glad_glMultiTexCoord3dv = GLAD_LAZY_STUB(glMultiTexCoord3dv);
+PFNGLMULTITEXCOORD3FPROC glad_glMultiTexCoord3f = GLAD_LAZY_STUB(glMultiTexCoord3f);
+PFNGLMULTITEXCOORD3FVPROC glad_glMultiTexCoord3fv = GLAD_LAZY_STUB(glMultiTexCoord3fv);
+PFNGLMULTITEXCOORD3IPROC glad_glMultiTexCoord3i = GLAD_LAZY_STUB(glMultiTexCoord3i);
+PFNGLMULTITEXCOORD3IVPROC glad_glMultiTexCoord3iv = GLAD_LAZY_STUB(glMultiTexCoord3iv);
+PFNGLMULTITEXCOORD3SPROC glad_glMultiTexCoord3s = GLAD_LAZY_STUB(glMultiTexCoord3s);
+PFNGLMULTITEXCOORD3SVPROC glad_glMultiTexCoord3sv = GLAD_LAZY_STUB(glMultiTexCoord3sv);
+PFNGLMULTITEXCOORD4DPROC glad_glMultiTexCoord4d = GLAD_LAZY_STUB(glMultiTexCoord4d);
+PFNGLMULTITEXCOORD4DVPROC glad_glMultiTexCoord4dv = GLAD_LAZY_STUB(glMultiTexCoord4dv);
+PFNGLMULTITEXCOORD4FPROC glad_glMultiTexCoord4f = GLAD_LAZY_STUB(glMultiTexCoord4f);
+PFNGLMULTITEXCOORD4FVPROC glad_glMultiTexCoord4fv = GLAD_LAZY_STUB(glMultiTexCoord4fv);
+PFNGLMULTITEXCOORD4IPROC glad_glMultiTexCoord4i = GLAD_LAZY_STUB(glMultiTexCoord4i);
+PFNGLMULTITEXCOORD4IVPROC glad_glMultiTexCoord4iv = GLAD_LAZY_STUB(glMultiTexCoord4iv);
+PFNGLMULTITEXCOORD4SPROC glad_glMultiTexCoord4s = GLAD_LAZY_STUB(glMultiTexCoord4s);
+PFNGLMULTITEXCOORD4SVPROC glad_glMultiTexCoord4sv = GLAD_LAZY_STUB(glMultiTexCoord4sv);
+PFNGLMULTITEXCOORDP1UIPROC glad_glMultiTexCoordP1ui = GLAD_LAZY_STUB(glMultiTexCoordP1ui);
+PFNGLMULTITEXCOORDP1UIVPROC glad_glMultiTexCoordP1uiv = GLAD_LAZY_STUB(glMultiTexCoordP1uiv);
+PFNGLMULTITEXCOORDP2UIPROC glad_glMultiTexCoordP2ui = GLAD_LAZY_STUB(glMultiTexCoordP2ui);
+PFNGLMULTITEXCOORDP2UIVPROC glad_glMultiTexCoordP2uiv = GLAD_LAZY_STUB(glMultiTexCoordP2uiv);
+PFNGLMULTITEXCOORDP3UIPROC glad_glMultiTexCoordP3ui = GLAD_LAZY_STUB(glMultiTexCoordP3ui);
+PFNGLMULTITEXCOORDP3UIVPROC glad_glMultiTexCoordP3uiv = GLAD_LAZY_STUB(glMultiTexCoordP3uiv);
+PFNGLMULTITEXCOORDP4UIPROC glad_glMultiTexCoordP4ui = GLAD_LAZY_STUB(glMultiTexCoordP4ui);
+PFNGLMULTITEXCOORDP4UIVPROC glad_glMultiTexCoordP4uiv = GLAD_LAZY_STUB(glMultiTexCoordP4uiv);
+PFNGLNEWLISTPROC glad_glNewList = GLAD_LAZY_STUB(glNewList);
+PFNGLNORMAL3BPROC glad_glNormal3b = GLAD_LAZY_STUB(glNormal3b);
+PFNGLNORMAL3BVPROC glad_glNormal3bv = GLAD_LAZY_STUB(glNormal3bv);
+PFNGLNORMAL3DPROC glad_glNormal3d = GLAD_LAZY_STUB(glNormal3d);
+PFNGLNORMAL3DVPROC glad_glNormal3dv = GLAD_LAZY_STUB(glNormal3dv);
+PFNGLNORMAL3FPROC glad_glNormal3f = GLAD_LAZY_STUB(glNormal3f);
+PFNGLNORMAL3FVPROC glad_glNormal3fv = GLAD_LAZY_STUB(glNormal3fv);
+PFNGLNORMAL3IPROC glad_glNormal3i = GLAD_LAZY_STUB(glNormal3i);
+PFNGLNORMAL3IVPROC glad_glNormal3iv = GLAD_LAZY_STUB(glNormal3iv);
+PFNGLNORMAL3SPROC glad_glNormal3s = GLAD_LAZY_STUB(glNormal3s);
+PFNGLNORMAL3SVPROC glad_glNormal3sv = GLAD_LAZY_STUB(glNormal3sv);
+PFNGLNORMALP3UIPROC glad_glNormalP3ui = GLAD_LAZY_STUB(glNormalP3ui);
+PFNGLNORMALP3UIVPROC glad_glNormalP3uiv = GLAD_LAZY_STUB(glNormalP3uiv);
+PFNGLNORMALPOINTERPROC glad_glNormalPointer = GLAD_LAZY_STUB(glNormalPointer);
+PFNGLORTHOPROC glad_glOrtho = GLAD_LAZY_STUB(glOrtho);
+PFNGLPASSTHROUGHPROC glad_glPassThrough = GLAD_LAZY_STUB(glPassThrough);
+PFNGLPIXELMAPFVPROC glad_glPixelMapfv = GLAD_LAZY_STUB(glPixelMapfv);
+PFNGLPIXELMAPUIVPROC glad_glPixelMapuiv = GLAD_LAZY_STUB(glPixelMapuiv);
+PFNGLPIXELMAPUSVPROC glad_glPixelMapusv = GLAD_LAZY_STUB(glPixelMapusv);
+PFNGLPIXELSTOREFPROC glad_glPixelStoref = GLAD_LAZY_STUB(glPixelStoref);
+PFNGLPIXELSTOREIPROC glad_glPixelStorei = GLAD_LAZY_STUB(glPixelStorei);
+PFNGLPIXELTRANSFERFPROC glad_glPixelTransferf = GLAD_LAZY_STUB(glPixelTransferf);
+PFNGLPIXELTRANSFERIPROC glad_glPixelTransferi = GLAD_LAZY_STUB(glPixelTransferi);
+PFNGLPIXELZOOMPROC glad_glPixelZoom = GLAD_LAZY_STUB(glPixelZoom);
+PFNGLPOINTPARAMETERFPROC glad_glPointParameterf = GLAD_LAZY_STUB(glPointParameterf);
+PFNGLPOINTPARAMETERFVPROC glad_glPointParameterfv = GLAD_LAZY_STUB(glPointParameterfv);
+PFNGLPOINTPARAMETERIPROC glad_glPointParameteri = GLAD_LAZY_STUB(glPointParameteri);
+PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv = GLAD_LAZY_STUB(glPointParameteriv);
+PFNGLPOINTSIZEPROC glad_glPointSize = GLAD_LAZY_STUB(glPointSize);
+PFNGLPOLYGONMODEPROC glad_glPolygonMode = GLAD_LAZY_STUB(glPolygonMode);
+PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset = GLAD_LAZY_STUB(glPolygonOffset);
+PFNGLPOLYGONSTIPPLEPROC glad_glPolygonStipple = GLAD_LAZY_STUB(glPolygonStipple);
+PFNGLPOPATTRIBPROC glad_glPopAttrib = GLAD_LAZY_STUB(glPopAttrib);
+PFNGLPOPCLIENTATTRIBPROC glad_glPopClientAttrib = GLAD_LAZY_STUB(glPopClientAttrib);
+PFNGLPOPMATRIXPROC glad_glPopMatrix = GLAD_LAZY_STUB(glPopMatrix);
+PFNGLPOPNAMEPROC glad_glPopName = GLAD_LAZY_STUB(glPopName);
+PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex = GLAD_LAZY_STUB(glPrimitiveRestartIndex);
+PFNGLPRIORITIZETEXTURESPROC glad_glPrioritizeTextures = GLAD_LAZY_STUB(glPrioritizeTextures);
+PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex = GLAD_LAZY_STUB(glProvokingVertex);
+PFNGLPUSHATTRIBPROC glad_glPushAttrib = GLAD_LAZY_STUB(glPushAttrib);
+PFNGLPUSHCLIENTATTRIBPROC glad_glPushClientAttrib = GLAD_LAZY_STUB(glPushClientAttrib);
+PFNGLPUSHMATRIXPROC glad_glPushMatrix = GLAD_LAZY_STUB(glPushMatrix);
+PFNGLPUSHNAMEPROC glad_glPushName = GLAD_LAZY_STUB(glPushName);
+PFNGLQUERYCOUNTERPROC glad_glQueryCounter = GLAD_LAZY_STUB(glQueryCounter);
+PFNGLRASTERPOS2DPROC glad_glRasterPos2d = GLAD_LAZY_STUB(glRasterPos2d);
+PFNGLRASTERPOS2DVPROC glad_glRasterPos2dv = GLAD_LAZY_STUB(glRasterPos2dv);
+PFNGLRASTERPOS2FPROC glad_glRasterPos2f = GLAD_LAZY_STUB(glRasterPos2f);
+PFNGLRASTERPOS2FVPROC glad_glRasterPos2fv = GLAD_LAZY_STUB(glRasterPos2fv);
+PFNGLRASTERPOS2IPROC glad_glRasterPos2i = GLAD_LAZY_STUB(glRasterPos2i);
+PFNGLRASTERPOS2IVPROC glad_glRasterPos2iv = GLAD_LAZY_STUB(glRasterPos2iv);
+PFNGLRASTERPOS2SPROC glad_glRasterPos2s = GLAD_LAZY_STUB(glRasterPos2s);
+PFNGLRASTERPOS2SVPROC glad_glRasterPos2sv = GLAD_LAZY_STUB(glRasterPos2sv);
+PFNGLRASTERPOS3DPROC glad_glRasterPos3d = GLAD_LAZY_STUB(glRasterPos3d);
+PFNGLRASTERPOS3DVPROC glad_glRasterPos3dv = GLAD_LAZY_STUB(glRasterPos3dv);
+PFNGLRASTERPOS3FPROC glad_glRasterPos3f = GLAD_LAZY_STUB(glRasterPos3f);
+PFNGLRASTERPOS3FVPROC glad_glRasterPos3fv = GLAD_LAZY_STUB(glRasterPos3fv);
+PFNGLRASTERPOS3IPROC glad_glRasterPos3i = GLAD_LAZY_STUB(glRasterPos3i);
+PFNGLRASTERPOS3IVPROC glad_glRasterPos3iv = GLAD_LAZY_STUB(glRasterPos3iv);
+PFNGLRASTERPOS3SPROC glad_glRasterPos3s = GLAD_LAZY_STUB(glRasterPos3s);
+PFNGLRASTERPOS3SVPROC glad_glRasterPos3sv = GLAD_LAZY_STUB(glRasterPos3sv);
+PFNGLRASTERPOS4DPROC glad_glRasterPos4d = GLAD_LAZY_STUB(glRasterPos4d);
+PFNGLRASTERPOS4DVPROC glad_glRasterPos4dv = GLAD_LAZY_STUB(glRasterPos4dv);
+PFNGLRASTERPOS4FPROC glad_glRasterPos4f = GLAD_LAZY_STUB(glRasterPos4f);
+PFNGLRASTERPOS4FVPROC glad_glRasterPos4fv = GLAD_LAZY_STUB(glRasterPos4fv);
+PFNGLRASTERPOS4IPROC glad_glRasterPos4i = GLAD_LAZY_STUB(glRasterPos4i);
+PFNGLRASTERPOS4IVPROC glad_glRasterPos4iv = GLAD_LAZY_STUB(glRasterPos4iv);
+PFNGLRASTERPOS4SPROC glad_glRasterPos4s = GLAD_LAZY_STUB(glRasterPos4s);
+PFNGLRASTERPOS4SVPROC glad_glRasterPos4sv = GLAD_LAZY_STUB(glRasterPos4sv);
+PFNGLREADBUFFERPROC glad_glReadBuffer = GLAD_LAZY_STUB(glReadBuffer);
+PFNGLREADPIXELSPROC glad_glReadPixels = GLAD_LAZY_STUB(glReadPixels);
+PFNGLRECTDPROC glad_glRectd = GLAD_LAZY_STUB(glRectd);
+PFNGLRECTDVPROC glad_glRectdv = GLAD_LAZY_STUB(glRectdv);
+PFNGLRECTFPROC glad_glRectf = GLAD_LAZY_STUB(glRectf);
+PFNGLRECTFVPROC glad_glRectfv = GLAD_LAZY_STUB(glRectfv);
+PFNGLRECTIPROC glad_glRecti = GLAD_LAZY_STUB(glRecti);
+PFNGLRECTIVPROC glad_glRectiv = GLAD_LAZY_STUB(glRectiv);
+PFNGLRECTSPROC glad_glRects = GLAD_LAZY_STUB(glRects);
+PFNGLRECTSVPROC glad_glRectsv = GLAD_LAZY_STUB(glRectsv);
+PFNGLRENDERMODEPROC glad_glRenderMode = GLAD_LAZY_STUB(glRenderMode);
+PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage = GLAD_LAZY_STUB(glRenderbufferStorage);
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample = GLAD_LAZY_STUB(glRenderbufferStorageMultisample);
+PFNGLROTATEDPROC glad_glRotated = GLAD_LAZY_STUB(glRotated);
+PFNGLROTATEFPROC glad_glRotatef = GLAD_LAZY_STUB(glRotatef);
+PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage = GLAD_LAZY_STUB(glSampleCoverage);
+PFNGLSAMPLEMASKIPROC glad_glSampleMaski = GLAD_LAZY_STUB(glSampleMaski);
+PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv = GLAD_LAZY_STUB(glSamplerParameterIiv);
+PFNGLSAMPLERPARAMETERIUIVPROC glad_glSamplerParameterIuiv = GLAD_LAZY_STUB(glSamplerParameterIuiv);
+PFNGLSAMPLERPARAMETERFPROC glad_glSamplerParameterf = GLAD_LAZY_STUB(glSamplerParameterf);
+PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv = GLAD_LAZY_STUB(glSamplerParameterfv);
+PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri = GLAD_LAZY_STUB(glSamplerParameteri);
+PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv = GLAD_LAZY_STUB(glSamplerParameteriv);
+PFNGLSCALEDPROC glad_glScaled = GLAD_LAZY_STUB(glScaled);
+PFNGLSCALEFPROC glad_glScalef = GLAD_LAZY_STUB(glScalef);
+PFNGLSCISSORPROC glad_glScissor = GLAD_LAZY_STUB(glScissor);
+PFNGLSECONDARYCOLOR3BPROC glad_glSecondaryColor3b = GLAD_LAZY_STUB(glSecondaryColor3b);
+PFNGLSECONDARYCOLOR3BVPROC glad_glSecondaryColor3bv = GLAD_LAZY_STUB(glSecondaryColor3bv);
+PFNGLSECONDARYCOLOR3DPROC glad_glSecondaryColor3d = GLAD_LAZY_STUB(glSecondaryColor3d);
+PFNGLSECONDARYCOLOR3DVPROC glad_glSecondaryColor3dv = GLAD_LAZY_STUB(glSecondaryColor3dv);
+PFNGLSECONDARYCOLOR3FPROC glad_glSecondaryColor3f = GLAD_LAZY_STUB(glSecondaryColor3f);
+PFNGLSECONDARYCOLOR3FVPROC glad_glSecondaryColor3fv = GLAD_LAZY_STUB(glSecondaryColor3fv);
+PFNGLSECONDARYCOLOR3IPROC glad_glSecondaryColor3i = GLAD_LAZY_STUB(glSecondaryColor3i);
+PFNGLSECONDARYCOLOR3IVPROC glad_glSecondaryColor3iv = GLAD_LAZY_STUB(glSecondaryColor3iv);
+PFNGLSECONDARYCOLOR3SPROC glad_glSecondaryColor3s = GLAD_LAZY_STUB(glSecondaryColor3s);
+PFNGLSECONDARYCOLOR3SVPROC glad_glSecondaryColor3sv = GLAD_LAZY_STUB(glSecondaryColor3sv);
+PFNGLSECONDARYCOLOR3UBPROC glad_glSecondaryColor3ub = GLAD_LAZY_STUB(glSecondaryColor3ub);
+PFNGLSECONDARYCOLOR3UBVPROC glad_glSecondaryColor3ubv = GLAD_LAZY_STUB(glSecondaryColor3ubv);
+PFNGLSECONDARYCOLOR3UIPROC glad_glSecondaryColor3ui = GLAD_LAZY_STUB(glSecondaryColor3ui);
+PFNGLSECONDARYCOLOR3UIVPROC glad_glSecondaryColor3uiv = GLAD_LAZY_STUB(glSecondaryColor3uiv);
+PFNGLSECONDARYCOLOR3USPROC glad_glSecondaryColor3us = GLAD_LAZY_STUB(glSecondaryColor3us);
+PFNGLSECONDARYCOLOR3USVPROC glad_glSecondaryColor3usv = GLAD_LAZY_STUB(glSecondaryColor3usv);
+PFNGLSECONDARYCOLORP3UIPROC glad_glSecondaryColorP3ui = GLAD_LAZY_STUB(glSecondaryColorP3ui);
+PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv = GLAD_LAZY_STUB(glSecondaryColorP3uiv);
+PFNGLSECONDARYCOLORPOINTERPROC glad_glSecondaryColorPointer = GLAD_LAZY_STUB(glSecondaryColorPointer);
+PFNGLSELECTBUFFERPROC glad_glSelectBuffer = GLAD_LAZY_STUB(glSelectBuffer);
+PFNGLSHADEMODELPROC glad_glShadeModel = GLAD_LAZY_STUB(glShadeModel);
+PFNGLSHADERSOURCEPROC glad_glShaderSource = GLAD_LAZY_STUB(glShaderSource);
+PFNGLSTENCILFUNCPROC glad_glStencilFunc = GLAD_LAZY_STUB(glStencilFunc);
+PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate = GLAD_LAZY_STUB(glStencilFuncSeparate);
+PFNGLSTENCILMASKPROC glad_glStencilMask = GLAD_LAZY_STUB(glStencilMask);
+PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate = GLAD_LAZY_STUB(glStencilMaskSeparate);
+PFNGLSTENCILOPPROC glad_glStencilOp = GLAD_LAZY_STUB(glStencilOp);
+PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate = GLAD_LAZY_STUB(glStencilOpSeparate);
+PFNGLTEXBUFFERPROC glad_glTexBuffer = GLAD_LAZY_STUB(glTexBuffer);
+PFNGLTEXCOORD1DPROC glad_glTexCoord1d = GLAD_LAZY_STUB(glTexCoord1d);
+PFNGLTEXCOORD1DVPROC glad_glTexCoord1dv = GLAD_LAZY_STUB(glTexCoord1dv);
+PFNGLTEXCOORD1FPROC glad_glTexCoord1f = GLAD_LAZY_STUB(glTexCoord1f);
+PFNGLTEXCOORD1FVPROC glad_glTexCoord1fv = GLAD_LAZY_STUB(glTexCoord1fv);
+PFNGLTEXCOORD1IPROC glad_glTexCoord1i = GLAD_LAZY_STUB(glTexCoord1i);
+PFNGLTEXCOORD1IVPROC glad_glTexCoord1iv = GLAD_LAZY_STUB(glTexCoord1iv);
+PFNGLTEXCOORD1SPROC glad_glTexCoord1s = GLAD_LAZY_STUB(glTexCoord1s);
+PFNGLTEXCOORD1SVPROC glad_glTexCoord1sv = GLAD_LAZY_STUB(glTexCoord1sv);
+PFNGLTEXCOORD2DPROC glad_glTexCoord2d = GLAD_LAZY_STUB(glTexCoord2d);
+PFNGLTEXCOORD2DVPROC glad_glTexCoord2dv = GLAD_LAZY_STUB(glTexCoord2dv);
+PFNGLTEXCOORD2FPROC glad_glTexCoord2f = GLAD_LAZY_STUB(glTexCoord2f);
+PFNGLTEXCOORD2FVPROC glad_glTexCoord2fv = GLAD_LAZY_STUB(glTexCoord2fv);
+PFNGLTEXCOORD2IPROC glad_glTexCoord2i = GLAD_LAZY_STUB(glTexCoord2i);
+PFNGLTEXCOORD2IVPROC glad_glTexCoord2iv = GLAD_LAZY_STUB(glTexCoord2iv);
+PFNGLTEXCOORD2SPROC glad_glTexCoord2s = GLAD_LAZY_STUB(glTexCoord2s);
+PFNGLTEXCOORD2SVPROC glad_glTexCoord2sv = GLAD_LAZY_STUB(glTexCoord2sv);
+PFNGLTEXCOORD3DPROC glad_glTexCoord3d = GLAD_LAZY_STUB(glTexCoord3d);
+PFNGLTEXCOORD3DVPROC glad_glTexCoord3dv = GLAD_LAZY_STUB(glTexCoord3dv);
+PFNGLTEXCOORD3FPROC glad_glTexCoord3f = GLAD_LAZY_STUB(glTexCoord3f);
+PFNGLTEXCOORD3FVPROC glad_glTexCoord3fv = GLAD_LAZY_STUB(glTexCoord3fv);
+PFNGLTEXCOORD3IPROC glad_glTexCoord3i = GLAD_LAZY_STUB(glTexCoord3i);
+PFNGLTEXCOORD3IVPROC glad_glTexCoord3iv = GLAD_LAZY_STUB(glTexCoord3iv);
+PFNGLTEXCOORD3SPROC glad_glTexCoord3s = GLAD_LAZY_STUB(glTexCoord3s);
+PFNGLTEXCOORD3SVPROC glad_glTexCoord3sv = GLAD_LAZY_STUB(glTexCoord3sv);
+PFNGLTEXCOORD4DPROC glad_glTexCoord4d = GLAD_LAZY_STUB(glTexCoord4d);
+PFNGLTEXCOORD4DVPROC glad_glTexCoord4dv = GLAD_LAZY_STUB(glTexCoord4dv);
+PFNGLTEXCOORD4FPROC glad_glTexCoord4f = GLAD_LAZY_STUB(glTexCoord4f);
+PFNGLTEXCOORD4FVPROC glad_glTexCoord4fv = GLAD_LAZY_STUB(glTexCoord4fv);
+PFNGLTEXCOORD4IPROC glad_glTexCoord4i = GLAD_LAZY_STUB(glTexCoord4i);
+PFNGLTEXCOORD4IVPROC glad_glTexCoord4iv = GLAD_LAZY_STUB(glTexCoord4iv);
+PFNGLTEXCOORD4SPROC glad_glTexCoord4s = GLAD_LAZY_STUB(glTexCoord4s);
+PFNGLTEXCOORD4SVPROC glad_glTexCoord4sv = GLAD_LAZY_STUB(glTexCoord4sv);
+PFNGLTEXCOORDP1UIPROC glad_glTexCoordP1ui = GLAD_LAZY_STUB(glTexCoordP1ui);
+PFNGLTEXCOORDP1UIVPROC glad_glTexCoordP1uiv = GLAD_LAZY_STUB(glTexCoordP1uiv);
+PFNGLTEXCOORDP2UIPROC glad_glTexCoordP2ui = GLAD_LAZY_STUB(glTexCoordP2ui);
+PFNGLTEXCOORDP2UIVPROC glad_glTexCoordP2uiv = GLAD_LAZY_STUB(glTexCoordP2uiv);
+PFNGLTEXCOORDP3UIPROC glad_glTexCoordP3ui = GLAD_LAZY_STUB(glTexCoordP3ui);
+PFNGLTEXCOORDP3UIVPROC glad_glTexCoordP3uiv = GLAD_LAZY_STUB(glTexCoordP3uiv);
+PFNGLTEXCOORDP4UIPROC glad_glTexCoordP4ui = GLAD_LAZY_STUB(glTexCoordP4ui);
+PFNGLTEXCOORDP4UIVPROC glad_glTexCoordP4uiv = GLAD_LAZY_STUB(glTexCoordP4uiv);
+PFNGLTEXCOORDPOINTERPROC glad_glTexCoordPointer = GLAD_LAZY_STUB(glTexCoordPointer);
+PFNGLTEXENVFPROC glad_glTexEnvf = GLAD_LAZY_STUB(glTexEnvf);
+PFNGLTEXENVFVPROC glad_glTexEnvfv = GLAD_LAZY_STUB(glTexEnvfv);
+PFNGLTEXENVIPROC glad_glTexEnvi = GLAD_LAZY_STUB(glTexEnvi);
+PFNGLTEXENVIVPROC glad_glTexEnviv = GLAD_LAZY_STUB(glTexEnviv);
+PFNGLTEXGENDPROC glad_glTexGend = GLAD_LAZY_STUB(glTexGend);
+PFNGLTEXGENDVPROC glad_glTexGendv = GLAD_LAZY_STUB(glTexGendv);
+PFNGLTEXGENFPROC glad_glTexGenf = GLAD_LAZY_STUB(glTexGenf);
+PFNGLTEXGENFVPROC glad_glTexGenfv = GLAD_LAZY_STUB(glTexGenfv);
+PFNGLTEXGENIPROC glad_glTexGeni = GLAD_LAZY_STUB(glTexGeni);
+PFNGLTEXGENIVPROC glad_glTexGeniv = GLAD_LAZY_STUB(glTexGeniv);
+PFNGLTEXIMAGE1DPROC glad_glTexImage1D = GLAD_LAZY_STUB(glTexImage1D);
+PFNGLTEXIMAGE2DPROC glad_glTexImage2D = GLAD_LAZY_STUB(glTexImage2D);
+PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_glTexImage2DMultisample = GLAD_LAZY_STUB(glTexImage2DMultisample);
+PFNGLTEXIMAGE3DPROC glad_glTexImage3D = GLAD_LAZY_STUB(glTexImage3D);
+PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_glTexImage3DMultisample = GLAD_LAZY_STUB(glTexImage3DMultisample);
+PFNGLTEXPARAMETERIIVPROC glad_glTexParameterIiv = GLAD_LAZY_STUB(glTexParameterIiv);
+PFNGLTEXPARAMETERIUIVPROC glad_glTexParameterIuiv = GLAD_LAZY_STUB(glTexParameterIuiv);
+PFNGLTEXPARAMETERFPROC glad_glTexParameterf = GLAD_LAZY_STUB(glTexParameterf);
+PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv = GLAD_LAZY_STUB(glTexParameterfv);
+PFNGLTEXPARAMETERIPROC glad_glTexParameteri = GLAD_LAZY_STUB(glTexParameteri);
+PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv = GLAD_LAZY_STUB(glTexParameteriv);
+PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D = GLAD_LAZY_STUB(glTexSubImage1D);
+PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D = GLAD_LAZY_STUB(glTexSubImage2D);
+PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D = GLAD_LAZY_STUB(glTexSubImage3D);
+PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings = GLAD_LAZY_STUB(glTransformFeedbackVaryings);
+PFNGLTRANSLATEDPROC glad_glTranslated = GLAD_LAZY_STUB(glTranslated);
+PFNGLTRANSLATEFPROC glad_glTranslatef = GLAD_LAZY_STUB(glTranslatef);
+PFNGLUNIFORM1FPROC glad_glUniform1f = GLAD_LAZY_STUB(glUniform1f);
+PFNGLUNIFORM1FVPROC glad_glUniform1fv = GLAD_LAZY_STUB(glUniform1fv);
+PFNGLUNIFORM1IPROC glad_glUniform1i = GLAD_LAZY_STUB(glUniform1i);
+PFNGLUNIFORM1IVPROC glad_glUniform1iv = GLAD_LAZY_STUB(glUniform1iv);
+PFNGLUNIFORM1UIPROC glad_glUniform1ui = GLAD_LAZY_STUB(glUniform1ui);
+PFNGLUNIFORM1UIVPROC glad_glUniform1uiv = GLAD_LAZY_STUB(glUniform1uiv);
+PFNGLUNIFORM2FPROC glad_glUniform2f = GLAD_LAZY_STUB(glUniform2f);
+PFNGLUNIFORM2FVPROC glad_glUniform2fv = GLAD_LAZY_STUB(glUniform2fv);
+PFNGLUNIFORM2IPROC glad_glUniform2i = GLAD_LAZY_STUB(glUniform2i);
+PFNGLUNIFORM2IVPROC glad_glUniform2iv = GLAD_LAZY_STUB(glUniform2iv);
+PFNGLUNIFORM2UIPROC glad_glUniform2ui = GLAD_LAZY_STUB(glUniform2ui);
+PFNGLUNIFORM2UIVPROC glad_glUniform2uiv = GLAD_LAZY_STUB(glUniform2uiv);
+PFNGLUNIFORM3FPROC glad_glUniform3f = GLAD_LAZY_STUB(glUniform3f);
+PFNGLUNIFORM3FVPROC glad_glUniform3fv = GLAD_LAZY_STUB(glUniform3fv);
+PFNGLUNIFORM3IPROC glad_glUniform3i = GLAD_LAZY_STUB(glUniform3i);
+PFNGLUNIFORM3IVPROC glad_glUniform3iv = GLAD_LAZY_STUB(glUniform3iv);
+PFNGLUNIFORM3UIPROC glad_glUniform3ui = GLAD_LAZY_STUB(glUniform3ui);
+PFNGLUNIFORM3UIVPROC glad_glUniform3uiv = GLAD_LAZY_STUB(glUniform3uiv);
+PFNGLUNIFORM4FPROC glad_glUniform4f = GLAD_LAZY_STUB(glUniform4f);
+PFNGLUNIFORM4FVPROC glad_glUniform4fv = GLAD_LAZY_STUB(glUniform4fv);
+PFNGLUNIFORM4IPROC glad_glUniform4i = GLAD_LAZY_STUB(glUniform4i);
+PFNGLUNIFORM4IVPROC glad_glUniform4iv = GLAD_LAZY_STUB(glUniform4iv);
+PFNGLUNIFORM4UIPROC glad_glUniform4ui = GLAD_LAZY_STUB(glUniform4ui);
+PFNGLUNIFORM4UIVPROC glad_glUniform4uiv = GLAD_LAZY_STUB(glUniform4uiv);
+PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding = GLAD_LAZY_STUB(glUniformBlockBinding);
+PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv = GLAD_LAZY_STUB(glUniformMatrix2fv);
+PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv = GLAD_LAZY_STUB(glUniformMatrix2x3fv);
+PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv = GLAD_LAZY_STUB(glUniformMatrix2x4fv);
+PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv = GLAD_LAZY_STUB(glUniformMatrix3fv);
+PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv = GLAD_LAZY_STUB(glUniformMatrix3x2fv);
+PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv = GLAD_LAZY_STUB(glUniformMatrix3x4fv);
+PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv = GLAD_LAZY_STUB(glUniformMatrix4fv);
+PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv = GLAD_LAZY_STUB(glUniformMatrix4x2fv);
+PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv = GLAD_LAZY_STUB(glUniformMatrix4x3fv);
+PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer = GLAD_LAZY_STUB(glUnmapBuffer);
+PFNGLUSEPROGRAMPROC glad_glUseProgram = GLAD_LAZY_STUB(glUseProgram);
+PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram = GLAD_LAZY_STUB(glValidateProgram);
+PFNGLVERTEX2DPROC glad_glVertex2d = GLAD_LAZY_STUB(glVertex2d);
+PFNGLVERTEX2DVPROC glad_glVertex2dv = GLAD_LAZY_STUB(glVertex2dv);
+PFNGLVERTEX2FPROC glad_glVertex2f = GLAD_LAZY_STUB(glVertex2f);
+PFNGLVERTEX2FVPROC glad_glVertex2fv = GLAD_LAZY_STUB(glVertex2fv);
+PFNGLVERTEX2IPROC glad_glVertex2i = GLAD_LAZY_STUB(glVertex2i);
+PFNGLVERTEX2IVPROC glad_glVertex2iv = GLAD_LAZY_STUB(glVertex2iv);
+PFNGLVERTEX2SPROC glad_glVertex2s = GLAD_LAZY_STUB(glVertex2s);
+PFNGLVERTEX2SVPROC glad_glVertex2sv = GLAD_LAZY_STUB(glVertex2sv);
+PFNGLVERTEX3DPROC glad_glVertex3d = GLAD_LAZY_STUB(glVertex3d);
+PFNGLVERTEX3DVPROC glad_glVertex3dv = GLAD_LAZY_STUB(glVertex3dv);
+PFNGLVERTEX3FPROC glad_glVertex3f = GLAD_LAZY_STUB(glVertex3f);
+PFNGLVERTEX3FVPROC glad_glVertex3fv = GLAD_LAZY_STUB(glVertex3fv);
+PFNGLVERTEX3IPROC glad_glVertex3i = GLAD_LAZY_STUB(glVertex3i);
+PFNGLVERTEX3IVPROC glad_glVertex3iv = GLAD_LAZY_STUB(glVertex3iv);
+PFNGLVERTEX3SPROC glad_glVertex3s = GLAD_LAZY_STUB(glVertex3s);
+PFNGLVERTEX3SVPROC glad_glVertex3sv = GLAD_LAZY_STUB(glVertex3sv);
+PFNGLVERTEX4DPROC glad_glVertex4d = GLAD_LAZY_STUB(glVertex4d);
+PFNGLVERTEX4DVPROC glad_glVertex4dv = GLAD_LAZY_STUB(glVertex4dv);
+PFNGLVERTEX4FPROC glad_glVertex4f = GLAD_LAZY_STUB(glVertex4f);
+PFNGLVERTEX4FVPROC glad_glVertex4fv = GLAD_LAZY_STUB(glVertex4fv);
+PFNGLVERTEX4IPROC glad_glVertex4i = GLAD_LAZY_STUB(glVertex4i);
+PFNGLVERTEX4IVPROC glad_glVertex4iv = GLAD_LAZY_STUB(glVertex4iv);
+PFNGLVERTEX4SPROC glad_glVertex4s = GLAD_LAZY_STUB(glVertex4s);
+PFNGLVERTEX4SVPROC glad_glVertex4sv = GLAD_LAZY_STUB(glVertex4sv);
+PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d = GLAD_LAZY_STUB(glVertexAttrib1d);
+PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv = GLAD_LAZY_STUB(glVertexAttrib1dv);
+PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f = GLAD_LAZY_STUB(glVertexAttrib1f);
+PFNGLVERTEXATTRIB1FVPROC glad_glVertexAttrib1fv = GLAD_LAZY_STUB(glVertexAttrib1fv);
+PFNGLVERTEXATTRIB1SPROC glad_glVertexAttrib1s = GLAD_LAZY_STUB(glVertexAttrib1s);
+PFNGLVERTEXATTRIB1SVPROC glad_glVertexAttrib1sv = GLAD_LAZY_STUB(glVertexAttrib1sv);
+PFNGLVERTEXATTRIB2DPROC glad_glVertexAttrib2d = GLAD_LAZY_STUB(glVertexAttrib2d);
+PFNGLVERTEXATTRIB2DVPROC glad_glVertexAttrib2dv = GLAD_LAZY_STUB(glVertexAttrib2dv);
+PFNGLVERTEXATTRIB2FPROC glad_glVertexAttrib2f = GLAD_LAZY_STUB(glVertexAttrib2f);
+PFNGLVERTEXATTRIB2FVPROC glad_glVertexAttrib2fv = GLAD_LAZY_STUB(glVertexAttrib2fv);
+PFNGLVERTEXATTRIB2SPROC glad_glVertexAttrib2s = GLAD_LAZY_STUB(glVertexAttrib2s);
+PFNGLVERTEXATTRIB2SVPROC glad_glVertexAttrib2sv = GLAD_LAZY_STUB(glVertexAttrib2sv);
+PFNGLVERTEXATTRIB3DPROC glad_glVertexAttrib3d = GLAD_LAZY_STUB(glVertexAttrib3d);
+PFNGLVERTEXATTRIB3DVPROC glad_glVertexAttrib3dv = GLAD_LAZY_STUB(glVertexAttrib3dv);
+PFNGLVERTEXATTRIB3FPROC glad_glVertexAttrib3f = GLAD_LAZY_STUB(glVertexAttrib3f);
+PFNGLVERTEXATTRIB3FVPROC glad_glVertexAttrib3fv = GLAD_LAZY_STUB(glVertexAttrib3fv);
+PFNGLVERTEXATTRIB3SPROC glad_glVertexAttrib3s = GLAD_LAZY_STUB(glVertexAttrib3s);
+PFNGLVERTEXATTRIB3SVPROC glad_glVertexAttrib3sv = GLAD_LAZY_STUB(glVertexAttrib3sv);
+PFNGLVERTEXATTRIB4NBVPROC glad_glVertexAttrib4Nbv = GLAD_LAZY_STUB(glVertexAttrib4Nbv);
+PFNGLVERTEXATTRIB4NIVPROC glad_glVertexAttrib4Niv = GLAD_LAZY_STUB(glVertexAttrib4Niv);
+PFNGLVERTEXATTRIB4NSVPROC glad_glVertexAttrib4Nsv = GLAD_LAZY_STUB(glVertexAttrib4Nsv);
+PFNGLVERTEXATTRIB4NUBPROC glad_glVertexAttrib4Nub = GLAD_LAZY_STUB(glVertexAttrib4Nub);
+PFNGLVERTEXATTRIB4NUBVPROC glad_glVertexAttrib4Nubv = GLAD_LAZY_STUB(glVertexAttrib4Nubv);
+PFNGLVERTEXATTRIB4NUIVPROC glad_glVertexAttrib4Nuiv = GLAD_LAZY_STUB(glVertexAttrib4Nuiv);
+PFNGLVERTEXATTRIB4NUSVPROC glad_glVertexAttrib4Nusv = GLAD_LAZY_STUB(glVertexAttrib4Nusv);
+PFNGLVERTEXATTRIB4BVPROC glad_glVertexAttrib4bv = GLAD_LAZY_STUB(glVertexAttrib4bv);
+PFNGLVERTEXATTRIB4DPROC glad_glVertexAttrib4d = GLAD_LAZY_STUB(glVertexAttrib4d);
+PFNGLVERTEXATTRIB4DVPROC glad_glVertexAttrib4dv = GLAD_LAZY_STUB(glVertexAttrib4dv);
+PFNGLVERTEXATTRIB4FPROC glad_glVertexAttrib4f = GLAD_LAZY_STUB(glVertexAttrib4f);
+PFNGLVERTEXATTRIB4FVPROC glad_glVertexAttrib4fv = GLAD_LAZY_STUB(glVertexAttrib4fv);
+PFNGLVERTEXATTRIB4IVPROC glad_glVertexAttrib4iv = GLAD_LAZY_STUB(glVertexAttrib4iv);
+PFNGLVERTEXATTRIB4SPROC glad_glVertexAttrib4s = GLAD_LAZY_STUB(glVertexAttrib4s);
+PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv = GLAD_LAZY_STUB(glVertexAttrib4sv);
+PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv = GLAD_LAZY_STUB(glVertexAttrib4ubv);
+PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv = GLAD_LAZY_STUB(glVertexAttrib4uiv);
+PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv = GLAD_LAZY_STUB(glVertexAttrib4usv);
+PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor = GLAD_LAZY_STUB(glVertexAttribDivisor);
+PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i = GLAD_LAZY_STUB(glVertexAttribI1i);
+PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv = GLAD_LAZY_STUB(glVertexAttribI1iv);
+PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui = GLAD_LAZY_STUB(glVertexAttribI1ui);
+PFNGLVERTEXATTRIBI1UIVPROC glad_glVertexAttribI1uiv = GLAD_LAZY_STUB(glVertexAttribI1uiv);
+PFNGLVERTEXATTRIBI2IPROC glad_glVertexAttribI2i = GLAD_LAZY_STUB(glVertexAttribI2i);
+PFNGLVERTEXATTRIBI2IVPROC glad_glVertexAttribI2iv = GLAD_LAZY_STUB(glVertexAttribI2iv);
+PFNGLVERTEXATTRIBI2UIPROC glad_glVertexAttribI2ui = GLAD_LAZY_STUB(glVertexAttribI2ui);
+PFNGLVERTEXATTRIBI2UIVPROC glad_glVertexAttribI2uiv = GLAD_LAZY_STUB(glVertexAttribI2uiv);
+PFNGLVERTEXATTRIBI3IPROC glad_glVertexAttribI3i = GLAD_LAZY_STUB(glVertexAttribI3i);
+PFNGLVERTEXATTRIBI3IVPROC glad_glVertexAttribI3iv = GLAD_LAZY_STUB(glVertexAttribI3iv);
+PFNGLVERTEXATTRIBI3UIPROC glad_glVertexAttribI3ui = GLAD_LAZY_STUB(glVertexAttribI3ui);
+PFNGLVERTEXATTRIBI3UIVPROC glad_glVertexAttribI3uiv = GLAD_LAZY_STUB(glVertexAttribI3uiv);
+PFNGLVERTEXATTRIBI4BVPROC glad_glVertexAttribI4bv = GLAD_LAZY_STUB(glVertexAttribI4bv);
+PFNGLVERTEXATTRIBI4IPROC glad_glVertexAttribI4i = GLAD_LAZY_STUB(glVertexAttribI4i);
+PFNGLVERTEXATTRIBI4IVPROC glad_glVertexAttribI4iv = GLAD_LAZY_STUB(glVertexAttribI4iv);
+PFNGLVERTEXATTRIBI4SVPROC glad_glVertexAttribI4sv = GLAD_LAZY_STUB(glVertexAttribI4sv);
+PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv = GLAD_LAZY_STUB(glVertexAttribI4ubv);
+PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui = GLAD_LAZY_STUB(glVertexAttribI4ui);
+PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv = GLAD_LAZY_STUB(glVertexAttribI4uiv);
+PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv = GLAD_LAZY_STUB(glVertexAttribI4usv);
+PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer = GLAD_LAZY_STUB(glVertexAttribIPointer);
+PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui = GLAD_LAZY_STUB(glVertexAttribP1ui);
+PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv = GLAD_LAZY_STUB(glVertexAttribP1uiv);
+PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui = GLAD_LAZY_STUB(glVertexAttribP2ui);
+PFNGLVERTEXATTRIBP2UIVPROC glad_glVertexAttribP2uiv = GLAD_LAZY_STUB(glVertexAttribP2uiv);
+PFNGLVERTEXATTRIBP3UIPROC glad_glVertexAttribP3ui = GLAD_LAZY_STUB(glVertexAttribP3ui);
+PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv = GLAD_LAZY_STUB(glVertexAttribP3uiv);
+PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui = GLAD_LAZY_STUB(glVertexAttribP4ui);
+PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv = GLAD_LAZY_STUB(glVertexAttribP4uiv);
+PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer = GLAD_LAZY_STUB(glVertexAttribPointer);
+PFNGLVERTEXP2UIPROC glad_glVertexP2ui = GLAD_LAZY_STUB(glVertexP2ui);
+PFNGLVERTEXP2UIVPROC glad_glVertexP2uiv = GLAD_LAZY_STUB(glVertexP2uiv);
+PFNGLVERTEXP3UIPROC glad_glVertexP3ui = GLAD_LAZY_STUB(glVertexP3ui);
+PFNGLVERTEXP3UIVPROC glad_glVertexP3uiv = GLAD_LAZY_STUB(glVertexP3uiv);
+PFNGLVERTEXP4UIPROC glad_glVertexP4ui = GLAD_LAZY_STUB(glVertexP4ui);
+PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv = GLAD_LAZY_STUB(glVertexP4uiv);
+PFNGLVERTEXPOINTERPROC glad_glVertexPointer = GLAD_LAZY_STUB(glVertexPointer);
+PFNGLVIEWPORTPROC glad_glViewport = GLAD_LAZY_STUB(glViewport);
+PFNGLWAITSYNCPROC glad_glWaitSync = GLAD_LAZY_STUB(glWaitSync);
+PFNGLWINDOWPOS2DPROC glad_glWindowPos2d = GLAD_LAZY_STUB(glWindowPos2d);
+PFNGLWINDOWPOS2DVPROC glad_glWindowPos2dv = GLAD_LAZY_STUB(glWindowPos2dv);
+PFNGLWINDOWPOS2FPROC glad_glWindowPos2f = GLAD_LAZY_STUB(glWindowPos2f);
+PFNGLWINDOWPOS2FVPROC glad_glWindowPos2fv = GLAD_LAZY_STUB(glWindowPos2fv);
+PFNGLWINDOWPOS2IPROC glad_glWindowPos2i = GLAD_LAZY_STUB(glWindowPos2i);
+PFNGLWINDOWPOS2IVPROC glad_glWindowPos2iv = GLAD_LAZY_STUB(glWindowPos2iv);
+PFNGLWINDOWPOS2SPROC glad_glWindowPos2s = GLAD_LAZY_STUB(glWindowPos2s);
+PFNGLWINDOWPOS2SVPROC glad_glWindowPos2sv = GLAD_LAZY_STUB(glWindowPos2sv);
+PFNGLWINDOWPOS3DPROC glad_glWindowPos3d = GLAD_LAZY_STUB(glWindowPos3d);
+PFNGLWINDOWPOS3DVPROC glad_glWindowPos3dv = GLAD_LAZY_STUB(glWindowPos3dv);
+PFNGLWINDOWPOS3FPROC glad_glWindowPos3f = GLAD_LAZY_STUB(glWindowPos3f);
+PFNGLWINDOWPOS3FVPROC glad_glWindowPos3fv = GLAD_LAZY_STUB(glWindowPos3fv);
+PFNGLWINDOWPOS3IPROC glad_glWindowPos3i = GLAD_LAZY_STUB(glWindowPos3i);
+PFNGLWINDOWPOS3IVPROC glad_glWindowPos3iv = GLAD_LAZY_STUB(glWindowPos3iv);
+PFNGLWINDOWPOS3SPROC glad_glWindowPos3s = GLAD_LAZY_STUB(glWindowPos3s);
+PFNGLWINDOWPOS3SVPROC glad_glWindowPos3sv = GLAD_LAZY_STUB(glWindowPos3sv);
+#ifndef GLAD_LAZY_LOAD
 static void load_GL_VERSION_1_0(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_0) return;
 	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
@@ -1754,10 +3155,12 @@ static void load_GL_VERSION_3_3(GLADloadproc load) {
 	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
 	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
 }
+#endif /* GLAD_LAZY_LOAD */
+/* This build was generated with --extensions="" and loads no extensions: there is no GLAD_GL_<extension> flag
+ * to set and no has_ext() query to make, so the extension list is not read at all (on GL 3+ reading it is one
+ * glGetStringi() per extension). A hashed has_ext() with a process-wide cache was tried here and removed:
+ * with nothing looking an extension up, it only added work. */
 static int find_extensionsGL(void) {
-	if (!get_exts()) return 0;
-	(void)&has_ext;
-	free_exts();
 	return 1;
 }
 
@@ -1817,10 +3220,20 @@ static void find_coreGL(void) {
 
 int gladLoadGLLoader(GLADloadproc load) {
 	GLVersion.major = 0; GLVersion.minor = 0;
+#ifdef GLAD_LAZY_LOAD
+	glad_lazy_reset(); /* pointers patched with the previous loader would keep its entry points */
+	glad_lazy_loader = load;
+#endif
 	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
-	if(glGetString == NULL) return 0;
+	if(glGetString == NULL) {
+#ifdef GLAD_LAZY_LOAD
+		glGetString = glad_lazy_glGetString; /* never NULL in lazy mode */
+#endif
+		return 0;
+	}
 	if(glGetString(GL_VERSION) == NULL) return 0;
 	find_coreGL();
+#ifndef GLAD_LAZY_LOAD
 	load_GL_VERSION_1_0(load);
 	load_GL_VERSION_1_1(load);
 	load_GL_VERSION_1_2(load);
@@ -1833,6 +3246,7 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_VERSION_3_1(load);
 	load_GL_VERSION_3_2(load);
 	load_GL_VERSION_3_3(load);
+#endif
 
 	if (!find_extensionsGL()) return 0;
 	return GLVersion.major != 0 || GLVersion.minor != 0;
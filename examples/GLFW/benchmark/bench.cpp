@@ -0,0 +1,417 @@
+// Headless benchmark suite: CPU-only workloads of the ImGui examples and of the pencil app stroke code.
+// No window and no GL context are created, draw data is consumed by the null renderer backend (imgui_impl_null),
+// which only counts vertices/indices/commands/texture uploads, and optionally records the demo frames to a file.
+// Results are written as JSON so they can be stored and compared per commit.
+//
+// Build (Linux, from this folder):
+//   cmake -S . -B build && cmake --build build
+// Usage: ./build/bench [--filter <substring>] [--iterations <n>] [--out <file.json>] [--record <frames.imdd>]
+
+#define IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui.h"
+#include "imgui_internal.h"
+#include "imgui_impl_null.h"
+#include "strokes.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifndef BENCH_GIT_COMMIT
+#define BENCH_GIT_COMMIT "unknown"
+#endif
+#ifndef BENCH_UNITY_BUILD
+#define BENCH_UNITY_BUILD 0
+#endif
+#ifndef BENCH_PGO
+#define BENCH_PGO "OFF"
+#endif
+#ifndef BENCH_CONFIG_PROFILE
+#define BENCH_CONFIG_PROFILE "default"
+#endif
+
+static double NowMs()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+// --- Measurement ----------------------------------------------------------
+
+struct BenchResult
+{
+    std::string name;
+    std::vector<double> samples_ms;
+    std::vector<std::pair<std::string, double>> counters; // Per iteration values (vertices, points...)
+};
+
+struct BenchOptions
+{
+    const char* filter = NULL;
+    int iterations = 0; // 0: use each workload's default
+    const char* out_path = NULL;
+    const char* record_path = NULL; // Dump the demo frames with imgui_impl_null, for offline renderer replay
+};
+
+static BenchOptions g_options;
+static std::vector<BenchResult> g_results;
+
+static bool BenchEnabled(const char* name)
+{
+    return g_options.filter == NULL || strstr(name, g_options.filter) != NULL;
+}
+
+// Time 'iterations' calls of 'func' after 'warmup' untimed calls
+template<typename FUNC>
+static BenchResult& Measure(const char* name, int iterations, int warmup, FUNC func)
+{
+    if (g_options.iterations > 0)
+        iterations = g_options.iterations;
+    for (int n = 0; n < warmup; n++)
+        func();
+
+    BenchResult result;
+    result.name = name;
+    result.samples_ms.reserve(iterations);
+    for (int n = 0; n < iterations; n++)
+    {
+        const double t0 = NowMs();
+        func();
+        result.samples_ms.push_back(NowMs() - t0);
+    }
+    g_results.push_back(result);
+    fprintf(stderr, "%-24s %8.4f ms/iteration\n", name, result.samples_ms.empty() ? 0.0 : result.samples_ms[result.samples_ms.size() / 2]);
+    return g_results.back();
+}
+
+// --- Workloads ------------------------------------------------------------
+
+static void SetupHeadlessContext(const char* record_path = NULL)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.LogFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    if (!ImGui_ImplNull_Init(record_path))
+    {
+        fprintf(stderr, "Can't open %s, not recording\n", record_path);
+        ImGui_ImplNull_Init();
+    }
+}
+
+static void ShutdownHeadlessContext()
+{
+    ImGui_ImplNull_Shutdown();
+    ImGui::DestroyContext();
+}
+
+static void ShowDemoFrameContents()
+{
+    ImGui::ShowDemoWindow();
+    ImGui::SetNextWindowPos(ImVec2(1300, 20), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(600, 1000), ImGuiCond_FirstUseEver);
+    ImGui::Begin("Dear ImGui Style Editor");
+    ImGui::ShowStyleEditor();
+    ImGui::End();
+}
+
+// Full demo frames: NewFrame() -> demo window + style editor -> Render()
+static void BenchDemoFrame()
+{
+    if (!BenchEnabled("imgui_demo_frame"))
+        return;
+    SetupHeadlessContext(g_options.record_path);
+    ImGuiIO& io = ImGui::GetIO();
+
+    // First frame creates the windows, then open the main sections so the frame is representative
+    ImGui_ImplNull_NewFrame();
+    ImGui::NewFrame();
+    ShowDemoFrameContents();
+    ImGui::Render();
+    ImGui_ImplNull_RenderDrawData(ImGui::GetDrawData());
+    ImGui::SetWindowSize("Dear ImGui Demo", ImVec2(1280, 1000));
+    ImGuiWindow* demo_window = ImGui::FindWindowByName("Dear ImGui Demo"); // NULL with IMGUI_DISABLE_DEMO_WINDOWS
+    const char* sections[] = { "Widgets", "Layout & Scrolling", "Tables & Columns" };
+    for (const char* section : sections)
+        if (demo_window != NULL)
+            demo_window->StateStorage.SetInt(ImHashStr(section, 0, demo_window->ID), 1);
+
+    // The recording covers every frame, the counters only the measured ones (ResetStats() keeps DumpBytesWritten)
+    const ImGui_ImplNull_Stats* stats = ImGui_ImplNull_GetStats();
+    const int setup_frames = stats->Frames;
+    ImGui_ImplNull_ResetStats();
+    BenchResult& result = Measure("imgui_demo_frame", 500, 10, [&]()
+    {
+        io.MousePos = ImVec2(-FLT_MAX, -FLT_MAX);
+        ImGui_ImplNull_NewFrame();
+        ImGui::NewFrame();
+        ShowDemoFrameContents();
+        ImGui::Render();
+        ImGui_ImplNull_RenderDrawData(ImGui::GetDrawData());
+    });
+    result.counters.push_back({ "vertices", (double)stats->LastVtxCount });
+    result.counters.push_back({ "indices", (double)stats->LastIdxCount });
+    result.counters.push_back({ "commands", (double)stats->LastCmdCount });
+    result.counters.push_back({ "texture_bytes", (double)stats->TextureBytesUploaded });
+    if (g_options.record_path != NULL)
+        fprintf(stderr, "recorded %d frames to %s (%.1f MB)\n", setup_frames + stats->Frames, g_options.record_path, stats->DumpBytesWritten / (1024.0 * 1024.0));
+    ShutdownHeadlessContext();
+}
+
+// ImDrawList primitives: thick anti-aliased polylines, filled circles, curves, rounded rectangles and text
+static void BenchDrawListTessellation()
+{
+    if (!BenchEnabled("drawlist_tessellation"))
+        return;
+    SetupHeadlessContext();
+    ImGui::NewFrame(); // Sets up shared draw list data (font, texture uv)
+
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    std::vector<ImVec2> polyline(2000);
+    for (size_t n = 0; n < polyline.size(); n++)
+    {
+        const float t = (float)n / (float)polyline.size() * 2.0f * IM_PI;
+        polyline[n] = ImVec2(960.0f + 800.0f * ImSin(t * 3.0f), 540.0f + 450.0f * ImSin(t * 4.0f));
+    }
+
+    int vtx_count = 0;
+    BenchResult& result = Measure("drawlist_tessellation", 500, 10, [&]()
+    {
+        draw_list._ResetForNewFrame();
+        draw_list.PushClipRectFullScreen();
+        draw_list.PushTexture(ImGui::GetIO().Fonts->TexRef);
+        draw_list.AddPolyline(polyline.data(), (int)polyline.size(), IM_COL32(255, 200, 0, 255), ImDrawFlags_None, 3.0f);
+        draw_list.AddPolyline(polyline.data(), 500, IM_COL32(0, 200, 255, 255), ImDrawFlags_Closed, 1.0f);
+        for (int n = 0; n < 200; n++)
+        {
+            const ImVec2 p((float)(n % 20) * 90.0f + 40.0f, (float)(n / 20) * 100.0f + 40.0f);
+            draw_list.AddCircleFilled(p, 30.0f, IM_COL32(255, 0, 0, 128));
+            draw_list.AddCircle(p, 34.0f, IM_COL32(255, 255, 255, 255), 0, 2.0f);
+            draw_list.AddRectFilled(p - ImVec2(40, 40), p + ImVec2(40, 40), IM_COL32(0, 255, 0, 64), 8.0f);
+            draw_list.AddBezierCubic(p, p + ImVec2(30, -60), p + ImVec2(60, 60), p + ImVec2(90, 0), IM_COL32(255, 255, 255, 255), 1.5f);
+            draw_list.AddText(p, IM_COL32_WHITE, "The quick brown fox jumps over the lazy dog");
+        }
+        draw_list.PopTexture();
+        draw_list.PopClipRect();
+        vtx_count = draw_list.VtxBuffer.Size;
+    });
+    result.counters.push_back({ "vertices", (double)vtx_count });
+    ImGui::EndFrame();
+    ShutdownHeadlessContext();
+}
+
+// Font atlas creation from the embedded default font, including rasterization of the default glyph ranges
+static void BenchFontAtlasBuild()
+{
+    if (!BenchEnabled("font_atlas_build"))
+        return;
+    int tex_w = 0, tex_h = 0;
+    BenchResult& result = Measure("font_atlas_build", 50, 2, [&]()
+    {
+        ImFontAtlas* atlas = IM_NEW(ImFontAtlas)();
+        atlas->AddFontDefault();
+        ImFontAtlasBuildMain(atlas);
+        tex_w = atlas->TexData->Width;
+        tex_h = atlas->TexData->Height;
+        IM_DELETE(atlas);
+    });
+    result.counters.push_back({ "texture_bytes", (double)tex_w * tex_h * 4 });
+}
+
+// Synthetic mouse input: 200 strokes of 5000 samples following a curve, with sub-pixel jitter.
+// Every 4th sample repeats the previous position, like a mouse reporting without moving.
+static const int kStrokes = 200, kSamplesPerStroke = 5000;
+
+static std::vector<StrokeSample> MakeStrokeSamples()
+{
+    std::vector<StrokeSample> samples((size_t)kStrokes * kSamplesPerStroke);
+    unsigned int seed = 12345;
+    for (int s = 0; s < kStrokes; s++)
+        for (int n = 0; n < kSamplesPerStroke; n++)
+        {
+            const size_t i = (size_t)s * kSamplesPerStroke + n;
+            if (n % 4 == 3)
+            {
+                samples[i] = samples[i - 1];
+                continue;
+            }
+            seed = seed * 1664525u + 1013904223u;
+            const double t = (double)n / kSamplesPerStroke * 6.2831853;
+            const double jitter = (double)(seed >> 16) / 65536.0 - 0.5;
+            samples[i].x = 400.0 + 300.0 * std::sin(t * (1 + s % 3)) + jitter;
+            samples[i].y = 300.0 + 250.0 * std::cos(t) + jitter;
+        }
+    return samples;
+}
+
+// Pencil app input path: window coordinates -> NDC, distance threshold filter, stroke commit.
+// stroke_processing: one sample per call through the global functions (what the GLFW callbacks do);
+// stroke_builder_batch: StrokeBuilder::feed() with all the samples of a stroke at once. Both must keep the same points.
+static void BenchStrokeProcessing()
+{
+    const bool per_sample = BenchEnabled("stroke_processing");
+    const bool batch = BenchEnabled("stroke_builder_batch");
+    if (!per_sample && !batch)
+        return;
+    const std::vector<StrokeSample> samples = MakeStrokeSamples();
+
+    // Reference result, also the first workload
+    g_win_w = 800; g_win_h = 600;
+    auto run_per_sample = [&]()
+    {
+        strokes_clear();
+        for (int s = 0; s < kStrokes; s++)
+        {
+            const StrokeSample* sample = &samples[(size_t)s * kSamplesPerStroke];
+            stroke_begin(sample[0].x, sample[0].y);
+            for (int n = 1; n < kSamplesPerStroke; n++)
+                stroke_add_point(sample[n].x, sample[n].y);
+            stroke_end();
+        }
+    };
+    size_t points = 0;
+    if (per_sample)
+    {
+        BenchResult& result = Measure("stroke_processing", 50, 2, [&]()
+        {
+            run_per_sample();
+            points = 0;
+            for (const std::vector<Vec2>& stroke : g_strokes)
+                points += stroke.size();
+        });
+        result.counters.push_back({ "samples", (double)kStrokes * kSamplesPerStroke });
+        result.counters.push_back({ "points_kept", (double)points });
+    }
+
+    if (batch)
+    {
+        run_per_sample();
+        StrokeBuilder builder(800, 600);
+        BenchResult& result = Measure("stroke_builder_batch", 50, 2, [&]()
+        {
+            builder.clear();
+            for (int s = 0; s < kStrokes; s++)
+            {
+                const StrokeSample* sample = &samples[(size_t)s * kSamplesPerStroke];
+                builder.begin(sample[0].x, sample[0].y);
+                builder.feed(sample + 1, kSamplesPerStroke - 1);
+                builder.end();
+            }
+        });
+        points = 0;
+        bool same = builder.strokes().size() == g_strokes.size();
+        for (size_t s = 0; same && s < g_strokes.size(); s++)
+        {
+            same = builder.strokes()[s].size() == g_strokes[s].size() &&
+                memcmp(builder.strokes()[s].data(), g_strokes[s].data(), g_strokes[s].size() * sizeof(Vec2)) == 0;
+            points += g_strokes[s].size();
+        }
+        if (!same)
+            fprintf(stderr, "stroke_builder_batch: points differ from stroke_add_point()\n");
+        result.counters.push_back({ "samples", (double)kStrokes * kSamplesPerStroke });
+        result.counters.push_back({ "points_kept", (double)points });
+        result.counters.push_back({ "matches_reference", same ? 1.0 : 0.0 });
+    }
+    strokes_clear();
+}
+
+// --- Output ---------------------------------------------------------------
+
+static void WriteJson(FILE* f)
+{
+    fprintf(f, "{\n");
+    fprintf(f, "  \"suite\": \"glfw-headless\",\n");
+    fprintf(f, "  \"commit\": \"%s\",\n", BENCH_GIT_COMMIT);
+    fprintf(f, "  \"imgui_version\": \"%s\",\n", IMGUI_VERSION);
+#if defined(__clang__)
+    fprintf(f, "  \"compiler\": \"clang %s\",\n", __clang_version__);
+#elif defined(__GNUC__)
+    fprintf(f, "  \"compiler\": \"gcc %s\",\n", __VERSION__);
+#elif defined(_MSC_VER)
+    fprintf(f, "  \"compiler\": \"msvc %d\",\n", _MSC_VER);
+#endif
+    fprintf(f, "  \"unity_build\": %s,\n", BENCH_UNITY_BUILD ? "true" : "false");
+    fprintf(f, "  \"pgo\": \"%s\",\n", BENCH_PGO);
+    fprintf(f, "  \"config_profile\": \"%s\",\n", BENCH_CONFIG_PROFILE);
+#ifdef NDEBUG
+    fprintf(f, "  \"assertions\": false,\n");
+#else
+    fprintf(f, "  \"assertions\": true,\n");
+#endif
+    fprintf(f, "  \"benchmarks\": [\n");
+    for (size_t r = 0; r < g_results.size(); r++)
+    {
+        BenchResult& result = g_results[r];
+        std::vector<double> sorted = result.samples_ms;
+        std::sort(sorted.begin(), sorted.end());
+        double mean = 0.0, variance = 0.0;
+        for (double sample : sorted)
+            mean += sample;
+        mean /= sorted.empty() ? 1 : sorted.size();
+        for (double sample : sorted)
+            variance += (sample - mean) * (sample - mean);
+        variance /= sorted.empty() ? 1 : sorted.size();
+
+        fprintf(f, "    {\n");
+        fprintf(f, "      \"name\": \"%s\",\n", result.name.c_str());
+        fprintf(f, "      \"iterations\": %d,\n", (int)sorted.size());
+        if (!sorted.empty())
+        {
+            fprintf(f, "      \"min_ms\": %.6f,\n", sorted.front());
+            fprintf(f, "      \"median_ms\": %.6f,\n", sorted[sorted.size() / 2]);
+            fprintf(f, "      \"mean_ms\": %.6f,\n", mean);
+            fprintf(f, "      \"max_ms\": %.6f,\n", sorted.back());
+            fprintf(f, "      \"stddev_ms\": %.6f,\n", std::sqrt(variance));
+        }
+        fprintf(f, "      \"counters\": {");
+        for (size_t c = 0; c < result.counters.size(); c++)
+            fprintf(f, "%s\"%s\": %.0f", c ? ", " : " ", result.counters[c].first.c_str(), result.counters[c].second);
+        fprintf(f, "%s}\n", result.counters.empty() ? "" : " ");
+        fprintf(f, "    }%s\n", r + 1 < g_results.size() ? "," : "");
+    }
+    fprintf(f, "  ]\n");
+    fprintf(f, "}\n");
+}
+
+int main(int argc, char** argv)
+{
+    for (int n = 1; n < argc; n++)
+    {
+        if (strcmp(argv[n], "--filter") == 0 && n + 1 < argc)
+            g_options.filter = argv[++n];
+        else if (strcmp(argv[n], "--iterations") == 0 && n + 1 < argc)
+            g_options.iterations = atoi(argv[++n]);
+        else if (strcmp(argv[n], "--out") == 0 && n + 1 < argc)
+            g_options.out_path = argv[++n];
+        else if (strcmp(argv[n], "--record") == 0 && n + 1 < argc)
+            g_options.record_path = argv[++n];
+        else
+        {
+            fprintf(stderr, "Usage: %s [--filter <substring>] [--iterations <n>] [--out <file.json>] [--record <frames.imdd>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    BenchDemoFrame();
+    BenchDrawListTessellation();
+    BenchFontAtlasBuild();
+    BenchStrokeProcessing();
+
+    FILE* f = g_options.out_path ? fopen(g_options.out_path, "w") : stdout;
+    if (f == NULL)
+    {
+        fprintf(stderr, "Can't open %s\n", g_options.out_path);
+        return 1;
+    }
+    WriteJson(f);
+    if (f != stdout)
+        fclose(f);
+    return 0;
+}
@@ -0,0 +1,72 @@
+// Frame benchmark: a palette editor showing 16 hue wheel color pickers at once.
+// Measures the CPU cost of building the frame (NewFrame..Render), draw data is not submitted anywhere.
+//
+// Build (Linux, from this folder):
+//   g++ -O2 -std=c++11 -I"../GLFW + VSC + IMGUI/GLFW_VSC/Libraries/imgui" color_pickers.cpp
+//     "../GLFW + VSC + IMGUI/GLFW_VSC/Libraries/imgui/"imgui{,_draw,_tables,_widgets}.cpp -o color_pickers
+// Usage: ./color_pickers [frames]
+
+#include "imgui.h"
+#include "imgui_internal.h"     // ImFontAtlasBuildMain
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+static double NowMs()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+int main(int argc, char** argv)
+{
+    const int frames = argc > 1 ? atoi(argv[1]) : 1000;
+    const int pickers = 16;
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    ImFontAtlasBuildMain(io.Fonts);
+
+    static float colors[pickers][4];
+    for (int n = 0; n < pickers; n++)
+    {
+        ImGui::ColorConvertHSVtoRGB(n / (float)pickers, 0.8f, 0.9f, colors[n][0], colors[n][1], colors[n][2]);
+        colors[n][3] = 1.0f;
+    }
+
+    double total_ms = 0.0;
+    int vtx_count = 0, idx_count = 0;
+    for (int frame = 0; frame < frames + 1; frame++)
+    {
+        const double t0 = NowMs();
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0, 0));
+        ImGui::SetNextWindowSize(io.DisplaySize);
+        ImGui::Begin("Palette", NULL, ImGuiWindowFlags_NoDecoration);
+        for (int n = 0; n < pickers; n++)
+        {
+            ImGui::PushID(n);
+            if (n % 4 != 0)
+                ImGui::SameLine();
+            ImGui::SetNextItemWidth(400.0f);
+            ImGui::ColorPicker4("##picker", colors[n], ImGuiColorEditFlags_PickerHueWheel | ImGuiColorEditFlags_NoInputs | ImGuiColorEditFlags_NoSidePreview);
+            ImGui::PopID();
+        }
+        ImGui::End();
+        ImGui::Render();
+        if (frame > 0) // First frame is warm-up
+            total_ms += NowMs() - t0;
+
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        vtx_count = draw_data->TotalVtxCount;
+        idx_count = draw_data->TotalIdxCount;
+    }
+    printf("%d pickers, %d frames: %.4f ms/frame (%d vertices, %d indices)\n", pickers, frames, total_ms / frames, vtx_count, idx_count);
+
+    ImGui::DestroyContext();
+    return 0;
+}
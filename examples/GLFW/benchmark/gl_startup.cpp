@@ -0,0 +1,133 @@
+// Startup benchmark: time from a fresh GL context to the first finished frame of the triangle example,
+// with glad resolving every entry point up front (default) or on first call (GLAD_LAZY_LOAD).
+// Then creates more contexts one after the other (like headless render workers) and times gladLoadGLLoader() for each.
+// Runs headless on Mesa through an EGL surfaceless context (llvmpipe software rasterizer), rendering into an FBO.
+//
+// Build (Linux, from this folder):
+//   g++ -O2 -I"../GLFW + VSC + IMGUI/GLFW_VSC/Libraries/include" gl_startup.cpp
+//     -x c "../GLFW + VSC + IMGUI/GLFW_VSC/glad.c" -o gl_startup_eager -lEGL -ldl
+//   (same with -DGLAD_LAZY_LOAD -o gl_startup_lazy)
+// Usage: EGL_PLATFORM=surfaceless ./gl_startup_eager [contexts]
+
+#include <glad/glad.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+static double NowMs()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+static int g_resolved = 0;
+static void* CountingLoader(const char* name)
+{
+    g_resolved++;
+    return (void*)eglGetProcAddress(name);
+}
+
+static const char* vertexShaderSource = "#version 330 core\n"
+"layout (location = 0) in vec3 aPos;\n"
+"void main() { gl_Position = vec4(aPos, 1.0); }\0";
+static const char* fragmentShaderSource = "#version 330 core\n"
+"out vec4 FragColor;\n"
+"void main() { FragColor = vec4(0.8f, 0.3f, 0.02f, 1.0f); }\n\0";
+
+int main(int argc, char** argv)
+{
+    const int contexts = argc > 1 ? atoi(argv[1]) : 20;
+
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    EGLDisplay display = getPlatformDisplay ? getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL) : eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (!eglInitialize(display, NULL, NULL))
+    {
+        fprintf(stderr, "eglInitialize failed\n");
+        return 1;
+    }
+    eglBindAPI(EGL_OPENGL_API);
+    const EGLint contextAttribs[] = { EGL_CONTEXT_MAJOR_VERSION, 3, EGL_CONTEXT_MINOR_VERSION, 3, EGL_NONE };
+    EGLContext context = eglCreateContext(display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, contextAttribs);
+    if (context == EGL_NO_CONTEXT || !eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+    {
+        fprintf(stderr, "Failed to create a GL 3.3 context\n");
+        return 1;
+    }
+
+    const double t0 = NowMs();
+    gladLoadGLLoader(CountingLoader);
+    const double t1 = NowMs();
+
+    // First frame of the triangle example, into an offscreen framebuffer
+    GLuint fbo, colorBuffer;
+    glGenFramebuffers(1, &fbo);
+    glGenRenderbuffers(1, &colorBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, colorBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, 800, 800);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorBuffer);
+    glViewport(0, 0, 800, 800);
+
+    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
+    glCompileShader(vertexShader);
+    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
+    glCompileShader(fragmentShader);
+    GLuint shaderProgram = glCreateProgram();
+    glAttachShader(shaderProgram, vertexShader);
+    glAttachShader(shaderProgram, fragmentShader);
+    glLinkProgram(shaderProgram);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    GLfloat vertices[] = { -0.5f, -0.5f, 0.0f, 0.5f, -0.5f, 0.0f, 0.0f, 0.5f, 0.0f };
+    GLuint VAO, VBO;
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    glClearColor(0.07f, 0.13f, 0.17f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glUseProgram(shaderProgram);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    unsigned char pixel[4];
+    glReadPixels(400, 400, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+    const double t2 = NowMs();
+
+    printf("%s\n", (const char*)glGetString(GL_RENDERER));
+    printf("gladLoadGLLoader: %.3f ms, first frame: %.3f ms, total: %.3f ms\n", t1 - t0, t2 - t1, t2 - t0);
+    printf("entry points resolved: %d, center pixel: %d,%d,%d\n", g_resolved, pixel[0], pixel[1], pixel[2]);
+
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteBuffers(1, &VBO);
+    glDeleteProgram(shaderProgram);
+    glDeleteRenderbuffers(1, &colorBuffer);
+    glDeleteFramebuffers(1, &fbo);
+    eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroyContext(display, context);
+
+    // Following contexts on the same driver
+    double reload_ms = 0.0;
+    for (int n = 0; n < contexts; n++)
+    {
+        context = eglCreateContext(display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, contextAttribs);
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context);
+        const double t3 = NowMs();
+        gladLoadGLLoader(CountingLoader);
+        reload_ms += NowMs() - t3;
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        eglDestroyContext(display, context);
+    }
+    if (contexts > 0)
+        printf("gladLoadGLLoader on %d more contexts: %.3f ms average\n", contexts, reload_ms / contexts);
+    eglTerminate(display);
+    return 0;
+}
@@ -0,0 +1,10 @@
+// Single translation unit ("unity"/"jumbo") build of the Dear ImGui library, used when configuring with -DIMGUI_UNITY_BUILD=ON.
+// The compiler then sees every hot helper (ImHashStr, ImDrawList::PrimWriteVtx, ImTextCharFromUtf8...) in the same unit
+// as its callers and can inline across what would otherwise be separate object files, without needing LTO.
+
+#include "imgui.cpp"
+#include "imgui_demo.cpp"
+#include "imgui_draw.cpp"
+#include "imgui_tables.cpp"
+#include "imgui_widgets.cpp"
+#include "imgui_impl_null.cpp"
@@ -0,0 +1,43 @@
+// Layout report of the hot structs of the drawing app and of the ImGui render data: offsets, padding, cache line spans
+// (struct_layout.h, from examples/basics). The static_asserts fail the build when a struct grows a hole.
+//
+// Build (Linux, from this folder):
+//   cmake -S . -B build && cmake --build build --target layout_report
+// Usage: ./build/layout_report
+
+#include "imgui.h"
+#include "strokes.h"
+#include "struct_layout.h"
+
+// Stroke points: 8 bytes, 8 per cache line
+constexpr auto layoutVec2 = layout::describe<Vec2>("Vec2 (stroke point)",
+    { LAYOUT_FIELD(Vec2, x), LAYOUT_FIELD(Vec2, y) });
+
+// Vertex buffer element: pos, uv, col
+constexpr auto layoutImDrawVert = layout::describe<ImDrawVert>("ImDrawVert",
+    { LAYOUT_FIELD(ImDrawVert, pos), LAYOUT_FIELD(ImDrawVert, uv), LAYOUT_FIELD(ImDrawVert, col) });
+
+// Command buffer element, walked by every renderer backend once per draw call
+constexpr auto layoutImDrawCmd = layout::describe<ImDrawCmd>("ImDrawCmd",
+    { LAYOUT_FIELD(ImDrawCmd, ClipRect), LAYOUT_FIELD(ImDrawCmd, TexRef), LAYOUT_FIELD(ImDrawCmd, VtxOffset),
+      LAYOUT_FIELD(ImDrawCmd, IdxOffset), LAYOUT_FIELD(ImDrawCmd, ElemCount), LAYOUT_FIELD(ImDrawCmd, UserCallback),
+      LAYOUT_FIELD(ImDrawCmd, UserCallbackData), LAYOUT_FIELD(ImDrawCmd, UserCallbackDataSize),
+      LAYOUT_FIELD(ImDrawCmd, UserCallbackDataOffset) });
+
+// ImGuiStorage element (binary searched by key): the value is a union of int/float/pointer, reported as val_p
+constexpr auto layoutImGuiStoragePair = layout::describe<ImGuiStoragePair>("ImGuiStoragePair",
+    { LAYOUT_FIELD(ImGuiStoragePair, key), LAYOUT_FIELD(ImGuiStoragePair, val_p),
+      LAYOUT_FIELD(ImGuiStoragePair, val_i), LAYOUT_FIELD(ImGuiStoragePair, val_f) });
+
+static_assert(layoutVec2.paddingBytes() == 0, "Vec2 has padding");
+static_assert(layoutImDrawVert.paddingBytes() == 0, "ImDrawVert has padding");
+static_assert(layoutImDrawCmd.packedSize() == sizeof(ImDrawCmd), "ImDrawCmd could be made smaller by reordering its fields");
+
+int main()
+{
+    layout::printReport(layoutVec2);
+    layout::printReport(layoutImDrawVert);
+    layout::printReport(layoutImDrawCmd);
+    layout::printReport(layoutImGuiStoragePair);
+    return 0;
+}
@@ -0,0 +1,33 @@
+#!/bin/sh
+# Builds the benchmark suite three ways and compares the median frame times:
+#   default (one object per ImGui source), unity (IMGUI_UNITY_BUILD) and unity + PGO trained on the demo frames.
+# Usage (from this folder): sh pgo.sh [build root, default: build-configs]
+set -e
+ROOT="${1:-build-configs}"
+
+build() # <dir> <cmake args...>
+{
+    dir="$1"; shift
+    cmake -S . -B "$ROOT/$dir" "$@" > /dev/null
+    cmake --build "$ROOT/$dir" -j > /dev/null
+}
+
+build default -DIMGUI_UNITY_BUILD=OFF -DIMGUI_PGO=OFF
+build unity -DIMGUI_UNITY_BUILD=ON -DIMGUI_PGO=OFF
+build unity-pgo -DIMGUI_UNITY_BUILD=ON -DIMGUI_PGO=GENERATE
+cmake --build "$ROOT/unity-pgo" --target pgo_train > /dev/null
+build unity-pgo -DIMGUI_UNITY_BUILD=ON -DIMGUI_PGO=USE
+
+for dir in default unity unity-pgo; do
+    "$ROOT/$dir/bench" --out "$ROOT/$dir/bench.json" 2> /dev/null
+done
+
+# One line per workload: median ms of each build, then the gain of unity+PGO over default
+printf "%-24s %12s %12s %12s %8s\n" workload default unity unity-pgo gain
+for name in $(sed -n 's/.*"name": "\(.*\)".*/\1/p' "$ROOT/default/bench.json"); do
+    medians=""
+    for dir in default unity unity-pgo; do
+        medians="$medians $(sed -n "/\"name\": \"$name\"/,/median_ms/s/.*\"median_ms\": \([0-9.]*\).*/\1/p" "$ROOT/$dir/bench.json")"
+    done
+    echo "$name$medians" | awk '{ printf "%-24s %12.4f %12.4f %12.4f %7.1f%%\n", $1, $2, $3, $4, ($2 - $4) / $2 * 100 }'
+done
@@ -0,0 +1,20 @@
+#!/bin/sh
+# Builds tool_frame with each imconfig.h profile (IMGUI_CONFIG_PROFILE) and compares binary size, startup time and frame time.
+# Startup (context + font atlas + first frame) and frame time are the best of 5 runs.
+# Usage (from this folder): sh profiles.sh [build root, default: build-profiles]
+set -e
+ROOT="${1:-build-profiles}"
+
+printf "%-12s %14s %12s %12s %10s\n" profile stripped_bytes startup_ms frame_ms idx_bytes
+for profile in default lean lean_idx32; do
+    cmake -S . -B "$ROOT/$profile" -DIMGUI_CONFIG_PROFILE=$profile > /dev/null
+    cmake --build "$ROOT/$profile" --target tool_frame -j > /dev/null
+    strip -o "$ROOT/$profile/tool_frame.stripped" "$ROOT/$profile/tool_frame"
+    size=$(wc -c < "$ROOT/$profile/tool_frame.stripped")
+    # "startup X ms, N frames: Y ms/frame (V vertices, I indices of B bytes)": best startup and best frame time of 5 runs
+    for run in 1 2 3 4 5; do "$ROOT/$profile/tool_frame"; done | awk -v profile=$profile -v size=$size '
+        NR == 1 || $2 < startup { startup = $2 }
+        NR == 1 || $6 < frame { frame = $6 }
+        { idx = $13 }
+        END { printf "%-12s %14d %12.3f %12.4f %10d\n", profile, size, startup, frame, idx }'
+done
@@ -0,0 +1,450 @@
+// Renderer benchmark: replays frames recorded by imgui_impl_null (e.g. 'bench --record demo.imdd') into
+// ImGui_ImplOpenGL3_RenderDrawData(), in a loop, on an offscreen context. Nothing but the renderer backend runs,
+// so changes to imgui_impl_opengl3 can be measured on real frames with stable numbers.
+// Runs headless on Mesa through an EGL surfaceless context (llvmpipe software rasterizer), rendering into an FBO.
+//
+// Build (Linux, from this folder):
+//   cmake -S . -B build && cmake --build build --target replay_gl
+// Usage: EGL_PLATFORM=surfaceless ./build/replay_gl <frames.imdd> [loops]
+//
+// - Texture events are applied in order during the first pass only (warm-up), later passes only draw.
+// - 'submit' is the time spent in ImGui_ImplOpenGL3_RenderDrawData(), 'frame' also waits for the GPU (glFinish).
+// - The checksum of the last frame's pixels is printed, to check that a renderer change doesn't change the output.
+
+#include "imgui.h"
+#include "imgui_impl_null.h"
+#include "imgui_impl_opengl3.h"
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GL/gl.h>
+
+#include <algorithm>
+#include <climits>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <vector>
+
+#ifndef GL_FRAMEBUFFER
+#define GL_FRAMEBUFFER          0x8D40
+#define GL_RENDERBUFFER         0x8D41
+#define GL_COLOR_ATTACHMENT0    0x8CE0
+#endif
+typedef void (*PFN_GenObjects)(GLsizei n, GLuint* ids);
+typedef void (*PFN_BindObject)(GLenum target, GLuint id);
+typedef void (*PFN_RenderbufferStorage)(GLenum target, GLenum internalformat, GLsizei width, GLsizei height);
+typedef void (*PFN_FramebufferRenderbuffer)(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer);
+
+static double NowMs()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+// --- Dump loading ---------------------------------------------------------
+
+struct TexEvent
+{
+    ImGui_ImplNull_DumpTexEvent desc;
+    const unsigned char* pixels;        // Points into the file data
+};
+
+struct Frame
+{
+    ImDrawData draw_data;
+    std::vector<ImDrawList*> draw_lists;
+    std::vector<TexEvent> tex_events;
+    std::vector<std::pair<ImDrawCmd*, ImU32>> tex_cmds; // Commands to point to the replayed textures once they exist
+};
+
+struct Replay
+{
+    std::vector<unsigned char> file_data;
+    std::vector<Frame*> frames;
+    std::map<ImU32, ImTextureData*> textures;   // Recorded TexID -> replayed texture
+    int unresolved_cmds = 0;                    // Commands using a texture which wasn't recorded (user textures)
+};
+
+// Records are copied out of the file data: they aren't aligned in it (e.g. after Alpha8 pixels)
+template<typename T>
+static bool Read(const std::vector<unsigned char>& data, size_t& offset, T* out)
+{
+    if (offset > data.size() || sizeof(T) > data.size() - offset)
+        return false;
+    memcpy(out, data.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+}
+
+// 'count' elements of 'size' bytes, left in place (only memcpy'd from): returns NULL if the file is too short
+static const unsigned char* ReadArray(const std::vector<unsigned char>& data, size_t& offset, size_t size, size_t count)
+{
+    if (offset > data.size() || count > (data.size() - offset) / size) // count comes from the file: don't overflow
+        return NULL;
+    const unsigned char* p = data.data() + offset;
+    offset += size * count;
+    return p;
+}
+
+// Texture events must stay inside their texture: CopyPixels() writes through ImTextureData::GetPixelsAt()
+static bool CheckTexEvent(const ImGui_ImplNull_DumpTexEvent& ev, std::map<ImU32, std::pair<int, int>>& sizes)
+{
+    if (ev.Type == ImGui_ImplNull_DumpTexEventType_Destroy)
+        return true;
+    if (ev.Format != ImTextureFormat_Alpha8 && ev.Format != ImTextureFormat_RGBA32)
+        return false;
+    if (ev.Width <= 0 || ev.Height <= 0 || ev.Width > 0xFFFF || ev.Height > 0xFFFF) // ImTextureRect is 16-bit
+        return false;
+    if (ev.X < 0 || ev.Y < 0 || ev.W < 0 || ev.H < 0 || ev.W > ev.Width - ev.X || ev.H > ev.Height - ev.Y)
+        return false;
+    if (ev.Type == ImGui_ImplNull_DumpTexEventType_Create)
+    {
+        sizes[ev.TexID] = std::make_pair(ev.Width, ev.Height);
+        return true;
+    }
+    std::map<ImU32, std::pair<int, int>>::const_iterator it = sizes.find(ev.TexID);
+    return ev.Type == ImGui_ImplNull_DumpTexEventType_Update && it != sizes.end() && it->second == std::make_pair(ev.Width, ev.Height);
+}
+
+static bool LoadDump(const char* filename, Replay& replay)
+{
+    FILE* f = fopen(filename, "rb");
+    if (f == NULL)
+    {
+        fprintf(stderr, "Can't open %s\n", filename);
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    replay.file_data.resize((size_t)ftell(f));
+    fseek(f, 0, SEEK_SET);
+    const size_t read_size = fread(replay.file_data.data(), 1, replay.file_data.size(), f);
+    fclose(f);
+    if (read_size != replay.file_data.size())
+        return false;
+
+    const std::vector<unsigned char>& data = replay.file_data;
+    size_t offset = 0;
+    ImGui_ImplNull_DumpHeader header;
+    if (!Read(data, offset, &header) || memcmp(header.Magic, "IMDD", 4) != 0 || header.Version != IMGUI_IMPL_NULL_DUMP_VERSION)
+    {
+        fprintf(stderr, "%s: not a frame dump, or unsupported version\n", filename);
+        return false;
+    }
+    if (header.VtxSize != sizeof(ImDrawVert) || header.IdxSize != sizeof(ImDrawIdx))
+    {
+        fprintf(stderr, "%s: recorded with sizeof(ImDrawVert) = %u, sizeof(ImDrawIdx) = %u, this build has %d, %d\n", filename, header.VtxSize, header.IdxSize, (int)sizeof(ImDrawVert), (int)sizeof(ImDrawIdx));
+        return false;
+    }
+
+    std::map<ImU32, std::pair<int, int>> tex_sizes; // TexID -> Width, Height of its last Create event
+    while (offset < data.size())
+    {
+        ImGui_ImplNull_DumpFrame frame_desc;
+        if (!Read(data, offset, &frame_desc) || frame_desc.Magic != IMGUI_IMPL_NULL_DUMP_FRAME_MAGIC)
+            break;
+        Frame* frame = new Frame();
+        replay.frames.push_back(frame);
+        const int frame_n = (int)replay.frames.size() - 1;
+
+        for (ImU32 n = 0; n < frame_desc.TexEventsCount; n++)
+        {
+            TexEvent ev;
+            if (!Read(data, offset, &ev.desc))
+            {
+                fprintf(stderr, "%s: truncated frame %d\n", filename, frame_n);
+                return false;
+            }
+            if (!CheckTexEvent(ev.desc, tex_sizes))
+            {
+                fprintf(stderr, "%s: frame %d: invalid event for texture %u (%dx%d, rect %d,%d %dx%d)\n", filename, frame_n,
+                    ev.desc.TexID, ev.desc.Width, ev.desc.Height, ev.desc.X, ev.desc.Y, ev.desc.W, ev.desc.H);
+                return false;
+            }
+            ev.pixels = NULL;
+            if (ev.desc.Type != ImGui_ImplNull_DumpTexEventType_Destroy)
+            {
+                const int bytes_per_pixel = (ev.desc.Format == ImTextureFormat_Alpha8) ? 1 : 4;
+                ev.pixels = ReadArray(data, offset, bytes_per_pixel, (size_t)ev.desc.W * (size_t)ev.desc.H);
+                if (ev.pixels == NULL)
+                {
+                    fprintf(stderr, "%s: truncated frame %d\n", filename, frame_n);
+                    return false;
+                }
+            }
+            frame->tex_events.push_back(ev);
+        }
+
+        ImDrawData& draw_data = frame->draw_data;
+        draw_data.Valid = true;
+        draw_data.DisplayPos = ImVec2(frame_desc.DisplayPos[0], frame_desc.DisplayPos[1]);
+        draw_data.DisplaySize = ImVec2(frame_desc.DisplaySize[0], frame_desc.DisplaySize[1]);
+        draw_data.FramebufferScale = ImVec2(frame_desc.FramebufferScale[0], frame_desc.FramebufferScale[1]);
+        for (ImU32 n = 0; n < frame_desc.CmdListsCount; n++)
+        {
+            ImGui_ImplNull_DumpCmdList list_desc;
+            const bool has_list = Read(data, offset, &list_desc);
+            const unsigned char* vtx = has_list ? ReadArray(data, offset, sizeof(ImDrawVert), list_desc.VtxCount) : NULL;
+            const unsigned char* idx = vtx ? ReadArray(data, offset, sizeof(ImDrawIdx), list_desc.IdxCount) : NULL;
+            const unsigned char* cmds = idx ? ReadArray(data, offset, sizeof(ImGui_ImplNull_DumpCmd), list_desc.CmdCount) : NULL;
+            if (cmds == NULL)
+            {
+                fprintf(stderr, "%s: truncated frame %d\n", filename, frame_n);
+                return false;
+            }
+            if (list_desc.VtxCount > INT_MAX || list_desc.IdxCount > INT_MAX || list_desc.CmdCount > INT_MAX)
+            {
+                fprintf(stderr, "%s: frame %d: draw list too large\n", filename, frame_n);
+                return false;
+            }
+
+            ImDrawList* draw_list = IM_NEW(ImDrawList)(NULL);
+            frame->draw_lists.push_back(draw_list);
+            draw_list->VtxBuffer.resize((int)list_desc.VtxCount);
+            draw_list->IdxBuffer.resize((int)list_desc.IdxCount);
+            memcpy(draw_list->VtxBuffer.Data, vtx, list_desc.VtxCount * sizeof(ImDrawVert));
+            memcpy(draw_list->IdxBuffer.Data, idx, list_desc.IdxCount * sizeof(ImDrawIdx));
+            draw_list->CmdBuffer.reserve((int)list_desc.CmdCount);
+            for (ImU32 cmd_n = 0; cmd_n < list_desc.CmdCount; cmd_n++)
+            {
+                ImGui_ImplNull_DumpCmd cmd_desc;
+                memcpy(&cmd_desc, cmds + cmd_n * sizeof(ImGui_ImplNull_DumpCmd), sizeof(cmd_desc));
+                if ((cmd_desc.Flags & ImGui_ImplNull_DumpCmdFlags_UserCallback) && !(cmd_desc.Flags & ImGui_ImplNull_DumpCmdFlags_ResetRenderState))
+                    continue; // User callbacks can't be replayed
+
+                // The renderer reads IdxBuffer[IdxOffset, IdxOffset + ElemCount) and the vertices they point to (+ VtxOffset)
+                bool in_range = (ImU64)cmd_desc.IdxOffset + cmd_desc.ElemCount <= list_desc.IdxCount;
+                for (ImU32 i = 0; in_range && i < cmd_desc.ElemCount; i++)
+                    in_range = (ImU64)draw_list->IdxBuffer.Data[cmd_desc.IdxOffset + i] + cmd_desc.VtxOffset < list_desc.VtxCount;
+                if (!in_range)
+                {
+                    fprintf(stderr, "%s: frame %d: command %u reads outside its draw list\n", filename, frame_n, cmd_n);
+                    return false;
+                }
+
+                ImDrawCmd cmd;
+                cmd.ClipRect = ImVec4(cmd_desc.ClipRect[0], cmd_desc.ClipRect[1], cmd_desc.ClipRect[2], cmd_desc.ClipRect[3]);
+                cmd.VtxOffset = cmd_desc.VtxOffset;
+                cmd.IdxOffset = cmd_desc.IdxOffset;
+                cmd.ElemCount = cmd_desc.ElemCount;
+                if (cmd_desc.Flags & ImGui_ImplNull_DumpCmdFlags_ResetRenderState)
+                    cmd.UserCallback = ImDrawCallback_ResetRenderState;
+                draw_list->CmdBuffer.push_back(cmd);
+                if (cmd.UserCallback == NULL)
+                    frame->tex_cmds.push_back({ &draw_list->CmdBuffer.back(), (ImU32)cmd_desc.TexID });
+            }
+            draw_data.AddDrawList(draw_list);
+        }
+    }
+    if (offset != data.size())
+        fprintf(stderr, "%s: ignoring %d trailing bytes\n", filename, (int)(data.size() - offset));
+    return !replay.frames.empty();
+}
+
+// --- Replay ---------------------------------------------------------------
+
+// Copy recorded pixels into the texture, converting to RGBA32 (the only format imgui_impl_opengl3 takes)
+static void CopyPixels(ImTextureData* tex, const TexEvent& ev)
+{
+    for (int y = 0; y < ev.desc.H; y++)
+    {
+        unsigned char* dst = (unsigned char*)tex->GetPixelsAt(ev.desc.X, ev.desc.Y + y);
+        if (ev.desc.Format == ImTextureFormat_Alpha8)
+        {
+            const unsigned char* src = ev.pixels + (size_t)y * ev.desc.W;
+            for (int x = 0; x < ev.desc.W; x++, dst += 4)
+                dst[0] = dst[1] = dst[2] = 255, dst[3] = src[x];
+        }
+        else
+        {
+            memcpy(dst, ev.pixels + (size_t)y * ev.desc.W * 4, (size_t)ev.desc.W * 4);
+        }
+    }
+}
+
+// Turn the recorded texture events into requests for the renderer backend, as ImGui would have done
+static void ApplyTexEvents(Replay& replay, Frame& frame, ImVector<ImTextureData*>& requests)
+{
+    requests.resize(0);
+    for (const TexEvent& ev : frame.tex_events)
+    {
+        ImTextureData*& tex = replay.textures[ev.desc.TexID];
+        if (ev.desc.Type == ImGui_ImplNull_DumpTexEventType_Create)
+        {
+            if (tex == NULL)
+                tex = IM_NEW(ImTextureData)();
+            tex->Create(ImTextureFormat_RGBA32, ev.desc.Width, ev.desc.Height);
+            tex->Status = ImTextureStatus_WantCreate;
+            CopyPixels(tex, ev);
+        }
+        else if (ev.desc.Type == ImGui_ImplNull_DumpTexEventType_Update && tex != NULL)
+        {
+            CopyPixels(tex, ev);
+            if (tex->Status != ImTextureStatus_WantCreate)
+            {
+                ImTextureRect rect = { (unsigned short)ev.desc.X, (unsigned short)ev.desc.Y, (unsigned short)ev.desc.W, (unsigned short)ev.desc.H };
+                tex->Updates.push_back(rect);
+                tex->Status = ImTextureStatus_WantUpdates;
+            }
+        }
+        // Destroy events are ignored: later passes replay the commands which used the texture again.
+        if (tex != NULL && tex->Status != ImTextureStatus_OK && !requests.contains(tex))
+            requests.push_back(tex);
+    }
+}
+
+static void ResolveTextures(Replay& replay, Frame& frame)
+{
+    for (std::pair<ImDrawCmd*, ImU32>& tex_cmd : frame.tex_cmds)
+    {
+        std::map<ImU32, ImTextureData*>::iterator it = replay.textures.find(tex_cmd.second);
+        if (it == replay.textures.end())
+            it = replay.textures.begin(); // Unknown texture: use the first one so the draw call still happens
+        if (it == replay.textures.end())
+            continue;
+        if (it->first != tex_cmd.second)
+            replay.unresolved_cmds++;
+        tex_cmd.first->TexRef = it->second->GetTexRef();
+    }
+    frame.tex_cmds.clear();
+}
+
+static unsigned int ChecksumPixels(int w, int h)
+{
+    std::vector<unsigned char> pixels((size_t)w * h * 4);
+    glReadPixels(0, 0, w, h, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    unsigned int hash = 2166136261u;
+    for (unsigned char c : pixels)
+        hash = (hash ^ c) * 16777619u;
+    return hash;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: %s <frames.imdd> [loops]\n", argv[0]);
+        return 1;
+    }
+    const int loops = argc > 2 ? atoi(argv[2]) : 10;
+
+    Replay replay;
+    if (!LoadDump(argv[1], replay))
+        return 1;
+
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    EGLDisplay display = getPlatformDisplay ? getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL) : eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (!eglInitialize(display, NULL, NULL))
+    {
+        fprintf(stderr, "eglInitialize failed\n");
+        return 1;
+    }
+    eglBindAPI(EGL_OPENGL_API);
+    const EGLint contextAttribs[] = { EGL_CONTEXT_MAJOR_VERSION, 3, EGL_CONTEXT_MINOR_VERSION, 3, EGL_NONE };
+    EGLContext context = eglCreateContext(display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, contextAttribs);
+    if (context == EGL_NO_CONTEXT || !eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+    {
+        fprintf(stderr, "Failed to create a GL 3.3 context\n");
+        return 1;
+    }
+
+    // Offscreen framebuffer the size of the first recorded frame
+    const ImDrawData& first = replay.frames[0]->draw_data;
+    const int fb_width = (int)(first.DisplaySize.x * first.FramebufferScale.x);
+    const int fb_height = (int)(first.DisplaySize.y * first.FramebufferScale.y);
+    GLuint fbo, colorBuffer;
+    ((PFN_GenObjects)eglGetProcAddress("glGenFramebuffers"))(1, &fbo);
+    ((PFN_GenObjects)eglGetProcAddress("glGenRenderbuffers"))(1, &colorBuffer);
+    ((PFN_BindObject)eglGetProcAddress("glBindRenderbuffer"))(GL_RENDERBUFFER, colorBuffer);
+    ((PFN_RenderbufferStorage)eglGetProcAddress("glRenderbufferStorage"))(GL_RENDERBUFFER, GL_RGBA8, fb_width, fb_height);
+    ((PFN_BindObject)eglGetProcAddress("glBindFramebuffer"))(GL_FRAMEBUFFER, fbo);
+    ((PFN_FramebufferRenderbuffer)eglGetProcAddress("glFramebufferRenderbuffer"))(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorBuffer);
+
+    // The renderer backend stores its data in the ImGui context, nothing else of it is used
+    ImGui::CreateContext();
+    ImGui::GetIO().IniFilename = NULL;
+    if (!ImGui_ImplOpenGL3_Init("#version 330 core"))
+    {
+        fprintf(stderr, "ImGui_ImplOpenGL3_Init failed\n");
+        return 1;
+    }
+    ImGui_ImplOpenGL3_NewFrame();
+    printf("%s, %d frames of %dx%d\n", (const char*)glGetString(GL_RENDERER), (int)replay.frames.size(), fb_width, fb_height);
+
+    ImVector<ImTextureData*> tex_requests;
+    std::vector<double> submit_ms, frame_ms;
+    unsigned int checksum = 0;
+    for (int loop = 0; loop < loops + 1; loop++) // First loop is warm-up and creates the textures
+    {
+        for (Frame* frame : replay.frames)
+        {
+            if (loop == 0)
+            {
+                ApplyTexEvents(replay, *frame, tex_requests);
+                ResolveTextures(replay, *frame);
+                frame->draw_data.Textures = &tex_requests;
+            }
+            else
+            {
+                frame->draw_data.Textures = NULL;
+            }
+
+            const double t0 = NowMs();
+            glViewport(0, 0, fb_width, fb_height);
+            glClearColor(0.45f, 0.55f, 0.60f, 1.00f);
+            glClear(GL_COLOR_BUFFER_BIT);
+            ImGui_ImplOpenGL3_RenderDrawData(&frame->draw_data);
+            const double t1 = NowMs();
+            glFinish();
+            const double t2 = NowMs();
+            if (loop > 0)
+            {
+                submit_ms.push_back(t1 - t0);
+                frame_ms.push_back(t2 - t0);
+            }
+        }
+        if (loop == loops)
+            checksum = ChecksumPixels(fb_width, fb_height);
+    }
+
+    if (!submit_ms.empty())
+    {
+        double submit_total = 0.0, frame_total = 0.0;
+        for (size_t n = 0; n < submit_ms.size(); n++)
+            submit_total += submit_ms[n], frame_total += frame_ms[n];
+        std::sort(submit_ms.begin(), submit_ms.end());
+        std::sort(frame_ms.begin(), frame_ms.end());
+        printf("%d loops: submit %.4f ms/frame (median %.4f), frame %.4f ms/frame (median %.4f)\n", loops,
+            submit_total / submit_ms.size(), submit_ms[submit_ms.size() / 2], frame_total / frame_ms.size(), frame_ms[frame_ms.size() / 2]);
+    }
+    if (replay.unresolved_cmds > 0)
+        printf("%d draw commands used textures which weren't recorded, drawn with texture %u instead\n", replay.unresolved_cmds, replay.textures.begin()->first);
+    printf("last frame checksum: %08x\n", checksum);
+
+    // Release textures then backend, as ImGui_ImplOpenGL3_Shutdown() only knows about the ImGui context's own textures
+    for (std::pair<const ImU32, ImTextureData*>& it : replay.textures)
+    {
+        ImTextureData* tex = it.second;
+        if (tex->Status == ImTextureStatus_OK)
+        {
+            tex->Status = ImTextureStatus_WantDestroy;
+            tex->UnusedFrames = 1;
+            tex->WantDestroyNextFrame = true;
+            ImGui_ImplOpenGL3_UpdateTexture(tex);
+        }
+        IM_DELETE(tex);
+    }
+    for (Frame* frame : replay.frames)
+    {
+        for (ImDrawList* draw_list : frame->draw_lists)
+            IM_DELETE(draw_list);
+        delete frame;
+    }
+    ImGui_ImplOpenGL3_Shutdown();
+    ImGui::DestroyContext();
+    eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroyContext(display, context);
+    eglTerminate(display);
+    return 0;
+}
@@ -0,0 +1,67 @@
+// Startup benchmark: load an .ini with 10k saved windows and 10k saved tables,
+// then instantiate every window once, like an application restoring a large layout.
+//
+// Build (Linux, from this folder):
+//   g++ -O2 -std=c++11 -I"../GLFW + VSC + IMGUI/GLFW_VSC/Libraries/imgui" settings_load.cpp
+//     "../GLFW + VSC + IMGUI/GLFW_VSC/Libraries/imgui/"imgui{,_draw,_tables,_widgets}.cpp -o settings_load
+// Usage: ./settings_load [count]
+
+#include "imgui.h"
+#include "imgui_internal.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+static double NowMs()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+int main(int argc, char** argv)
+{
+    const int count = argc > 1 ? atoi(argv[1]) : 10000;
+
+    ImGuiTextBuffer ini;
+    for (int n = 0; n < count; n++)
+        ini.appendf("[Window][Tool window %d]\nPos=%d,%d\nSize=300,200\nCollapsed=0\n\n", n, n % 1000, n / 1000);
+    for (int n = 0; n < count; n++)
+        ini.appendf("[Table][0x%08X,4]\nColumn 0  Width=100\nColumn 1  Width=80\n\n", ImHashStr("Table", 0, (ImGuiID)n + 1));
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    ImFontAtlasBuildMain(io.Fonts);
+
+    const double t0 = NowMs();
+    ImGui::LoadIniSettingsFromMemory(ini.c_str(), (size_t)ini.size());
+    const double t1 = NowMs();
+
+    // First frame: every window looks up its saved settings
+    ImGui::NewFrame();
+    char name[64];
+    for (int n = 0; n < count; n++)
+    {
+        snprintf(name, sizeof(name), "Tool window %d", n);
+        ImGui::Begin(name);
+        ImGui::End();
+    }
+    ImGui::EndFrame();
+    const double t2 = NowMs();
+
+    // Direct lookups (what table instantiation does)
+    int found = 0;
+    for (int n = 0; n < count; n++)
+        found += ImGui::TableSettingsFindByID(ImHashStr("Table", 0, (ImGuiID)n + 1)) != NULL;
+    const double t3 = NowMs();
+
+    printf("entries: %d windows + %d tables (%d found)\n", count, count, found);
+    printf("load ini:          %9.2f ms\n", t1 - t0);
+    printf("first frame:       %9.2f ms\n", t2 - t1);
+    printf("table lookups:     %9.2f ms\n", t3 - t2);
+    ImGui::DestroyContext();
+    return 0;
+}
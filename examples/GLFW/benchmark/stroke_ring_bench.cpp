@@ -0,0 +1,138 @@
+// Throughput of the shared memory stroke ring (stroke_ring.h) between two processes:
+// a child process writes strokes of 1000 points in APPEND records of 50 points (what a few input events per frame
+// look like), the parent maps the ring by name and reads every point in place, checking the sequence.
+// The writer waits for space instead of dropping, so every point must arrive.
+//
+// Build (Linux, from this folder):
+//   g++ -O2 -std=c++17 -I"../GLFW + VSC + IMGUI - Drawing app/GLFW_VSC" stroke_ring_bench.cpp
+//     "../GLFW + VSC + IMGUI - Drawing app/GLFW_VSC/"{stroke_ring,strokes}.cpp -o stroke_ring_bench
+// Usage: ./stroke_ring_bench [points] [ring KB] [drain]
+//   drain: the reader uses stroke_ring_drain() (copies into stroke vectors, like the apps) instead of reading in place
+
+#include "stroke_ring.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <sched.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+static double NowMs()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+static const uint32_t kStrokePoints = 1000;
+static const uint32_t kBatchPoints = 50;
+
+// Point n of the sequence: exact in float up to 2^24
+static Vec2 PointOf(uint64_t n) { return { (float)(n & 0xFFFFFF), (float)(n / kStrokePoints & 0xFFFF) }; }
+
+static int Writer(const char* name, uint64_t points, size_t ring_bytes)
+{
+    StrokeRing ring;
+    if (!ring.create(name, ring_bytes)) { perror("shm_open"); return 1; }
+    Vec2 batch[kBatchPoints];
+    uint64_t n = 0;
+    while (n < points)
+    {
+        const uint64_t stroke_end = std::min<uint64_t>(n + kStrokePoints, points);
+        bool first = true;
+        while (n < stroke_end)
+        {
+            const uint32_t count = (uint32_t)std::min<uint64_t>(kBatchPoints, stroke_end - n);
+            for (uint32_t i = 0; i < count; i++)
+                batch[i] = PointOf(n + i);
+            while (ring.free_space() < 2 * (sizeof(StrokeRecord) + count * sizeof(Vec2)))
+                sched_yield();
+            if (!(first ? ring.begin(batch, count) : ring.append(batch, count))) { fprintf(stderr, "dropped\n"); return 1; }
+            first = false;
+            n += count;
+        }
+        while (ring.free_space() < 2 * sizeof(StrokeRecord))
+            sched_yield();
+        ring.end();
+    }
+    // Let the reader finish before closing (close() unlinks the name, the mapping stays valid for the reader anyway)
+    while (ring.free_space() < ring_bytes)
+        sched_yield();
+    ring.close();
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    const uint64_t points = argc > 1 ? strtoull(argv[1], nullptr, 10) : 50000000;
+    const size_t ring_bytes = (argc > 2 ? (size_t)atoi(argv[2]) : 4096) << 10;
+    const bool drain = argc > 3 && strcmp(argv[3], "drain") == 0;
+    const std::string name = "/opus_strokes_bench_" + std::to_string(getpid());
+
+    const pid_t child = fork();
+    if (child == 0)
+        _exit(Writer(name.c_str(), points, ring_bytes));
+
+    StrokeRing ring;
+    while (!ring.open(name.c_str()))
+        sched_yield(); // the writer hasn't created it yet
+
+    uint64_t received = 0, records = 0, strokes = 0, errors = 0, empty_polls = 0;
+    std::vector<std::vector<Vec2>> drained;
+    std::vector<Vec2> current;
+    double t0 = 0.0;
+    for (;;)
+    {
+        if (drain)
+        {
+            const size_t n = stroke_ring_drain(ring, drained, current);
+            if (n && t0 == 0.0) t0 = NowMs();
+            records += n;
+            for (const auto& s : drained)
+            {
+                for (const Vec2& p : s)
+                {
+                    const Vec2 expected = PointOf(received++);
+                    errors += memcmp(&p, &expected, sizeof(Vec2)) != 0;
+                }
+                strokes++;
+            }
+            drained.clear();
+        }
+        else
+        {
+            // In place: the points are read straight from the mapping
+            while (const StrokeRecord* r = ring.peek())
+            {
+                if (t0 == 0.0) t0 = NowMs();
+                const Vec2* p = r->points();
+                for (uint32_t i = 0; i < r->count; i++)
+                {
+                    const Vec2 expected = PointOf(received++);
+                    errors += memcmp(&p[i], &expected, sizeof(Vec2)) != 0;
+                }
+                strokes += r->type == STROKE_END;
+                records++;
+                ring.pop();
+            }
+        }
+        if (received == points && ring.writer_closed())
+            break;
+        empty_polls++;
+        sched_yield();
+    }
+    const double ms = NowMs() - t0;
+
+    int status = 0;
+    waitpid(child, &status, 0);
+    printf("%s, ring %zu KB: %llu points in %llu records (%llu strokes), %.1f ms\n",
+        drain ? "drain" : "in place", ring_bytes >> 10, (unsigned long long)received, (unsigned long long)records,
+        (unsigned long long)strokes, ms);
+    printf("  %.1f M points/s, %.0f MB/s of points, %llu empty polls, %llu mismatches, writer exit %d\n",
+        received / ms / 1e3, received * sizeof(Vec2) / ms / 1e3, (unsigned long long)empty_polls,
+        (unsigned long long)errors, WIFEXITED(status) ? WEXITSTATUS(status) : -1);
+    return errors == 0 && received == points && WIFEXITED(status) && WEXITSTATUS(status) == 0 ? 0 : 1;
+}
@@ -0,0 +1,141 @@
+// Production tool benchmark: startup time and frame time of a typical tool UI (menu bar, property editor, clipped table,
+// tree, plot), without the demo. Used to compare the imconfig.h profiles (IMGUI_CONFIG_PROFILE, see profiles.sh).
+//
+// Build (Linux, from this folder):
+//   cmake -S . -B build -DIMGUI_CONFIG_PROFILE=lean && cmake --build build --target tool_frame
+// Usage: ./build/tool_frame [frames]
+
+#include "imgui.h"
+#include "imgui_impl_null.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+static double NowMs()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+struct ToolState
+{
+    float   exposure = 1.0f;
+    float   gamma = 2.2f;
+    int     samples = 64;
+    bool    denoise = true;
+    float   tint[3] = { 1.0f, 0.9f, 0.8f };
+    char    name[64] = "scene_042";
+    float   history[240] = {};
+    int     selected_row = -1;
+};
+
+static void ShowToolFrame(ToolState& state, int frame)
+{
+    const ImGuiViewport* viewport = ImGui::GetMainViewport();
+    ImGui::SetNextWindowPos(viewport->Pos);
+    ImGui::SetNextWindowSize(viewport->Size);
+    ImGui::Begin("Tool", NULL, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_MenuBar);
+    if (ImGui::BeginMenuBar())
+    {
+        if (ImGui::BeginMenu("File")) { ImGui::EndMenu(); }
+        if (ImGui::BeginMenu("Edit")) { ImGui::EndMenu(); }
+        if (ImGui::BeginMenu("View")) { ImGui::EndMenu(); }
+        ImGui::EndMenuBar();
+    }
+
+    // Property editor
+    ImGui::BeginChild("Properties", ImVec2(500, 0), ImGuiChildFlags_Borders);
+    ImGui::InputText("Name", state.name, IM_ARRAYSIZE(state.name));
+    ImGui::SliderFloat("Exposure", &state.exposure, 0.0f, 4.0f);
+    ImGui::DragFloat("Gamma", &state.gamma, 0.01f, 1.0f, 3.0f);
+    ImGui::SliderInt("Samples", &state.samples, 1, 1024);
+    ImGui::Checkbox("Denoise", &state.denoise);
+    ImGui::ColorEdit3("Tint", state.tint);
+    state.history[frame % IM_ARRAYSIZE(state.history)] = sinf(frame * 0.05f) * 0.5f + 0.5f;
+    ImGui::PlotLines("Frame time", state.history, IM_ARRAYSIZE(state.history), frame % IM_ARRAYSIZE(state.history), NULL, 0.0f, 1.0f, ImVec2(0, 120));
+    if (ImGui::TreeNodeEx("Scene", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        for (int n = 0; n < 30; n++)
+        {
+            char label[32];
+            snprintf(label, sizeof(label), "Object %d", n);
+            ImGui::TreeNodeEx(label, ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen);
+        }
+        ImGui::TreePop();
+    }
+    ImGui::EndChild();
+    ImGui::SameLine();
+
+    // Asset table: 10000 rows, only the visible ones are submitted
+    if (ImGui::BeginTable("Assets", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY | ImGuiTableFlags_Resizable | ImGuiTableFlags_Sortable))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("ID");
+        ImGui::TableSetupColumn("Name");
+        ImGui::TableSetupColumn("Size");
+        ImGui::TableSetupColumn("Progress");
+        ImGui::TableHeadersRow();
+        ImGuiListClipper clipper;
+        clipper.Begin(10000);
+        while (clipper.Step())
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                char label[32];
+                snprintf(label, sizeof(label), "%05d", row);
+                if (ImGui::Selectable(label, state.selected_row == row, ImGuiSelectableFlags_SpanAllColumns))
+                    state.selected_row = row;
+                ImGui::TableNextColumn();
+                ImGui::Text("asset_%d.bin", row * 7);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f KB", (row % 97) * 10.5f);
+                ImGui::TableNextColumn();
+                ImGui::ProgressBar((row % 10) / 10.0f, ImVec2(-FLT_MIN, 0));
+            }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+int main(int argc, char** argv)
+{
+    const int frames = argc > 1 ? atoi(argv[1]) : 2000;
+
+    // Startup: context creation, font atlas (built during the first NewFrame()) and first frame
+    const double t0 = NowMs();
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    ImGui_ImplNull_Init();
+    ToolState state;
+    ImGui_ImplNull_NewFrame();
+    ImGui::NewFrame();
+    ShowToolFrame(state, 0);
+    ImGui::Render();
+    ImGui_ImplNull_RenderDrawData(ImGui::GetDrawData());
+    const double startup_ms = NowMs() - t0;
+
+    double total_ms = 0.0;
+    for (int frame = 1; frame <= frames; frame++)
+    {
+        const double t1 = NowMs();
+        ImGui_ImplNull_NewFrame();
+        ImGui::NewFrame();
+        ShowToolFrame(state, frame);
+        ImGui::Render();
+        ImGui_ImplNull_RenderDrawData(ImGui::GetDrawData());
+        total_ms += NowMs() - t1;
+    }
+    const ImGui_ImplNull_Stats* stats = ImGui_ImplNull_GetStats();
+    printf("startup %.3f ms, %d frames: %.4f ms/frame (%d vertices, %d indices of %d bytes)\n",
+        startup_ms, frames, total_ms / frames, stats->LastVtxCount, stats->LastIdxCount, (int)sizeof(ImDrawIdx));
+
+    ImGui_ImplNull_Shutdown();
+    ImGui::DestroyContext();
+    return 0;
+}
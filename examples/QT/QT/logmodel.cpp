@@ -0,0 +1,187 @@
+#include "logmodel.h"
+
+#include <QByteArrayMatcher>
+#include <QTimer>
+
+#include <algorithm>
+
+// Lines scanned between two checks for a newer filter, and between two batches of published ranges
+static const qint64 kScanBatch = 1 << 16;
+
+LogModel::LogModel(QObject *parent)
+    : QAbstractListModel(parent)
+    , shownLines(0)
+    , publishScheduled(false)
+    , generation(0)
+    , matches(0)
+    , scannedTo(0)
+    , scanRunning(false)
+{
+    pool.setMaxThreadCount(1);
+}
+
+LogModel::~LogModel()
+{
+    generation++;
+    pool.waitForDone();
+}
+
+void LogModel::appendLine(const char *text, int size)
+{
+    store.append(text, size);
+    if (!publishScheduled) {
+        publishScheduled = true;
+        QTimer::singleShot(0, this, &LogModel::publishAppended);
+    }
+}
+
+void LogModel::appendLine(const QString &text)
+{
+    const QByteArray utf8 = text.toUtf8();
+    appendLine(utf8.constData(), utf8.size());
+}
+
+void LogModel::publishAppended()
+{
+    publishScheduled = false;
+    const qint64 count = store.count();
+    if (count <= shownLines)
+        return;
+    if (isFiltering()) {
+        shownLines = count;
+        scheduleScan();
+        return;
+    }
+    beginInsertRows(QModelIndex(), (int)shownLines, (int)count - 1);
+    shownLines = count;
+    endInsertRows();
+}
+
+void LogModel::clear()
+{
+    generation++;
+    pool.waitForDone(); // the worker reads the store
+    beginResetModel();
+    store.clear();
+    shownLines = 0;
+    ranges.clear();
+    rangeRows.clear();
+    matches = 0;
+    scannedTo = 0;
+    scanRunning = false;
+    endResetModel();
+}
+
+void LogModel::setFilter(const QString &text)
+{
+    const QByteArray utf8 = text.toUtf8();
+    if (utf8 == needle)
+        return;
+    generation++;
+    beginResetModel();
+    needle = utf8;
+    ranges.clear();
+    rangeRows.clear();
+    matches = 0;
+    scannedTo = 0;
+    scanRunning = false;
+    endResetModel();
+    filterClock.start();
+    scheduleScan();
+}
+
+// One scan at a time, over the lines announced but not scanned yet
+void LogModel::scheduleScan()
+{
+    if (!isFiltering() || scanRunning || scannedTo >= shownLines)
+        return;
+    scanRunning = true;
+    const qint64 begin = scannedTo;
+    const qint64 end = shownLines;
+    const quint64 current = generation.load();
+    const QByteArray pattern = needle;
+    pool.start([this, pattern, begin, end, current] { scan(this, &store, pattern, begin, end, current); });
+}
+
+// Worker thread: only reads lines below 'end' (already in the store) and the generation counter
+void LogModel::scan(LogModel *model, const LogStore *store, QByteArray needle, qint64 begin, qint64 end,
+                    quint64 generation)
+{
+    const QByteArrayMatcher matcher(needle);
+    QVector<Range> found;
+    qint64 line = begin;
+    while (line < end) {
+        const qint64 stop = std::min(end, line + kScanBatch);
+        for (; line < stop; ++line) {
+            int size;
+            const char *text = store->line(line, &size);
+            if (matcher.indexIn(text, size) < 0)
+                continue;
+            if (!found.isEmpty() && found.last().first + found.last().count == line)
+                found.last().count++;
+            else
+                found.append({ line, 1 });
+        }
+        if (model->generation.load() != generation)
+            return;
+        const bool done = line == end;
+        QMetaObject::invokeMethod(model, [model, generation, found, line, done] {
+            model->addMatches(generation, found, line, done);
+        }, Qt::QueuedConnection);
+        found.clear();
+    }
+}
+
+void LogModel::addMatches(quint64 scanGeneration, const QVector<Range> &found, qint64 scanned, bool done)
+{
+    if (scanGeneration != generation.load())
+        return; // the filter changed meanwhile
+
+    qint64 added = 0;
+    for (const Range &range : found)
+        added += range.count;
+    if (added > 0) {
+        beginInsertRows(QModelIndex(), (int)matches, (int)(matches + added) - 1);
+        for (const Range &range : found) {
+            if (!ranges.isEmpty() && ranges.last().first + ranges.last().count == range.first) {
+                ranges.last().count += range.count; // continues the previous batch
+            } else {
+                ranges.append(range);
+                rangeRows.append(matches);
+            }
+            matches += range.count;
+        }
+        endInsertRows();
+    }
+    scannedTo = scanned;
+    emit scanProgress(scannedTo, filterClock.nsecsElapsed() / 1e6);
+
+    if (done) {
+        scanRunning = false;
+        scheduleScan(); // lines appended during the scan
+    }
+}
+
+qint64 LogModel::lineOfRow(qint64 row) const
+{
+    if (!isFiltering())
+        return row;
+    const int n = int(std::upper_bound(rangeRows.begin(), rangeRows.end(), row) - rangeRows.begin()) - 1;
+    return ranges[n].first + (row - rangeRows[n]);
+}
+
+int LogModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid())
+        return 0;
+    return (int)(isFiltering() ? matches : shownLines);
+}
+
+QVariant LogModel::data(const QModelIndex &index, int role) const
+{
+    if (role != Qt::DisplayRole || !index.isValid())
+        return QVariant();
+    int size;
+    const char *text = store.line(lineOfRow(index.row()), &size);
+    return QString::fromUtf8(text, size);
+}
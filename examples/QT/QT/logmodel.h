@@ -0,0 +1,77 @@
+#ifndef LOGMODEL_H
+#define LOGMODEL_H
+
+#include "logstore.h"
+
+#include <QAbstractListModel>
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QThreadPool>
+#include <QVector>
+
+#include <atomic>
+
+// List model over a LogStore, for a QListView with uniform item sizes (the view then only asks for the visible rows).
+// Unfiltered, row n is line n. With a filter, the matching lines are found on a worker thread, which publishes them
+// as ranges of consecutive lines while it scans: rows appear progressively, the UI thread never walks the lines.
+// Lines appended while a filter is active are scanned by the same worker, after the ones already there.
+class LogModel : public QAbstractListModel
+{
+    Q_OBJECT
+public:
+    explicit LogModel(QObject *parent = nullptr);
+    ~LogModel();
+
+    // Rows are added on the next event loop iteration, once for everything appended meanwhile
+    void appendLine(const char *text, int size);
+    void appendLine(const QString &text);
+    void clear();
+
+    // Case sensitive substring; empty shows every line
+    void setFilter(const QString &text);
+    bool isFiltering() const { return !needle.isEmpty(); }
+
+    qint64 lineCount() const { return shownLines; }
+    qint64 matchCount() const { return matches; }
+    qint64 bytes() const { return store.bytes(); }
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+signals:
+    // Filter progress: lines scanned of lineCount(), and the time since setFilter()
+    void scanProgress(qint64 scanned, double ms);
+
+private slots:
+    void publishAppended();
+
+private:
+    struct Range
+    {
+        qint64 first;       // line
+        qint64 count;
+    };
+
+    void scheduleScan();
+    static void scan(LogModel *model, const LogStore *store, QByteArray needle, qint64 begin, qint64 end,
+                     quint64 generation);
+    void addMatches(quint64 scanGeneration, const QVector<Range> &found, qint64 scanned, bool done);
+    qint64 lineOfRow(qint64 row) const;
+
+    LogStore store;
+    qint64 shownLines;              // lines the model has announced (<= store.count())
+    bool publishScheduled;
+
+    // Filter state, owned by the UI thread
+    QByteArray needle;
+    std::atomic<quint64> generation; // bumped by setFilter()/clear(): stale workers stop and their results are dropped
+    QVector<Range> ranges;          // matching lines, in order
+    QVector<qint64> rangeRows;      // first row of each range
+    qint64 matches;
+    qint64 scannedTo;               // lines [0, scannedTo) are in 'ranges'
+    bool scanRunning;
+    QElapsedTimer filterClock;
+    QThreadPool pool;               // one worker: scans run in order, a stale one exits at its next check
+};
+
+#endif // LOGMODEL_H
@@ -0,0 +1,123 @@
+#include "logpanel.h"
+#include "logmodel.h"
+
+#include <QDebug>
+#include <QFontDatabase>
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QLineEdit>
+#include <QListView>
+#include <QPushButton>
+#include <QTimer>
+#include <QVBoxLayout>
+
+#include <algorithm>
+#include <cstdio>
+
+// Lines generated per event loop iteration: about 20 ms of work, the window stays responsive while it fills
+static const qint64 kGenerateBatch = 100000;
+
+LogPanel::LogPanel(QWidget *parent)
+    : QWidget(parent, Qt::Window)
+    , logModel(new LogModel(this))
+    , generateLeft(0)
+    , generated(0)
+    , lastScanMs(0.0)
+{
+    setWindowTitle("Log");
+    resize(900, 600);
+
+    filterEdit = new QLineEdit(this);
+    filterEdit->setPlaceholderText("Filtr (np. ERROR)");
+    QPushButton *generateButton = new QPushButton("Generuj 10M", this);
+    QPushButton *clearButton = new QPushButton("Wyczyść", this);
+
+    // Uniform item sizes: the view computes the geometry of any row from the first one, scrolling through 10M rows
+    // only asks the model for the visible lines
+    view = new QListView(this);
+    view->setModel(logModel);
+    view->setUniformItemSizes(true);
+    view->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    view->setSelectionMode(QAbstractItemView::ExtendedSelection);
+
+    status = new QLabel(this);
+
+    QHBoxLayout *top = new QHBoxLayout;
+    top->addWidget(filterEdit, 1);
+    top->addWidget(generateButton);
+    top->addWidget(clearButton);
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->addLayout(top);
+    layout->addWidget(view, 1);
+    layout->addWidget(status);
+
+    filterDelay = new QTimer(this);
+    filterDelay->setSingleShot(true);
+    filterDelay->setInterval(150);
+    generator = new QTimer(this);
+    generator->setInterval(0);
+
+    connect(filterEdit, &QLineEdit::textChanged, filterDelay, qOverload<>(&QTimer::start));
+    connect(filterDelay, &QTimer::timeout, this, &LogPanel::applyFilter);
+    connect(generator, &QTimer::timeout, this, &LogPanel::generateBatch);
+    connect(generateButton, &QPushButton::clicked, this, [this] { generate(10000000); });
+    connect(clearButton, &QPushButton::clicked, this, [this] {
+        generateLeft = 0;
+        generator->stop();
+        logModel->clear();
+        updateStatus();
+    });
+    connect(logModel, &LogModel::scanProgress, this, [this](qint64, double ms) {
+        lastScanMs = ms;
+        updateStatus();
+    });
+    connect(logModel, &QAbstractItemModel::rowsInserted, this, &LogPanel::updateStatus);
+
+    updateStatus();
+}
+
+void LogPanel::generate(qint64 lines)
+{
+    if (generateLeft == 0)
+        generateClock.start();
+    generateLeft += lines;
+    generator->start();
+}
+
+void LogPanel::generateBatch()
+{
+    static const char *const levels[] = { "INFO ", "INFO ", "INFO ", "DEBUG", "WARN ", "ERROR" };
+    static const char *const sources[] = { "canvas", "pool", "startup", "render", "input" };
+    char line[128];
+    const qint64 count = std::min(generateLeft, kGenerateBatch);
+    for (qint64 n = 0; n < count; ++n, ++generated) {
+        const qint64 ms = generated * 7;
+        const int size = snprintf(line, sizeof(line), "%02d:%02d:%02d.%03d [%s] %-7s event #%lld took %d.%02d ms",
+                                  (int)(ms / 3600000 % 24), (int)(ms / 60000 % 60), (int)(ms / 1000 % 60),
+                                  (int)(ms % 1000), levels[generated % 6], sources[generated % 5],
+                                  (long long)generated, (int)(generated * 31 % 17), (int)(generated * 13 % 100));
+        logModel->appendLine(line, size);
+    }
+    generateLeft -= count;
+    if (generateLeft == 0) {
+        generator->stop();
+        qInfo().noquote() << QString("Log: generated in %1 ms, %2 MB stored")
+                                 .arg(generateClock.elapsed())
+                                 .arg(logModel->bytes() / 1e6, 0, 'f', 1);
+    }
+}
+
+void LogPanel::applyFilter()
+{
+    lastScanMs = 0.0;
+    logModel->setFilter(filterEdit->text());
+    updateStatus();
+}
+
+void LogPanel::updateStatus()
+{
+    QString text = QString("%1 linii, %2 MB").arg(logModel->lineCount()).arg(logModel->bytes() / 1e6, 0, 'f', 1);
+    if (logModel->isFiltering())
+        text += QString(", pasujących: %1 (filtr: %2 ms)").arg(logModel->matchCount()).arg(lastScanMs, 0, 'f', 1);
+    status->setText(text);
+}
@@ -0,0 +1,44 @@
+#ifndef LOGPANEL_H
+#define LOGPANEL_H
+
+#include <QElapsedTimer>
+#include <QWidget>
+
+class LogModel;
+class QLabel;
+class QLineEdit;
+class QListView;
+class QTimer;
+
+// Live log window: a LogModel in a QListView with uniform item sizes, a filter field (applied on a worker thread,
+// see LogModel) and a generator of synthetic lines to try it with millions of rows.
+class LogPanel : public QWidget
+{
+    Q_OBJECT
+public:
+    explicit LogPanel(QWidget *parent = nullptr);
+
+    LogModel *model() const { return logModel; }
+
+    // Appends 'lines' synthetic lines, kGenerateBatch per event loop iteration
+    void generate(qint64 lines);
+
+private slots:
+    void generateBatch();
+    void applyFilter();
+    void updateStatus();
+
+private:
+    LogModel *logModel;
+    QListView *view;
+    QLineEdit *filterEdit;
+    QLabel *status;
+    QTimer *filterDelay;            // typing restarts it, the filter is applied when it fires
+    QTimer *generator;
+    qint64 generateLeft;
+    qint64 generated;
+    QElapsedTimer generateClock;
+    double lastScanMs;
+};
+
+#endif // LOGPANEL_H
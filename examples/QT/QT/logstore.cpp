@@ -0,0 +1,52 @@
+#include "logstore.h"
+
+#include <cstring>
+
+LogStore::LogStore()
+    : chunks(new Chunk *[kMaxChunks]())
+    , lines(0)
+    , published(0)
+    , textBytes(0)
+{
+}
+
+LogStore::~LogStore()
+{
+    clear();
+}
+
+bool LogStore::append(const char *text, int size)
+{
+    const qint64 chunkIndex = lines / kChunkLines;
+    if (chunkIndex >= kMaxChunks)
+        return false;
+    Chunk *&chunk = chunks[chunkIndex];
+    if (!chunk)
+        chunk = new Chunk();
+
+    if (size > kMaxLineBytes)
+        size = kMaxLineBytes;
+    if (chunk->blockUsed + size > kBlockBytes) { // lines never straddle two blocks
+        chunk->blocks[chunk->blockCount++].reset(new char[kBlockBytes]);
+        chunk->blockUsed = 0;
+    }
+    const int block = chunk->blockCount - 1;
+    memcpy(chunk->blocks[block].get() + chunk->blockUsed, text, size);
+    chunk->lines[lines % kChunkLines] = { (quint32)(block * kBlockBytes + chunk->blockUsed), (quint32)size };
+    chunk->blockUsed += size;
+    textBytes += size;
+
+    published.store(++lines, std::memory_order_release);
+    return true;
+}
+
+void LogStore::clear()
+{
+    for (qint64 n = 0; n < kMaxChunks && chunks[n]; n++) {
+        delete chunks[n];
+        chunks[n] = nullptr;
+    }
+    lines = 0;
+    textBytes = 0;
+    published.store(0, std::memory_order_release);
+}
@@ -0,0 +1,66 @@
+#ifndef LOGSTORE_H
+#define LOGSTORE_H
+
+#include <QtGlobal>
+
+#include <atomic>
+#include <memory>
+
+// Append-only storage for millions of log lines (UTF-8 bytes, no per-line allocation):
+//  - lines are grouped in chunks of kChunkLines, so line n is in chunk n / kChunkLines;
+//  - a chunk keeps its text in 1 MB blocks and one (offset, size) pair per line, nothing ever moves or is freed
+//    until clear();
+//  - one thread appends (the UI thread), any number of threads read lines below count(): a line is fully written
+//    before count() includes it, which is what the background filter relies on.
+class LogStore
+{
+public:
+    static const int kChunkLines = 16384;
+    static const int kBlockBytes = 1 << 20;
+    static const int kMaxLineBytes = 4096;      // longer lines are truncated
+    static const int kMaxChunks = 1 << 14;      // 268M lines
+
+    LogStore();
+    ~LogStore();
+
+    // Returns false when the store is full
+    bool append(const char *text, int size);
+
+    qint64 count() const { return published.load(std::memory_order_acquire); }
+    qint64 bytes() const { return textBytes; }
+
+    // Line 'index' < count(); the pointer stays valid until clear()
+    const char *line(qint64 index, int *size) const
+    {
+        const Chunk *chunk = chunks[index / kChunkLines];
+        const LineRef &ref = chunk->lines[index % kChunkLines];
+        *size = (int)ref.size;
+        return chunk->blocks[ref.offset / kBlockBytes].get() + ref.offset % kBlockBytes;
+    }
+
+    // Not thread safe: no reader may be running
+    void clear();
+
+private:
+    struct LineRef
+    {
+        quint32 offset;     // block * kBlockBytes + position in the block
+        quint32 size;
+    };
+
+    // kChunkLines * kMaxLineBytes bytes at most: 64 blocks always hold a whole chunk
+    struct Chunk
+    {
+        LineRef lines[kChunkLines];
+        std::unique_ptr<char[]> blocks[kChunkLines / (kBlockBytes / kMaxLineBytes)];
+        int blockCount = 0;
+        int blockUsed = kBlockBytes;   // bytes used in the last block
+    };
+
+    std::unique_ptr<Chunk *[]> chunks;  // fixed directory, never reallocated while readers run
+    qint64 lines;                       // appended (owner thread)
+    std::atomic<qint64> published;      // visible to readers
+    qint64 textBytes;
+};
+
+#endif // LOGSTORE_H
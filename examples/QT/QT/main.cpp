@@ -1,23 +1,50 @@
 #include "mainwindow.h"
+#include "startuptiming.h"
+#include "translations_index.h"
 
 #include <QApplication>
 #include <QLocale>
+#include <QSurfaceFormat>
 #include <QTranslator>
 
+// Embedded translation for the first UI language that has one, from the table generated at build time:
+// string compares only, the resource is opened once by translator.load().
+static const char *findTranslation(const QStringList &uiLanguages)
+{
+    for (const QString &locale : uiLanguages) {
+        const QByteArray name = QLocale(locale).name().toLatin1();
+        for (const TranslationEntry *entry = kTranslations; entry->locale; ++entry)
+            if (name == entry->locale)
+                return entry->resource;
+    }
+    return nullptr;
+}
+
 int main(int argc, char *argv[])
 {
+    StartupTiming timing;
+
+    // The stroke canvas uses OpenGL 3.3 core (same shaders as the GLFW drawing app); must be set before QApplication
+    QSurfaceFormat format;
+    format.setVersion(3, 3);
+    format.setProfile(QSurfaceFormat::CoreProfile);
+    format.setSwapInterval(1);
+    QSurfaceFormat::setDefaultFormat(format);
+
     QApplication a(argc, argv);
+    timing.mark("QApplication");
 
     QTranslator translator;
-    const QStringList uiLanguages = QLocale::system().uiLanguages();
-    for (const QString &locale : uiLanguages) {
-        const QString baseName = "QT_" + QLocale(locale).name();
-        if (translator.load(":/i18n/" + baseName)) {
+    if (const char *resource = findTranslation(QLocale::system().uiLanguages())) {
+        if (translator.load(QString::fromLatin1(resource)))
             a.installTranslator(&translator);
-            break;
-        }
     }
+    timing.mark("translator");
+
     MainWindow w;
+    timing.mark("MainWindow");
     w.show();
+    timing.mark("show");
+    timing.reportAfterFirstPaint(&w);
     return a.exec();
 }
@@ -1,19 +1,53 @@
 #include "mainwindow.h"
+#include "logpanel.h"
 #include "secondwindow.h"
+#include "strokecanvas.h"
+#include "windowpool.h"
 #include "./ui_mainwindow.h"
 
+#include <QHBoxLayout>
+#include <QTimer>
+#include <QVBoxLayout>
+
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
     , ui(new Ui::MainWindow)
-    , secondWindow(nullptr)
+    , windowPool(new WindowPool(2, this))
+    , statsWindow(nullptr)
+    , logPanel(nullptr)
 {
     ui->setupUi(this);
 
 
 
-    button = new QPushButton("Otwórz okno", this);
-    setCentralWidget(button);
+    // Canvas (pencil, like the GLFW drawing app) with the buttons under it
+    QWidget *central = new QWidget(this);
+    canvas = new StrokeCanvas(central);
+    button = new QPushButton("Otwórz okno", central);
+    QPushButton *statsButton = new QPushButton("Statystyki", central);
+    QPushButton *clearButton = new QPushButton("Wyczyść", central);
+    QPushButton *logButton = new QPushButton("Log", central);
+
+    QHBoxLayout *buttons = new QHBoxLayout;
+    buttons->addWidget(button);
+    buttons->addWidget(statsButton);
+    buttons->addWidget(clearButton);
+    buttons->addWidget(logButton);
+    QVBoxLayout *layout = new QVBoxLayout(central);
+    layout->addWidget(canvas, 1);
+    layout->addLayout(buttons);
+    setCentralWidget(central);
+    resize(800, 600);
+
     connect(button, &QPushButton::clicked, this, &MainWindow::openSecondWindow);
+    connect(statsButton, &QPushButton::clicked, this, &MainWindow::showStats);
+    connect(clearButton, &QPushButton::clicked, canvas, &StrokeCanvas::clear);
+    connect(logButton, &QPushButton::clicked, this, &MainWindow::showLog);
+
+    // Statistics are collected all the time, shown (and reset) twice per second while the window is open
+    QTimer *statsTimer = new QTimer(this);
+    connect(statsTimer, &QTimer::timeout, this, &MainWindow::updateStats);
+    statsTimer->start(500);
 }
 
 MainWindow::~MainWindow()
@@ -22,11 +56,43 @@ MainWindow::~MainWindow()
 }
 
 
+// Each click opens one more window, taken from the pool (pre-built during idle time, closed ones are reused)
 void MainWindow::openSecondWindow()
 {
-    if (!secondWindow)
-        secondWindow = new SecondWindow(); // nie dajemy parenta, żeby było niezależne
-    secondWindow->show();
-    secondWindow->raise();  // na wierzch
-    secondWindow->activateWindow(); // aktywacja
+    windowPool->open();
+}
+
+// The statistics window is an ordinary pooled window showing text instead of the greeting
+void MainWindow::showStats()
+{
+    if (statsWindow) {
+        statsWindow->raise();
+        statsWindow->activateWindow();
+        return;
+    }
+    statsWindow = windowPool->open();
+    statsWindow->setWindowTitle("Statystyki");
+    statsWindow->setText(canvas->takeStatsText());
+    connect(statsWindow, &SecondWindow::closed, this, [this](SecondWindow *window) {
+        disconnect(window, &SecondWindow::closed, this, nullptr);
+        window->setWindowTitle("Drugie okno");
+        window->setText(QString()); // back to the pool as a plain window
+        statsWindow = nullptr;
+    });
+}
+
+void MainWindow::updateStats()
+{
+    const QString text = canvas->takeStatsText();
+    if (statsWindow)
+        statsWindow->setText(text);
+}
+
+void MainWindow::showLog()
+{
+    if (!logPanel)
+        logPanel = new LogPanel(this); // separate window (Qt::Window), deleted with the main window
+    logPanel->show();
+    logPanel->raise();
+    logPanel->activateWindow();
 }
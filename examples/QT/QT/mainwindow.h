@@ -6,7 +6,10 @@
 #include <QPushButton>
 
 
+class LogPanel;
 class SecondWindow;
+class StrokeCanvas;
+class WindowPool;
 
 QT_BEGIN_NAMESPACE
 namespace Ui {
@@ -24,11 +27,17 @@ public:
 
 private slots:
     void openSecondWindow();
+    void showStats();
+    void showLog();
+    void updateStats();
 
 private:
     Ui::MainWindow *ui;
 
     QPushButton *button;
-    SecondWindow *secondWindow;
+    WindowPool *windowPool;
+    StrokeCanvas *canvas;
+    SecondWindow *statsWindow;  // nullptr while closed
+    LogPanel *logPanel;         // created on first use
 };
 #endif // MAINWINDOW_H
@@ -1,14 +1,29 @@
 #include "secondwindow.h"
 
+#include <QCloseEvent>
+
 SecondWindow::SecondWindow(QWidget *parent) : QWidget(parent)
 {
     setWindowTitle("Drugie okno");
     resize(200, 100);
 
-    QLabel *label = new QLabel("Hello World!", this);
+    label = new QLabel("Hello World!", this);
     label->setAlignment(Qt::AlignCenter);
 
     QVBoxLayout *layout = new QVBoxLayout(this);
     layout->addWidget(label);
     setLayout(layout);
 }
+
+void SecondWindow::setText(const QString &text)
+{
+    label->setText(text.isEmpty() ? QString("Hello World!") : text);
+    label->setAlignment(text.isEmpty() ? Qt::AlignCenter : Qt::AlignLeft | Qt::AlignTop);
+    adjustSize();
+}
+
+void SecondWindow::closeEvent(QCloseEvent *event)
+{
+    QWidget::closeEvent(event);
+    emit closed(this);
+}
@@ -10,6 +10,19 @@ class SecondWindow : public QWidget
     Q_OBJECT
 public:
     explicit SecondWindow(QWidget *parent = nullptr);
+
+    // Replaces the greeting (multi-line text, e.g. the canvas statistics); an empty text restores it
+    void setText(const QString &text);
+
+signals:
+    // Emitted when the user closes the window: it's only hidden, WindowPool reuses it
+    void closed(SecondWindow *window);
+
+protected:
+    void closeEvent(QCloseEvent *event) override;
+
+private:
+    QLabel *label;
 };
 
 #endif // SECONDWINDOW_H
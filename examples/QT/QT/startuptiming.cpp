@@ -0,0 +1,51 @@
+#include "startuptiming.h"
+
+#include <QApplication>
+#include <QDebug>
+#include <QEvent>
+#include <QTimer>
+#include <QWidget>
+
+StartupTiming::StartupTiming() : watchedWindow(nullptr)
+{
+    timer.start();
+    marks.reserve(8);
+}
+
+void StartupTiming::mark(const char *phase)
+{
+    marks.append({ phase, timer.nsecsElapsed() });
+}
+
+// The first Paint event of any widget of the window starts its first frame. Painting ends when the event loop
+// gets back to its queue, hence the zero timer: the report then includes the whole first frame.
+void StartupTiming::reportAfterFirstPaint(QWidget *window)
+{
+    watchedWindow = window;
+    qApp->installEventFilter(this);
+}
+
+bool StartupTiming::eventFilter(QObject *watched, QEvent *event)
+{
+    if (event->type() == QEvent::Paint && watched->isWidgetType() && static_cast<QWidget *>(watched)->window() == watchedWindow) {
+        qApp->removeEventFilter(this);
+        QTimer::singleShot(0, this, [this]() {
+            mark("first paint");
+            report();
+        });
+    }
+    return QObject::eventFilter(watched, event);
+}
+
+void StartupTiming::report()
+{
+    qint64 previous = 0;
+    qInfo().noquote() << "Startup timing (ms):";
+    for (const Mark &m : marks) {
+        qInfo().noquote() << QString("  %1 %2 (total %3)")
+                                 .arg(QString::fromLatin1(m.phase), -16)
+                                 .arg((m.nsecs - previous) / 1e6, 8, 'f', 3)
+                                 .arg(m.nsecs / 1e6, 8, 'f', 3);
+        previous = m.nsecs;
+    }
+}
@@ -0,0 +1,40 @@
+#ifndef STARTUPTIMING_H
+#define STARTUPTIMING_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QVector>
+
+class QWidget;
+
+// Startup phases, measured from the start of main() and reported once the first paint of the main window is done:
+//   StartupTiming timing;                 // first thing in main()
+//   timing.mark("QApplication");          // end of each phase
+//   timing.reportAfterFirstPaint(&w);     // after w.show()
+class StartupTiming : public QObject
+{
+    Q_OBJECT
+public:
+    StartupTiming();
+
+    void mark(const char *phase);
+    void reportAfterFirstPaint(QWidget *window);
+
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
+private:
+    void report();
+
+    struct Mark
+    {
+        const char *phase;
+        qint64 nsecs;
+    };
+
+    QElapsedTimer timer;
+    QVector<Mark> marks;
+    QWidget *watchedWindow;
+};
+
+#endif // STARTUPTIMING_H
@@ -0,0 +1,416 @@
+#include "strokecanvas.h"
+
+#include "strokes.h"
+#include "stroke_shaders.h"
+
+#include <QDebug>
+#include <QLabel>
+#include <QMouseEvent>
+#include <QTabletEvent>
+#include <QTimer>
+
+#include <algorithm>
+
+// Event position in widget coordinates, Qt 5 and Qt 6
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+static QPointF eventPos(const QMouseEvent *event) { return event->position(); }
+static QPointF eventPos(const QTabletEvent *event) { return event->position(); }
+#else
+static QPointF eventPos(const QMouseEvent *event) { return event->localPos(); }
+static QPointF eventPos(const QTabletEvent *event) { return event->posF(); }
+#endif
+
+StrokeCanvas::StrokeCanvas(QWidget *parent)
+    : QOpenGLWidget(parent)
+    , penDown(false)
+    , glReady(false)
+    , fallback(nullptr)
+    , program(0)
+    , colorLoc(-1)
+    , finishedVao(0), finishedVbo(0)
+    , currentVao(0), currentVbo(0)
+    , finishedCapacity(0), finishedPoints(0), uploadedStrokes(0)
+    , currentCapacity(0), currentUploaded(0)
+    , remoteVao(0), remoteVbo(0)
+    , published(0), remoteDirty(false), remotePolls(0)
+    , lastSwapNs(-1), oldestSampleNs(-1)
+    , frames(0), frameSumMs(0.0), frameMaxMs(0.0), paintSumMs(0.0)
+    , latencyFrames(0), latencySumMs(0.0), latencyMaxMs(0.0)
+    , samplesReceived(0), samplesApplied(0), uploadedBytes(0)
+{
+    clock.start();
+    setMinimumSize(400, 300);
+    pending.reserve(256);
+    connect(this, &QOpenGLWidget::frameSwapped, this, &StrokeCanvas::onFrameSwapped);
+
+    // Publish our strokes, and look for the GLFW app's about 60 times per second
+    ringOut.create(STROKE_RING_QT);
+    QTimer *poll = new QTimer(this);
+    connect(poll, &QTimer::timeout, this, &StrokeCanvas::pollRemote);
+    poll->start(16);
+}
+
+StrokeCanvas::~StrokeCanvas()
+{
+    if (!glReady) // never shown, or no usable context: no GL object to delete
+        return;
+    makeCurrent();
+    glDeleteBuffers(1, &finishedVbo);
+    glDeleteBuffers(1, &currentVbo);
+    glDeleteBuffers(1, &remoteVbo);
+    glDeleteVertexArrays(1, &finishedVao);
+    glDeleteVertexArrays(1, &currentVao);
+    glDeleteVertexArrays(1, &remoteVao);
+    glDeleteProgram(program);
+    doneCurrent();
+}
+
+void StrokeCanvas::clear()
+{
+    // A stroke in progress is finished for the GLFW app, its next points start a new one (publishCurrent())
+    if (g_mouse_down) {
+        publishCurrent();
+        ringOut.end();
+    }
+    strokes_clear();
+    published = 0;
+    remoteCurrent.clear();
+    uploadedStrokes = 0;
+    finishedPoints = 0;
+    currentUploaded = 0;
+    firsts.clear();
+    counts.clear();
+    update();
+}
+
+// --- Input: queue only, the strokes are updated once per frame ---------------
+void StrokeCanvas::queueSample(SampleKind kind, const QPointF &pos)
+{
+    pending.append({ kind, pos, clock.nsecsElapsed() });
+    samplesReceived++;
+    update(); // at most one repaint per frame, however many events arrive
+}
+
+void StrokeCanvas::mousePressEvent(QMouseEvent *event)
+{
+    if (event->button() == Qt::LeftButton && !penDown)
+        queueSample(SampleKind::Begin, eventPos(event));
+}
+
+void StrokeCanvas::mouseMoveEvent(QMouseEvent *event)
+{
+    if ((event->buttons() & Qt::LeftButton) && !penDown)
+        queueSample(SampleKind::Move, eventPos(event));
+}
+
+void StrokeCanvas::mouseReleaseEvent(QMouseEvent *event)
+{
+    if (event->button() == Qt::LeftButton && !penDown)
+        queueSample(SampleKind::End, eventPos(event));
+}
+
+// Tablet events come at the pen's rate (often 200+ Hz); accepting them stops Qt from synthesizing mouse events
+void StrokeCanvas::tabletEvent(QTabletEvent *event)
+{
+    switch (event->type()) {
+    case QEvent::TabletPress:
+        penDown = true;
+        queueSample(SampleKind::Begin, eventPos(event));
+        break;
+    case QEvent::TabletMove:
+        if (penDown)
+            queueSample(SampleKind::Move, eventPos(event));
+        break;
+    case QEvent::TabletRelease:
+        if (penDown)
+            queueSample(SampleKind::End, eventPos(event));
+        penDown = false;
+        break;
+    default:
+        break;
+    }
+    event->accept();
+}
+
+void StrokeCanvas::applySamples()
+{
+    oldestSampleNs = pending.isEmpty() ? -1 : pending.front().receivedNs;
+    g_win_w = width();
+    g_win_h = height();
+    // Consecutive moves go through the batch kernel together (stroke_add_points)
+    auto flushMoves = [this] {
+        stroke_add_points(moveBatch.data(), moveBatch.size());
+        moveBatch.clear();
+    };
+    for (const Sample &s : pending) {
+        switch (s.kind) {
+        case SampleKind::Begin:
+            flushMoves();
+            stroke_begin(s.pos.x(), s.pos.y());
+            currentUploaded = 0;
+            ringOut.begin(g_current.data(), (uint32_t)g_current.size());
+            published = g_current.size();
+            break;
+        case SampleKind::Move:
+            moveBatch.push_back({ s.pos.x(), s.pos.y() });
+            break;
+        case SampleKind::End:
+            moveBatch.push_back({ s.pos.x(), s.pos.y() });
+            flushMoves();
+            publishCurrent();
+            stroke_end();
+            ringOut.end();
+            currentUploaded = 0;
+            break;
+        }
+    }
+    flushMoves();
+    publishCurrent(); // one APPEND record per frame for the stroke in progress
+    samplesApplied += pending.size();
+    pending.clear();
+}
+
+void StrokeCanvas::publishCurrent()
+{
+    if (g_current.size() > published) {
+        const Vec2 *points = g_current.data() + published;
+        const uint32_t count = (uint32_t)(g_current.size() - published);
+        if (published == 0) // cleared mid-stroke
+            ringOut.begin(points, count);
+        else
+            ringOut.append(points, count);
+        published = g_current.size();
+    }
+}
+
+// Records from the GLFW app: read in place in the mapping, their points are copied to g_strokes (finished strokes,
+// the batched upload picks them up) and remoteCurrent (redrawn when it changed)
+void StrokeCanvas::pollRemote()
+{
+    const bool everySecond = remotePolls++ % 60 == 0;
+    if (!ringIn.is_open() && everySecond)
+        ringIn.open(STROKE_RING_GLFW);
+    if (stroke_ring_drain(ringIn, g_strokes, remoteCurrent) > 0) {
+        remoteDirty = true;
+        update();
+    }
+    // The GLFW app exited, or crashed and was restarted: its unfinished stroke goes away
+    if (ringIn.writer_closed() || (everySecond && ringIn.writer_restarted())) {
+        ringIn.close();
+        remoteCurrent.clear();
+        update();
+    }
+}
+
+// --- GL ------------------------------------------------------------------------
+static GLuint compileShader(QOpenGLFunctions_3_3_Core *gl, GLenum type, const char *src)
+{
+    GLuint s = gl->glCreateShader(type);
+    gl->glShaderSource(s, 1, &src, nullptr);
+    gl->glCompileShader(s);
+    GLint ok = 0;
+    gl->glGetShaderiv(s, GL_COMPILE_STATUS, &ok);
+    if (!ok) {
+        char buf[1024];
+        gl->glGetShaderInfoLog(s, sizeof(buf), nullptr, buf);
+        qWarning() << "Shader compile error:" << buf;
+    }
+    return s;
+}
+
+void StrokeCanvas::initializeGL()
+{
+    glReady = initializeOpenGLFunctions();
+    if (!glReady) {
+        // GLES/ANGLE or a driver older than 3.3: the functions aren't resolved, no GL call may be made
+        qWarning() << "StrokeCanvas needs an OpenGL 3.3 core context";
+        if (!fallback) {
+            fallback = new QLabel("Płótno wymaga OpenGL 3.3 (core profile),\nniedostępnego na tym sterowniku.", this);
+            fallback->setAlignment(Qt::AlignCenter);
+            fallback->setAutoFillBackground(true);
+        }
+        fallback->setGeometry(rect());
+        fallback->show();
+        return;
+    }
+    if (fallback)
+        fallback->hide();
+
+    GLuint v = compileShader(this, GL_VERTEX_SHADER, vertex_shader_src);
+    GLuint f = compileShader(this, GL_FRAGMENT_SHADER, fragment_shader_src);
+    program = glCreateProgram();
+    glAttachShader(program, v);
+    glAttachShader(program, f);
+    glLinkProgram(program);
+    glDeleteShader(v);
+    glDeleteShader(f);
+    colorLoc = glGetUniformLocation(program, "uColor");
+
+    // Three VAO/VBO pairs: finished strokes (append only), the current stroke and the GLFW app's current stroke
+    GLuint vaos[3], vbos[3];
+    glGenVertexArrays(3, vaos);
+    glGenBuffers(3, vbos);
+    finishedVao = vaos[0]; currentVao = vaos[1]; remoteVao = vaos[2];
+    finishedVbo = vbos[0]; currentVbo = vbos[1]; remoteVbo = vbos[2];
+    for (int n = 0; n < 3; n++) {
+        glBindVertexArray(vaos[n]);
+        glBindBuffer(GL_ARRAY_BUFFER, vbos[n]);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vec2), (void *)0);
+    }
+    glBindVertexArray(0);
+
+    // Everything that was drawn before the context was (re)created must be uploaded again
+    finishedCapacity = finishedPoints = uploadedStrokes = 0;
+    currentCapacity = currentUploaded = 0;
+    remoteDirty = true;
+    firsts.clear();
+    counts.clear();
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glClearColor(1.0f, 1.0f, 1.0f, 1.0f); // White background (like paper)
+}
+
+void StrokeCanvas::resizeGL(int w, int h)
+{
+    Q_UNUSED(w);
+    Q_UNUSED(h);
+    // QOpenGLWidget sets the viewport; the strokes are in NDC, nothing else depends on the size
+    if (fallback)
+        fallback->setGeometry(rect());
+}
+
+// New finished strokes are appended to the buffer. When it's full, its capacity doubles and everything is uploaded
+// again: amortized, each point is uploaded about twice over the life of the canvas.
+void StrokeCanvas::uploadFinishedStrokes()
+{
+    if (uploadedStrokes == g_strokes.size())
+        return;
+    size_t needed = finishedPoints;
+    for (size_t n = uploadedStrokes; n < g_strokes.size(); n++)
+        needed += g_strokes[n].size();
+
+    glBindBuffer(GL_ARRAY_BUFFER, finishedVbo);
+    if (needed > finishedCapacity) {
+        finishedCapacity = std::max<size_t>(needed, std::max<size_t>(4096, finishedCapacity * 2));
+        glBufferData(GL_ARRAY_BUFFER, finishedCapacity * sizeof(Vec2), nullptr, GL_DYNAMIC_DRAW);
+        finishedPoints = 0;
+        uploadedStrokes = 0;
+        firsts.clear();
+        counts.clear();
+    }
+    for (; uploadedStrokes < g_strokes.size(); uploadedStrokes++) {
+        const std::vector<Vec2> &s = g_strokes[uploadedStrokes];
+        glBufferSubData(GL_ARRAY_BUFFER, finishedPoints * sizeof(Vec2), s.size() * sizeof(Vec2), s.data());
+        uploadedBytes += s.size() * sizeof(Vec2);
+        firsts.push_back((GLint)finishedPoints);
+        counts.push_back((GLsizei)s.size());
+        finishedPoints += s.size();
+    }
+}
+
+// Only the points added since the last frame
+void StrokeCanvas::uploadCurrentStroke()
+{
+    if (g_current.size() < currentUploaded)
+        currentUploaded = 0;
+    if (g_current.size() == currentUploaded)
+        return;
+    glBindBuffer(GL_ARRAY_BUFFER, currentVbo);
+    if (g_current.size() > currentCapacity) {
+        currentCapacity = std::max<size_t>(g_current.size(), std::max<size_t>(1024, currentCapacity * 2));
+        glBufferData(GL_ARRAY_BUFFER, currentCapacity * sizeof(Vec2), nullptr, GL_DYNAMIC_DRAW);
+        currentUploaded = 0;
+    }
+    const size_t count = g_current.size() - currentUploaded;
+    glBufferSubData(GL_ARRAY_BUFFER, currentUploaded * sizeof(Vec2), count * sizeof(Vec2), g_current.data() + currentUploaded);
+    uploadedBytes += count * sizeof(Vec2);
+    currentUploaded = g_current.size();
+}
+
+void StrokeCanvas::paintGL()
+{
+    const qint64 paintStart = clock.nsecsElapsed();
+    applySamples(); // strokes are still recorded and shared without GL
+    if (!glReady)
+        return;
+    uploadFinishedStrokes();
+    uploadCurrentStroke();
+
+    glClear(GL_COLOR_BUFFER_BIT);
+    glUseProgram(program);
+    glUniform3f(colorLoc, 0.05f, 0.05f, 0.05f); // dark pencil color (close to black but a bit soft)
+    glLineWidth(2.5f); // core profile: widths above 1 are optional, drivers may clamp
+
+    if (!counts.empty()) {
+        glBindVertexArray(finishedVao);
+        glMultiDrawArrays(GL_LINE_STRIP, firsts.data(), counts.data(), (GLsizei)counts.size());
+    }
+    if (g_current.size() >= 2) {
+        glBindVertexArray(currentVao);
+        glDrawArrays(GL_LINE_STRIP, 0, (GLsizei)g_current.size());
+    }
+    if (remoteCurrent.size() >= 2) {
+        glBindVertexArray(remoteVao);
+        if (remoteDirty) {
+            glBindBuffer(GL_ARRAY_BUFFER, remoteVbo);
+            glBufferData(GL_ARRAY_BUFFER, remoteCurrent.size() * sizeof(Vec2), remoteCurrent.data(), GL_DYNAMIC_DRAW);
+            uploadedBytes += remoteCurrent.size() * sizeof(Vec2);
+            remoteDirty = false;
+        }
+        glUniform3f(colorLoc, 0.45f, 0.15f, 0.05f);
+        glDrawArrays(GL_LINE_STRIP, 0, (GLsizei)remoteCurrent.size());
+    }
+    glBindVertexArray(0);
+    glUseProgram(0);
+    paintSumMs += (clock.nsecsElapsed() - paintStart) / 1e6;
+}
+
+// The frame is presented: frame time since the previous one, and input latency of the oldest sample it shows
+void StrokeCanvas::onFrameSwapped()
+{
+    const qint64 now = clock.nsecsElapsed();
+    if (lastSwapNs >= 0) {
+        const double ms = (now - lastSwapNs) / 1e6;
+        frames++;
+        frameSumMs += ms;
+        frameMaxMs = std::max(frameMaxMs, ms);
+    }
+    lastSwapNs = now;
+    if (oldestSampleNs >= 0) {
+        const double ms = (now - oldestSampleNs) / 1e6;
+        latencyFrames++;
+        latencySumMs += ms;
+        latencyMaxMs = std::max(latencyMaxMs, ms);
+        oldestSampleNs = -1;
+    }
+}
+
+QString StrokeCanvas::takeStatsText()
+{
+    size_t points = finishedPoints + g_current.size();
+    QString text = QString("Frames: %1\n"
+                           "Frame time: avg %2 ms, max %3 ms\n"
+                           "paintGL: avg %4 ms\n"
+                           "Input latency: avg %5 ms, max %6 ms\n"
+                           "Samples: %7 received, %8 applied\n"
+                           "Strokes: %9, points: %10\n"
+                           "Uploaded: %11 KB, draw calls per frame: %12")
+                       .arg(frames)
+                       .arg(frames ? frameSumMs / frames : 0.0, 0, 'f', 2)
+                       .arg(frameMaxMs, 0, 'f', 2)
+                       .arg(frames ? paintSumMs / frames : 0.0, 0, 'f', 3)
+                       .arg(latencyFrames ? latencySumMs / latencyFrames : 0.0, 0, 'f', 2)
+                       .arg(latencyMaxMs, 0, 'f', 2)
+                       .arg(samplesReceived)
+                       .arg(samplesApplied)
+                       .arg(g_strokes.size())
+                       .arg(points)
+                       .arg(uploadedBytes / 1024)
+                       .arg((counts.empty() ? 0 : 1) + (g_current.size() >= 2 ? 1 : 0) + (remoteCurrent.size() >= 2 ? 1 : 0));
+    frames = latencyFrames = samplesReceived = samplesApplied = 0;
+    frameSumMs = frameMaxMs = paintSumMs = latencySumMs = latencyMaxMs = 0.0;
+    uploadedBytes = 0;
+    return text;
+}
@@ -0,0 +1,107 @@
+#ifndef STROKECANVAS_H
+#define STROKECANVAS_H
+
+#include <QElapsedTimer>
+#include "stroke_ring.h"
+
+#include <QOpenGLFunctions_3_3_Core>
+#include <QOpenGLWidget>
+#include <QPointF>
+#include <QVector>
+
+#include <vector>
+
+class QLabel;
+
+// Pencil canvas of the GLFW drawing app hosted in Qt: same stroke storage (strokes.h/.cpp, g_strokes / g_current)
+// and same shaders (stroke_shaders.h), with a batched renderer:
+//  - finished strokes live in one vertex buffer, only new strokes are uploaded (glBufferSubData), and they are all
+//    drawn with a single glMultiDrawArrays(GL_LINE_STRIP) call;
+//  - the stroke being drawn has its own small buffer, only its new points are uploaded.
+// Mouse and tablet events are only queued with their arrival time, and applied once per frame in paintGL().
+// Strokes are shared with the GLFW drawing app through shared memory rings (stroke_ring.h): ours are published once
+// per frame, its finished strokes join g_strokes and the one it's drawing is shown in brown.
+class StrokeCanvas : public QOpenGLWidget, protected QOpenGLFunctions_3_3_Core
+{
+    Q_OBJECT
+public:
+    explicit StrokeCanvas(QWidget *parent = nullptr);
+    ~StrokeCanvas();
+
+    void clear();
+
+    // Frame time, input latency and upload statistics since the previous call, as display text
+    QString takeStatsText();
+
+protected:
+    void initializeGL() override;
+    void resizeGL(int w, int h) override;
+    void paintGL() override;
+
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+    void mouseReleaseEvent(QMouseEvent *event) override;
+    void tabletEvent(QTabletEvent *event) override;
+
+private slots:
+    void onFrameSwapped();
+    void pollRemote();
+
+private:
+    enum class SampleKind { Begin, Move, End };
+    struct Sample
+    {
+        SampleKind kind;
+        QPointF pos;            // widget coordinates
+        qint64 receivedNs;      // 'clock' time when the event was delivered
+    };
+
+    void queueSample(SampleKind kind, const QPointF &pos);
+    void applySamples();
+    void uploadFinishedStrokes();
+    void uploadCurrentStroke();
+    void publishCurrent();
+
+    QVector<Sample> pending;
+    std::vector<StrokeSample> moveBatch; // applySamples() scratch
+    bool penDown;               // A tablet stroke is in progress: synthesized mouse events are ignored
+
+    // GL objects
+    bool glReady;               // initializeGL() got a 3.3 core context: nothing below exists otherwise
+    QLabel *fallback;           // shown instead of the strokes when it didn't
+    GLuint program;
+    GLint colorLoc;
+    GLuint finishedVao, finishedVbo;
+    GLuint currentVao, currentVbo;
+    size_t finishedCapacity;    // points
+    size_t finishedPoints;      // points uploaded
+    size_t uploadedStrokes;     // g_strokes[0..uploadedStrokes) are in finishedVbo
+    std::vector<GLint> firsts;  // glMultiDrawArrays() arguments, one entry per finished stroke
+    std::vector<GLsizei> counts;
+    size_t currentCapacity;
+    size_t currentUploaded;     // g_current[0..currentUploaded) are in currentVbo
+    GLuint remoteVao, remoteVbo;
+
+    // Stroke sharing
+    StrokeRing ringOut;         // ours, read by the GLFW app
+    StrokeRing ringIn;          // the GLFW app's
+    size_t published;           // g_current[0..published) are in ringOut
+    std::vector<Vec2> remoteCurrent;
+    bool remoteDirty;           // remoteCurrent changed since it was uploaded
+    int remotePolls;
+
+    // Statistics
+    QElapsedTimer clock;
+    qint64 lastSwapNs;
+    qint64 oldestSampleNs;      // Oldest sample applied in the frame being presented, -1 if none
+    int frames;
+    double frameSumMs, frameMaxMs;
+    double paintSumMs;
+    int latencyFrames;
+    double latencySumMs, latencyMaxMs;
+    int samplesReceived;
+    int samplesApplied;
+    qint64 uploadedBytes;
+};
+
+#endif // STROKECANVAS_H
@@ -0,0 +1,103 @@
+#include "windowpool.h"
+#include "secondwindow.h"
+
+#include <QDebug>
+#include <QEvent>
+#include <QLayout>
+#include <QTimer>
+
+WindowPool::WindowPool(int spare, QObject *parent)
+    : QObject(parent)
+    , spare(spare)
+    , prewarmScheduled(false)
+    , opens(0)
+{
+    clock.start();
+    // Start once the main window had time for its first frame, startup shouldn't pay for the spares
+    prewarmScheduled = true;
+    QTimer::singleShot(200, this, &WindowPool::prewarmOne);
+}
+
+WindowPool::~WindowPool()
+{
+    qDeleteAll(owned); // top-level windows without a parent: the pool owns them
+}
+
+SecondWindow *WindowPool::open()
+{
+    const qint64 started = clock.nsecsElapsed();
+    const bool pooled = !idle.isEmpty();
+    SecondWindow *window = pooled ? idle.takeLast() : create();
+
+    pending.append({ window, pooled, ++opens, started });
+    window->installEventFilter(this);
+    window->show();
+    window->raise();  // na wierzch
+    window->activateWindow(); // aktywacja
+
+    schedulePrewarm();
+    return window;
+}
+
+// First paint of a window being opened: report the time to visible
+bool WindowPool::eventFilter(QObject *watched, QEvent *event)
+{
+    if (event->type() == QEvent::Paint) {
+        for (int n = 0; n < pending.size(); ++n) {
+            if (pending[n].window != watched)
+                continue;
+            const double ms = (clock.nsecsElapsed() - pending[n].started) / 1e6;
+            qInfo().noquote() << QString("Open #%1 (%2): %3 ms to visible")
+                                     .arg(pending[n].number)
+                                     .arg(pending[n].pooled ? "pooled" : "new")
+                                     .arg(ms, 0, 'f', 3);
+            watched->removeEventFilter(this);
+            pending.removeAt(n);
+            break;
+        }
+    }
+    return QObject::eventFilter(watched, event);
+}
+
+void WindowPool::prewarmOne()
+{
+    prewarmScheduled = false;
+    if (idle.size() >= spare)
+        return;
+    idle.append(create());
+    schedulePrewarm(); // next one on a later iteration, input events get processed in between
+}
+
+void WindowPool::recycle(SecondWindow *window)
+{
+    for (int n = 0; n < pending.size(); ++n) {
+        if (pending[n].window == window) { // closed before its first paint
+            window->removeEventFilter(this);
+            pending.removeAt(n);
+            break;
+        }
+    }
+    if (!idle.contains(window))
+        idle.append(window);
+}
+
+// Construction, style polish, layout and native window: everything show() would otherwise do on the first open
+SecondWindow *WindowPool::create()
+{
+    SecondWindow *window = new SecondWindow(); // nie dajemy parenta, żeby było niezależne
+    window->ensurePolished();
+    if (window->layout())
+        window->layout()->activate();
+    window->winId();
+    connect(window, &SecondWindow::closed, this, &WindowPool::recycle);
+    owned.append(window);
+    return window;
+}
+
+void WindowPool::schedulePrewarm()
+{
+    if (prewarmScheduled || idle.size() >= spare)
+        return;
+    prewarmScheduled = true;
+    QTimer::singleShot(0, this, &WindowPool::prewarmOne);
+}
@@ -0,0 +1,53 @@
+#ifndef WINDOWPOOL_H
+#define WINDOWPOOL_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QVector>
+
+class SecondWindow;
+
+// Pool of SecondWindow instances:
+//  - 'spare' windows are constructed, polished and given their native window ahead of time, starting shortly after
+//    startup, one per event loop iteration (zero timers) so the UI thread never blocks on more than one at a time;
+//  - closed windows are hidden and kept for the next open instead of being leaked or deleted;
+//  - time to visible (open request -> first paint) is reported for every open, pooled or not.
+class WindowPool : public QObject
+{
+    Q_OBJECT
+public:
+    explicit WindowPool(int spare = 2, QObject *parent = nullptr);
+    ~WindowPool();
+
+    // Shows a window from the pool (a new one if the pool is empty) and refills the pool afterwards
+    SecondWindow *open();
+
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
+private slots:
+    void prewarmOne();
+    void recycle(SecondWindow *window);
+
+private:
+    SecondWindow *create();
+    void schedulePrewarm();
+
+    struct PendingOpen
+    {
+        SecondWindow *window;
+        bool pooled;
+        int number;
+        qint64 started;
+    };
+
+    int spare;
+    bool prewarmScheduled;
+    int opens;
+    QVector<SecondWindow *> idle;       // hidden, ready to show
+    QVector<SecondWindow *> owned;      // every window created
+    QVector<PendingOpen> pending;       // shown, not painted yet
+    QElapsedTimer clock;
+};
+
+#endif // WINDOWPOOL_H
@@ -1,23 +1,15 @@
-// C++ program to merge two sorted arrays/
+// C++ program to merge sorted arrays/
+// (merge.h has the merge functions: two-way, k-way and parallel)
 #include<bits/stdc++.h>
+#include "merge.h"
 using namespace std;
 
+// arr3 must have room for n1+n2 elements
 void mergeArrays(int arr1[], int arr2[], int n1,
                             int n2, int arr3[])
 {
-    int i = 0, j = 0, k = 0;
-      // traverse the arr1 and insert its element in arr3
-      while(i < n1){
-      arr3[k++] = arr1[i++];
-    }
-      
-      // now traverse arr2 and insert in arr3
-      while(j < n2){
-      arr3[k++] = arr2[j++];
-    }
-      
-      // sort the whole array arr3
-      sort(arr3, arr3+n1+n2);
+      // walk both arrays once, always taking the smaller front element
+      merging::mergeTwo(arr1, n1, arr2, n2, arr3);
 }
 
 // Driver code
@@ -29,12 +21,30 @@ int main()
     int arr2[] = {2, 4, 6, 8};
     int n2 = sizeof(arr2) / sizeof(arr2[0]);
 
-    int arr3[n1+n2];
-    mergeArrays(arr1, arr2, n1, n2, arr3);
+    // on the heap: a variable length array on the stack overflows with big inputs
+    vector<int> arr3(n1+n2);
+    mergeArrays(arr1, arr2, n1, n2, arr3.data());
 
     cout << "Array after merging" <<endl;
     for (int i=0; i < n1+n2; i++)
         cout << arr3[i] << " ";
+    cout << endl;
+
+    // more than two sorted arrays (shards) at once
+    int shard1[] = {1, 4, 9};
+    int shard2[] = {2, 3, 10, 11};
+    int shard3[] = {0, 5, 6, 7, 8};
+    merging::Run<int> shards[] = {
+        {begin(shard1), end(shard1)},
+        {begin(shard2), end(shard2)},
+        {begin(shard3), end(shard3)},
+    };
+    vector<int> all(size(shard1) + size(shard2) + size(shard3));
+    merging::mergeK(shards, 3, all.data());
+
+    cout << "Shards after merging" <<endl;
+    for (int x : all)
+        cout << x << " ";
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,171 @@
+// Unit conversion benchmark: unit_convert.h against the footcovert.cpp way (cin >> value, cout << value * factor << endl),
+// on a generated sensor log of 3 columns (meters, celsius, pascals) with 3 decimals.
+// The output of convertStream() is checked against the expected values before timing.
+//
+// Build (Linux, from this folder):
+//   cmake -S . -B build && cmake --build build
+// Usage: ./build/convert_bench [MB]     (default: 256; the log is written to /tmp and removed afterwards)
+
+#include "unit_convert.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+static double NowMs()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Positive decimal argument; 0 when it isn't one (empty, signed, trailing characters, out of range)
+static unsigned long long ParseCount(const char* text)
+{
+    if (*text < '0' || *text > '9')
+        return 0;
+    char* end = nullptr;
+    errno = 0;
+    const unsigned long long value = strtoull(text, &end, 10);
+    return *end != '\0' || errno == ERANGE ? 0 : value;
+}
+
+static const char* kUnitNames[] = { "m_to_ft", "c_to_f", "pa_to_psi" };
+
+static bool Check(const char* log_path, const char* out_path, const unitconv::Options& options, size_t lines)
+{
+    std::ifstream in(log_path), out(out_path);
+    for (size_t line = 0; line < lines; line++)
+        for (size_t c = 0; c < options.columns.size(); c++)
+        {
+            double value = 0.0, converted = 0.0;
+            if (!(in >> value) || !(out >> converted))
+            {
+                fprintf(stderr, "line %zu: missing value\n", line + 1);
+                return false;
+            }
+            const double expected = value * options.columns[c].factor + options.columns[c].offset;
+            if (std::fabs(converted - expected) > 0.0005 + 1e-12 * std::fabs(expected))
+            {
+                fprintf(stderr, "line %zu column %zu: %.6f, expected %.6f\n", line + 1, c + 1, converted, expected);
+                return false;
+            }
+        }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    const size_t megabytes = argc > 1 ? (size_t)ParseCount(argv[1]) : 256;
+    if (argc > 2 || megabytes == 0 || megabytes > (1 << 20))
+    {
+        fprintf(stderr, "Usage: %s [MB]     (1 .. 1048576, default: 256)\n", argv[0]);
+        return 1;
+    }
+    const char* log_path = "/tmp/convert_bench_log.txt";
+    const char* out_path = "/tmp/convert_bench_out.txt";
+
+    // Generate the log
+    {
+        FILE* f = fopen(log_path, "wb");
+        if (f == nullptr)
+            return 1;
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<double> meters(0.0, 10000.0), celsius(-40.0, 60.0), pascals(90000.0, 110000.0);
+        size_t written = 0;
+        char line[128];
+        while (written < megabytes << 20)
+        {
+            const int len = snprintf(line, sizeof(line), "%.3f %.3f %.3f\n", meters(rng), celsius(rng), pascals(rng));
+            fwrite(line, 1, (size_t)len, f);
+            written += (size_t)len;
+        }
+        fclose(f);
+    }
+
+    unitconv::Options options;
+    for (const char* name : kUnitNames)
+        options.columns.push_back(*unitconv::findUnit(name));
+
+    // Check on the real output
+    {
+        const int in_fd = open(log_path, O_RDONLY);
+        const int out_fd = open(out_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        unitconv::Stats stats;
+        std::string error;
+        if (in_fd < 0 || out_fd < 0 || !unitconv::convertStream(in_fd, out_fd, options, stats, error))
+        {
+            fprintf(stderr, "convertStream failed: %s\n", error.c_str());
+            return 1;
+        }
+        close(in_fd);
+        close(out_fd);
+        if (!Check(log_path, out_path, options, std::min<size_t>(stats.lines, 100000)))
+            return 1;
+        remove(out_path);
+    }
+
+    printf("%zu MB log, 3 columns, output to /dev/null, best of 3\n", megabytes);
+    printf("%-34s %10s %10s %10s %10s\n", "", "MB/s", "values/s", "reads", "writes");
+
+    // Previous code: iostream extraction, one flushing endl per value. Run on the first 8 MB only, it's slow.
+    {
+        const size_t limit = std::min<size_t>(megabytes, 8) << 20;
+        double best = 1e30;
+        size_t bytes = 0, values = 0;
+        for (int run = 0; run < 3; run++)
+        {
+            std::ifstream in(log_path);
+            std::ofstream out("/dev/null");
+            const double t0 = NowMs();
+            double value;
+            values = 0;
+            while (in >> value)
+            {
+                out << value * options.columns[values % 3].factor + options.columns[values % 3].offset << std::endl;
+                values++;
+                if ((size_t)in.tellg() >= limit)
+                    break;
+            }
+            bytes = (size_t)in.tellg();
+            best = std::min(best, NowMs() - t0);
+        }
+        printf("%-34s %10.1f %10.3g %10s %10zu\n", "iostream + endl (first 8 MB)", bytes / 1048576.0 / (best / 1000.0), values / (best / 1000.0), "-", values);
+    }
+
+    // unit_convert.h, for a few block sizes
+    for (size_t block : { (size_t)64 << 10, (size_t)1 << 20, (size_t)4 << 20 })
+    {
+        options.block_size = block;
+        double best = 1e30;
+        unitconv::Stats stats;
+        for (int run = 0; run < 3; run++)
+        {
+            const int in_fd = open(log_path, O_RDONLY);
+            const int out_fd = open("/dev/null", O_WRONLY);
+            std::string error;
+            stats = unitconv::Stats();
+            const double t0 = NowMs();
+            unitconv::convertStream(in_fd, out_fd, options, stats, error);
+            best = std::min(best, NowMs() - t0);
+            close(in_fd);
+            close(out_fd);
+        }
+        char label[64];
+        snprintf(label, sizeof(label), "convertStream, %zu KB blocks", block >> 10);
+        printf("%-34s %10.1f %10.3g %10zu %10zu\n", label, stats.bytes_in / 1048576.0 / (best / 1000.0), stats.values / (best / 1000.0), stats.reads, stats.writes);
+    }
+
+    remove(log_path);
+    return 0;
+}
@@ -0,0 +1,142 @@
+// Merge benchmark: merge.h against the previous mergeArrays() (concatenate then sort), on random sorted inputs.
+//  - two-way: 2 runs of n/2 elements
+//  - k-way:   16 shards of n/16 elements
+// Each result is checked against std::stable_sort of the concatenation before being timed.
+//
+// Build (Linux, from this folder):
+//   cmake -S . -B build && cmake --build build
+// Usage: ./build/merge_bench [threads] [n...]     (default: hardware threads, n = 1M 10M 100M; 1B needs ~16 GB of RAM)
+
+#include "merge.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+static double NowMs()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Best of 'repeats' runs
+template<typename FUNC>
+static double TimeMs(int repeats, FUNC func)
+{
+    double best = 1e30;
+    for (int n = 0; n < repeats; n++)
+    {
+        const double t0 = NowMs();
+        func();
+        best = std::min(best, NowMs() - t0);
+    }
+    return best;
+}
+
+// Concatenate then sort, as mergeArrays() used to do
+static void ConcatSort(const std::vector<merging::Run<int>>& runs, int* out)
+{
+    int* end = out;
+    for (const merging::Run<int>& run : runs)
+        end = std::copy(run.begin, run.end, end);
+    std::sort(out, end);
+}
+
+static bool Check(const std::vector<int>& result, const std::vector<int>& expected, const char* name)
+{
+    if (result == expected)
+        return true;
+    fprintf(stderr, "%s: wrong result\n", name);
+    return false;
+}
+
+int main(int argc, char** argv)
+{
+    const unsigned threads = argc > 1 ? (unsigned)atoi(argv[1]) : 0;
+    std::vector<size_t> sizes;
+    for (int n = 2; n < argc; n++)
+        sizes.push_back((size_t)atoll(argv[n]));
+    if (sizes.empty())
+        sizes = { 1000000, 10000000, 100000000 };
+
+    // Correctness on small inputs: many shard counts (stack and heap loser trees), duplicates, empty runs, 4 threads
+    std::mt19937 rng(42);
+    for (size_t k : { 1, 2, 3, 5, 16, 64, 65, 200 })
+    {
+        std::vector<std::vector<int>> shards(k);
+        std::vector<merging::Run<int>> runs;
+        std::vector<int> expected;
+        for (size_t n = 0; n < k; n++)
+        {
+            shards[n].resize(rng() % 5000);
+            for (int& x : shards[n])
+                x = (int)(rng() % 1000);
+            std::sort(shards[n].begin(), shards[n].end());
+            runs.push_back({ shards[n].data(), shards[n].data() + shards[n].size() });
+            expected.insert(expected.end(), shards[n].begin(), shards[n].end());
+        }
+        std::stable_sort(expected.begin(), expected.end());
+        std::vector<int> result(expected.size());
+        merging::mergeK(runs.data(), k, result.data());
+        if (!Check(result, expected, "mergeK"))
+            return 1;
+        merging::parallelMergeK(runs.data(), k, result.data(), 4);
+        if (!Check(result, expected, "parallelMergeK"))
+            return 1;
+        if (k == 2)
+        {
+            merging::parallelMerge(runs[0].begin, runs[0].size(), runs[1].begin, runs[1].size(), result.data(), 4);
+            if (!Check(result, expected, "parallelMerge"))
+                return 1;
+        }
+    }
+
+    printf("threads: %u\n", threads ? threads : std::max(1u, std::thread::hardware_concurrency()));
+    printf("%12s %6s %14s %14s %14s %14s\n", "n", "runs", "concat+sort", "std::merge", "merge", "parallel");
+    for (size_t n : sizes)
+    {
+        std::vector<int> input(n), out(n);
+        for (size_t k : { 2, 16 })
+        {
+            // k sorted shards of uniformly random values, stored back to back in 'input'
+            std::vector<merging::Run<int>> runs;
+            for (size_t s = 0; s < k; s++)
+            {
+                int* begin = input.data() + n * s / k;
+                int* end = input.data() + n * (s + 1) / k;
+                for (int* p = begin; p != end; p++)
+                    *p = (int)(rng() >> 1);
+                std::sort(begin, end);
+                runs.push_back({ begin, end });
+            }
+            const int repeats = n >= 100000000 ? 1 : 3;
+            const double concat_ms = TimeMs(repeats, [&]() { ConcatSort(runs, out.data()); });
+            const std::vector<int> expected = out;
+
+            double std_ms = 0.0, merge_ms, parallel_ms;
+            if (k == 2)
+            {
+                std_ms = TimeMs(repeats, [&]() { std::merge(runs[0].begin, runs[0].end, runs[1].begin, runs[1].end, out.data()); });
+                merge_ms = TimeMs(repeats, [&]() { merging::mergeTwo(runs[0].begin, runs[0].size(), runs[1].begin, runs[1].size(), out.data()); });
+                Check(out, expected, "mergeTwo");
+                parallel_ms = TimeMs(repeats, [&]() { merging::parallelMerge(runs[0].begin, runs[0].size(), runs[1].begin, runs[1].size(), out.data(), threads); });
+                Check(out, expected, "parallelMerge");
+            }
+            else
+            {
+                merge_ms = TimeMs(repeats, [&]() { merging::mergeK(runs.data(), k, out.data()); });
+                Check(out, expected, "mergeK");
+                parallel_ms = TimeMs(repeats, [&]() { merging::parallelMergeK(runs.data(), k, out.data(), threads); });
+                Check(out, expected, "parallelMergeK");
+            }
+            char std_text[32] = "-";
+            if (k == 2)
+                snprintf(std_text, sizeof(std_text), "%.2f ms", std_ms);
+            printf("%12zu %6zu %11.2f ms %14s %11.2f ms %11.2f ms\n", n, k, concat_ms, std_text, merge_ms, parallel_ms);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,125 @@
+// Output benchmark: out_sink.h against the per-character cout loop of whilestatment.cpp and endl per line,
+// writing 10^8 characters to /dev/null. The write() calls are counted by the kernel (/proc/self/io, syscw).
+//
+// Build (Linux, from this folder):
+//   cmake -S . -B build && cmake --build build
+// Usage: ./build/out_sink_bench [chars]     (default: 10^8)
+
+#include "out_sink.h"
+
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+static double NowMs()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Positive decimal argument; 0 when it isn't one (empty, signed, trailing characters, out of range)
+static unsigned long long ParseCount(const char* text)
+{
+    if (*text < '0' || *text > '9')
+        return 0;
+    char* end = nullptr;
+    errno = 0;
+    const unsigned long long value = strtoull(text, &end, 10);
+    return *end != '\0' || errno == ERANGE ? 0 : value;
+}
+
+// Write system calls of this process so far
+static long long WriteSyscalls()
+{
+    FILE* f = fopen("/proc/self/io", "r");
+    if (f == nullptr)
+        return -1;
+    char line[128];
+    long long count = -1;
+    while (fgets(line, sizeof(line), f))
+        if (strncmp(line, "syscw:", 6) == 0)
+            count = atoll(line + 6);
+    fclose(f);
+    return count;
+}
+
+static const int kLine = 80;    // Characters per line for the line based cases
+
+int main(int argc, char** argv)
+{
+    const unsigned long long chars_arg = argc > 1 ? ParseCount(argv[1]) : 100000000ULL;
+    if (argc > 2 || chars_arg == 0 || chars_arg > (unsigned long long)LLONG_MAX)
+    {
+        fprintf(stderr, "Usage: %s [chars]     (default: 10^8)\n", argv[0]);
+        return 1;
+    }
+    const long long chars = (long long)chars_arg;
+
+    // stdout goes to /dev/null during the runs, the results to the original stdout
+    const int results_fd = dup(1);
+    const int null_fd = open("/dev/null", O_WRONLY);
+    FILE* results = fdopen(results_fd, "w");
+    if (null_fd < 0 || results == nullptr)
+        return 1;
+    dup2(null_fd, 1);
+
+    fprintf(results, "%lld characters to /dev/null\n", chars);
+    fprintf(results, "%-40s %10s %14s\n", "", "ms", "write() calls");
+    auto run = [&](const char* label, auto func)
+    {
+        const long long calls0 = WriteSyscalls();
+        const double t0 = NowMs();
+        func();
+        const double ms = NowMs() - t0;
+        fprintf(results, "%-40s %10.1f %14lld\n", label, ms, WriteSyscalls() - calls0);
+        fflush(results);
+    };
+
+    run("cout << \"*\" per character", [&]()
+    {
+        for (long long i = 0; i < chars; i++)
+            std::cout << "*";
+        std::cout.flush();
+    });
+    run("cout << '*' per character, endl per line", [&]()
+    {
+        for (long long i = 0; i < chars; i += kLine)
+        {
+            for (int n = 0; n < kLine - 1; n++)
+                std::cout << '*';
+            std::cout << std::endl;
+        }
+    });
+    run("Sink::put() per character", [&]()
+    {
+        outsink::Sink out;
+        for (long long i = 0; i < chars; i++)
+            out.put('*');
+    });
+    run("Sink, repeat() + '\\n' per line", [&]()
+    {
+        outsink::Sink out;
+        for (long long i = 0; i < chars; i += kLine)
+            out << outsink::repeat('*', kLine - 1) << '\n';
+    });
+    run("Sink::fill() once", [&]()
+    {
+        outsink::Sink out;
+        out.fill('*', (size_t)chars);
+    });
+    run("Sink::fill() once, 1 MB buffer", [&]()
+    {
+        outsink::Sink out(1, 1 << 20);
+        out.fill('*', (size_t)chars);
+    });
+
+    dup2(results_fd, 1);
+    return 0;
+}
@@ -0,0 +1,160 @@
+// Overflow-safe arithmetic benchmark (safe_int.h):
+//  - batch: acc[i] = saturate(acc[i] + x[i]) over int16 arrays larger than the caches, against a scalar clamping loop
+//    and a plain (wrapping) add, the memory bandwidth reference. GB/s count the bytes read and written.
+//  - scalar: summing an int32 array with int, Wrapping<int>, Checked<int> and Saturating<int> accumulators.
+// The batch results are checked against the scalar loop before being timed.
+//
+// Build (Linux, from this folder):
+//   cmake -S . -B build && cmake --build build          (-DCMAKE_CXX_FLAGS=-mavx2 for 32 bytes per instruction)
+// Usage: ./build/safe_int_bench [elements]     (default: 32M int16 per array, 64 MB each)
+
+#include "safe_int.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+static double NowMs()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Positive decimal argument; 0 when it isn't one (empty, signed, trailing characters, out of range)
+static unsigned long long ParseCount(const char* text)
+{
+    if (*text < '0' || *text > '9')
+        return 0;
+    char* end = nullptr;
+    errno = 0;
+    const unsigned long long value = strtoull(text, &end, 10);
+    return *end != '\0' || errno == ERANGE ? 0 : value;
+}
+
+// Best of 'repeats' runs
+template<typename FUNC>
+static double TimeMs(int repeats, FUNC func)
+{
+    double best = 1e30;
+    for (int n = 0; n < repeats; n++)
+    {
+        const double t0 = NowMs();
+        func();
+        best = std::min(best, NowMs() - t0);
+    }
+    return best;
+}
+
+// The obvious scalar version: widen, add, clamp
+static void AddClampScalar(int16_t* acc, const int16_t* x, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        const int sum = acc[i] + x[i];
+        acc[i] = (int16_t)std::min(32767, std::max(-32768, sum));
+    }
+}
+
+static void AddWrapping(int16_t* acc, const int16_t* x, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        acc[i] = (int16_t)(uint16_t)((uint16_t)acc[i] + (uint16_t)x[i]);
+}
+
+template<typename ACC>
+static int SumInto(const int* values, size_t count, ACC acc)
+{
+    for (size_t i = 0; i < count; i++)
+        acc += values[i];
+    return acc.value;
+}
+
+struct PlainInt
+{
+    int value = 0;
+    PlainInt& operator+=(int rhs) { value += rhs; return *this; }
+};
+
+int main(int argc, char** argv)
+{
+    const size_t count = argc > 1 ? (size_t)ParseCount(argv[1]) : (size_t)32 << 20;
+    if (argc > 2 || count == 0)
+    {
+        fprintf(stderr, "Usage: %s [elements]     (default: 32M)\n", argv[0]);
+        return 1;
+    }
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> dist(-20000, 20000);
+    std::vector<int16_t> x(count), acc0(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        x[i] = (int16_t)dist(rng);
+        acc0[i] = (int16_t)dist(rng);
+    }
+
+    // Check
+    {
+        std::vector<int16_t> a = acc0, b = acc0;
+        safeint::addSaturate(a.data(), x.data(), count);
+        AddClampScalar(b.data(), x.data(), count);
+        if (a != b)
+        {
+            fprintf(stderr, "addSaturate() differs from the scalar loop\n");
+            return 1;
+        }
+        // 16-bit products are computed in unsigned int, not in int where they would overflow
+        safeint::Wrapping<uint16_t> u(65535);
+        u *= 65535;
+        safeint::Wrapping<int16_t> s(-32768);
+        s *= -32768;
+        if (u.value != 1 || s.value != 0)
+        {
+            fprintf(stderr, "Wrapping<16-bit> products are wrong\n");
+            return 1;
+        }
+    }
+
+    std::vector<int16_t> acc = acc0;
+    const double bytes = 3.0 * count * sizeof(int16_t);
+    const double wrap_ms = TimeMs(5, [&]() { AddWrapping(acc.data(), x.data(), count); });
+    const double clamp_ms = TimeMs(5, [&]() { AddClampScalar(acc.data(), x.data(), count); });
+    const double batch_ms = TimeMs(5, [&]() { safeint::addSaturate(acc.data(), x.data(), count); });
+    // Same, on a 16 KB slice that stays in L1: the compute bound
+    const size_t small = 8192;
+    const int small_repeats = (int)(count / small);
+    const double batch_l1_ms = TimeMs(5, [&]() { for (int r = 0; r < small_repeats; r++) safeint::addSaturate(acc.data(), x.data(), small); });
+    const double clamp_l1_ms = TimeMs(5, [&]() { for (int r = 0; r < small_repeats; r++) AddClampScalar(acc.data(), x.data(), small); });
+
+    printf("int16 batch add, %zu elements (%.0f MB per array), GB/s of memory traffic (2 reads + 1 write)\n", count, count * 2 / 1048576.0);
+    printf("%-34s %10.2f GB/s  %8.2f ms\n", "plain add (bandwidth reference)", bytes / wrap_ms / 1e6, wrap_ms);
+    printf("%-34s %10.2f GB/s  %8.2f ms\n", "scalar clamp", bytes / clamp_ms / 1e6, clamp_ms);
+    printf("%-34s %10.2f GB/s  %8.2f ms\n", "addSaturate()", bytes / batch_ms / 1e6, batch_ms);
+    printf("%-34s %10.2f GB/s\n", "scalar clamp, in L1", bytes / clamp_l1_ms / 1e6);
+    printf("%-34s %10.2f GB/s\n", "addSaturate(), in L1", bytes / batch_l1_ms / 1e6);
+
+    // Scalar accumulators over an int32 array (no overflow: the sums stay small)
+    std::vector<int> values(count);
+    for (size_t i = 0; i < count; i++)
+        values[i] = dist(rng) / 1000;
+    int results[4] = {};
+    const double plain_ms = TimeMs(3, [&]() { results[0] = SumInto(values.data(), count, PlainInt()); });
+    const double wrapping_ms = TimeMs(3, [&]() { results[1] = SumInto(values.data(), count, safeint::Wrapping<int>()); });
+    const double checked_ms = TimeMs(3, [&]() { results[2] = SumInto(values.data(), count, safeint::Checked<int>()); });
+    const double saturating_ms = TimeMs(3, [&]() { results[3] = SumInto(values.data(), count, safeint::Saturating<int>()); });
+    if (results[0] != results[1] || results[0] != results[2] || results[0] != results[3])
+    {
+        fprintf(stderr, "accumulators disagree\n");
+        return 1;
+    }
+    printf("\nint32 sum of %zu values, ns per element\n", count);
+    printf("%-34s %10.3f\n", "int", plain_ms * 1e6 / count);
+    printf("%-34s %10.3f\n", "Wrapping<int>", wrapping_ms * 1e6 / count);
+    printf("%-34s %10.3f\n", "Checked<int>", checked_ms * 1e6 / count);
+    printf("%-34s %10.3f\n", "Saturating<int>", saturating_ms * 1e6 / count);
+    return 0;
+}
@@ -0,0 +1,141 @@
+// Type table benchmark: the numericlimits.cpp table rendered with the previous iostream/setw code against
+// type_table.h (compile-time table, to_chars into one buffer). Output goes to /dev/null, one write per table.
+//
+// Build (Linux, from this folder):
+//   cmake -S . -B build && cmake --build build
+// Usage: ./build/type_table_bench [tables]     (default: 100000)
+
+#include "type_table.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+static double NowMs()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Positive decimal argument; 0 when it isn't one (empty, signed, trailing characters, out of range)
+static unsigned long long ParseCount(const char* text)
+{
+    if (*text < '0' || *text > '9')
+        return 0;
+    char* end = nullptr;
+    errno = 0;
+    const unsigned long long value = strtoull(text, &end, 10);
+    return *end != '\0' || errno == ERANGE ? 0 : value;
+}
+
+// The previous numericlimits.cpp row
+template <typename T>
+static void info_of_type_iostream(std::ostream& out, const std::string& opis)
+{
+    out << std::setw(18) << opis << ":" << std::setw(2) << sizeof(T) << "|" << std::setw(2) << std::numeric_limits<T>::digits
+        << (std::numeric_limits<T>::is_signed ? "|sign|" : "|withoutsign|")
+        << "[" << std::numeric_limits<T>::min() << "," << std::numeric_limits<T>::max() << "]" << std::endl;
+}
+
+static void TableIostream(std::ostream& out)
+{
+    info_of_type_iostream<short int>(out, "short int");
+    info_of_type_iostream<signed short int>(out, "signed short int");
+    info_of_type_iostream<unsigned short int>(out, "unsigned short int");
+    info_of_type_iostream<int>(out, "int");
+    info_of_type_iostream<signed int>(out, "signed int");
+    info_of_type_iostream<unsigned int>(out, "unsigned int");
+    info_of_type_iostream<long int>(out, "long int");
+    info_of_type_iostream<signed long int>(out, "signed long int");
+    info_of_type_iostream<unsigned long int>(out, "unsigned long int");
+    info_of_type_iostream<int>(out, "char");     // char as a number, as type_table.h prints it
+    info_of_type_iostream<float>(out, "float");
+    info_of_type_iostream<double>(out, "double");
+}
+
+static constexpr const char* type_names[] = {
+    "short int", "signed short int", "unsigned short int",
+    "int", "signed int", "unsigned int",
+    "long int", "signed long int", "unsigned long int",
+    "char", "float", "double",
+};
+
+static constexpr auto types = typetable::typeTable<
+    short int, signed short int, unsigned short int,
+    int, signed int, unsigned int,
+    long int, signed long int, unsigned long int,
+    char, float, double>(type_names);
+
+int main(int argc, char** argv)
+{
+    const unsigned long long tables_arg = argc > 1 ? ParseCount(argv[1]) : 100000;
+    if (argc > 2 || tables_arg == 0 || tables_arg > (unsigned long long)std::numeric_limits<int>::max())
+    {
+        fprintf(stderr, "Usage: %s [tables]     (1 .. 2^31-1, default: 100000)\n", argv[0]);
+        return 1;
+    }
+    const int tables = (int)tables_arg;
+    const int fd = open("/dev/null", O_WRONLY);
+    if (fd < 0)
+        return 1;
+
+    // Previous code, to a stream flushed by every endl (as std::cout would be)
+    std::ofstream null_stream("/dev/null");
+    double t0 = NowMs();
+    for (int n = 0; n < tables; n++)
+        TableIostream(null_stream);
+    const double iostream_ms = NowMs() - t0;
+
+    // Same, formatted in memory and written once per table: what's left is the formatting cost
+    t0 = NowMs();
+    size_t iostream_bytes = 0;
+    for (int n = 0; n < tables; n++)
+    {
+        std::ostringstream text;
+        TableIostream(text);
+        const std::string s = text.str();
+        iostream_bytes = s.size();
+        typetable::writeAll(fd, s.data(), s.size());
+    }
+    const double sstream_ms = NowMs() - t0;
+
+    t0 = NowMs();
+    size_t table_bytes = 0;
+    char storage[types.size() * typetable::kMaxRowChars];
+    for (int n = 0; n < tables; n++)
+    {
+        typetable::Buffer out(storage, sizeof(storage));
+        typetable::renderText(out, types.data(), types.size());
+        table_bytes = out.size();
+        typetable::writeAll(fd, out.begin, out.size());
+    }
+    const double table_ms = NowMs() - t0;
+
+    t0 = NowMs();
+    for (int n = 0; n < tables; n++)
+    {
+        typetable::Buffer out(storage, sizeof(storage));
+        typetable::renderJson(out, types.data(), types.size());
+        typetable::writeAll(fd, out.begin, out.size());
+    }
+    const double json_ms = NowMs() - t0;
+
+    printf("%d tables of %zu types, us per table\n", tables, types.size());
+    printf("%-36s %10.3f   (%zu bytes, %zu write() calls per table)\n", "iostream + setw + endl", iostream_ms * 1000.0 / tables, iostream_bytes, types.size());
+    printf("%-36s %10.3f\n", "iostream + setw, one write", sstream_ms * 1000.0 / tables);
+    printf("%-36s %10.3f   (%zu bytes, 1 write() call per table)\n", "type_table.h text", table_ms * 1000.0 / tables, table_bytes);
+    printf("%-36s %10.3f\n", "type_table.h json", json_ms * 1000.0 / tables);
+    close(fd);
+    return 0;
+}
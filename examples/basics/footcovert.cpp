@@ -1,8 +1,48 @@
+// Meters to foots, one value from the keyboard.
+// Usage: footcovert                                interactive
+//        footcovert --stream <unit>[,<unit>...] [precision] < in.txt > out.txt
+//                                                  converts a whole log, one unit per column (unit_convert.h: m_to_ft, c_to_f, ...)
 #include <iostream>
+#include <cstring>
+#include "unit_convert.h"
 
 using namespace std;
 
-int main(){
+static int stream(int argc, char** argv){
+
+    unitconv::Options options;
+    for (const char* p = argv[2]; ; ){
+        const char* comma = strchr(p, ',');
+        const size_t len = comma ? (size_t)(comma - p) : strlen(p);
+        const unitconv::Unit* unit = unitconv::findUnit(p, len);
+        if (unit == nullptr){
+            cerr << "Unknown unit: " << string(p, len) << ", known units:";
+            for (const unitconv::Unit& u : unitconv::kUnits)
+                cerr << " " << u.name;
+            cerr << "\n";
+            return 1;
+        }
+        options.columns.push_back(*unit);
+        if (comma == nullptr)
+            break;
+        p = comma + 1;
+    }
+    if (argc > 3)
+        options.precision = atoi(argv[3]);
+
+    unitconv::Stats stats;
+    string error;
+    if (!unitconv::convertStream(0, 1, options, stats, error)){
+        cerr << "footcovert: " << error << "\n";
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char** argv){
+
+    if (argc > 2 && strcmp(argv[1], "--stream") == 0)
+        return stream(argc, argv);
 
     int meters;
     double foots;
@@ -18,4 +58,4 @@ int main(){
 
 
     return 0;
-}
\ No newline at end of file
+}
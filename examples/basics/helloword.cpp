@@ -1,11 +1,11 @@
-#include <iostream>
-
-using namespace std;
+#include "out_sink.h"
 
 int main(){
 
-    cout<<"Hello Word!"<<endl;
+    outsink::Sink out;
+
+    out<<"Hello Word!\n";
 
     return 0;
 
-}
\ No newline at end of file
+}
@@ -1,23 +1,27 @@
 #include <iostream>
+#include "out_sink.h"
 
 using namespace std;
 
 int main(){
 
+    outsink::Sink out;
+
     int height,points;
-    cout<< " Enter height: [in centimeters] "<<endl;
+    out<< " Enter height: [in centimeters] \n";
+    out.flush();
 
     cin >>height;
 
     if(height < 180)
     {
-        cout<<"Your height is to small!"<<endl;
+        out<<"Your height is to small!\n";
     }
     else
     {
-        cout<<"Your height is to okey!"<<endl;
+        out<<"Your height is to okey!\n";
     }
 
     return 0;
 
-}
\ No newline at end of file
+}
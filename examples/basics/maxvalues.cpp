@@ -1,49 +1,61 @@
-#include <iostream> 
-#include <climits>  
-
-using namespace std; 
+#include <climits>
+#include "out_sink.h"
+#include "safe_int.h"
 
 int main() 
 {
-    cout << "\n\n Check the upper and lower limits of integer :\n"; 
-	cout << "--------------------------------------------------\n"; 
+    outsink::Sink out;
+
+    out << "\n\n Check the upper and lower limits of integer :\n"; 
+	out << "--------------------------------------------------\n"; 
 
 	
-	cout << " The maximum limit of int data type :                  " << INT_MAX << endl;
-	cout << " The minimum limit of int data type :                  " << INT_MIN << endl;
-	cout << " The maximum limit of unsigned int data type :         " << UINT_MAX << endl;
-	cout << " The maximum limit of long long data type :            " << LLONG_MAX << endl;
-	cout << " The minimum limit of long long data type :            " << LLONG_MIN << endl;
-	cout << " The maximum limit of unsigned long long data type :   " << ULLONG_MAX << endl;
-	cout << " The Bits contain in char data type :                  " << CHAR_BIT << endl;
-	cout << " The maximum limit of char data type :                 " << CHAR_MAX << endl;
-	cout << " The minimum limit of char data type :                 " << CHAR_MIN << endl;
-	cout << " The maximum limit of signed char data type :          " << SCHAR_MAX << endl;
-	cout << " The minimum limit of signed char data type :          " << SCHAR_MIN << endl;
-	cout << " The maximum limit of unsigned char data type :        " << UCHAR_MAX << endl;
-	cout << " The minimum limit of short data type :                " << SHRT_MIN << endl;
-    cout << " The maximum limit of short data type :                " << SHRT_MAX << endl;
-    cout << " The maximum limit of unsigned short data type :       " << USHRT_MAX << endl;
-
-    cout << "--------------------------------------------------\n"; 
-
-    signed int x = INT_MAX;
-    cout << "Max value of signed int:                               "<< x <<endl;
-    x = x + 1 ;
-    cout << "Max + 1 value of signed int:                           "<< x <<endl;
-    x = x + 1 ;
-    cout << "Max + 2 value of signed int:                           "<< x <<endl;
-
-    cout<<endl;
+	out << " The maximum limit of int data type :                  " << INT_MAX << '\n';
+	out << " The minimum limit of int data type :                  " << INT_MIN << '\n';
+	out << " The maximum limit of unsigned int data type :         " << UINT_MAX << '\n';
+	out << " The maximum limit of long long data type :            " << LLONG_MAX << '\n';
+	out << " The minimum limit of long long data type :            " << LLONG_MIN << '\n';
+	out << " The maximum limit of unsigned long long data type :   " << ULLONG_MAX << '\n';
+	out << " The Bits contain in char data type :                  " << CHAR_BIT << '\n';
+	out << " The maximum limit of char data type :                 " << CHAR_MAX << '\n';
+	out << " The minimum limit of char data type :                 " << CHAR_MIN << '\n';
+	out << " The maximum limit of signed char data type :          " << SCHAR_MAX << '\n';
+	out << " The minimum limit of signed char data type :          " << SCHAR_MIN << '\n';
+	out << " The maximum limit of unsigned char data type :        " << UCHAR_MAX << '\n';
+	out << " The minimum limit of short data type :                " << SHRT_MIN << '\n';
+    out << " The maximum limit of short data type :                " << SHRT_MAX << '\n';
+    out << " The maximum limit of unsigned short data type :       " << USHRT_MAX << '\n';
+
+    out << "--------------------------------------------------\n"; 
+
+    // INT_MAX + 1 is undefined behavior for a plain int: Wrapping<int> makes the wrap around explicit and defined
+    safeint::Wrapping<int> x = INT_MAX;
+    out << "Max value of signed int:                               "<< x.value <<'\n';
+    x += 1 ;
+    out << "Max + 1 value of signed int:                           "<< x.value <<'\n';
+    x += 1 ;
+    out << "Max + 2 value of signed int:                           "<< x.value <<'\n';
+
+    out<<'\n';
+
+    // the same with overflow detection, and with clamping
+    safeint::Checked<int> checked = INT_MAX;
+    checked += 1;
+    out << "Max + 1 checked:                                       "<< checked.value << (checked.overflow ? " (overflow)" : "") <<'\n';
+    safeint::Saturating<int> saturated = INT_MAX;
+    saturated += 1;
+    out << "Max + 1 saturated:                                     "<< saturated.value <<'\n';
+
+    out<<'\n';
 
     unsigned int y = UINT_MAX;
-    cout << "Max value of unsigned int:                             "<< y <<endl;
+    out << "Max value of unsigned int:                             "<< y <<'\n';
     y = y + 1; 
-    cout << "Max + 1 value of unsigned int:                         "<< y <<endl;
+    out << "Max + 1 value of unsigned int:                         "<< y <<'\n';
     y = y + 1; 
-    cout << "Max + 2 value of unsigned int:                         "<< y <<endl;
+    out << "Max + 2 value of unsigned int:                         "<< y <<'\n';
 
-    cout << endl; 
+    out << '\n'; 
 
     return 0; 
 } 
@@ -0,0 +1,255 @@
+// Merging of sorted arrays (shards) into one sorted array.
+// Header only, C++17. The output buffer is provided by the caller, nothing is allocated per element.
+//
+//  mergeTwo()       linear two-way merge, O(n1+n2)
+//  mergeK()         k-way merge with a loser tree, O(n log k), stable (ties keep the order of the runs)
+//  parallelMerge()  two-way merge split across threads with merge-path partitioning
+//  parallelMergeK() k-way merge split across threads at common splitter values, then mergeK() per thread
+//
+// All merges are stable: on equal keys, elements of an earlier input come first.
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace merging
+{
+
+// A sorted input range
+template<typename T>
+struct Run
+{
+    const T* begin;
+    const T* end;
+    size_t size() const { return (size_t)(end - begin); }
+};
+
+// Two-way merge of [a, a+na) and [b, b+nb) into out (na+nb elements). Returns the end of the output.
+// The loop is branch-free on the comparison: the inputs are usually interleaved at random, which defeats the predictor.
+template<typename T, typename Less = std::less<T>>
+T* mergeTwo(const T* a, size_t na, const T* b, size_t nb, T* out, Less less = Less())
+{
+    const T* a_end = a + na;
+    const T* b_end = b + nb;
+    while (a != a_end && b != b_end)
+    {
+        const bool take_b = less(*b, *a);
+        *out++ = take_b ? *b : *a;
+        b += take_b;
+        a += !take_b;
+    }
+    out = std::copy(a, a_end, out);
+    return std::copy(b, b_end, out);
+}
+
+// Merge path: number of elements taken from 'a' among the first 'diag' elements of the merged output
+template<typename T, typename Less>
+size_t mergePathSplit(const T* a, size_t na, const T* b, size_t nb, size_t diag, Less less)
+{
+    size_t lo = diag > nb ? diag - nb : 0;
+    size_t hi = diag < na ? diag : na;
+    while (lo < hi)
+    {
+        const size_t mid = (lo + hi) / 2;
+        if (less(b[diag - mid - 1], a[mid]))
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    return lo;
+}
+
+// Two-way merge using up to 'threads' threads (0: hardware concurrency). Each thread merges an equal share of the output,
+// its input ranges are found with a binary search along the merge path, so no thread waits on another.
+template<typename T, typename Less = std::less<T>>
+T* parallelMerge(const T* a, size_t na, const T* b, size_t nb, T* out, unsigned threads = 0, Less less = Less())
+{
+    const size_t total = na + nb;
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    const size_t min_per_thread = 1 << 16; // Below that, starting a thread costs more than merging
+    threads = (unsigned)std::min<size_t>(threads, std::max<size_t>(1, total / min_per_thread));
+    if (threads <= 1)
+        return mergeTwo(a, na, b, nb, out, less);
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (unsigned t = 0; t < threads; t++)
+    {
+        auto job = [=]()
+        {
+            const size_t diag_begin = total * t / threads;
+            const size_t diag_end = total * (t + 1) / threads;
+            const size_t a_begin = mergePathSplit(a, na, b, nb, diag_begin, less);
+            const size_t a_end = mergePathSplit(a, na, b, nb, diag_end, less);
+            mergeTwo(a + a_begin, a_end - a_begin, b + (diag_begin - a_begin), (diag_end - a_end) - (diag_begin - a_begin), out + diag_begin, less);
+        };
+        if (t + 1 < threads)
+            workers.emplace_back(job);
+        else
+            job(); // Last share on the calling thread
+    }
+    for (std::thread& worker : workers)
+        worker.join();
+    return out + total;
+}
+
+// K-way merge of 'runs' into out (sum of the run sizes). Returns the end of the output.
+// Loser tree: internal node n keeps the loser of the match played there, node 0 the overall winner. After outputting
+// the winner only its path to the root is replayed, log2(k) comparisons per element (a heap needs about twice as many).
+template<typename T, typename Less = std::less<T>>
+T* mergeK(const Run<T>* runs, size_t k, T* out, Less less = Less())
+{
+    if (k == 0)
+        return out;
+    if (k == 1)
+        return std::copy(runs[0].begin, runs[0].end, out);
+    if (k == 2)
+        return mergeTwo(runs[0].begin, runs[0].size(), runs[1].begin, runs[1].size(), out, less);
+
+    // Cursors, current front values and tree live on the stack for up to 64 runs
+    const size_t stack_ways = 64;
+    Run<T> stack_cursors[stack_ways];
+    T stack_fronts[stack_ways];
+    unsigned stack_tree[stack_ways];
+    std::vector<Run<T>> heap_cursors;
+    std::vector<T> heap_fronts;
+    std::vector<unsigned> heap_tree;
+    Run<T>* cursors = stack_cursors;
+    T* fronts = stack_fronts;
+    unsigned* tree = stack_tree;
+    if (k > stack_ways)
+    {
+        heap_cursors.resize(k);
+        heap_fronts.resize(k);
+        heap_tree.resize(k);
+        cursors = heap_cursors.data();
+        fronts = heap_fronts.data();
+        tree = heap_tree.data();
+    }
+    size_t total = 0;
+    for (size_t n = 0; n < k; n++)
+    {
+        cursors[n] = runs[n];
+        if (runs[n].begin != runs[n].end)
+            fronts[n] = *runs[n].begin;
+        total += runs[n].size();
+    }
+
+    // Does run 'x' win against run 'y'? Exhausted runs lose against everything, ties go to the lower run index (stability).
+    auto wins = [&](unsigned x, unsigned y) -> bool
+    {
+        const bool x_done = cursors[x].begin == cursors[x].end;
+        const bool y_done = cursors[y].begin == cursors[y].end;
+        if (x_done | y_done)
+            return !x_done;
+        if (less(fronts[x], fronts[y])) return true;
+        if (less(fronts[y], fronts[x])) return false;
+        return x < y;
+    };
+
+    // Fill the tree bottom-up: each internal node plays the winners of its two subtrees
+    // (leaf n sits at position n + k, the winner of each subtree is kept in 'up' meanwhile)
+    {
+        unsigned stack_up[2 * stack_ways];
+        std::vector<unsigned> heap_up(k > stack_ways ? 2 * k : 0);
+        unsigned* up = k > stack_ways ? heap_up.data() : stack_up;
+        for (size_t n = 0; n < k; n++)
+            up[n + k] = (unsigned)n;
+        for (size_t node = k - 1; node > 0; node--)
+        {
+            const unsigned l = up[2 * node], r = up[2 * node + 1];
+            const bool l_wins = wins(l, r);
+            up[node] = l_wins ? l : r;
+            tree[node] = l_wins ? r : l;
+        }
+        tree[0] = up[1];
+    }
+
+    for (size_t n = 0; n < total; n++)
+    {
+        unsigned winner = tree[0];
+        *out++ = fronts[winner];
+        if (++cursors[winner].begin != cursors[winner].end)
+            fronts[winner] = *cursors[winner].begin;
+        // Replay the matches on the path of the leaf that just advanced
+        for (size_t node = (winner + k) / 2; node > 0; node /= 2)
+        {
+            const unsigned loser = tree[node];
+            if (wins(loser, winner))
+            {
+                tree[node] = winner;
+                winner = loser;
+            }
+        }
+        tree[0] = winner;
+    }
+    return out;
+}
+
+// K-way merge using up to 'threads' threads (0: hardware concurrency).
+// Splitter values are taken at regular positions of the largest run, every run is cut at the same values with a binary search,
+// and each thread k-way merges its slice of every run into its own part of the output. Equal keys always land in the same
+// slice, so the result is identical to mergeK(). Slices are balanced as long as the runs hold similar value distributions.
+template<typename T, typename Less = std::less<T>>
+T* parallelMergeK(const Run<T>* runs, size_t k, T* out, unsigned threads = 0, Less less = Less())
+{
+    size_t total = 0, largest = 0;
+    for (size_t n = 0; n < k; n++)
+    {
+        total += runs[n].size();
+        if (runs[n].size() > runs[largest].size())
+            largest = n;
+    }
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    const size_t min_per_thread = 1 << 16;
+    threads = (unsigned)std::min<size_t>(threads, std::max<size_t>(1, total / min_per_thread));
+    if (threads <= 1 || k == 0)
+        return mergeK(runs, k, out, less);
+
+    // cuts[t * k + n]: start of slice t in run n
+    std::vector<const T*> cuts((threads + 1) * k);
+    for (size_t n = 0; n < k; n++)
+    {
+        cuts[n] = runs[n].begin;
+        cuts[threads * k + n] = runs[n].end;
+    }
+    const Run<T>& pivot_run = runs[largest];
+    for (unsigned t = 1; t < threads; t++)
+    {
+        const T& splitter = pivot_run.begin[pivot_run.size() * t / threads];
+        for (size_t n = 0; n < k; n++)
+            cuts[t * k + n] = std::lower_bound(runs[n].begin, runs[n].end, splitter, less);
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    T* slice_out = out;
+    for (unsigned t = 0; t < threads; t++)
+    {
+        size_t slice_size = 0;
+        for (size_t n = 0; n < k; n++)
+            slice_size += (size_t)(cuts[(t + 1) * k + n] - cuts[t * k + n]);
+        auto job = [=, &cuts]()
+        {
+            std::vector<Run<T>> slice(k);
+            for (size_t n = 0; n < k; n++)
+                slice[n] = { cuts[t * k + n], cuts[(t + 1) * k + n] };
+            mergeK(slice.data(), k, slice_out, less);
+        };
+        if (t + 1 < threads)
+            workers.emplace_back(job);
+        else
+            job();
+        slice_out += slice_size;
+    }
+    for (std::thread& worker : workers)
+        worker.join();
+    return out + total;
+}
+
+} // namespace merging
@@ -1,50 +1,51 @@
-#include <iostream>
-#include <limits>
-#include <iomanip>
-#include <string>
+// Prints info about the numeric types: size, digits, signedness, [min,max].
+// The table is computed at compile time (type_table.h) and written with a single write(), no iostream formatting.
+// Usage: numericlimits [--json]
+#include <cstdio>
+#include <cstring>
+#include "type_table.h"
 using namespace std;
 
-template <typename T>
-void info_of_type(string opis)
-{
-    cout << setw(18)
-    << opis <<":"
-    <<setw(2) << sizeof(T)
-    <<"|"
-    <<setw(2)
-    <<numeric_limits<T>::digits
-    <<(numeric_limits<T>::is_signed ? "|sign|":"|withoutsign|")
-    <<"["<<numeric_limits<T>::min()
-    <<","<<numeric_limits<T>::max()
-    <<"]"<<endl;
-}
-
-int main()
-{
-    cout<<"Printing info about types:"<<endl<<endl;
-
-    info_of_type<short int>("short int");
-    info_of_type<signed short int>("signed short int");
-    info_of_type<unsigned short int>("unsigned short int");
-
-    cout<<endl;
+static constexpr const char* type_names[] = {
+    "short int", "signed short int", "unsigned short int",
+    "int", "signed int", "unsigned int",
+    "long int", "signed long int", "unsigned long int",
+    "char", "float", "double",
+};
 
-    info_of_type<int>("int");
-    info_of_type<signed int>("signed int");
-    info_of_type<unsigned int>("unsigned int");
+static constexpr auto types = typetable::typeTable<
+    short int, signed short int, unsigned short int,
+    int, signed int, unsigned int,
+    long int, signed long int, unsigned long int,
+    char, float, double>(type_names);
 
-    cout<<endl;
-
-    info_of_type<long int>("long int");
-    info_of_type<signed long int>("signed long int");
-    info_of_type<unsigned long int>("unsigned long int");
-
-    cout<<endl;
-
-    info_of_type<char>("char");
-    info_of_type<float>("float");
-    info_of_type<double>("double");
-
-    cout<<endl;
+static_assert(types[3].size == sizeof(int) && types[3].is_signed, "table built at compile time");
 
+int main(int argc, char** argv)
+{
+    const bool json = argc > 1 && strcmp(argv[1], "--json") == 0;
+
+    char storage[256 + types.size() * typetable::kMaxRowChars];
+    typetable::Buffer out(storage, sizeof(storage));
+    if (json)
+    {
+        typetable::renderJson(out, types.data(), types.size());
+    }
+    else
+    {
+        out.append("Printing info about types:\n\n");
+        // groups of 3 types, separated by an empty line
+        for (size_t n = 0; n < types.size(); n += 3)
+        {
+            typetable::renderText(out, types.data() + n, 3);
+            out.append("\n");
+        }
+    }
+
+    if (out.overflow || !typetable::writeAll(1, out.begin, out.size()))
+    {
+        fprintf(stderr, "numericlimits: output failed\n");
+        return 1;
+    }
+    return 0;
 }
@@ -1,17 +1,17 @@
 // C++ program to check if the number is even
 // or odd using modulo operator
-#include <bits/stdc++.h>
-using namespace std;
+#include "out_sink.h"
 
 int main() {
+    outsink::Sink out;
     int n = 11;
 
     // If n is completely divisible by 2
     if (n % 2 == 0)
-        cout << "Even";
+        out << "Even";
 
     // If n is NOT completely divisible by 2
     else
-        cout << "Odd";
+        out << "Odd";
     return 0;
 }
\ No newline at end of file
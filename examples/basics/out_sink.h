@@ -0,0 +1,177 @@
+// Buffered output sink for command line tools: text goes to a large buffer, write() happens when it's full or on flush().
+// Header only, C++17, POSIX write().
+//
+//     outsink::Sink out;                           // stdout, 64 KB buffer
+//     out << "Stars: " << count << '\n';           // no flush per line, unlike endl
+//     out << outsink::repeat('*', count);          // runs are memset, long runs reuse one filled buffer
+//     out.flush();                                 // before reading input, or when the output must be seen now
+//
+// Nothing is flushed implicitly except when the buffer is full and in the destructor.
+// Numbers are formatted with std::to_chars (no locale). Errors are sticky: see failed().
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <unistd.h>
+
+namespace outsink
+{
+
+// 'count' times the character 'c', see Sink::fill()
+struct Repeat
+{
+    char    c;
+    size_t  count;
+};
+
+inline Repeat repeat(char c, size_t count) { return Repeat{ c, count }; }
+
+class Sink
+{
+public:
+    explicit Sink(int fd = 1, size_t capacity = 64 << 10) : m_fd(fd), m_buffer(std::max<size_t>(capacity, 64)) {}
+    ~Sink() { flush(); }
+
+    Sink(const Sink&) = delete;
+    Sink& operator=(const Sink&) = delete;
+
+    Sink& write(const char* data, size_t size)
+    {
+        if (size <= room())
+        {
+            memcpy(m_buffer.data() + m_used, data, size);
+            m_used += size;
+            return *this;
+        }
+        // Larger than what's left: complete the buffer, then write big pieces directly
+        const size_t head = room();
+        memcpy(m_buffer.data() + m_used, data, head);
+        m_used += head;
+        data += head;
+        size -= head;
+        flush();
+        if (size >= m_buffer.size())
+        {
+            writeAll(data, size);
+            return *this;
+        }
+        memcpy(m_buffer.data(), data, size);
+        m_used = size;
+        return *this;
+    }
+
+    Sink& put(char c)
+    {
+        if (m_used == m_buffer.size())
+            flush();
+        m_buffer[m_used++] = c;
+        return *this;
+    }
+
+    // 'count' times 'c'. Once a whole buffer has been filled with 'c' it's written again as is, no memset per chunk.
+    Sink& fill(char c, size_t count)
+    {
+        const size_t head = std::min(count, room());
+        memset(m_buffer.data() + m_used, c, head);
+        m_used += head;
+        count -= head;
+        if (count == 0)
+            return *this;
+        flush();
+        memset(m_buffer.data(), c, std::min(count, m_buffer.size()));
+        while (count >= m_buffer.size())
+        {
+            m_used = m_buffer.size();
+            flush();
+            count -= m_buffer.size();
+        }
+        m_used = count;             // Already filled
+        return *this;
+    }
+
+    // Integers and floating point values, shortest round trip form for the latter
+    template<typename T>
+    Sink& number(T value)
+    {
+        static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, "number() takes integers and floating point values");
+        if (room() < 64)
+            flush();
+        char* p = m_buffer.data() + m_used;
+        m_used = (size_t)(std::to_chars(p, p + 64, value).ptr - m_buffer.data());
+        return *this;
+    }
+
+    // 0x-prefixed hexadecimal address, as cout prints a pointer
+    Sink& pointer(const void* p)
+    {
+        if (room() < 24)
+            flush();
+        char* out = m_buffer.data() + m_used;
+        *out++ = '0';
+        *out++ = 'x';
+        m_used = (size_t)(std::to_chars(out, out + 16, (uintptr_t)p, 16).ptr - m_buffer.data());
+        return *this;
+    }
+
+    // Write the buffered text. Returns false if this or an earlier write failed.
+    bool flush()
+    {
+        if (m_used > 0)
+        {
+            writeAll(m_buffer.data(), m_used);
+            m_used = 0;
+        }
+        return !m_failed;
+    }
+
+    bool    failed() const { return m_failed; }
+    size_t  writeCalls() const { return m_write_calls; }      // write() system calls so far
+    size_t  capacity() const { return m_buffer.size(); }
+
+    Sink& operator<<(std::string_view text)     { return write(text.data(), text.size()); }
+    Sink& operator<<(const char* text)          { return write(text, strlen(text)); }
+    Sink& operator<<(const std::string& text)   { return write(text.data(), text.size()); }
+    Sink& operator<<(char c)                    { return put(c); }
+    Sink& operator<<(bool value)                { return value ? write("1", 1) : write("0", 1); }
+    Sink& operator<<(const void* p)             { return pointer(p); }
+    Sink& operator<<(Repeat run)                { return fill(run.c, run.count); }
+    template<typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+    Sink& operator<<(T value)                   { return number(value); }
+
+private:
+    size_t room() const { return m_buffer.size() - m_used; }
+
+    void writeAll(const char* data, size_t size)
+    {
+        while (size > 0 && !m_failed)
+        {
+            const ssize_t written = ::write(m_fd, data, size);
+            m_write_calls++;
+            if (written < 0)
+            {
+                if (errno != EINTR)
+                    m_failed = true;
+                continue;
+            }
+            data += written;
+            size -= (size_t)written;
+        }
+    }
+
+    int                 m_fd;
+    std::vector<char>   m_buffer;
+    size_t              m_used = 0;
+    size_t              m_write_calls = 0;
+    bool                m_failed = false;
+};
+
+} // namespace outsink
@@ -1,14 +1,14 @@
-#include <iostream>
+#include "out_sink.h"
 
-using namespace std;
+static outsink::Sink out;
 
 
 void foo(const char*){
-    cout<<"Const char here"<<endl;
+    out<<"Const char here\n";
 }
 
 void foo(short){
-    cout<<"Short here"<<endl;
+    out<<"Short here\n";
 }
 
 int main(){
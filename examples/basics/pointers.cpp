@@ -1,17 +1,17 @@
-#include <iostream>
-using namespace std;
+#include "out_sink.h"
 
 int main() {
+    outsink::Sink out;
     int var = 10;
 
     // declare pointer and store address of x
     int* ptr = &var;
 
     // print value and address
-    cout << "Value of x: " << var << endl;
-    cout << "Address of x: " << &var << endl;
-    cout << "Value stored in pointer ptr: " << ptr << endl;
-    cout << "Value pointed to by ptr: " << *ptr << endl;
+    out << "Value of x: " << var << '\n';
+    out << "Address of x: " << &var << '\n';
+    out << "Value stored in pointer ptr: " << ptr << '\n';
+    out << "Value pointed to by ptr: " << *ptr << '\n';
 
     return 0;
 }
\ No newline at end of file
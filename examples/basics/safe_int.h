@@ -0,0 +1,174 @@
+// Overflow-safe integer arithmetic. Header only, C++17, GCC/Clang (__builtin_*_overflow).
+//
+//  Checked<T>      result plus a sticky overflow flag, the value wraps like the hardware would (no undefined behavior)
+//  Saturating<T>   clamps to [min, max] of T
+//  Wrapping<T>     modulo 2^bits for signed types too (two's complement), what INT_MAX + 1 "does" without being UB
+//  addSaturate()   batch: acc[i] = saturate(acc[i] + x[i]) over arrays of 8/16-bit integers, 16 or 32 lanes at a time
+//                  (SSE2 _mm_adds_epi16 and friends, AVX2 when compiled with -mavx2)
+//
+// The scalar types are plain wrappers of one T: arrays of them have the layout of arrays of T.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace safeint
+{
+
+template<typename T>
+struct Checked
+{
+    static_assert(std::is_integral<T>::value, "Checked<T> needs an integer type");
+    T       value = 0;
+    bool    overflow = false;       // Set by the first overflowing operation, kept by all the following ones
+
+    Checked() = default;
+    Checked(T v) : value(v) {}
+
+    Checked& operator+=(T rhs) { overflow |= __builtin_add_overflow(value, rhs, &value); return *this; }
+    Checked& operator-=(T rhs) { overflow |= __builtin_sub_overflow(value, rhs, &value); return *this; }
+    Checked& operator*=(T rhs) { overflow |= __builtin_mul_overflow(value, rhs, &value); return *this; }
+    Checked& operator+=(Checked rhs) { overflow |= rhs.overflow; return *this += rhs.value; }
+    Checked& operator-=(Checked rhs) { overflow |= rhs.overflow; return *this -= rhs.value; }
+    Checked& operator*=(Checked rhs) { overflow |= rhs.overflow; return *this *= rhs.value; }
+    friend Checked operator+(Checked a, Checked b) { return a += b; }
+    friend Checked operator-(Checked a, Checked b) { return a -= b; }
+    friend Checked operator*(Checked a, Checked b) { return a *= b; }
+    Checked& operator++() { return *this += (T)1; }
+    Checked& operator--() { return *this -= (T)1; }
+};
+
+template<typename T>
+struct Saturating
+{
+    static_assert(std::is_integral<T>::value, "Saturating<T> needs an integer type");
+    T       value = 0;
+
+    Saturating() = default;
+    Saturating(T v) : value(v) {}
+
+    // On overflow the true result has the sign of rhs (add), of -rhs (sub), of a * b (mul)
+    Saturating& operator+=(T rhs)
+    {
+        if (__builtin_add_overflow(value, rhs, &value))
+            value = (std::is_signed<T>::value && rhs < 0) ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+        return *this;
+    }
+    Saturating& operator-=(T rhs)
+    {
+        if (__builtin_sub_overflow(value, rhs, &value))
+            value = (std::is_signed<T>::value && rhs < 0) ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min();
+        return *this;
+    }
+    Saturating& operator*=(T rhs)
+    {
+        const bool negative = std::is_signed<T>::value && ((value < 0) != (rhs < 0));
+        if (__builtin_mul_overflow(value, rhs, &value))
+            value = negative ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+        return *this;
+    }
+    friend Saturating operator+(Saturating a, Saturating b) { return a += b.value; }
+    friend Saturating operator-(Saturating a, Saturating b) { return a -= b.value; }
+    friend Saturating operator*(Saturating a, Saturating b) { return a *= b.value; }
+    Saturating& operator++() { return *this += (T)1; }
+    Saturating& operator--() { return *this -= (T)1; }
+};
+
+template<typename T>
+struct Wrapping
+{
+    static_assert(std::is_integral<T>::value, "Wrapping<T> needs an integer type");
+    typedef typename std::make_unsigned<T>::type U;
+    T       value = 0;
+
+    Wrapping() = default;
+    Wrapping(T v) : value(v) {}
+
+    // Unsigned arithmetic is defined modulo 2^bits, the conversion back to T is two's complement (C++20, and GCC/Clang before)
+    Wrapping& operator+=(T rhs) { value = (T)(U)((U)value + (U)rhs); return *this; }
+    Wrapping& operator-=(T rhs) { value = (T)(U)((U)value - (U)rhs); return *this; }
+    // At least unsigned int: 16-bit operands would be promoted to int, where 65535 * 65535 overflows
+    Wrapping& operator*=(T rhs)
+    {
+        typedef typename std::common_type<U, unsigned int>::type W;
+        value = (T)(U)((W)(U)value * (W)(U)rhs);
+        return *this;
+    }
+    friend Wrapping operator+(Wrapping a, Wrapping b) { return a += b.value; }
+    friend Wrapping operator-(Wrapping a, Wrapping b) { return a -= b.value; }
+    friend Wrapping operator*(Wrapping a, Wrapping b) { return a *= b.value; }
+    Wrapping& operator++() { return *this += (T)1; }
+    Wrapping& operator--() { return *this -= (T)1; }
+};
+
+// Scalar saturating add, used for the tails of the batch versions
+template<typename T>
+inline T saturateAdd(T a, T b)
+{
+    Saturating<T> s(a);
+    s += b;
+    return s.value;
+}
+
+// acc[i] = saturate(acc[i] + x[i]), i < count
+#if defined(__AVX2__) || defined(__SSE2__)
+#if defined(__AVX2__)
+#define SAFEINT_BATCH(TYPE, ADDS)                                                                   \
+inline void addSaturate(TYPE* acc, const TYPE* x, size_t count)                                    \
+{                                                                                                   \
+    const size_t lanes = 32 / sizeof(TYPE);                                                         \
+    size_t i = 0;                                                                                   \
+    for (; i + 2 * lanes <= count; i += 2 * lanes)                                                  \
+    {                                                                                               \
+        const __m256i a0 = _mm256_loadu_si256((const __m256i*)(acc + i));                           \
+        const __m256i a1 = _mm256_loadu_si256((const __m256i*)(acc + i + lanes));                   \
+        const __m256i x0 = _mm256_loadu_si256((const __m256i*)(x + i));                             \
+        const __m256i x1 = _mm256_loadu_si256((const __m256i*)(x + i + lanes));                     \
+        _mm256_storeu_si256((__m256i*)(acc + i), _mm256_##ADDS(a0, x0));                            \
+        _mm256_storeu_si256((__m256i*)(acc + i + lanes), _mm256_##ADDS(a1, x1));                    \
+    }                                                                                               \
+    for (; i < count; i++)                                                                          \
+        acc[i] = saturateAdd(acc[i], x[i]);                                                         \
+}
+#else
+#define SAFEINT_BATCH(TYPE, ADDS)                                                                   \
+inline void addSaturate(TYPE* acc, const TYPE* x, size_t count)                                    \
+{                                                                                                   \
+    const size_t lanes = 16 / sizeof(TYPE);                                                         \
+    size_t i = 0;                                                                                   \
+    for (; i + 2 * lanes <= count; i += 2 * lanes)                                                  \
+    {                                                                                               \
+        const __m128i a0 = _mm_loadu_si128((const __m128i*)(acc + i));                              \
+        const __m128i a1 = _mm_loadu_si128((const __m128i*)(acc + i + lanes));                      \
+        const __m128i x0 = _mm_loadu_si128((const __m128i*)(x + i));                                \
+        const __m128i x1 = _mm_loadu_si128((const __m128i*)(x + i + lanes));                        \
+        _mm_storeu_si128((__m128i*)(acc + i), _mm_##ADDS(a0, x0));                                  \
+        _mm_storeu_si128((__m128i*)(acc + i + lanes), _mm_##ADDS(a1, x1));                          \
+    }                                                                                               \
+    for (; i < count; i++)                                                                          \
+        acc[i] = saturateAdd(acc[i], x[i]);                                                         \
+}
+#endif
+SAFEINT_BATCH(int8_t, adds_epi8)
+SAFEINT_BATCH(uint8_t, adds_epu8)
+SAFEINT_BATCH(int16_t, adds_epi16)
+SAFEINT_BATCH(uint16_t, adds_epu16)
+#undef SAFEINT_BATCH
+#else
+template<typename T>
+inline void addSaturate(T* acc, const T* x, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        acc[i] = saturateAdd(acc[i], x[i]);
+}
+#endif
+
+} // namespace safeint
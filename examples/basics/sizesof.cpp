@@ -1,4 +1,5 @@
 #include <iostream>
+#include "struct_layout.h"
 
 using namespace std;
 
@@ -17,10 +18,25 @@ struct C{
     char b;
 };
 
-int main(){
-
+// padding depends on the field order: D has 7 padding bytes, with its fields sorted by alignment it fits in 12 bytes
+struct D{
     char a;
     int b;
+    char c;
+    short d;
+    char e;
+};
+
+// offsets, padding and cache line spans, computed at compile time (struct_layout.h)
+constexpr auto layoutA = layout::describe<A>("A", { LAYOUT_FIELD(A, a), LAYOUT_FIELD(A, b) });
+constexpr auto layoutB = layout::describe<B>("B", { LAYOUT_FIELD(B, a), LAYOUT_FIELD(B, b) });
+constexpr auto layoutC = layout::describe<C>("C", { LAYOUT_FIELD(C, a), LAYOUT_FIELD(C, b) });
+constexpr auto layoutD = layout::describe<D>("D", { LAYOUT_FIELD(D, a), LAYOUT_FIELD(D, b), LAYOUT_FIELD(D, c), LAYOUT_FIELD(D, d), LAYOUT_FIELD(D, e) });
+
+static_assert(layoutC.paddingBytes() == 0, "two chars need no padding");
+static_assert(layoutD.packedSize() < sizeof(D), "reordering D saves bytes");
+
+int main(){
 
     cout <<"Size of struc A: "<<sizeof(A)<<endl;
 
@@ -28,8 +44,14 @@ int main(){
 
     cout <<"Size of struc C: "<<sizeof(C)<<endl;
 
+    cout <<"Size of struc D: "<<sizeof(D)<<"\n\n";
 
+    cout.flush();
+    layout::printReport(layoutA);
+    layout::printReport(layoutB);
+    layout::printReport(layoutC);
+    layout::printReport(layoutD);
 
     return 0;
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,179 @@
+// Struct layout inspection: field offsets, padding holes, cache-line spans and a packed field order, all computed at
+// compile time from a list of fields. Header only, C++17.
+//
+//  LAYOUT_FIELD(T, member)          one field: name, offset, size, alignment
+//  layout::describe<T>(name, {...}) constexpr Layout of T from its fields (declaration order not required)
+//  paddingBytes() / packedSize()    bytes lost to holes and tail padding / size with the fields sorted by alignment
+//  straddlingElements()             elements of a T[] that cross a 64 bytes line (array base aligned on a line)
+//  printReport()                    human readable report (printf)
+//
+// Fields at the same offset (union members) are merged into one slot of the largest size.
+// Bit fields can't be listed (offsetof doesn't apply to them), nor can members of a non standard layout type be relied on.
+//
+//     constexpr auto vert = layout::describe<ImDrawVert>("ImDrawVert",
+//         { LAYOUT_FIELD(ImDrawVert, pos), LAYOUT_FIELD(ImDrawVert, uv), LAYOUT_FIELD(ImDrawVert, col) });
+//     static_assert(vert.paddingBytes() == 0, "ImDrawVert grew a hole");
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdio>
+
+namespace layout
+{
+
+static const size_t kCacheLine = 64;
+
+struct Field
+{
+    const char* name;
+    size_t      offset;
+    size_t      size;
+    size_t      align;
+};
+
+#define LAYOUT_FIELD(T, member) layout::Field{ #member, offsetof(T, member), sizeof(decltype(T::member)), alignof(decltype(T::member)) }
+
+constexpr size_t roundUp(size_t value, size_t align) { return (value + align - 1) / align * align; }
+
+template<size_t N>
+struct Layout
+{
+    const char*             name;
+    size_t                  size;
+    size_t                  align;
+    std::array<Field, N>    fields;     // Sorted by offset, union members merged
+    size_t                  count;      // Fields in use after merging
+
+    // Holes between fields plus tail padding
+    constexpr size_t paddingBytes() const
+    {
+        size_t used = 0;
+        for (size_t n = 0; n < count; n++)
+            used += fields[n].size;
+        return size - used;
+    }
+
+    // Size with the fields sorted by decreasing alignment, the order that never needs a hole
+    constexpr size_t packedSize() const
+    {
+        std::array<Field, N> sorted = packedOrder();
+        size_t end = 0;
+        for (size_t n = 0; n < count; n++)
+            end = roundUp(end, sorted[n].align) + sorted[n].size;
+        return roundUp(end, align);
+    }
+
+    // Fields by decreasing alignment, then decreasing size (stable: ties keep the declaration order)
+    constexpr std::array<Field, N> packedOrder() const
+    {
+        std::array<Field, N> sorted = fields;
+        for (size_t i = 1; i < count; i++)
+            for (size_t j = i; j > 0; j--)
+            {
+                const Field& a = sorted[j - 1];
+                const Field& b = sorted[j];
+                if (b.align > a.align || (b.align == a.align && b.size > a.size))
+                {
+                    const Field tmp = sorted[j - 1];
+                    sorted[j - 1] = sorted[j];
+                    sorted[j] = tmp;
+                }
+                else
+                    break;
+            }
+        return sorted;
+    }
+
+    // Out of one period of an array (lcm(size, 64) bytes), how many elements cross a cache line boundary
+    constexpr size_t periodElements() const
+    {
+        size_t bytes = size;
+        while (bytes % kCacheLine != 0)
+            bytes += size;
+        return bytes / size;
+    }
+    constexpr size_t straddlingElements() const
+    {
+        size_t straddling = 0;
+        for (size_t n = 0; n < periodElements(); n++)
+            if ((n * size) / kCacheLine != (n * size + size - 1) / kCacheLine)
+                straddling++;
+        return straddling;
+    }
+
+    // Cache lines touched by one element at an aligned address
+    constexpr size_t linesSpanned() const { return (size + kCacheLine - 1) / kCacheLine; }
+
+    // Fields crossing a cache line boundary when the struct itself starts on a line
+    constexpr bool fieldStraddles(size_t n) const
+    {
+        return fields[n].offset / kCacheLine != (fields[n].offset + fields[n].size - 1) / kCacheLine;
+    }
+};
+
+template<typename T, size_t N>
+constexpr Layout<N> describe(const char* name, const Field (&fields)[N])
+{
+    Layout<N> out = { name, sizeof(T), alignof(T), {}, 0 };
+    for (size_t n = 0; n < N; n++)
+        out.fields[n] = fields[n];
+
+    // Sort by offset (insertion sort: constexpr, and N is small)
+    for (size_t i = 1; i < N; i++)
+        for (size_t j = i; j > 0 && out.fields[j].offset < out.fields[j - 1].offset; j--)
+        {
+            const Field tmp = out.fields[j - 1];
+            out.fields[j - 1] = out.fields[j];
+            out.fields[j] = tmp;
+        }
+
+    // Merge union members: same offset -> one slot, named after the first, of the largest size and alignment
+    for (size_t n = 0; n < N; n++)
+    {
+        if (out.count > 0 && out.fields[out.count - 1].offset == out.fields[n].offset)
+        {
+            Field& slot = out.fields[out.count - 1];
+            slot.size = slot.size > out.fields[n].size ? slot.size : out.fields[n].size;
+            slot.align = slot.align > out.fields[n].align ? slot.align : out.fields[n].align;
+            continue;
+        }
+        out.fields[out.count++] = out.fields[n];
+    }
+    return out;
+}
+
+template<size_t N>
+void printReport(const Layout<N>& l, FILE* out = stdout)
+{
+    fprintf(out, "%s: %zu bytes, align %zu, %zu padding bytes", l.name, l.size, l.align, l.paddingBytes());
+    if (l.packedSize() < l.size)
+        fprintf(out, " -> %zu bytes when reordered", l.packedSize());
+    fprintf(out, "\n");
+
+    size_t end = 0;
+    for (size_t n = 0; n < l.count; n++)
+    {
+        const Field& f = l.fields[n];
+        if (f.offset > end)
+            fprintf(out, "  %6zu  %4zu  %s\n", end, f.offset - end, "(hole)");
+        fprintf(out, "  %6zu  %4zu  %s%s\n", f.offset, f.size, f.name, l.fieldStraddles(n) ? "  crosses a cache line" : "");
+        end = f.offset + f.size;
+    }
+    if (l.size > end)
+        fprintf(out, "  %6zu  %4zu  %s\n", end, l.size - end, "(tail padding)");
+
+    const size_t straddling = l.straddlingElements();
+    fprintf(out, "  array: %zu line(s) per element, %zu of every %zu elements cross a cache line\n",
+        l.linesSpanned(), straddling, l.periodElements());
+    if (l.packedSize() < l.size)
+    {
+        const std::array<Field, N> order = l.packedOrder();
+        fprintf(out, "  packed order:");
+        for (size_t n = 0; n < l.count; n++)
+            fprintf(out, " %s", order[n].name);
+        fprintf(out, "\n");
+    }
+}
+
+} // namespace layout
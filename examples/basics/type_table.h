@@ -0,0 +1,203 @@
+// Numeric type capability table, built at compile time for a list of types, rendered without iostream.
+// Header only, C++17.
+//
+//  info_of_type<T>(name)        constexpr TypeInfo of one type (size, digits, signedness, min/max)
+//  typeTable<Ts...>(names)      constexpr std::array<TypeInfo, sizeof...(Ts)>, one entry per type, in order
+//  renderText() / renderJson()  append the table to a char buffer with std::to_chars (no locale, no allocation)
+//  writeAll()                   write the buffer to a file descriptor, one write() call unless the kernel splits it
+#pragma once
+
+#include <array>
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include <unistd.h>
+
+namespace typetable
+{
+
+struct TypeInfo
+{
+    const char* name;
+    int         size;
+    int         digits;
+    bool        is_signed;
+    bool        is_integer;
+    // min/max in the widest type of the same kind, only one of the three pairs is used
+    int64_t     min_i;
+    int64_t     max_i;
+    uint64_t    max_u;          // unsigned integers (min is 0)
+    long double min_f;          // floating point: numeric_limits<T>::min() is the smallest positive normal value
+    long double max_f;
+    int         float_bits;     // 32, 64 or 80/128: floating values are printed at the precision of their own type
+};
+
+template<typename T>
+constexpr TypeInfo info_of_type(const char* name)
+{
+    static_assert(std::numeric_limits<T>::is_specialized, "numeric_limits is not specialized for this type");
+    typedef std::numeric_limits<T> limits;
+    TypeInfo info = { name, (int)sizeof(T), limits::digits, limits::is_signed, limits::is_integer, 0, 0, 0, 0.0L, 0.0L, 0 };
+    if constexpr (limits::is_integer && limits::is_signed)
+    {
+        info.min_i = (int64_t)limits::min();
+        info.max_i = (int64_t)limits::max();
+    }
+    else if constexpr (limits::is_integer)
+    {
+        info.max_u = (uint64_t)limits::max();
+    }
+    else
+    {
+        info.min_f = (long double)limits::min();
+        info.max_f = (long double)limits::max();
+        info.float_bits = (int)sizeof(T) * 8;
+    }
+    return info;
+}
+
+template<typename... Ts, size_t... Is>
+constexpr std::array<TypeInfo, sizeof...(Ts)> typeTableImpl(const char* const* names, std::index_sequence<Is...>)
+{
+    return { { info_of_type<Ts>(names[Is])... } };
+}
+
+// names[i] is the display name of the i-th type
+template<typename... Ts>
+constexpr std::array<TypeInfo, sizeof...(Ts)> typeTable(const char* const (&names)[sizeof...(Ts)])
+{
+    return typeTableImpl<Ts...>(names, std::index_sequence_for<Ts...>());
+}
+
+// Upper bound of the rendered size of one row in either format, for names up to 32 characters
+static const size_t kMaxRowChars = 192;
+
+// Output buffer: the caller owns the storage, appends past the capacity are dropped and flagged
+struct Buffer
+{
+    char*   begin;
+    char*   pos;
+    char*   end;
+    bool    overflow = false;
+
+    Buffer(char* storage, size_t capacity) : begin(storage), pos(storage), end(storage + capacity) {}
+    size_t size() const { return (size_t)(pos - begin); }
+
+    void append(const char* s, size_t len)
+    {
+        if (len > (size_t)(end - pos)) { overflow = true; return; }
+        memcpy(pos, s, len);
+        pos += len;
+    }
+    void append(const char* s) { append(s, strlen(s)); }
+    void pad(size_t count, char c = ' ')
+    {
+        if (count > (size_t)(end - pos)) { overflow = true; return; }
+        memset(pos, c, count);
+        pos += count;
+    }
+    template<typename V>
+    void number(V value)
+    {
+        const std::to_chars_result r = std::to_chars(pos, end, value);
+        if (r.ec != std::errc()) { overflow = true; return; }
+        pos = r.ptr;
+    }
+    // Right aligned in 'width' columns, like setw()
+    template<typename V>
+    void number(V value, size_t width)
+    {
+        char tmp[64];
+        const std::to_chars_result r = std::to_chars(tmp, tmp + sizeof(tmp), value);
+        const size_t len = (size_t)(r.ptr - tmp);
+        if (len < width)
+            pad(width - len);
+        append(tmp, len);
+    }
+};
+
+inline void renderValue(Buffer& out, const TypeInfo& info, bool max)
+{
+    if (info.is_integer && info.is_signed)
+        out.number(max ? info.max_i : info.min_i);
+    else if (info.is_integer)
+        out.number(max ? info.max_u : (uint64_t)0);
+    else if (info.float_bits == 32)
+        out.number((float)(max ? info.max_f : info.min_f));
+    else if (info.float_bits == 64)
+        out.number((double)(max ? info.max_f : info.min_f));
+    else
+        out.number(max ? info.max_f : info.min_f);
+}
+
+// "        short int: 2|15|sign|[-32768,32767]", the numericlimits.cpp layout
+inline void renderText(Buffer& out, const TypeInfo* infos, size_t count)
+{
+    for (size_t n = 0; n < count; n++)
+    {
+        const TypeInfo& info = infos[n];
+        const size_t name_len = strlen(info.name);
+        if (name_len < 18)
+            out.pad(18 - name_len);
+        out.append(info.name, name_len);
+        out.append(":");
+        out.number(info.size, 2);
+        out.append("|");
+        out.number(info.digits, 2);
+        out.append(info.is_signed ? "|sign|" : "|withoutsign|");
+        out.append("[");
+        renderValue(out, info, false);
+        out.append(",");
+        renderValue(out, info, true);
+        out.append("]\n");
+    }
+}
+
+// [{"name":"int","size":4,"digits":31,"signed":true,"integer":true,"min":-2147483648,"max":2147483647}, ...]
+// Names are written as is: they are C++ type names, nothing to escape.
+inline void renderJson(Buffer& out, const TypeInfo* infos, size_t count)
+{
+    out.append("[\n");
+    for (size_t n = 0; n < count; n++)
+    {
+        const TypeInfo& info = infos[n];
+        out.append("  {\"name\":\"");
+        out.append(info.name);
+        out.append("\",\"size\":");
+        out.number(info.size);
+        out.append(",\"digits\":");
+        out.number(info.digits);
+        out.append(info.is_signed ? ",\"signed\":true" : ",\"signed\":false");
+        out.append(info.is_integer ? ",\"integer\":true,\"min\":" : ",\"integer\":false,\"min\":");
+        renderValue(out, info, false);
+        out.append(",\"max\":");
+        renderValue(out, info, true);
+        out.append(n + 1 < count ? "},\n" : "}\n");
+    }
+    out.append("]\n");
+}
+
+// Returns false on a write error. Loops only on short writes (pipes, signals).
+inline bool writeAll(int fd, const char* data, size_t size)
+{
+    while (size > 0)
+    {
+        const ssize_t written = ::write(fd, data, size);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        data += written;
+        size -= (size_t)written;
+    }
+    return true;
+}
+
+} // namespace typetable
@@ -0,0 +1,391 @@
+// Streaming unit conversion of numeric logs (footcovert.cpp, at file scale).
+// Header only, C++17, POSIX read()/write().
+//
+// The input is lines of numbers separated by spaces, tabs, ',' or ';', every line with the same number of columns.
+// Column c is converted with its unit: out = in * factor + offset. Lines are written back with one separator.
+//
+//  findUnit()          unit by name from kUnits ("m_to_ft", "c_to_f", ...)
+//  convertStream()     fd -> fd: read in large blocks, parse, convert a block of values at once (SSE2), format, write
+//
+// Parsing: plain decimals ("-12.345") with at most 15 significant digits take an exact fast path (mantissa / 10^k,
+// both exact doubles, so the division is correctly rounded), anything else goes through std::from_chars.
+// Formatting: fixed 'precision' decimals through 64-bit integers, values beyond 9e15 / 10^precision in std::to_chars shortest form.
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace unitconv
+{
+
+struct Unit
+{
+    const char* name;
+    double      factor;
+    double      offset;
+};
+
+static const Unit kUnits[] =
+{
+    { "none",       1.0,                0.0 },
+    { "m_to_ft",    1.0 / 0.3048,       0.0 },
+    { "ft_to_m",    0.3048,             0.0 },
+    { "km_to_mi",   1.0 / 1.609344,     0.0 },
+    { "mi_to_km",   1.609344,           0.0 },
+    { "kg_to_lb",   1.0 / 0.45359237,   0.0 },
+    { "lb_to_kg",   0.45359237,         0.0 },
+    { "c_to_f",     1.8,                32.0 },
+    { "f_to_c",     1.0 / 1.8,          -32.0 / 1.8 },
+    { "c_to_k",     1.0,                273.15 },
+    { "k_to_c",     1.0,                -273.15 },
+    { "pa_to_psi",  1.0 / 6894.757293168, 0.0 },
+    { "psi_to_pa",  6894.757293168,     0.0 },
+};
+
+inline const Unit* findUnit(const char* name, size_t len)
+{
+    for (const Unit& unit : kUnits)
+        if (strlen(unit.name) == len && memcmp(unit.name, name, len) == 0)
+            return &unit;
+    return nullptr;
+}
+
+inline const Unit* findUnit(const char* name) { return findUnit(name, strlen(name)); }
+
+struct Options
+{
+    std::vector<Unit>   columns;                // One unit per column (the number of columns of every line)
+    int                 precision = 3;          // Decimals written, 0..9
+    char                separator = ' ';        // Written between columns
+    size_t              block_size = 1 << 20;   // Read and write buffer size. A line must fit in one block.
+};
+
+struct Stats
+{
+    size_t  bytes_in = 0;
+    size_t  bytes_out = 0;
+    size_t  values = 0;
+    size_t  lines = 0;
+    size_t  reads = 0;
+    size_t  writes = 0;
+};
+
+inline bool isSeparator(char c) { return c == ' ' || c == '\t' || c == ',' || c == ';' || c == '\r'; }
+
+// Exact fast path for [-]digits[.digits] with at most 15 significant digits, else std::from_chars
+inline const char* parseNumber(const char* p, const char* end, double& out)
+{
+    static const double pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18 };
+    const char* start = p;
+    const bool negative = p != end && *p == '-';
+    p += negative;
+    uint64_t mantissa = 0;
+    int digits = 0, decimals = 0;
+    while (p != end && (unsigned)(*p - '0') < 10)
+    {
+        mantissa = mantissa * 10 + (unsigned)(*p++ - '0');
+        digits++;
+    }
+    if (p != end && *p == '.')
+    {
+        p++;
+        while (p != end && (unsigned)(*p - '0') < 10)
+        {
+            mantissa = mantissa * 10 + (unsigned)(*p++ - '0');
+            digits++;
+            decimals++;
+        }
+    }
+    const bool plain = digits > 0 && digits <= 15 && (p == end || (*p != 'e' && *p != 'E'));
+    if (plain)
+    {
+        const double value = (double)mantissa / pow10[decimals];
+        out = negative ? -value : value;
+        return p;
+    }
+    const std::from_chars_result r = std::from_chars(start, end, out);
+    return r.ec == std::errc() ? r.ptr : nullptr;
+}
+
+// Number of decimal digits of value, without a loop (no mispredicted branches on random lengths)
+inline int countDigits(uint64_t value)
+{
+    static const uint64_t pow10[] = { 1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull,
+        1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull, 100000000000000ull,
+        1000000000000000ull, 10000000000000000ull, 100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull };
+    const int bits = 64 - __builtin_clzll(value | 1);
+    const int approx = (bits * 1233) >> 12;     // 1233 / 4096 ~ log10(2), never more than the real count
+    return approx + ((value | 1) >= pow10[approx]);
+}
+
+// Two digits at a time, from the end of the buffer
+inline char* writeDigitsBackward(char* p, uint64_t value)
+{
+    static const char pairs[] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+    while (value >= 100)
+    {
+        const unsigned pair = (unsigned)(value % 100) * 2;
+        value /= 100;
+        *--p = pairs[pair + 1];
+        *--p = pairs[pair];
+    }
+    if (value >= 10)
+    {
+        *--p = pairs[value * 2 + 1];
+        *--p = pairs[value * 2];
+    }
+    else
+        *--p = (char)('0' + value);
+    return p;
+}
+
+// Fixed PRECISION decimals of a value below 9e15 / 10^PRECISION. The precision is a template parameter so that all
+// the divisions are by constants (multiplications), a 64-bit division by a variable costs tens of cycles.
+template<int PRECISION>
+inline char* formatFixed(char* p, double value, double scaled)
+{
+    constexpr uint64_t scale = PRECISION == 0 ? 1 : 10 * (PRECISION == 1 ? 1 : PRECISION == 2 ? 10 : PRECISION == 3 ? 100 :
+        PRECISION == 4 ? 1000 : PRECISION == 5 ? 10000 : PRECISION == 6 ? 100000 : PRECISION == 7 ? 1000000 : PRECISION == 8 ? 10000000 : 100000000);
+    const uint64_t fixed = (uint64_t)(scaled + 0.5);
+    const uint64_t integer = fixed / scale;
+    uint64_t fraction = fixed - integer * scale;
+    if (value < 0.0 && fixed != 0)
+        *p++ = '-';
+    p += countDigits(integer);
+    writeDigitsBackward(p, integer);
+    if (PRECISION > 0)
+    {
+        *p++ = '.';
+        for (int n = PRECISION - 1; n >= 0; n--)
+        {
+            p[n] = (char)('0' + fraction % 10);
+            fraction /= 10;
+        }
+        p += PRECISION;
+    }
+    return p;
+}
+
+// Fixed 'precision' decimals (0..9). Needs 64 bytes of room after p. Returns the end of the text.
+inline char* formatNumber(char* p, double value, int precision)
+{
+    static const double scales[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+    const double scaled = std::fabs(value) * scales[precision];
+    if (!(scaled < 9e15)) // Too large for 64-bit fixed point (or NaN): shortest form, scientific when large
+        return std::to_chars(p, p + 64, value).ptr;
+    switch (precision)
+    {
+    case 0: return formatFixed<0>(p, value, scaled);
+    case 1: return formatFixed<1>(p, value, scaled);
+    case 2: return formatFixed<2>(p, value, scaled);
+    case 3: return formatFixed<3>(p, value, scaled);
+    case 4: return formatFixed<4>(p, value, scaled);
+    case 5: return formatFixed<5>(p, value, scaled);
+    case 6: return formatFixed<6>(p, value, scaled);
+    case 7: return formatFixed<7>(p, value, scaled);
+    case 8: return formatFixed<8>(p, value, scaled);
+    default: return formatFixed<9>(p, value, scaled);
+    }
+}
+
+// values[i] = values[i] * factor[i % columns] + offset[i % columns], count is a whole number of rows.
+// The factors are laid out for 2 values per SSE2 register: 'columns' registers cover 2 rows, whatever the column count.
+inline void applyUnits(double* values, size_t count, const std::vector<Unit>& columns)
+{
+    const size_t k = columns.size();
+#if defined(__SSE2__)
+    double factors[2 * 64], offsets[2 * 64];
+    if (k <= 64)
+    {
+        for (size_t n = 0; n < 2 * k; n++)
+        {
+            factors[n] = columns[n % k].factor;
+            offsets[n] = columns[n % k].offset;
+        }
+        size_t i = 0;
+        for (; i + 2 * k <= count; i += 2 * k)
+            for (size_t n = 0; n < 2 * k; n += 2)
+            {
+                const __m128d v = _mm_loadu_pd(values + i + n);
+                _mm_storeu_pd(values + i + n, _mm_add_pd(_mm_mul_pd(v, _mm_loadu_pd(factors + n)), _mm_loadu_pd(offsets + n)));
+            }
+        for (; i < count; i++)
+            values[i] = values[i] * factors[i % k] + offsets[i % k];
+        return;
+    }
+#endif
+    for (size_t i = 0; i < count; i++)
+        values[i] = values[i] * columns[i % k].factor + columns[i % k].offset;
+}
+
+inline bool writeAll(int fd, const char* data, size_t size, Stats& stats)
+{
+    while (size > 0)
+    {
+        const ssize_t written = ::write(fd, data, size);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        stats.writes++;
+        data += written;
+        size -= (size_t)written;
+    }
+    return true;
+}
+
+// Converts in_fd to out_fd until end of input. On failure returns false with a message in 'error'.
+inline bool convertStream(int in_fd, int out_fd, const Options& options, Stats& stats, std::string& error)
+{
+    const size_t k = options.columns.size();
+    if (k == 0 || options.precision < 0 || options.precision > 9)
+    {
+        error = "need at least one column and a precision of 0..9";
+        return false;
+    }
+    const size_t block = options.block_size;
+    std::vector<char> in(block);
+    std::vector<char> out(block + 1024);
+    size_t in_used = 0, out_used = 0;
+    bool eof = false;
+    const size_t max_number_chars = 64 + 2;    // formatNumber() + separator
+
+    // Convert a batch of whole rows at once, then format it into the output buffer (written out when full)
+    const size_t batch_values = std::max<size_t>(k, 2048 / k * k);
+    std::vector<double> values;
+    values.reserve(batch_values);
+    auto flushBatch = [&]() -> bool
+    {
+        applyUnits(values.data(), values.size(), options.columns);
+        size_t column = 0;
+        for (double value : values)
+        {
+            if (out_used + max_number_chars > out.size())
+            {
+                if (!writeAll(out_fd, out.data(), out_used, stats))
+                {
+                    error = std::string("write: ") + strerror(errno);
+                    return false;
+                }
+                stats.bytes_out += out_used;
+                out_used = 0;
+            }
+            char* p = formatNumber(out.data() + out_used, value, options.precision);
+            *p++ = ++column == k ? '\n' : options.separator;
+            column = column == k ? 0 : column;
+            out_used = (size_t)(p - out.data());
+        }
+        stats.values += values.size();
+        values.clear();
+        return true;
+    };
+
+    while (!eof || in_used > 0)
+    {
+        // Fill the block
+        while (!eof && in_used < block)
+        {
+            const ssize_t got = ::read(in_fd, in.data() + in_used, block - in_used);
+            if (got < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                error = std::string("read: ") + strerror(errno);
+                return false;
+            }
+            stats.reads++;
+            if (got == 0)
+                eof = true;
+            in_used += (size_t)got;
+            stats.bytes_in += (size_t)got;
+        }
+
+        // Complete lines only: the tail goes to the next block (at end of input the last line may lack its '\n')
+        const char* begin = in.data();
+        const char* end = begin + in_used;
+        if (!eof)
+        {
+            const char* last_newline = (const char*)memrchr(begin, '\n', in_used);
+            if (last_newline == nullptr)
+            {
+                error = "line longer than the block size";
+                return false;
+            }
+            end = last_newline + 1;
+        }
+
+        // Parse, a batch of values at a time: the batch stays in L1 cache between parsing, converting and formatting
+        size_t lines = 0;
+        for (const char* p = begin; p < end; )
+        {
+            while (p < end && isSeparator(*p))
+                p++;
+            if (p < end && *p == '\n')
+            {
+                p++;                // Empty line
+                continue;
+            }
+            if (p >= end)
+                break;
+            for (size_t c = 0; c < k; c++)
+            {
+                double value;
+                const char* next = parseNumber(p, end, value);
+                if (next == nullptr || next == p || (next < end && !isSeparator(*next) && *next != '\n'))
+                {
+                    error = "line " + std::to_string(stats.lines + lines + 1) + ": expected a number";
+                    return false;
+                }
+                values.push_back(value);
+                p = next;
+                while (p < end && isSeparator(*p))
+                    p++;
+            }
+            if (p < end && *p != '\n')
+            {
+                error = "line " + std::to_string(stats.lines + lines + 1) + ": more than " + std::to_string(k) + " column(s)";
+                return false;
+            }
+            p++;
+            lines++;
+            if (values.size() + k > batch_values && !flushBatch())
+                return false;
+        }
+        if (!flushBatch())
+            return false;
+        stats.lines += lines;
+
+        // Keep the partial line
+        const size_t consumed = (size_t)(end - begin);
+        memmove(in.data(), in.data() + consumed, in_used - consumed);
+        in_used -= consumed;
+    }
+
+    if (out_used > 0 && !writeAll(out_fd, out.data(), out_used, stats))
+    {
+        error = std::string("write: ") + strerror(errno);
+        return false;
+    }
+    stats.bytes_out += out_used;
+    return true;
+}
+
+} // namespace unitconv
@@ -1,21 +1,28 @@
 #include <iostream>
+#include "out_sink.h"
 
 using namespace std;
 
 int main(){
 
+    // buffered output: one write() for many stars, flushed before reading and at the end
+    outsink::Sink out;
+
     int i = 0, starsCount;
 
-    cout<<"How much start to print?"<<endl;
+    out<<"How much start to print?\n";
+    out.flush();
 
     cin>>starsCount;
 
+    // one star per iteration, as before: the sink only copies a byte
     while(i<starsCount){
-        cout<<"*";
+        out<<'*';
         i++;
     }
+    // (the same in one call: out<<outsink::repeat('*', starsCount);)
 
-    cout<<"Starts to printed:"<<starsCount <<endl;
+    out<<"Starts to printed:"<<starsCount<<'\n';
     return 0;
 
-}
\ No newline at end of file
+}
@@ -1,16 +1,11 @@
+#include <vector>
+#include "two_sum.h"
+using namespace std;
+
+// O(n): one pass with a flat hash table of the values seen so far (see two_sum.h)
 class Solution {
 public:
     vector<int> twoSum(vector<int>& nums, int target) {
-
-        int len = nums.size();
-
-        for(int i{0};i<len;i++){
-            for(int j=i+1;j<len;j++){
-                if(nums[i] + nums[j] == target){
-                    return {i,j};
-                }
-            }
-        }  
-        return {};
+        return twosum::twoSum(nums, target);
     }
-};
\ No newline at end of file
+};
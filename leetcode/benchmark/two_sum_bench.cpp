@@ -0,0 +1,134 @@
+// Two Sum benchmark: two_sum.h against the previous double loop and std::unordered_map, n = 10^3 .. 10^8.
+// Each query has a unique pair planted at two random positions (the hard case: found on average 2/3 into the array, no early exit). Every answer is checked (i < j, nums[i] + nums[j] == target).
+//
+// Build (Linux, from this folder):
+//   cmake -S . -B build && cmake --build build          (-DCMAKE_CXX_FLAGS=-mavx2 for the 8 lanes scans)
+// Usage: ./build/two_sum_bench [max n] [queries]      (default: 10^8, 64 queries; 10^8 needs ~2 GB of RAM)
+
+#include "two_sum.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+static double NowMs()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Previous Solution::twoSum
+static twosum::IndexPair DoubleLoop(const std::vector<int>& nums, int target)
+{
+    const int len = (int)nums.size();
+    for (int i = 0; i < len; i++)
+        for (int j = i + 1; j < len; j++)
+            if ((long long)nums[i] + nums[j] == target)
+                return twosum::IndexPair(i, j);
+    return twosum::kNoPair;
+}
+
+static twosum::IndexPair UnorderedMap(const std::vector<int>& nums, int target)
+{
+    std::unordered_map<int, int> seen;
+    seen.reserve(nums.size());
+    for (int i = 0; i < (int)nums.size(); i++)
+    {
+        auto it = seen.find((int)((long long)target - nums[i]));
+        if (it != seen.end() && (long long)target - nums[i] == it->first)
+            return twosum::IndexPair(it->second, i);
+        seen.emplace(nums[i], i);
+    }
+    return twosum::kNoPair;
+}
+
+static int g_errors = 0;
+static void Check(const std::vector<int>& nums, int target, twosum::IndexPair pair, const char* name)
+{
+    if (pair.first < 0 || pair.first >= pair.second || pair.second >= (int)nums.size() || (long long)nums[pair.first] + nums[pair.second] != target)
+    {
+        if (g_errors++ < 10)
+            fprintf(stderr, "%s: wrong answer (%d, %d) for target %d\n", name, pair.first, pair.second, target);
+    }
+}
+
+// Average ms per query
+template<typename FUNC>
+static double PerQueryMs(const std::vector<int>& targets, FUNC func)
+{
+    const double t0 = NowMs();
+    for (int target : targets)
+        func(target);
+    return (NowMs() - t0) / targets.size();
+}
+
+int main(int argc, char** argv)
+{
+    const size_t max_n = argc > 1 ? (size_t)atoll(argv[1]) : 100000000;
+    const size_t queries = argc > 2 ? (size_t)atoll(argv[2]) : 64;
+    if (queries == 0 || queries > 500)
+    {
+        fprintf(stderr, "queries must be 1..500 (two planted values each in the n = 1000 array)\n");
+        return 1;
+    }
+    std::mt19937 rng(42);
+
+    printf("SIMD lanes: %d, %zu queries per n, ms per query (index: build ms once)\n", twosum::kLanes, queries);
+    printf("%10s %12s %12s %12s %12s %12s %12s\n", "n", "double loop", "unord. map", "twoSum", "index build", "find", "findBatch");
+    for (size_t n = 1000; n <= max_n; n *= 10)
+    {
+        // Random background values are multiples of 4 (spread over +-2^30, so they have duplicates at large n).
+        // Query q plants a[q] = 1 (mod 4) and b[q] = 2 (mod 4) at random positions and asks for a[q] + b[q] = 3 (mod 4):
+        // only a planted a + b pair has that remainder, and with a[q] = A + 4q, b[q] = B + 4 * queries * q the sum
+        // a[q'] + b[r] = A + B + 4 (q' + queries * r) names q' and r, so the pair is unique.
+        std::vector<int> nums(n);
+        std::uniform_int_distribution<int> value(-(1 << 28), 1 << 28);
+        for (int& x : nums)
+            x = value(rng) * 4;
+        const long long a0 = 1 + 4LL * std::uniform_int_distribution<int>(-(1 << 27), (1 << 27) - (int)queries)(rng);
+        const long long b0 = 2 + 4LL * std::uniform_int_distribution<int>(-(1 << 27), (1 << 27) - (int)(queries * queries))(rng);
+        std::vector<char> planted(n, 0);
+        auto plant = [&](long long v)
+        {
+            size_t i;
+            do i = rng() % n; while (planted[i]);
+            planted[i] = 1;
+            nums[i] = (int)v;
+        };
+        std::vector<int> targets(queries);
+        for (size_t q = 0; q < queries; q++)
+        {
+            const long long a = a0 + 4LL * q, b = b0 + 4LL * queries * q; // |a|, |b| < 2^29 + 1: the sum fits an int
+            plant(a);
+            plant(b);
+            targets[q] = (int)(a + b);
+        }
+
+        char loop_text[32] = "-", map_text[32] = "-";
+        if (n <= 10000)
+            snprintf(loop_text, sizeof(loop_text), "%.4f", PerQueryMs(targets, [&](int target) { Check(nums, target, DoubleLoop(nums, target), "double loop"); }));
+        if (n <= 10000000)
+            snprintf(map_text, sizeof(map_text), "%.4f", PerQueryMs(targets, [&](int target) { Check(nums, target, UnorderedMap(nums, target), "unordered_map"); }));
+        const double hash_ms = PerQueryMs(targets, [&](int target) { Check(nums, target, twosum::twoSum(nums.data(), n, target), "twoSum"); });
+
+        const double t0 = NowMs();
+        twosum::TwoSumIndex index(nums);
+        const double build_ms = NowMs() - t0;
+        const double find_ms = PerQueryMs(targets, [&](int target) { Check(nums, target, index.find(target), "find"); });
+        std::vector<twosum::IndexPair> answers(queries);
+        const double t1 = NowMs();
+        index.findBatch(targets.data(), queries, answers.data());
+        const double batch_ms = (NowMs() - t1) / queries;
+        for (size_t q = 0; q < queries; q++)
+            Check(nums, targets[q], answers[q], "findBatch");
+
+        printf("%10zu %12s %12s %12.4f %12.2f %12.4f %12.4f\n", n, loop_text, map_text, hash_ms, build_ms, find_ms, batch_ms);
+    }
+    if (g_errors > 0)
+        fprintf(stderr, "%d wrong answers\n", g_errors);
+    return g_errors > 0 ? 1 : 0;
+}
@@ -0,0 +1,248 @@
+// Two Sum engine: indices i < j with nums[i] + nums[j] == target.
+// Header only, C++17. The sum is exact (no int overflow): pairs whose sum doesn't fit an int are simply never equal to target.
+//
+//  twoSum()            one query, one pass with a flat open-addressing hash table, O(n)
+//  TwoSumIndex         preprocess an array once (sort), then answer many targets:
+//    find()            sorted two-pointer scan, the pointers skip over blocks of 4 (SSE2) or 8 (AVX2) values at a time
+//    findBatch()       find() for many targets
+//
+// When several pairs exist, twoSum() returns the one completed first when scanning left to right, find() may return
+// another one. No pair: { -1, -1 }.
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace twosum
+{
+
+typedef std::pair<int, int> IndexPair;
+static const IndexPair kNoPair(-1, -1);
+
+// Slot of 'key' in a power of two table of 2^bits slots (Fibonacci hashing, spreads sequential keys)
+inline uint32_t hashSlot(int key, int bits)
+{
+    return (uint32_t)((uint32_t)key * 2654435769u) >> (32 - bits);
+}
+
+// Smallest number of bits for a table of at least n / 0.75 slots
+inline int tableBits(size_t n)
+{
+    int bits = 4;
+    while (((size_t)1 << bits) * 3 < n * 4)
+        bits++;
+    return bits;
+}
+
+// Complement of x for target, or false if it doesn't fit an int (then no element can match)
+inline bool complement(int target, int x, int& out)
+{
+    const int64_t c = (int64_t)target - x;
+    out = (int)c;
+    return c >= INT_MIN && c <= INT_MAX;
+}
+
+// One query: for each element, look its complement up among the previous ones, then insert it.
+// The table is a flat array of { key, index } slots with linear probing (index -1: empty), one cache line per probe in practice.
+// It starts small and doubles when 3/4 full: a query answered early never touches a table sized for the whole array.
+inline IndexPair twoSum(const int* nums, size_t n, int target)
+{
+    struct Slot { int key; int index; };
+    int bits = std::min(tableBits(n), 12);
+    uint32_t mask = (1u << bits) - 1;
+    size_t count = 0;
+    std::vector<Slot> table((size_t)1 << bits, Slot{ 0, -1 });
+    std::vector<Slot> old_table;
+    for (size_t i = 0; i < n; i++)
+    {
+        int c;
+        if (complement(target, nums[i], c))
+            for (uint32_t slot = hashSlot(c, bits); table[slot].index != -1; slot = (slot + 1) & mask)
+                if (table[slot].key == c)
+                    return IndexPair(table[slot].index, (int)i);
+
+        if ((count + 1) * 4 > table.size() * 3)
+        {
+            old_table.swap(table);
+            bits++;
+            mask = (1u << bits) - 1;
+            table.assign((size_t)1 << bits, Slot{ 0, -1 });
+            for (const Slot& old : old_table)
+                if (old.index != -1)
+                {
+                    uint32_t slot = hashSlot(old.key, bits);
+                    while (table[slot].index != -1)
+                        slot = (slot + 1) & mask;
+                    table[slot] = old;
+                }
+        }
+        uint32_t slot = hashSlot(nums[i], bits);
+        while (table[slot].index != -1 && table[slot].key != nums[i])
+            slot = (slot + 1) & mask;
+        if (table[slot].index == -1) // Keep the first index of duplicates
+        {
+            table[slot] = Slot{ nums[i], (int)i };
+            count++;
+        }
+    }
+    return kNoPair;
+}
+
+inline std::vector<int> twoSum(const std::vector<int>& nums, int target)
+{
+    const IndexPair pair = twoSum(nums.data(), nums.size(), target);
+    if (pair == kNoPair)
+        return {};
+    return { pair.first, pair.second };
+}
+
+// Block scans over a sorted array, the building blocks of the two-pointer search
+#if defined(__AVX2__)
+static const int kLanes = 8;
+// Number of leading values of p[0..kLanes) that are < c
+inline int countLess(const int* p, int c)
+{
+    const __m256i lt = _mm256_cmpgt_epi32(_mm256_set1_epi32(c), _mm256_loadu_si256((const __m256i*)p));
+    return __builtin_ctz(~(unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(lt)));
+}
+// Number of trailing values of p[0..kLanes) that are > c
+inline int countGreater(const int* p, int c)
+{
+    const __m256i gt = _mm256_cmpgt_epi32(_mm256_loadu_si256((const __m256i*)p), _mm256_set1_epi32(c));
+    const unsigned not_gt = ~(unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(gt)) & 0xFF;
+    return not_gt ? __builtin_clz(not_gt) - (32 - kLanes) : kLanes;
+}
+#elif defined(__SSE2__)
+static const int kLanes = 4;
+inline int countLess(const int* p, int c)
+{
+    const __m128i lt = _mm_cmplt_epi32(_mm_loadu_si128((const __m128i*)p), _mm_set1_epi32(c));
+    return __builtin_ctz(~(unsigned)_mm_movemask_ps(_mm_castsi128_ps(lt)));
+}
+inline int countGreater(const int* p, int c)
+{
+    const __m128i gt = _mm_cmpgt_epi32(_mm_loadu_si128((const __m128i*)p), _mm_set1_epi32(c));
+    const unsigned not_gt = ~(unsigned)_mm_movemask_ps(_mm_castsi128_ps(gt)) & 0xF;
+    return not_gt ? __builtin_clz(not_gt) - (32 - kLanes) : kLanes;
+}
+#else
+static const int kLanes = 4;
+inline int countLess(const int* p, int c)    { int count = 0; while (count < kLanes && p[count] < c) count++; return count; }
+inline int countGreater(const int* p, int c) { int count = 0; while (count < kLanes && p[kLanes - 1 - count] > c) count++; return count; }
+#endif
+
+class TwoSumIndex
+{
+public:
+    explicit TwoSumIndex(const std::vector<int>& nums) : TwoSumIndex(nums.data(), nums.size()) {}
+
+    // Sorted values with their original indices, in separate arrays so the scans only stream values.
+    // Sorting (value, index) packed in one 64-bit key is several times faster than sorting indices with a comparator.
+    TwoSumIndex(const int* nums, size_t n)
+    {
+        std::vector<uint64_t> keys(n);
+        for (size_t i = 0; i < n; i++)
+            keys[i] = ((uint64_t)((uint32_t)nums[i] ^ 0x80000000u) << 32) | (uint32_t)i;
+        std::sort(keys.begin(), keys.end());
+        m_sorted.resize(n);
+        m_sortedIndex.resize(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            m_sorted[i] = (int)((uint32_t)(keys[i] >> 32) ^ 0x80000000u);
+            m_sortedIndex[i] = (int)(uint32_t)keys[i];
+        }
+    }
+
+    size_t size() const { return m_sorted.size(); }
+
+    // Sorted two-pointer: 'lo' moves right while sorted[lo] < target - sorted[hi], 'hi' moves left while
+    // sorted[hi] > target - sorted[lo], both a whole block at a time when the block is entirely on the moving side.
+    IndexPair find(int target) const
+    {
+        const int* a = m_sorted.data();
+        ptrdiff_t lo = 0, hi = (ptrdiff_t)m_sorted.size() - 1;
+        while (lo < hi)
+        {
+            int c;
+            if (!complement(target, a[hi], c))
+            {
+                if ((int64_t)target - a[hi] > INT_MAX)
+                    break;      // Even a[hi] + a[hi] is too small: a[hi] is the largest value left
+                hi--;           // a[hi] is too large for any partner
+                continue;
+            }
+            while (hi - lo >= kLanes)
+            {
+                const int count = countLess(a + lo, c);
+                lo += count;
+                if (count < kLanes)
+                    break;
+            }
+            while (lo < hi && a[lo] < c)
+                lo++;
+            if (lo >= hi)
+                break;
+            if (a[lo] == c)
+                return makePair(lo, hi);
+
+            // a[lo] + a[hi] > target: move hi
+            if (!complement(target, a[lo], c))
+            {
+                if ((int64_t)target - a[lo] < INT_MIN)
+                    break;
+                lo++;
+                continue;
+            }
+            while (hi - lo >= kLanes)
+            {
+                const int count = countGreater(a + hi - kLanes + 1, c);
+                hi -= count;
+                if (count < kLanes)
+                    break;
+            }
+            while (lo < hi && a[hi] > c)
+                hi--;
+            if (lo >= hi)
+                break;
+            if (a[hi] == c)
+                return makePair(lo, hi);
+        }
+        return kNoPair;
+    }
+
+    // Answer count targets, out[t] for targets[t]: the sort is paid once for all of them
+    void findBatch(const int* targets, size_t count, IndexPair* out) const
+    {
+        for (size_t t = 0; t < count; t++)
+            out[t] = find(targets[t]);
+    }
+
+    std::vector<IndexPair> findBatch(const std::vector<int>& targets) const
+    {
+        std::vector<IndexPair> out(targets.size());
+        findBatch(targets.data(), targets.size(), out.data());
+        return out;
+    }
+
+private:
+    IndexPair makePair(ptrdiff_t lo, ptrdiff_t hi) const
+    {
+        const int i = m_sortedIndex[lo], j = m_sortedIndex[hi];
+        return i < j ? IndexPair(i, j) : IndexPair(j, i);
+    }
+
+    std::vector<int>    m_sorted;
+    std::vector<int>    m_sortedIndex;
+};
+
+} // namespace twosum